@@ -0,0 +1,267 @@
+/*
+ * bench.c
+ *
+ *  Card write benchmark, cached in EEPROM per card CID, and a planner that
+ *  predicts from it whether the current config can be recorded without
+ *  overflowing the raw sample buffer.
+ */
+
+#include <stdio.h>
+
+#include "bench.h"
+#include "config.h"
+
+Card_Bench cardBench;
+
+// The benchmark cache must fit the EEPROM, checked at build time
+_Static_assert(BENCH_EEPROM_ADDR + BENCH_SLOTS * sizeof(Card_Bench) <= EEPROM_SIZE, "benchmark cache exceeds the EEPROM");
+
+static const char* const riskStr[] = {
+	"LOW",
+	"MEDIUM",
+	"HIGH",
+	"OVERFLOW"
+};
+
+// Returns true if the slot holds the result of the current card
+static bool bench_cidMatches(Card_Bench *b){
+	SD_CID *cid = &cardinfo.SD_cid;
+	return b->magic == BENCH_MAGIC &&
+		   b->cid_sn == cid->ProdSN &&
+		   b->cid_name == cid->ProdName1 &&
+		   b->cid_oem == cid->OEM_AppliID &&
+		   b->cid_mid == cid->ManufacturerID;
+}
+
+// Write BENCH_SIZE bytes to a scratch file the way the recorder does, timing each block
+static void bench_run(Card_Bench *b){
+	FIL benchFile;
+	char data[BLOCK_SIZE];
+	uint32_t top[BENCH_TOP]; // Longest write latencies in us, longest first
+	uint32_t i, j, start, us;
+	uint64_t elapsed = 0;
+	UINT bw;
+
+	memset(top, 0, sizeof(top));
+	memset(data, '0', sizeof(data));
+
+	if(f_open(&benchFile, BENCH_FN, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK){
+		return;
+	}
+
+	for(i=0;i<BENCH_SIZE/BLOCK_SIZE;i++){
+		start = DWT_Get();
+		if(f_write(&benchFile, data, BLOCK_SIZE, &bw) != FR_OK || bw != BLOCK_SIZE){
+			break;
+		}
+		us = (DWT_Get() - start) / (SystemCoreClock / 1000000);
+		elapsed += us;
+
+		// Insert into the longest writes
+		for(j=BENCH_TOP;j>0 && top[j-1] < us;j--){
+			if(j < BENCH_TOP){
+				top[j] = top[j-1];
+			}
+		}
+		if(j < BENCH_TOP){
+			top[j] = us;
+		}
+	}
+	start = DWT_Get();
+	f_close(&benchFile);
+	elapsed += (DWT_Get() - start) / (SystemCoreClock / 1000000);
+	f_unlink(BENCH_FN);
+
+	// Keep an unfinished benchmark out of the cache
+	if(i < BENCH_SIZE/BLOCK_SIZE || elapsed == 0){
+		return;
+	}
+
+	b->magic = BENCH_MAGIC;
+	b->write_Bps = (uint32_t)((uint64_t)BENCH_SIZE * 1000000 / elapsed);
+	b->p99_us = top[BENCH_TOP-1];
+	b->max_us = top[0];
+}
+
+// Log the read throughput from the start of the card with CMD59 CRC mode off and on, the cost of the data CRC
+static void bench_crc(void){
+	uint8_t data[SD_BLOCKSIZE];
+	uint32_t kBps[2], i, on, start;
+	char str[70];
+
+	for(on=0;on<2;on++){
+		if(sd_set_crc(on)){
+			break;
+		}
+		start = DWT_Get();
+		for(i=0;i<BENCH_CRC_BLOCKS && sd_read_block(i, data) == SD_OK;i++);
+		if(i < BENCH_CRC_BLOCKS){
+			break;
+		}
+		kBps[on] = (uint32_t)((uint64_t)BENCH_CRC_BLOCKS * SD_BLOCKSIZE * (SystemCoreClock / 1000) / (DWT_Get() - start));
+	}
+
+	// Back to the CRC mode of the build
+#ifdef SD_DATA_CRC
+	sd_set_crc(1);
+#else
+	sd_set_crc(0);
+#endif
+	if(on < 2){
+		return;
+	}
+
+	sprintf(str, "Card read %u kB/s, %u kB/s with CRC, SD at %u kHz", (unsigned int)kBps[0], (unsigned int)kBps[1],
+			(unsigned int)(cardinfo.SpiClock / 1000));
+	log_string(str);
+}
+
+// Log the f_write/f_read throughput of calls smaller than a sector from an unaligned buffer, the way READABLE data and the log are written
+// Most of the time goes to copies between the buffer and the file sector buffer, mem_cpy with _WORD_ACCESS in ffconf.h
+static void bench_fs(void){
+	FIL benchFile;
+	char data[BENCH_FS_CHUNK + 1];
+	uint32_t i, start, writeCycles, readCycles = 0;
+	UINT bw;
+	char str[70];
+
+	memset(data, '0', sizeof(data));
+	if(f_open(&benchFile, BENCH_FN, FA_CREATE_ALWAYS | FA_WRITE | FA_READ) != FR_OK){
+		return;
+	}
+
+	start = DWT_Get();
+	for(i=0;i<BENCH_FS_SIZE/BENCH_FS_CHUNK && f_write(&benchFile, data + 1, BENCH_FS_CHUNK, &bw) == FR_OK && bw == BENCH_FS_CHUNK;i++);
+	writeCycles = DWT_Get() - start;
+	if(i == BENCH_FS_SIZE/BENCH_FS_CHUNK && f_lseek(&benchFile, 0) == FR_OK){
+		start = DWT_Get();
+		for(i=0;i<BENCH_FS_SIZE/BENCH_FS_CHUNK && f_read(&benchFile, data + 1, BENCH_FS_CHUNK, &bw) == FR_OK && bw == BENCH_FS_CHUNK;i++);
+		readCycles = DWT_Get() - start;
+	}
+	f_close(&benchFile);
+	f_unlink(BENCH_FN);
+	if(i < BENCH_FS_SIZE/BENCH_FS_CHUNK || readCycles == 0){
+		return;
+	}
+
+	sprintf(str, "FS %u B calls: write %u kB/s, read %u kB/s, word access %u", BENCH_FS_CHUNK,
+			(unsigned int)((uint64_t)i * BENCH_FS_CHUNK * (SystemCoreClock / 1000) / writeCycles),
+			(unsigned int)((uint64_t)i * BENCH_FS_CHUNK * (SystemCoreClock / 1000) / readCycles), _WORD_ACCESS);
+	log_string(str);
+}
+
+// Load the benchmark of the current card from EEPROM, or run and cache it
+void bench_card(void){
+	Card_Bench slot[BENCH_SLOTS];
+	uint32_t i, oldest = 0, seq = 0;
+	char str[60];
+
+	Chip_EEPROM_Read(BENCH_EEPROM_ADDR, (uint8_t *)slot, sizeof(slot));
+	for(i=0;i<BENCH_SLOTS;i++){
+		if(bench_cidMatches(&slot[i])){
+			cardBench = slot[i];
+			return;
+		}
+		if(slot[i].magic != BENCH_MAGIC){
+			slot[i].seq = 0;
+		}
+		if(slot[i].seq < slot[oldest].seq){
+			oldest = i;
+		}
+		if(slot[i].seq > seq){
+			seq = slot[i].seq;
+		}
+	}
+
+	// First insert of this card
+	memset(&cardBench, 0, sizeof(cardBench));
+	bench_run(&cardBench);
+	if(cardBench.magic != BENCH_MAGIC){
+		return;
+	}
+
+	cardBench.seq = seq + 1;
+	cardBench.cid_sn = cardinfo.SD_cid.ProdSN;
+	cardBench.cid_name = cardinfo.SD_cid.ProdName1;
+	cardBench.cid_oem = cardinfo.SD_cid.OEM_AppliID;
+	cardBench.cid_mid = cardinfo.SD_cid.ManufacturerID;
+	eepromUpdate(BENCH_EEPROM_ADDR + oldest * sizeof(Card_Bench), (uint8_t *)&cardBench, sizeof(Card_Bench));
+
+	sprintf(str, "Card bench %u kB/s, p99 %u us, max %u us", (unsigned int)(cardBench.write_Bps / 1000),
+			(unsigned int)cardBench.p99_us, (unsigned int)cardBench.max_us);
+	log_string(str);
+
+	bench_crc();
+	bench_fs();
+}
+
+// Predict overflow risk and maximum duration of the current config on the current card
+void bench_plan(Card_Plan *plan){
+	uint32_t buffer_bytes = daq_rawBuffSize();
+	uint32_t sample_bytes;
+	DWORD free_clust;
+	uint64_t free_bytes;
+	FATFS *fs;
+
+	// Raw samples are 16 bits per value, readable lines are a time column and up to 12 chars per value
+	plan->raw_Bps = 2 * daq.value_count * daq.sample_rate;
+	if(plan->raw_Bps == 0){ // No values recorded
+		memset(plan, 0, sizeof(Card_Plan));
+		plan->risk = RISK_LOW;
+		return;
+	}
+	switch(daq.data_type){
+	case READABLE:
+		sample_bytes = 8 + daq.time_res + 12 * daq.value_count;
+		break;
+	case BINARY:
+	default:
+		sample_bytes = 2 * daq.value_count;
+		break;
+	}
+	plan->file_Bps = sample_bytes * daq.sample_rate;
+	plan->buffer_ms = (uint32_t)((uint64_t)buffer_bytes * 1000 / plan->raw_Bps);
+
+	// Free space limits the duration of any recording
+	plan->max_seconds = UINT32_MAX;
+	if(f_getfree("", &free_clust, &fs) == FR_OK){
+		free_bytes = (uint64_t)free_clust * fs->csize * SD_BLOCKSIZE;
+		if(free_bytes / plan->file_Bps < plan->max_seconds){
+			plan->max_seconds = free_bytes / plan->file_Bps;
+		}
+	}
+
+	if(cardBench.magic != BENCH_MAGIC){
+		plan->risk = RISK_MEDIUM; // Unknown card
+	} else if(plan->file_Bps >= cardBench.write_Bps){
+		// Buffer fills at the raw rate less the share of it the card keeps up with
+		uint64_t fill_Bps = plan->raw_Bps - (uint64_t)plan->raw_Bps * cardBench.write_Bps / plan->file_Bps;
+		plan->risk = RISK_OVERFLOW;
+		plan->max_seconds = fill_Bps ? buffer_bytes / fill_Bps : 0;
+	} else if(cardBench.max_us / 1000 >= plan->buffer_ms){
+		plan->risk = RISK_HIGH;
+	} else if(cardBench.max_us / 1000 >= plan->buffer_ms / 2 || plan->file_Bps >= cardBench.write_Bps / 2){
+		plan->risk = RISK_MEDIUM;
+	} else {
+		plan->risk = RISK_LOW;
+	}
+}
+
+// Risk name for logs
+const char *bench_riskStr(PLAN_RISK risk){
+	return riskStr[risk];
+}
+
+// Log the plan of the current config
+void bench_logPlan(void){
+	Card_Plan plan;
+	char str[70];
+
+	bench_plan(&plan);
+	sprintf(str, "Plan %s, %u of %u kB/s, buffer %u ms, max %u s", bench_riskStr(plan.risk),
+			(unsigned int)(plan.file_Bps / 1000), (unsigned int)(cardBench.write_Bps / 1000),
+			(unsigned int)plan.buffer_ms, (unsigned int)plan.max_seconds);
+	log_string(str);
+	sprintf(str, "Card write p99 %u ms, max %u ms", (unsigned int)(cardBench.p99_us / 1000), (unsigned int)(cardBench.max_us / 1000));
+	log_string(str);
+}
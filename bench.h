@@ -0,0 +1,72 @@
+/*
+ * bench.h
+ *
+ *  Card write benchmark, cached in EEPROM per card CID, and a planner that
+ *  predicts from it whether the current config can be recorded without
+ *  overflowing the raw sample buffer.
+ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include "board.h"
+#include "ff.h"
+#include "sd_spi.h"
+
+#define BENCH_FN "bench.tmp"		// Scratch file written by the benchmark
+#define BENCH_SIZE 0x40000			// Bytes written by the benchmark, 256kB
+#define BENCH_TOP (BENCH_SIZE / BLOCK_SIZE / 100 + 1) // Longest writes kept to find the 99th percentile
+#define BENCH_EEPROM_ADDR 0x00000440	// EEPROM address of the benchmark cache, past the config stamp
+#define BENCH_SLOTS 4				// Cards remembered in the benchmark cache
+#define BENCH_MAGIC 0x31484E42		// "BNH1"
+#define BENCH_CRC_BLOCKS 256		// Blocks read with the data CRC off and on to log its cost, 128kB
+#define BENCH_FS_SIZE 0x10000		// Bytes written and read back in BENCH_FS_CHUNK calls to log the partial-sector throughput, 64kB
+#define BENCH_FS_CHUNK 37			// Bytes per f_write/f_read call, about a READABLE line
+
+// Benchmark result of one card, identified by its CID
+typedef struct Card_Bench {
+	uint32_t magic;			// BENCH_MAGIC when the slot holds a result
+	uint32_t seq;			// Age of the slot, the lowest is replaced first
+	uint32_t cid_sn;		// CID product serial number
+	uint32_t cid_name;		// CID product name, first 4 characters
+	uint16_t cid_oem;		// CID OEM/application id
+	uint8_t cid_mid;		// CID manufacturer id
+	uint8_t reserved;
+	uint32_t write_Bps;		// Sequential write throughput in bytes/s
+	uint32_t p99_us;		// 99th percentile BLOCK_SIZE write latency in us
+	uint32_t max_us;		// Longest BLOCK_SIZE write latency in us
+} Card_Bench;
+
+// Overflow risk of a recording
+typedef enum {
+	RISK_LOW,		// Longest write stall uses less than half of the buffer
+	RISK_MEDIUM,	// Longest write stall uses more than half of the buffer, or the card is more than half busy
+	RISK_HIGH,		// Longest write stall is longer than the buffer lasts
+	RISK_OVERFLOW	// Data rate is higher than the card write throughput
+} PLAN_RISK;
+
+// Predicted behaviour of the current config on the current card
+typedef struct Card_Plan {
+	uint32_t raw_Bps;		// Raw sample data rate into the raw buffer in bytes/s
+	uint32_t file_Bps;		// File data rate in bytes/s
+	uint32_t buffer_ms;		// Time the raw buffer lasts while the card is stalled
+	uint32_t max_seconds;	// Predicted maximum recording duration, limited by overflow or free space
+	PLAN_RISK risk;
+} Card_Plan;
+
+// Benchmark of the current card, valid when magic is BENCH_MAGIC
+extern Card_Bench cardBench;
+
+// Load the benchmark of the current card from EEPROM, or run and cache it
+void bench_card(void);
+
+// Predict overflow risk and maximum duration of the current config on the current card
+void bench_plan(Card_Plan *plan);
+
+// Risk name for logs
+const char *bench_riskStr(PLAN_RISK risk);
+
+// Log the plan of the current config
+void bench_logPlan(void);
+
+#endif /* BENCH_H_ */
@@ -6,17 +6,36 @@
 /* Build options */
 
 //#define PRINT_DATA_UART
+//#define TRACE_ISR // Record sampling ISR entry and exit in the event trace, fills the trace in a few ms
+#define PROFILE // DWT cycle statistics of the acquisition stages, written to profile.txt at the end of each recording
+#define RAMFUNC_ISR // Run the sampling ISRs and the functions they call from SRAM, undefine to compare flash timing in profile.txt
+#define DAQ_SPECIALIZED // Sample collect and format paths specialized to the channels and data mode of the recording, undefine to compare the generic path in profile.txt
 
 /* End Build options */
 
+#include <cr_section_macros.h>
+
+/* Place a function in SRAM, copied from flash with the initialized data at startup, to run without flash wait states */
+#ifdef RAMFUNC_ISR
+#define RAMFUNC __RAMFUNC(RAM)
+#else
+#define RAMFUNC
+#endif
+
 #ifdef DEBUG
 #include "uart.h"
 #endif
 
-/* Address of the base of each ram bank */
-#define RAM0_BASE (void *)0x02000000 // 16kB
-#define RAM1_BASE (void *)0x02004000 // 16kB
-#define RAM2_BASE (void *)0x02008000 // 4kB
+/* Address and size of each ram bank */
+#define RAM0_BASE_ADDR 0x02000000
+#define RAM1_BASE_ADDR 0x02004000
+#define RAM2_BASE_ADDR 0x02008000
+#define RAM0_SIZE 0x4000 // 16kB, static data, heap and stack
+#define RAM1_SIZE 0x4000 // 16kB
+#define RAM2_SIZE 0x1000 // 4kB
+#define RAM0_BASE (void *)RAM0_BASE_ADDR
+#define RAM1_BASE (void *)RAM1_BASE_ADDR
+#define RAM2_BASE (void *)RAM2_BASE_ADDR
 
 /* Set up board led colors */
 typedef enum {
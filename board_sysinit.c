@@ -166,6 +166,10 @@ void Board_SetupClocking(void)
 	// Enable external 12MHz clock
 	Chip_SetupXtalClocking();
 
+	// Flash accesses take 3 clocks, the fewest allowed at 72MHz, set here so the timing does not depend on the chip library
+	// The sampling ISRs run from SRAM without wait states when RAMFUNC_ISR is defined
+	Chip_FMC_SetFLASHAccess(FLASHTIM_72MHZ_CPU);
+
 	/* Set SYSTICKDIV to 1 so CMSIS Systick functions work */
 	Chip_Clock_SetSysTickClockDiv(1);
 }
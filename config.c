@@ -1,22 +1,44 @@
+#include <stddef.h>
+
 #include "config.h"
 #include "console_converter.h"
+#include "lz_decomp.h"
+#include "bench.h"
+
+// EEPROM layout, checked at build time
+_Static_assert(sizeof(DAQ) <= CONFIG_STAMP_EEPROM_ADDR - CONFIG_EEPROM_ADDR, "binary config overlaps the config stamp");
+_Static_assert(CONFIG_STAMP_EEPROM_ADDR + sizeof(Config_Stamp) <= BENCH_EEPROM_ADDR, "config stamp overlaps the benchmark cache");
 
 FIL config;
 
 void configStart() {
+	FILINFO fno;
+	bool parseConfig = true; // Set when config.txt must be parsed and rewritten
+	bool provisioned = false; // Set when assets are written to a fresh card
+	uint32_t provisionTime = DWT_Get();
+
 	// Load the config from EEPROM
 	readConfigFromEEPROM();
 
+	// Benchmark a card on first insert, used to plan recordings
+	bench_card();
+
 	// Check for config file on SD card
-	FRESULT fr = f_stat("config.txt", NULL);
+	fno.lfname = NULL;
+	fno.lfsize = 0;
+	FRESULT fr = f_stat("config.txt", &fno);
 	switch (fr) {
 	case FR_OK:
-		// Config file exists
+		// Config file exists, skip parsing if it is the file the EEPROM config was built from
+		parseConfig = !configStampMatches(&fno);
 		break;
 	case FR_NO_FILE:
 		// Config file does not exist, create default
 		readConfigDefault();
+		daq_configCheck();
 		writeConfigToFile();
+		writeConfigToEEPROM();
+		parseConfig = false;
 		break;
 	default:
 		// Unknown file read error
@@ -31,6 +53,7 @@ void configStart() {
 	case FR_NO_FILE:
 		// Create exe file from binary
 		writeConverterToFile();
+		provisioned = true;
 		break;
 	default:
 		// Unknown file read error
@@ -45,6 +68,7 @@ void configStart() {
 		break;
 	case FR_NO_FILE:
 		writeUserGuideToFile();
+		provisioned = true;
 		break;
 	default:
 		// Unknown file read error
@@ -52,14 +76,27 @@ void configStart() {
 		error(ERROR_READ_CONFIG);
 	}
 
-	// Read config file from card
-	readConfigFromFile();
+	// Log the time taken to write assets to a fresh card
+	if(provisioned){
+		char provisionStr[40];
+		sprintf(provisionStr, "Card provisioned in %u ms", (unsigned int)((DWT_Get() - provisionTime) / (SystemCoreClock / 1000)));
+		log_string(provisionStr);
+	}
 
-	// Write config back to card
-	writeConfigToFile();
+	if(parseConfig){
+		// Read config file from card
+		readConfigFromFile();
 
-	// Update the config back to EEPROM
-	writeConfigToEEPROM();
+		// Write config back to card
+		writeConfigToFile();
+
+		// Update the config back to EEPROM
+		writeConfigToEEPROM();
+	}
+
+	// Log the plan of this card and config on every start, config.txt is only rewritten when it changes
+	daq_configCheck();
+	bench_logPlan();
 }
 
 // Set channel configuration defaults
@@ -91,6 +128,16 @@ void readConfigDefault(void){
 	// Data mode can be READABLE or BINARY
 	daq.data_type = BINARY;
 
+	// Do not record vout or correct ratiometrically
+	daq.vout_record = 0;
+	daq.ratiometric = 0;
+
+	// Record the ADC conversions
+	daq.signal = SIGNAL_ADC;
+
+	// Convert at the full rate and write block by block
+	daq.low_power = 0;
+
 	// Vout = 5v
 	daq.mv_out = 5000;
 
@@ -98,14 +145,100 @@ void readConfigDefault(void){
 	strcpy(daq.user_comment, "User header comment");
 }
 
+// CRC-32 (polynomial 0xEDB88320), continues from crc to allow checking non-contiguous data
+static uint32_t crc32(uint32_t crc, const uint8_t *data, uint32_t size){
+	int32_t i;
+	crc = ~crc;
+	while(size--){
+		crc ^= *data++;
+		for(i=0;i<8;i++){
+			crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+		}
+	}
+	return ~crc;
+}
+
+// Calculate the stamp CRC over the binary config and the stamp fields
+static uint32_t configStampCRC(Config_Stamp *stamp){
+	uint32_t crc = crc32(0, (uint8_t *)&daq, sizeof(daq));
+	return crc32(crc, (uint8_t *)stamp, offsetof(Config_Stamp, crc));
+}
+
+// Write data to EEPROM, only programming the pages that differ from the current contents
+void eepromUpdate(uint32_t addr, uint8_t *data, uint32_t size){
+	uint8_t page[EEPROM_PAGE_SIZE];
+	while(size > 0){
+		// Chunk ends at the next page boundary
+		uint32_t chunk = EEPROM_PAGE_SIZE - addr % EEPROM_PAGE_SIZE;
+		if(chunk > size){
+			chunk = size;
+		}
+		Chip_EEPROM_Read(addr, page, chunk);
+		if(memcmp(page, data, chunk) != 0){
+			Chip_EEPROM_Write(addr, data, chunk);
+		}
+		addr += chunk;
+		data += chunk;
+		size -= chunk;
+	}
+}
+
 // Read config from EEPROM
 void readConfigFromEEPROM(void){
-	Chip_EEPROM_Read(0x00000000, (uint8_t *)&daq, sizeof(daq));
+	Chip_EEPROM_Read(CONFIG_EEPROM_ADDR, (uint8_t *)&daq, sizeof(daq));
 }
 
-// Write config to EEPROM
+// Write config to EEPROM, stamped with the current config.txt
 void writeConfigToEEPROM(void){
-	Chip_EEPROM_Write(0x00000000, (uint8_t *)&daq, sizeof(daq));
+	Config_Stamp stamp;
+	FILINFO fno;
+
+	fno.lfname = NULL;
+	fno.lfsize = 0;
+	memset(&stamp, 0, sizeof(stamp));
+	if(f_stat("config.txt", &fno) == FR_OK){
+		stamp.magic = CONFIG_STAMP_MAGIC;
+		stamp.daq_size = sizeof(daq);
+		stamp.fsize = fno.fsize;
+		stamp.fdate = fno.fdate;
+		stamp.ftime = fno.ftime;
+		stamp.crc = configStampCRC(&stamp);
+	}
+
+	eepromUpdate(CONFIG_EEPROM_ADDR, (uint8_t *)&daq, sizeof(daq));
+	eepromUpdate(CONFIG_STAMP_EEPROM_ADDR, (uint8_t *)&stamp, sizeof(stamp));
+}
+
+// Returns true if the EEPROM config is intact and was built from the config.txt described by fno
+bool configStampMatches(FILINFO *fno){
+	Config_Stamp stamp;
+	Chip_EEPROM_Read(CONFIG_STAMP_EEPROM_ADDR, (uint8_t *)&stamp, sizeof(stamp));
+
+	return stamp.magic == CONFIG_STAMP_MAGIC &&
+		   stamp.daq_size == sizeof(daq) &&
+		   stamp.fsize == fno->fsize &&
+		   stamp.fdate == fno->fdate &&
+		   stamp.ftime == fno->ftime &&
+		   stamp.crc == configStampCRC(&stamp);
+}
+
+// Returns true if line, after leading spaces and tabs, starts with key
+static bool configKey(char *line, const char *key){
+	while (*line == ' ' || *line == '\t') {
+		line++;
+	}
+	return strncmp(line, key, strlen(key)) == 0;
+}
+
+// Returns 1 for a Y option value and 0 for N, error on anything else
+static uint8_t configYesNo(char c){
+	if (c == 'Y' || c == 'y') {
+		return 1;
+	} else if (c == 'N' || c == 'n') {
+		return 0;
+	}
+	error(ERROR_READ_CONFIG);
+	return 0;
 }
 
 // Set channel configuration from the config file on the SD card
@@ -162,8 +295,48 @@ void readConfigFromFile(){
 		} else {
 			error(ERROR_READ_CONFIG);
 		}
+		/* Options after data mode are found by name, so a config.txt written before an option was added still reads */
+		/* Options missing from the file are off */
+		daq.vout_record = 0;
+		daq.ratiometric = 0;
+		daq.signal = SIGNAL_ADC;
+		daq.low_power = 0;
+		getNonBlankLine(line,0);
+		while (!configKey(line, "CHANNEL")) {
+			if (f_eof(&config)) {
+				error(ERROR_READ_CONFIG);
+			}
+			if (configKey(line, "RECORD VOUT")) {
+				getNonBlankLine(line,0);
+				daq.vout_record = configYesNo(line[0]);
+			} else if (configKey(line, "RATIOMETRIC")) {
+				getNonBlankLine(line,0);
+				daq.ratiometric = configYesNo(line[0]);
+			} else if (configKey(line, "SIGNAL SOURCE")) {
+				getNonBlankLine(line,0);
+				if (line[0] == 'A' || line[0] == 'a') {
+					daq.signal = SIGNAL_ADC;
+				} else if (line[0] == 'R' || line[0] == 'r') {
+					daq.signal = SIGNAL_RAMP;
+				} else if (line[0] == 'S' || line[0] == 's') {
+					daq.signal = SIGNAL_SINE;
+				} else if (line[0] == 'W' || line[0] == 'w') {
+					daq.signal = SIGNAL_WORST;
+				} else {
+					error(ERROR_READ_CONFIG);
+				}
+			} else if (configKey(line, "LOW POWER")) {
+				getNonBlankLine(line,0);
+				daq.low_power = configYesNo(line[0]);
+			} else {
+				/* Skip the value of an unknown option */
+				getNonBlankLine(line,0);
+			}
+			getNonBlankLine(line,0);
+		}
+		/* Line is now the channel 1 title */
 		for (i = 0; i<MAX_CHAN; i++) {
-			getNonBlankLine(line,1);
+			getNonBlankLine(line, i == 0 ? 0 : 1);
 			/* Channel Config */
 			/* CH Enabled */
 			sscanf(line + countToColon(line), " %c", &cVal);
@@ -204,8 +377,11 @@ void readConfigFromFile(){
 		getNonBlankLine(line,1);
 
 	} else {
-		/* Move to next section if no update config */
-		getNonBlankLine(line,29);
+		/* Move to next section if no update config, found by name as the section length depends on the version */
+		do {
+			getNonBlankLine(line,0);
+		} while (!configKey(line, "**** UPDATE CALIBRATION") && !f_eof(&config));
+		getNonBlankLine(line,0);
 	}
 	if (line[0] == 'Y' || line[0] == 'y') {
 		/* Update Calibration - 18 Lines (Maybe) */
@@ -282,6 +458,14 @@ void writeConfigToFile() {
 			config_printf("B\n");
 			break;
 	}
+	config_printf("    RECORD VOUT [Y/N, readable mode]\n");
+	config_printf("%c\n", daq.vout_record ? 'Y' : 'N');
+	config_printf("    RATIOMETRIC [Y/N, records vout in readable mode]\n");
+	config_printf("%c\n", daq.ratiometric ? 'Y' : 'N');
+	config_printf("    SIGNAL SOURCE [[A]DC / [R]amp / [S]ine / [W]orst case, test signals]\n");
+	config_printf("%c\n", "ARSW"[daq.signal]);
+	config_printf("    LOW POWER [Y/N, rates up to %d Hz]\n", LOWPOWER_MAX_SAMPLE_RATE);
+	config_printf("%c\n", daq.low_power ? 'Y' : 'N');
 	for (i = 0; i < MAX_CHAN; i++) {
 		config_printf("    CHANNEL %d\n", i+1);
 		config_printf("ENABLED         [Y/N]: ");
@@ -340,11 +524,11 @@ void writeConverterToFile() {
 		error(ERROR_WRITE_CONFIG);
 	}
 
-	uint32_t writtenBytes;
-	f_write(&converter, consoleConverterBinary, sizeof(consoleConverterBinary), &writtenBytes);
+	UINT writtenBytes;
+	FRESULT fr = lz_decompressToFile(&converter, consoleConverterLZ, sizeof(consoleConverterLZ), &writtenBytes);
 	f_close(&converter);
 
-	if(writtenBytes != sizeof(consoleConverterBinary)){
+	if(fr != FR_OK || writtenBytes != CONVERTER_SIZE){
 		f_unlink(converterFn);
 		error(ERROR_WRITE_CONFIG);
 	}
@@ -357,11 +541,11 @@ void writeUserGuideToFile() {
 		error(ERROR_WRITE_CONFIG);
 	}
 
-	uint32_t writtenBytes;
-	f_write(&userGuide, userGuideText, sizeof(userGuideText)-1, &writtenBytes);
+	UINT writtenBytes;
+	FRESULT fr = lz_decompressToFile(&userGuide, userGuideLZ, sizeof(userGuideLZ), &writtenBytes);
 	f_close(&userGuide);
 
-	if(writtenBytes != sizeof(userGuideText)-1){
+	if(fr != FR_OK || writtenBytes != USER_GUIDE_SIZE){
 		f_unlink(userGuideFn);
 		error(ERROR_WRITE_CONFIG);
 	}
@@ -20,6 +20,22 @@
 
 #define LINE_SIZE 100
 
+#define CONFIG_EEPROM_ADDR 0x00000000		// EEPROM address of the binary DAQ config
+#define CONFIG_STAMP_EEPROM_ADDR 0x00000400	// EEPROM address of the config stamp, past the end of the binary config
+#define CONFIG_STAMP_MAGIC 0x36474643		// "CFG6", change when the config.txt layout changes so the file is rewritten
+#define EEPROM_PAGE_SIZE 64					// EEPROM is programmed in pages of this many bytes
+#define EEPROM_SIZE 4032					// Usable EEPROM bytes, the top page is reserved by the IAP
+
+// Stored in EEPROM next to the binary config, identifies the config.txt the binary config was built from
+typedef struct Config_Stamp {
+	uint32_t magic;		// CONFIG_STAMP_MAGIC when the stamp has been written
+	uint32_t daq_size;	// sizeof(DAQ) when the stamp was written, invalidates the stamp on layout changes
+	DWORD fsize;		// config.txt file size
+	WORD fdate;			// config.txt FAT modified date
+	WORD ftime;			// config.txt FAT modified time
+	uint32_t crc;		// CRC-32 of the binary config and the fields above
+} Config_Stamp;
+
 void configStart(void);
 
 void readConfigDefault(void);
@@ -28,6 +44,12 @@ void readConfigFromEEPROM(void);
 
 void writeConfigToEEPROM(void);
 
+// Write data to EEPROM, only programming the pages that differ from the current contents
+void eepromUpdate(uint32_t addr, uint8_t *data, uint32_t size);
+
+// Returns true if the EEPROM config is intact and was built from the config.txt described by fno
+bool configStampMatches(FILINFO *fno);
+
 void readConfigFromFile(void);
 
 void writeConfigToFile(void);
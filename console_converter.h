@@ -1,2383 +1,1741 @@
 #ifndef CONSOLE_CONVERTER_H_
 #define CONSOLE_CONVERTER_H_
 
+// Generated by tools/pack_assets.py, do not edit
+// Assets are LZ4 block compressed, decompress with lz_decompressToFile()
+
 const char userGuideFn[] = "user_guide.txt";
 
-const char userGuideText[] =
-	"DAQ USER GUIDE P15452\n"
-	"\n"
-	"**** Status LED ****\n"
-	"\n"
-	"Color  | Acquisition Mode          | Mass Storage Mode\n"
-	"-------+---------------------------+-------------------\n"
-	"OFF    | DAQ off                   | DAQ off\n"
-	"RED    | Acquiring data            | N/A\n"
-	"GREEN  | Power on idle,            | \n"
-	"       | Low battery when flashing | N/A\n"
-	"YELLOW | Writing data to SD card   | Idle\n"
-	"PURPLE | Waiting for trigger       | Transferring data\n"
-	"CYAN   | SD card not present/error | SD card not present/error\n"
-	"BLUE   | Other error,              | Other error,\n"
-	"       | detailed in log file      | detailed in log file\n"
-	"\n"
-	"\n"
-	"**** Charge LED ****\n"
-	"The charge LED is RED while charging, and OFF while not charging.\n"
-	"\n"
-	"\n"
-	"**** State Diagram ****\n"
-	"<Off>\n"
-	"   Short Press -------> Acquisition Mode Idle\n"
-	"\n"
-	"<Aquisition Mode Idle>\n"
-	"   Short Press -------> Acquiring Data\n"
-	"   USB Connected -----> Mass Storage Mode\n"
-	"   Long Press --------> Off\n"
-	"\n"
-	"<Aquiring Data>\n"
-	"   Short Press -------> Acquisition Mode Idle\n"
-	"   Long Press --------> Off\n"
-	"\n"
-	"<Mass Storage Mode>\n"
-	"   USB Disconnected --> Acquisition Mode Idle\n"
-	"   Short Press -------> Acquisition Mode Idle\n"
-	"   Long Press --------> Off\n"
-	"\n"
-	"\n"
-	"**** Acquire Data ****\n"
-	"1)  Turn on the DAQ.\n"
-	"    * The Status LED will turn GREEN.\n"
-	"\n"
-	"2)  Press the button to begin acquiring data.\n"
-	"    * The Status LED is PURPLE during the acquisition delay,\n"
-	"     then RED while acquiring.\n"
-	"\n"
-	"3)  Press the button to stop acquiring data.\n"
-	"    * The Status LED will turn GREEN.\n"
-	"\n"
-	"\n"
-	"**** Transfer Data to a Computer ****\n"
-	"Transfer Data to a Computer\n"
-	"1)  Connect the DAQ to a computer with a USB Mini-B cable.\n"
-	"\n"
-	"2)  Turn on the DAQ.\n"
-	"    * The DAQ will connect as a mass storage device.\n"
-	"    * The Status LED will turn YELLOW when connected,\n"
-	"      and flash PURPLE while transferring data.\n"
-	"\n"
-	"\n"
-	"**** Change Settings ****\n"
-	"1)  Open the file “config.txt” on the DAQ.\n"
-	"\n"
-	"2)  Change settings, and then set the section update to “Y” and save the file.\n"
-	"    * Sections are “Date/time”, “Configuration”, and “Calibration”.\n"
-	"\n"
-	"3)  Restart the DAQ and the new configuration will take effect.\n"
-	"\n"
-	"\n"
-	"**** Convert Data ****\n"
-	"If the data was saved in binary format, you will need to run the \n"
-	"command line tool “converter.exe” stored on the DAQ to convert the data.\n"
-	"If the data was saved in “readable” format, it is already csv formatted,\n"
-	"and can be imported into excel/Matlab etc.\n"
-	"\n"
-	"\n"
-	"**** Connect Sensors ****\n"
-	"Attach the sensor to a Mini-XLR connector, and then connect to the DAQ.\n"
-	"BNC to mini-XLR adapters are included for sensors not requiring power.\n"
-	"\n"
-	"\n"
-	"**** Mini XLR Pinout ****\n"
-	"1 -> GND\n"
-	"2 -> Signal\n"
-	"3 -> Power\n";
+#define USER_GUIDE_SIZE 3507 // Decompressed size in bytes
+
+const uint8_t userGuideLZ[2078] = {
+	0xF0, 0x18, 0x44, 0x41, 0x51, 0x20, 0x55, 0x53, 0x45, 0x52, 0x20, 0x47,
+	0x55, 0x49, 0x44, 0x45, 0x20, 0x50, 0x31, 0x35, 0x34, 0x35, 0x32, 0x0A,
+	0x0A, 0x2A, 0x2A, 0x2A, 0x2A, 0x20, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73,
+	0x20, 0x4C, 0x45, 0x44, 0x20, 0x10, 0x00, 0xF5, 0x0D, 0x0A, 0x0A, 0x43,
+	0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x20, 0x7C, 0x20, 0x41, 0x63, 0x71, 0x75,
+	0x69, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x4D, 0x6F, 0x64, 0x65,
+	0x20, 0x01, 0x00, 0xE1, 0x7C, 0x20, 0x4D, 0x61, 0x73, 0x73, 0x20, 0x53,
+	0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x1D, 0x00, 0x22, 0x0A, 0x2D, 0x01,
+	0x00, 0x13, 0x2B, 0x08, 0x00, 0x0F, 0x01, 0x00, 0x01, 0x0F, 0x1C, 0x00,
+	0x01, 0x42, 0x0A, 0x4F, 0x46, 0x46, 0x53, 0x00, 0x00, 0xA5, 0x00, 0x36,
+	0x6F, 0x66, 0x66, 0x66, 0x00, 0x07, 0x6F, 0x00, 0x03, 0x1C, 0x00, 0x42,
+	0x0A, 0x52, 0x45, 0x44, 0x11, 0x00, 0x01, 0x9C, 0x00, 0x9A, 0x72, 0x69,
+	0x6E, 0x67, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x00, 0x90, 0x4E, 0x2F,
+	0x41, 0x0A, 0x47, 0x52, 0x45, 0x45, 0x4E, 0x0D, 0x00, 0xEA, 0x50, 0x6F,
+	0x77, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x69, 0x64, 0x6C, 0x65, 0x2C,
+	0x29, 0x00, 0x15, 0x0A, 0x0A, 0x00, 0xF0, 0x07, 0x4C, 0x6F, 0x77, 0x20,
+	0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6E,
+	0x20, 0x66, 0x6C, 0x61, 0x73, 0x68, 0x5F, 0x00, 0x02, 0x4F, 0x00, 0xD5,
+	0x59, 0x45, 0x4C, 0x4C, 0x4F, 0x57, 0x20, 0x7C, 0x20, 0x57, 0x72, 0x69,
+	0x74, 0x76, 0x00, 0xA1, 0x74, 0x6F, 0x20, 0x53, 0x44, 0x20, 0x63, 0x61,
+	0x72, 0x64, 0x45, 0x00, 0xB0, 0x49, 0x64, 0x6C, 0x65, 0x0A, 0x50, 0x55,
+	0x52, 0x50, 0x4C, 0x45, 0x2A, 0x00, 0x12, 0x61, 0x2A, 0x00, 0xB5, 0x66,
+	0x6F, 0x72, 0x20, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x6F, 0x00,
+	0x85, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72, 0xC1, 0x00, 0x51,
+	0x0A, 0x43, 0x59, 0x41, 0x4E, 0x1B, 0x00, 0x04, 0x51, 0x00, 0xFF, 0x02,
+	0x6E, 0x6F, 0x74, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x2F,
+	0x65, 0x72, 0x72, 0x6F, 0x72, 0x1C, 0x00, 0x09, 0x51, 0x0A, 0x42, 0x4C,
+	0x55, 0x45, 0x3F, 0x00, 0x61, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x15,
+	0x00, 0x09, 0xED, 0x00, 0x0C, 0x1C, 0x00, 0x06, 0xFB, 0x00, 0xF3, 0x04,
+	0x64, 0x65, 0x74, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20,
+	0x6C, 0x6F, 0x67, 0x20, 0x66, 0x69, 0x6C, 0xEA, 0x01, 0x0F, 0x1C, 0x00,
+	0x03, 0x13, 0x0A, 0x38, 0x02, 0x66, 0x43, 0x68, 0x61, 0x72, 0x67, 0x65,
+	0x38, 0x02, 0x56, 0x54, 0x68, 0x65, 0x20, 0x63, 0x14, 0x00, 0x30, 0x69,
+	0x73, 0x20, 0xAD, 0x01, 0x20, 0x77, 0x68, 0x4F, 0x00, 0x01, 0x18, 0x00,
+	0x90, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0xF2, 0x01,
+	0x02, 0x18, 0x00, 0x00, 0xC9, 0x00, 0x04, 0x1C, 0x00, 0x14, 0x2E, 0x59,
+	0x00, 0x00, 0x91, 0x02, 0x92, 0x65, 0x20, 0x44, 0x69, 0x61, 0x67, 0x72,
+	0x61, 0x6D, 0x5C, 0x00, 0x50, 0x3C, 0x4F, 0x66, 0x66, 0x3E, 0xB3, 0x00,
+	0xC3, 0x53, 0x68, 0x6F, 0x72, 0x74, 0x20, 0x50, 0x72, 0x65, 0x73, 0x73,
+	0x20, 0x41, 0x02, 0x1E, 0x3E, 0xA8, 0x02, 0x01, 0x89, 0x01, 0x3F, 0x0A,
+	0x3C, 0x41, 0x17, 0x00, 0x00, 0x0F, 0x46, 0x00, 0x0C, 0x01, 0x91, 0x01,
+	0x10, 0x44, 0x91, 0x01, 0xF2, 0x01, 0x20, 0x20, 0x20, 0x55, 0x53, 0x42,
+	0x20, 0x43, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x65, 0x64, 0x29, 0x00,
+	0x1F, 0x3E, 0xF9, 0x02, 0x00, 0x7A, 0x20, 0x20, 0x20, 0x4C, 0x6F, 0x6E,
+	0x67, 0x50, 0x00, 0x63, 0x2D, 0x3E, 0x20, 0x4F, 0x66, 0x66, 0x85, 0x00,
+	0x05, 0x56, 0x00, 0x0F, 0xC4, 0x00, 0x1D, 0x0F, 0x5B, 0x00, 0x0B, 0x0D,
+	0x8B, 0x00, 0x01, 0x5F, 0x00, 0x00, 0xB6, 0x00, 0x47, 0x44, 0x69, 0x73,
+	0x63, 0xB9, 0x00, 0x0F, 0x5F, 0x00, 0x08, 0x0F, 0x8D, 0x00, 0x35, 0x02,
+	0xBB, 0x01, 0x02, 0x44, 0x01, 0x11, 0x65, 0xEC, 0x00, 0x02, 0xBA, 0x01,
+	0x80, 0x31, 0x29, 0x20, 0x20, 0x54, 0x75, 0x72, 0x6E, 0x82, 0x03, 0x30,
+	0x74, 0x68, 0x65, 0xC9, 0x03, 0x11, 0x2E, 0x7C, 0x02, 0x20, 0x2A, 0x20,
+	0x31, 0x02, 0x07, 0x7D, 0x04, 0x60, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x74,
+	0x2B, 0x00, 0x01, 0xBC, 0x03, 0x63, 0x2E, 0x0A, 0x0A, 0x32, 0x29, 0x20,
+	0x6D, 0x00, 0x00, 0x3A, 0x00, 0x40, 0x62, 0x75, 0x74, 0x74, 0x45, 0x00,
+	0x99, 0x6F, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x20, 0x61, 0x02, 0x04,
+	0x0F, 0x55, 0x00, 0x04, 0x33, 0x69, 0x73, 0x20, 0x91, 0x03, 0x21, 0x64,
+	0x75, 0x2C, 0x00, 0x00, 0x4A, 0x00, 0x01, 0x3A, 0x00, 0x03, 0xDF, 0x00,
+	0x53, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x0E, 0x03, 0x10, 0x74, 0xF9, 0x03,
+	0x06, 0xB5, 0x02, 0x05, 0x61, 0x00, 0x4F, 0x2E, 0x0A, 0x0A, 0x33, 0x8B,
+	0x00, 0x04, 0x4F, 0x73, 0x74, 0x6F, 0x70, 0x8A, 0x00, 0x13, 0x0E, 0xDF,
+	0x00, 0x02, 0x33, 0x01, 0x04, 0x0B, 0x04, 0x02, 0x34, 0x01, 0xD3, 0x74,
+	0x6F, 0x20, 0x61, 0x20, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x72,
+	0x58, 0x03, 0x0F, 0x21, 0x00, 0x07, 0x01, 0x5E, 0x01, 0x03, 0xA2, 0x02,
+	0x04, 0x5E, 0x01, 0x02, 0x22, 0x00, 0x14, 0x63, 0x43, 0x00, 0x61, 0x77,
+	0x69, 0x74, 0x68, 0x20, 0x61, 0x15, 0x02, 0xC3, 0x4D, 0x69, 0x6E, 0x69,
+	0x2D, 0x42, 0x20, 0x63, 0x61, 0x62, 0x6C, 0x65, 0x5E, 0x01, 0x0F, 0x9A,
+	0x01, 0x08, 0x00, 0x4B, 0x00, 0x01, 0xB4, 0x00, 0x03, 0x49, 0x02, 0x70,
+	0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x6D, 0x73, 0x02, 0x13, 0x73, 0x73,
+	0x02, 0x6F, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0xF0, 0x00, 0x0E, 0x03,
+	0x3C, 0x05, 0x01, 0x57, 0x05, 0x05, 0x96, 0x02, 0x04, 0x81, 0x04, 0x00,
+	0x10, 0x04, 0x01, 0x6C, 0x05, 0x04, 0xA8, 0x01, 0x02, 0x7C, 0x01, 0x1C,
+	0x74, 0x21, 0x05, 0x05, 0x30, 0x01, 0xA0, 0x43, 0x68, 0x61, 0x6E, 0x67,
+	0x65, 0x20, 0x53, 0x65, 0x74, 0x5E, 0x05, 0x16, 0x73, 0x66, 0x02, 0x32,
+	0x4F, 0x70, 0x65, 0xC9, 0x00, 0x01, 0xC1, 0x04, 0xF9, 0x01, 0xE2, 0x80,
+	0x9C, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x74, 0x78, 0x74, 0xE2,
+	0x80, 0x9D, 0xE6, 0x00, 0x01, 0xFC, 0x00, 0x03, 0x49, 0x00, 0x13, 0x73,
+	0x49, 0x00, 0x02, 0x9B, 0x04, 0x01, 0x03, 0x02, 0x22, 0x73, 0x65, 0x4E,
+	0x01, 0x31, 0x73, 0x65, 0x63, 0x24, 0x02, 0x30, 0x75, 0x70, 0x64, 0x92,
+	0x04, 0x20, 0x74, 0x6F, 0x56, 0x00, 0x10, 0x59, 0x4D, 0x00, 0x00, 0x2B,
+	0x00, 0x45, 0x73, 0x61, 0x76, 0x65, 0x70, 0x00, 0x04, 0x05, 0x01, 0x12,
+	0x53, 0x33, 0x00, 0x41, 0x73, 0x20, 0x61, 0x72, 0x84, 0x00, 0xD0, 0x44,
+	0x61, 0x74, 0x65, 0x2F, 0x74, 0x69, 0x6D, 0x65, 0xE2, 0x80, 0x9D, 0x2C,
+	0x11, 0x00, 0x11, 0x43, 0x95, 0x00, 0x30, 0x75, 0x72, 0x61, 0x27, 0x00,
+	0x01, 0x15, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x19, 0x00, 0x45, 0x61, 0x6C,
+	0x69, 0x62, 0x17, 0x00, 0x03, 0x73, 0x02, 0x66, 0x52, 0x65, 0x73, 0x74,
+	0x61, 0x72, 0xDC, 0x01, 0x03, 0xA3, 0x00, 0x40, 0x20, 0x6E, 0x65, 0x77,
+	0x4B, 0x01, 0x06, 0x4A, 0x00, 0x03, 0x6F, 0x01, 0xA6, 0x61, 0x6B, 0x65,
+	0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x30, 0x01, 0x67, 0x6F, 0x6E,
+	0x76, 0x65, 0x72, 0x74, 0x93, 0x03, 0x21, 0x49, 0x66, 0x44, 0x00, 0x01,
+	0xC2, 0x06, 0x31, 0x77, 0x61, 0x73, 0xC9, 0x00, 0x01, 0xE2, 0x05, 0x60,
+	0x62, 0x69, 0x6E, 0x61, 0x72, 0x79, 0xB1, 0x06, 0x82, 0x6D, 0x61, 0x74,
+	0x2C, 0x20, 0x79, 0x6F, 0x75, 0x57, 0x00, 0x40, 0x6E, 0x65, 0x65, 0x64,
+	0xFE, 0x00, 0x22, 0x72, 0x75, 0x44, 0x01, 0x50, 0x0A, 0x63, 0x6F, 0x6D,
+	0x6D, 0x8B, 0x00, 0x30, 0x6C, 0x69, 0x6E, 0x17, 0x01, 0x23, 0x6F, 0x6C,
+	0x6F, 0x01, 0x00, 0x69, 0x00, 0x50, 0x65, 0x72, 0x2E, 0x65, 0x78, 0xEF,
+	0x00, 0x01, 0x27, 0x02, 0x27, 0x65, 0x64, 0x79, 0x01, 0x00, 0x44, 0x00,
+	0x03, 0x26, 0x00, 0x05, 0x82, 0x00, 0x1F, 0x2E, 0x8F, 0x00, 0x07, 0x70,
+	0xE2, 0x80, 0x9C, 0x72, 0x65, 0x61, 0x64, 0xAF, 0x02, 0x00, 0x4F, 0x00,
+	0x04, 0x97, 0x00, 0x20, 0x69, 0x74, 0xD6, 0x03, 0x20, 0x61, 0x6C, 0x1C,
+	0x00, 0x53, 0x79, 0x20, 0x63, 0x73, 0x76, 0x1A, 0x00, 0x01, 0x55, 0x02,
+	0x00, 0x96, 0x00, 0xC0, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x69,
+	0x6D, 0x70, 0x6F, 0x72, 0x00, 0x05, 0xF6, 0x06, 0x69, 0x6E, 0x74, 0x6F,
+	0x20, 0x65, 0x78, 0x63, 0x65, 0x6C, 0x2F, 0x4D, 0x61, 0x74, 0x6C, 0x61,
+	0x62, 0x20, 0x65, 0x74, 0x63, 0x6E, 0x06, 0x63, 0x44, 0x20, 0x43, 0x61,
+	0x72, 0x64, 0x49, 0x02, 0x81, 0x53, 0x44, 0x2C, 0x20, 0x53, 0x44, 0x48,
+	0x43, 0x6A, 0x01, 0x41, 0x53, 0x44, 0x58, 0x43, 0x71, 0x07, 0x40, 0x73,
+	0x20, 0x75, 0x70, 0xBD, 0x00, 0x31, 0x32, 0x54, 0x42, 0xD9, 0x01, 0x32,
+	0x73, 0x75, 0x70, 0x5C, 0x00, 0x11, 0x2E, 0xF6, 0x02, 0x01, 0x94, 0x07,
+	0x85, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x0A, 0x8D, 0x00, 0x73,
+	0x20, 0x46, 0x41, 0x54, 0x33, 0x32, 0x2C, 0x41, 0x00, 0x10, 0x6C, 0x19,
+	0x07, 0xA3, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x33, 0x32, 0x47,
+	0x48, 0x00, 0x36, 0x6F, 0x6C, 0x64, 0xBE, 0x00, 0x60, 0x20, 0x65, 0x78,
+	0x46, 0x41, 0x54, 0x7A, 0x00, 0x13, 0x0A, 0x4D, 0x00, 0x3B, 0x20, 0x72,
+	0x65, 0x4F, 0x00, 0x04, 0xD0, 0x03, 0xA4, 0x74, 0x68, 0x69, 0x72, 0x64,
+	0x20, 0x70, 0x61, 0x72, 0x74, 0xB0, 0x01, 0x00, 0xC5, 0x02, 0x01, 0x8C,
+	0x01, 0x21, 0x2E, 0x0A, 0x8B, 0x07, 0x60, 0x66, 0x69, 0x72, 0x73, 0x74,
+	0x20, 0x7B, 0x02, 0x00, 0x0F, 0x04, 0x00, 0xA2, 0x00, 0x85, 0x69, 0x73,
+	0x20, 0x75, 0x73, 0x65, 0x64, 0x2C, 0x8F, 0x01, 0xF0, 0x07, 0x6D, 0x65,
+	0x61, 0x73, 0x75, 0x72, 0x65, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x77,
+	0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 0x70, 0x65, 0xD6, 0x00, 0x51, 0x45,
+	0x61, 0x63, 0x68, 0x0A, 0x3C, 0x00, 0x04, 0x2C, 0x00, 0x01, 0x88, 0x02,
+	0x12, 0x73, 0x3C, 0x00, 0x62, 0x22, 0x50, 0x6C, 0x61, 0x6E, 0x22, 0xFE,
+	0x01, 0x02, 0xA8, 0x01, 0x25, 0x6C, 0x6F, 0x68, 0x03, 0x50, 0x73, 0x68,
+	0x6F, 0x77, 0x73, 0xED, 0x03, 0x21, 0x74, 0x68, 0xF0, 0x00, 0x02, 0x1F,
+	0x01, 0xF0, 0x00, 0x0A, 0x69, 0x73, 0x20, 0x66, 0x61, 0x73, 0x74, 0x20,
+	0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0xB4, 0x00, 0x02, 0x1C, 0x00, 0x65,
+	0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x86, 0x03, 0xF0, 0x14, 0x2E, 0x20,
+	0x41, 0x6E, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x20,
+	0x72, 0x69, 0x73, 0x6B, 0x20, 0x6F, 0x66, 0x20, 0x48, 0x49, 0x47, 0x48,
+	0x20, 0x6F, 0x72, 0x0A, 0x4F, 0x56, 0x45, 0x52, 0x46, 0x4C, 0x04, 0x40,
+	0x6D, 0x65, 0x61, 0x6E, 0x2A, 0x02, 0x90, 0x6D, 0x70, 0x6C, 0x65, 0x73,
+	0x20, 0x6D, 0x61, 0x79, 0x2D, 0x01, 0x50, 0x64, 0x72, 0x6F, 0x70, 0x70,
+	0xE0, 0x00, 0x20, 0x75, 0x73, 0xF4, 0x00, 0x00, 0x6F, 0x00, 0x21, 0x65,
+	0x72, 0x7E, 0x00, 0x93, 0x2C, 0x20, 0x61, 0x20, 0x6C, 0x6F, 0x77, 0x65,
+	0x72, 0x33, 0x00, 0x90, 0x0A, 0x72, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x66,
+	0x65, 0x13, 0x00, 0xB4, 0x63, 0x68, 0x61, 0x6E, 0x6E, 0x65, 0x6C, 0x73,
+	0x20, 0x6F, 0x72, 0x02, 0x03, 0x30, 0x6D, 0x6F, 0x64, 0x22, 0x05, 0x03,
+	0x9A, 0x02, 0x01, 0x3D, 0x01, 0xE6, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74,
+	0x20, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x75, 0x70, 0x44, 0x01, 0x00, 0x11,
+	0x00, 0x80, 0x73, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x82, 0x01,
+	0x00, 0x38, 0x02, 0x00, 0x89, 0x00, 0x05, 0x9E, 0x00, 0x60, 0x0A, 0x75,
+	0x6E, 0x74, 0x69, 0x6C, 0xB6, 0x02, 0x60, 0x63, 0x61, 0x74, 0x63, 0x68,
+	0x65, 0x4C, 0x02, 0x02, 0x61, 0x01, 0x01, 0x50, 0x03, 0x24, 0x6F, 0x66,
+	0xB8, 0x00, 0x05, 0xCF, 0x00, 0x10, 0x69, 0xD2, 0x00, 0x70, 0x72, 0x6B,
+	0x65, 0x64, 0x20, 0x62, 0x79, 0xB9, 0x00, 0xB2, 0x69, 0x6E, 0x65, 0x0A,
+	0x22, 0x67, 0x61, 0x70, 0x2C, 0x20, 0x3C, 0xD5, 0x01, 0x02, 0x29, 0x00,
+	0x42, 0x3E, 0x2C, 0x20, 0x3C, 0x0A, 0x00, 0x80, 0x20, 0x63, 0x6F, 0x75,
+	0x6E, 0x74, 0x3E, 0x22, 0x8D, 0x01, 0x04, 0x32, 0x03, 0x02, 0x5D, 0x03,
+	0x22, 0x20, 0x42, 0xD1, 0x00, 0x01, 0x5D, 0x03, 0x01, 0xAB, 0x00, 0x23,
+	0x0A, 0x61, 0x3F, 0x00, 0x01, 0x83, 0x01, 0x10, 0x65, 0x87, 0x00, 0x0A,
+	0x80, 0x00, 0x02, 0x62, 0x02, 0xF1, 0x12, 0x65, 0x76, 0x65, 0x72, 0x79,
+	0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46,
+	0x46, 0x2C, 0x20, 0x66, 0x75, 0x6C, 0x6C, 0x20, 0x73, 0x63, 0x61, 0x6C,
+	0x65, 0x0A, 0x61, 0x66, 0x5B, 0x01, 0x01, 0xCC, 0x03, 0x45, 0x73, 0x69,
+	0x6F, 0x6E, 0x3D, 0x05, 0x00, 0xD4, 0x00, 0x02, 0xFD, 0x04, 0x30, 0x6C,
+	0x69, 0x73, 0xB6, 0x02, 0x01, 0x48, 0x05, 0x70, 0x61, 0x6D, 0x65, 0x20,
+	0x77, 0x61, 0x79, 0xA0, 0x00, 0x04, 0x31, 0x05, 0x31, 0x0A, 0x22, 0x3C,
+	0x95, 0x00, 0x00, 0x0C, 0x00, 0x60, 0x3E, 0x5F, 0x67, 0x61, 0x70, 0x73,
+	0x41, 0x02, 0x12, 0x22, 0x51, 0x03, 0x50, 0x74, 0x6F, 0x74, 0x61, 0x6C,
+	0x08, 0x01, 0x00, 0x95, 0x02, 0x10, 0x74, 0xD7, 0x05, 0x11, 0x6F, 0x39,
+	0x00, 0x00, 0x67, 0x02, 0x07, 0xD8, 0x04, 0x01, 0x97, 0x06, 0x63, 0x53,
+	0x65, 0x6E, 0x73, 0x6F, 0x72, 0xBF, 0x03, 0x30, 0x41, 0x74, 0x74, 0xD2,
+	0x00, 0x02, 0xBD, 0x05, 0x00, 0x18, 0x00, 0x02, 0x0E, 0x07, 0x01, 0xFA,
+	0x06, 0x34, 0x58, 0x4C, 0x52, 0x7F, 0x06, 0x27, 0x6F, 0x72, 0xEE, 0x05,
+	0x04, 0xE0, 0x06, 0x03, 0x64, 0x00, 0x01, 0x21, 0x06, 0x30, 0x42, 0x4E,
+	0x43, 0x10, 0x00, 0x14, 0x6D, 0x38, 0x00, 0x72, 0x61, 0x64, 0x61, 0x70,
+	0x74, 0x65, 0x72, 0xDA, 0x00, 0x71, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64,
+	0x65, 0xBA, 0x03, 0x03, 0x67, 0x00, 0x20, 0x73, 0x20, 0x1D, 0x02, 0x51,
+	0x72, 0x65, 0x71, 0x75, 0x69, 0xB2, 0x06, 0x10, 0x70, 0x6D, 0x02, 0x05,
+	0xAB, 0x00, 0x00, 0x7F, 0x00, 0x10, 0x20, 0x47, 0x00, 0x63, 0x50, 0x69,
+	0x6E, 0x6F, 0x75, 0x74, 0xB3, 0x06, 0x90, 0x20, 0x2D, 0x3E, 0x20, 0x47,
+	0x4E, 0x44, 0x0A, 0x32, 0x09, 0x00, 0xF0, 0x03, 0x53, 0x69, 0x67, 0x6E,
+	0x61, 0x6C, 0x0A, 0x33, 0x20, 0x2D, 0x3E, 0x20, 0x50, 0x6F, 0x77, 0x65,
+	0x72, 0x0A
+};
 
 const char converterFn[] = "converter.exe";
 
-const uint8_t consoleConverterBinary[37376] = {
-	0x4D, 0x5A, 0x90, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF0, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0xBA, 0x0E, 0x00, 0xB4, 0x09, 0xCD,
-	0x21, 0xB8, 0x01, 0x4C, 0xCD, 0x21, 0x54, 0x68, 0x69, 0x73, 0x20, 0x70,
-	0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F,
-	0x74, 0x20, 0x62, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x20,
-	0x44, 0x4F, 0x53, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x0D, 0x0D, 0x0A,
-	0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x36, 0x6C, 0x41,
-	0x11, 0x57, 0x02, 0x12, 0x11, 0x57, 0x02, 0x12, 0x11, 0x57, 0x02, 0x12,
-	0xD5, 0x92, 0xCF, 0x12, 0x12, 0x57, 0x02, 0x12, 0xD5, 0x92, 0xCC, 0x12,
-	0x02, 0x57, 0x02, 0x12, 0xD5, 0x92, 0xC9, 0x12, 0x14, 0x57, 0x02, 0x12,
-	0xD5, 0x92, 0xCD, 0x12, 0x17, 0x57, 0x02, 0x12, 0x11, 0x57, 0x03, 0x12,
-	0x8F, 0x57, 0x02, 0x12, 0xED, 0x20, 0xBB, 0x12, 0x13, 0x57, 0x02, 0x12,
-	0x36, 0x91, 0xD1, 0x12, 0x10, 0x57, 0x02, 0x12, 0x36, 0x91, 0xCB, 0x12,
-	0x10, 0x57, 0x02, 0x12, 0x36, 0x91, 0xCE, 0x12, 0x10, 0x57, 0x02, 0x12,
-	0x52, 0x69, 0x63, 0x68, 0x11, 0x57, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x50, 0x45, 0x00, 0x00, 0x4C, 0x01, 0x05, 0x00, 0xC5, 0x04, 0x5C, 0x55,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x02, 0x01,
-	0x0B, 0x01, 0x0B, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x2D, 0x58, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00,
-	0x00, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x81,
-	0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x81, 0x00, 0x00,
-	0x50, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xBC, 0x06, 0x00, 0x00,
-	0x40, 0x72, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x75, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x70, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x74, 0x65, 0x78,
-	0x74, 0x00, 0x00, 0x00, 0x15, 0x53, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-	0x00, 0x54, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60,
-	0x2E, 0x72, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x98, 0x25, 0x00, 0x00,
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x40, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00,
-	0x20, 0x07, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-	0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x2E, 0x72, 0x73, 0x72,
-	0x63, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-	0x00, 0x02, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40,
-	0x2E, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x00, 0x00, 0xA8, 0x0C, 0x00, 0x00,
-	0x00, 0xC0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x8B, 0x09, 0x85, 0xC9,
+#define CONVERTER_SIZE 37376 // Decompressed size in bytes
+
+const uint8_t consoleConverterLZ[23171] = {
+	0xF2, 0x03, 0x4D, 0x5A, 0x90, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xB8, 0x00, 0x01, 0x00, 0x13, 0x40,
+	0x08, 0x00, 0x0F, 0x01, 0x00, 0x09, 0xF3, 0x2E, 0xF0, 0x00, 0x00, 0x00,
+	0x0E, 0x1F, 0xBA, 0x0E, 0x00, 0xB4, 0x09, 0xCD, 0x21, 0xB8, 0x01, 0x4C,
+	0xCD, 0x21, 0x54, 0x68, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72,
+	0x61, 0x6D, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65,
+	0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x44, 0x4F, 0x53, 0x20,
+	0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x0D, 0x0D, 0x0A, 0x24, 0x44, 0x00, 0x84,
+	0x55, 0x36, 0x6C, 0x41, 0x11, 0x57, 0x02, 0x12, 0x04, 0x00, 0x51, 0xD5,
+	0x92, 0xCF, 0x12, 0x12, 0x08, 0x00, 0x31, 0xCC, 0x12, 0x02, 0x08, 0x00,
+	0x31, 0xC9, 0x12, 0x14, 0x08, 0x00, 0x31, 0xCD, 0x12, 0x17, 0x24, 0x00,
+	0xF1, 0x04, 0x03, 0x12, 0x8F, 0x57, 0x02, 0x12, 0xED, 0x20, 0xBB, 0x12,
+	0x13, 0x57, 0x02, 0x12, 0x36, 0x91, 0xD1, 0x12, 0x10, 0x08, 0x00, 0x13,
+	0xCB, 0x08, 0x00, 0x11, 0xCE, 0x08, 0x00, 0x40, 0x52, 0x69, 0x63, 0x68,
+	0x50, 0x00, 0x0C, 0xB4, 0x00, 0xC4, 0x50, 0x45, 0x00, 0x00, 0x4C, 0x01,
+	0x05, 0x00, 0xC5, 0x04, 0x5C, 0x55, 0x14, 0x00, 0xE2, 0xE0, 0x00, 0x02,
+	0x01, 0x0B, 0x01, 0x0B, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x3E, 0x14,
+	0x00, 0xA3, 0x2D, 0x58, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x70,
+	0x0E, 0x01, 0x00, 0x0C, 0x00, 0x43, 0x02, 0x00, 0x00, 0x06, 0x34, 0x00,
+	0x04, 0x08, 0x00, 0x23, 0x00, 0xD0, 0x3D, 0x01, 0x71, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x40, 0x81, 0x29, 0x00, 0x00, 0x2C, 0x00, 0x05, 0x08, 0x00,
+	0x05, 0x07, 0x00, 0x01, 0x01, 0x00, 0x50, 0xA0, 0x81, 0x00, 0x00, 0x50,
+	0x09, 0x00, 0x5C, 0xB0, 0x00, 0x00, 0xE0, 0x01, 0x9E, 0x00, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xBC, 0x06, 0x00, 0x00, 0x40, 0x72,
+	0x00, 0x00, 0x38, 0x1F, 0x00, 0x00, 0x04, 0x01, 0x00, 0x2B, 0xD8, 0x75,
+	0xA4, 0x01, 0x5F, 0x70, 0x00, 0x00, 0x08, 0x02, 0x30, 0x00, 0x07, 0xA3,
+	0x2E, 0x74, 0x65, 0x78, 0x74, 0x00, 0x00, 0x00, 0x15, 0x53, 0x91, 0x00,
+	0x00, 0xEC, 0x00, 0x03, 0xB8, 0x00, 0x04, 0x01, 0x00, 0xE3, 0x20, 0x00,
+	0x00, 0x60, 0x2E, 0x72, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x98, 0x25,
+	0xFC, 0x00, 0x40, 0x26, 0x00, 0x00, 0x00, 0x0C, 0x01, 0x07, 0x01, 0x00,
+	0x52, 0x40, 0x00, 0x00, 0x40, 0x2E, 0x27, 0x00, 0x30, 0x00, 0x20, 0x07,
+	0xD5, 0x00, 0x03, 0x4C, 0x00, 0x1D, 0x7E, 0x28, 0x00, 0x60, 0xC0, 0x2E,
+	0x72, 0x73, 0x72, 0x63, 0x64, 0x01, 0x00, 0xEC, 0x00, 0x12, 0xB0, 0x44,
+	0x01, 0x2F, 0x00, 0x82, 0x50, 0x00, 0x00, 0x92, 0x72, 0x65, 0x6C, 0x6F,
+	0x63, 0x00, 0x00, 0xA8, 0x0C, 0x04, 0x01, 0x6D, 0x00, 0x0E, 0x00, 0x00,
+	0x00, 0x84, 0x28, 0x00, 0x1A, 0x42, 0x12, 0x00, 0x0F, 0x01, 0x00, 0xFF,
+	0x30, 0x2A, 0xC3, 0xCC, 0x01, 0x00, 0xF5, 0x08, 0x8B, 0x09, 0x85, 0xC9,
 	0x74, 0x11, 0x8B, 0x01, 0xFF, 0x50, 0x08, 0x85, 0xC0, 0x74, 0x08, 0x8B,
-	0x10, 0x6A, 0x01, 0x8B, 0xC8, 0xFF, 0x12, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0xF6, 0x45, 0x08, 0x01, 0x56,
-	0x8B, 0xF1, 0xC7, 0x06, 0x80, 0x75, 0x40, 0x00, 0x74, 0x0A, 0x56, 0xFF,
-	0x15, 0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0x8B, 0xC6, 0x5E, 0x5D,
-	0xC2, 0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x8B, 0x45, 0x08, 0x8B, 0x55,
-	0x0C, 0x89, 0x10, 0x89, 0x48, 0x04, 0x5D, 0xC2, 0x08, 0x00, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x8B, 0x01, 0x83, 0xEC, 0x08, 0x8D, 0x55, 0xF8, 0xFF,
-	0x75, 0x08, 0x52, 0xFF, 0x50, 0x0C, 0x8B, 0x55, 0x0C, 0x8B, 0x48, 0x04,
-	0x3B, 0x4A, 0x04, 0x75, 0x0E, 0x8B, 0x00, 0x3B, 0x02, 0x75, 0x08, 0xB0,
-	0x01, 0x8B, 0xE5, 0x5D, 0xC2, 0x08, 0x00, 0x32, 0xC0, 0x8B, 0xE5, 0x5D,
-	0xC2, 0x08, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x8B, 0x45, 0x08, 0x3B, 0x48,
-	0x04, 0x75, 0x0D, 0x8B, 0x00, 0x3B, 0x45, 0x0C, 0x75, 0x06, 0xB0, 0x01,
-	0x5D, 0xC2, 0x08, 0x00, 0x32, 0xC0, 0x5D, 0xC2, 0x08, 0x00, 0xCC, 0xCC,
-	0xB8, 0x88, 0x72, 0x40, 0x00, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x51, 0x56, 0xFF, 0x75, 0x0C,
-	0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x15, 0x00, 0x71, 0x40,
+	0x10, 0x6A, 0x01, 0x8B, 0xC8, 0xFF, 0x12, 0x27, 0x00, 0xF9, 0x14, 0x55,
+	0x8B, 0xEC, 0xF6, 0x45, 0x08, 0x01, 0x56, 0x8B, 0xF1, 0xC7, 0x06, 0x80,
+	0x75, 0x40, 0x00, 0x74, 0x0A, 0x56, 0xFF, 0x15, 0x48, 0x71, 0x40, 0x00,
+	0x83, 0xC4, 0x04, 0x8B, 0xC6, 0x5E, 0x5D, 0xC2, 0x04, 0x00, 0x50, 0x00,
+	0xFA, 0x02, 0x55, 0x8B, 0xEC, 0x8B, 0x45, 0x08, 0x8B, 0x55, 0x0C, 0x89,
+	0x10, 0x89, 0x48, 0x04, 0x5D, 0xC2, 0x08, 0x1F, 0x00, 0x01, 0x20, 0x00,
+	0xF0, 0x14, 0x01, 0x83, 0xEC, 0x08, 0x8D, 0x55, 0xF8, 0xFF, 0x75, 0x08,
+	0x52, 0xFF, 0x50, 0x0C, 0x8B, 0x55, 0x0C, 0x8B, 0x48, 0x04, 0x3B, 0x4A,
+	0x04, 0x75, 0x0E, 0x8B, 0x00, 0x3B, 0x02, 0x75, 0x08, 0xB0, 0x01, 0x8B,
+	0xE5, 0x39, 0x00, 0x22, 0x32, 0xC0, 0x08, 0x00, 0x0F, 0x60, 0x00, 0x00,
+	0xE2, 0x3B, 0x48, 0x04, 0x75, 0x0D, 0x8B, 0x00, 0x3B, 0x45, 0x0C, 0x75,
+	0x06, 0xB0, 0x01, 0x2D, 0x00, 0x02, 0x2B, 0x00, 0x48, 0xB8, 0x88, 0x72,
+	0x40, 0xE5, 0x00, 0xB0, 0x55, 0x8B, 0xEC, 0x51, 0x56, 0xFF, 0x75, 0x0C,
+	0xC7, 0x45, 0xFC, 0xFF, 0x00, 0xF1, 0x10, 0xFF, 0x15, 0x00, 0x71, 0x40,
 	0x00, 0x8B, 0x75, 0x08, 0x83, 0xC4, 0x04, 0x85, 0xC0, 0xBA, 0x90, 0x72,
 	0x40, 0x00, 0x0F, 0x45, 0xD0, 0xC7, 0x46, 0x14, 0x0F, 0x00, 0x00, 0x00,
-	0xC7, 0x46, 0x10, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x06, 0x00, 0x80, 0x3A,
-	0x00, 0x75, 0x14, 0x33, 0xC9, 0x51, 0x52, 0x8B, 0xCE, 0xE8, 0x2A, 0x34,
-	0x00, 0x00, 0x8B, 0xC6, 0x5E, 0x8B, 0xE5, 0x5D, 0xC2, 0x08, 0x00, 0x8B,
-	0xCA, 0x57, 0x8D, 0x79, 0x01, 0x8A, 0x01, 0x41, 0x84, 0xC0, 0x75, 0xF9,
-	0x2B, 0xCF, 0x5F, 0x51, 0x52, 0x8B, 0xCE, 0xE8, 0x08, 0x34, 0x00, 0x00,
-	0x8B, 0xC6, 0x5E, 0x8B, 0xE5, 0x5D, 0xC2, 0x08, 0x00, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xB8, 0xA0, 0x72, 0x40, 0x00, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x51, 0x8B, 0x45, 0x0C, 0x56,
-	0x8B, 0x75, 0x08, 0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x83, 0xF8,
-	0x01, 0x75, 0x28, 0x6A, 0x15, 0xC7, 0x46, 0x14, 0x0F, 0x00, 0x00, 0x00,
-	0xC7, 0x46, 0x10, 0x00, 0x00, 0x00, 0x00, 0x68, 0xAC, 0x72, 0x40, 0x00,
-	0x8B, 0xCE, 0xC6, 0x06, 0x00, 0xE8, 0xAA, 0x33, 0x00, 0x00, 0x8B, 0xC6,
-	0x5E, 0x8B, 0xE5, 0x5D, 0xC2, 0x08, 0x00, 0x50, 0x56, 0xE8, 0x2A, 0xFF,
-	0xFF, 0xFF, 0x8B, 0xC6, 0x5E, 0x8B, 0xE5, 0x5D, 0xC2, 0x08, 0x00, 0xCC,
-	0xB8, 0xC4, 0x72, 0x40, 0x00, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x51, 0x56, 0xFF, 0x75, 0x0C,
-	0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x15, 0x04, 0x71, 0x40,
-	0x00, 0x8B, 0x75, 0x08, 0x83, 0xC4, 0x04, 0x85, 0xC0, 0xBA, 0x90, 0x72,
-	0x40, 0x00, 0x0F, 0x45, 0xD0, 0xC7, 0x46, 0x14, 0x0F, 0x00, 0x00, 0x00,
-	0xC7, 0x46, 0x10, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x06, 0x00, 0x80, 0x3A,
-	0x00, 0x75, 0x14, 0x33, 0xC9, 0x51, 0x52, 0x8B, 0xCE, 0xE8, 0x3A, 0x33,
-	0x00, 0x00, 0x8B, 0xC6, 0x5E, 0x8B, 0xE5, 0x5D, 0xC2, 0x08, 0x00, 0x8B,
-	0xCA, 0x57, 0x8D, 0x79, 0x01, 0x8A, 0x01, 0x41, 0x84, 0xC0, 0x75, 0xF9,
-	0x2B, 0xCF, 0x5F, 0x51, 0x52, 0x8B, 0xCE, 0xE8, 0x18, 0x33, 0x00, 0x00,
-	0x8B, 0xC6, 0x5E, 0x8B, 0xE5, 0x5D, 0xC2, 0x08, 0x00, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x56, 0x8B, 0x75, 0x0C, 0x56, 0xFF, 0x15, 0x00, 0x71,
-	0x40, 0x00, 0x83, 0xC4, 0x04, 0x85, 0xC0, 0x8B, 0x45, 0x08, 0x89, 0x30,
-	0x74, 0x0C, 0xC7, 0x40, 0x04, 0x90, 0xA3, 0x40, 0x00, 0x5E, 0x5D, 0xC2,
-	0x08, 0x00, 0xC7, 0x40, 0x04, 0x8C, 0xA3, 0x40, 0x00, 0x5E, 0x5D, 0xC2,
-	0x08, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x8B, 0x09, 0x8B, 0x01, 0x8B, 0x40, 0x04, 0x8B,
-	0x4C, 0x08, 0x38, 0x85, 0xC9, 0x74, 0x05, 0x8B, 0x01, 0xFF, 0x60, 0x08,
-	0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x6A, 0xFF, 0x68, 0x5D, 0x61, 0x40, 0x00, 0x64, 0xA1,
-	0x00, 0x00, 0x00, 0x00, 0x50, 0x81, 0xEC, 0xD8, 0x00, 0x00, 0x00, 0xA1,
-	0x18, 0xA0, 0x40, 0x00, 0x33, 0xC5, 0x89, 0x45, 0xEC, 0x53, 0x56, 0x57,
-	0x50, 0x8D, 0x45, 0xF4, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xDA,
-	0x89, 0x5D, 0xD0, 0x8B, 0x75, 0x08, 0x83, 0xEC, 0x08, 0x51, 0x8D, 0x8D,
-	0x1C, 0xFF, 0xFF, 0xFF, 0xE8, 0x5B, 0x18, 0x00, 0x00, 0xC7, 0x45, 0xFC,
-	0x00, 0x00, 0x00, 0x00, 0xC7, 0x45, 0xE8, 0x0F, 0x00, 0x00, 0x00, 0xC7,
-	0x45, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x45, 0xD4, 0x00, 0x53, 0x8D,
-	0x55, 0xD4, 0x8D, 0x8D, 0x1C, 0xFF, 0xFF, 0xFF, 0xC6, 0x45, 0xFC, 0x01,
-	0xE8, 0x7F, 0x3C, 0x00, 0x00, 0x8B, 0xC8, 0x83, 0xC4, 0x04, 0x8B, 0x01,
-	0x8B, 0x40, 0x04, 0x03, 0xC1, 0xB9, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x40,
-	0x0C, 0x06, 0x0F, 0x45, 0xC1, 0x85, 0xC0, 0x0F, 0x84, 0xD3, 0x00, 0x00,
-	0x00, 0x8B, 0x7E, 0x04, 0x8D, 0x45, 0xD4, 0x3B, 0xC7, 0x73, 0x5C, 0x8B,
-	0x06, 0x8D, 0x4D, 0xD4, 0x3B, 0xC1, 0x77, 0x53, 0x2B, 0xC8, 0xB8, 0xAB,
-	0xAA, 0xAA, 0x2A, 0xF7, 0xE9, 0xC1, 0xFA, 0x02, 0x8B, 0xDA, 0xC1, 0xEB,
-	0x1F, 0x03, 0xDA, 0x3B, 0x7E, 0x08, 0x75, 0x08, 0x51, 0x8B, 0xCE, 0xE8,
-	0xEC, 0x2E, 0x00, 0x00, 0x8B, 0x06, 0x8D, 0x0C, 0x5B, 0x8D, 0x04, 0xC8,
-	0x8B, 0x4E, 0x04, 0xC6, 0x45, 0xFC, 0x02, 0x85, 0xC9, 0x74, 0x1B, 0x6A,
-	0xFF, 0x6A, 0x00, 0xC7, 0x41, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x41,
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x50, 0xC6, 0x01, 0x00, 0xE8, 0xFE, 0x2B,
-	0x00, 0x00, 0x8B, 0x5D, 0xD0, 0xEB, 0x36, 0x3B, 0x7E, 0x08, 0x75, 0x08,
-	0x51, 0x8B, 0xCE, 0xE8, 0xAC, 0x2E, 0x00, 0x00, 0x8B, 0x4E, 0x04, 0xC6,
-	0x45, 0xFC, 0x03, 0x85, 0xC9, 0x74, 0x1E, 0x6A, 0xFF, 0x6A, 0x00, 0x8D,
-	0x45, 0xD4, 0xC7, 0x41, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x41, 0x10,
-	0x00, 0x00, 0x00, 0x00, 0x50, 0xC6, 0x01, 0x00, 0xE8, 0xC3, 0x2B, 0x00,
-	0x00, 0xC6, 0x45, 0xFC, 0x01, 0x83, 0x46, 0x04, 0x18, 0x53, 0x8D, 0x55,
-	0xD4, 0x8D, 0x8D, 0x1C, 0xFF, 0xFF, 0xFF, 0xE8, 0xAC, 0x3B, 0x00, 0x00,
-	0x8B, 0xC8, 0x83, 0xC4, 0x04, 0x8B, 0x01, 0x8B, 0x40, 0x04, 0x03, 0xC1,
-	0xB9, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x40, 0x0C, 0x06, 0x0F, 0x45, 0xC1,
-	0x85, 0xC0, 0x0F, 0x85, 0x2D, 0xFF, 0xFF, 0xFF, 0x83, 0x7D, 0xE8, 0x10,
-	0x72, 0x0C, 0xFF, 0x75, 0xD4, 0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x83,
-	0xC4, 0x04, 0x8B, 0x85, 0x1C, 0xFF, 0xFF, 0xFF, 0x8B, 0x40, 0x04, 0xC7,
-	0x84, 0x05, 0x1C, 0xFF, 0xFF, 0xFF, 0x28, 0x75, 0x40, 0x00, 0x8B, 0x8D,
-	0x1C, 0xFF, 0xFF, 0xFF, 0x8B, 0x51, 0x04, 0x8D, 0x4A, 0x98, 0x89, 0x8C,
-	0x15, 0x18, 0xFF, 0xFF, 0xFF, 0x8D, 0x8D, 0x34, 0xFF, 0xFF, 0xFF, 0xE8,
-	0xD8, 0x17, 0x00, 0x00, 0x8D, 0x8D, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x15,
-	0x88, 0x70, 0x40, 0x00, 0x8D, 0x4D, 0x84, 0xFF, 0x15, 0xB0, 0x70, 0x40,
-	0x00, 0x8B, 0xC6, 0x8B, 0x4D, 0xF4, 0x64, 0x89, 0x0D, 0x00, 0x00, 0x00,
-	0x00, 0x59, 0x5F, 0x5E, 0x5B, 0x8B, 0x4D, 0xEC, 0x33, 0xCD, 0xE8, 0xB9,
-	0x3F, 0x00, 0x00, 0x8B, 0xE5, 0x5D, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x8B, 0x01, 0x56, 0x8B, 0x40, 0x04, 0x8D, 0x71, 0x68, 0xC7, 0x44, 0x30,
-	0x98, 0x28, 0x75, 0x40, 0x00, 0x8B, 0x46, 0x98, 0x8D, 0x4E, 0xB0, 0x8B,
-	0x50, 0x04, 0x8D, 0x42, 0x98, 0x89, 0x44, 0x32, 0x94, 0xE8, 0x7A, 0x17,
-	0x00, 0x00, 0x8D, 0x4E, 0xB8, 0xFF, 0x15, 0x88, 0x70, 0x40, 0x00, 0x8B,
-	0xCE, 0x5E, 0xFF, 0x25, 0xB0, 0x70, 0x40, 0x00, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x6A, 0xFF, 0x68, 0x19, 0x61,
-	0x40, 0x00, 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x50, 0x83, 0xEC, 0x08,
-	0x56, 0xA1, 0x18, 0xA0, 0x40, 0x00, 0x33, 0xC5, 0x50, 0x8D, 0x45, 0xF4,
-	0x64, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xC2, 0x8B, 0xF1, 0x89, 0x75,
-	0xEC, 0xC7, 0x45, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x06, 0x00, 0x00,
-	0x00, 0x00, 0xC7, 0x46, 0x04, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x46, 0x08,
-	0x00, 0x00, 0x00, 0x00, 0x8A, 0x55, 0x08, 0xC7, 0x45, 0xFC, 0x00, 0x00,
-	0x00, 0x00, 0x56, 0x8B, 0xC8, 0xC7, 0x45, 0xF0, 0x01, 0x00, 0x00, 0x00,
-	0xE8, 0x7F, 0xFD, 0xFF, 0xFF, 0x83, 0xC4, 0x04, 0x8B, 0xC6, 0x8B, 0x4D,
-	0xF4, 0x64, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5E, 0x8B, 0xE5,
-	0x5D, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x53, 0x8B, 0xD9, 0x57, 0x8B, 0x4B, 0x14, 0x83, 0xF9, 0x10, 0x72, 0x04,
-	0x8B, 0x03, 0xEB, 0x02, 0x8B, 0xC3, 0x56, 0x8B, 0x73, 0x10, 0x03, 0xF0,
-	0x83, 0xF9, 0x10, 0x72, 0x04, 0x8B, 0x3B, 0xEB, 0x02, 0x8B, 0xFB, 0x3B,
-	0xFE, 0x74, 0x1F, 0xEB, 0x07, 0x8D, 0xA4, 0x24, 0x00, 0x00, 0x00, 0x00,
-	0x0F, 0xBE, 0x07, 0x50, 0xFF, 0x15, 0xDC, 0x71, 0x40, 0x00, 0x83, 0xC4,
-	0x04, 0x85, 0xC0, 0x74, 0x05, 0x47, 0x3B, 0xFE, 0x75, 0xEA, 0x8B, 0x4B,
-	0x14, 0x5E, 0x83, 0xF9, 0x10, 0x72, 0x04, 0x8B, 0x03, 0xEB, 0x02, 0x8B,
-	0xC3, 0x83, 0xF9, 0x10, 0x72, 0x04, 0x8B, 0x13, 0xEB, 0x02, 0x8B, 0xD3,
+	0xC7, 0x46, 0xBA, 0x03, 0xF2, 0x07, 0xC6, 0x06, 0x00, 0x80, 0x3A, 0x00,
+	0x75, 0x14, 0x33, 0xC9, 0x51, 0x52, 0x8B, 0xCE, 0xE8, 0x2A, 0x34, 0x00,
+	0x00, 0x8B, 0xC6, 0x5E, 0x8C, 0x00, 0xF1, 0x01, 0x8B, 0xCA, 0x57, 0x8D,
+	0x79, 0x01, 0x8A, 0x01, 0x41, 0x84, 0xC0, 0x75, 0xF9, 0x2B, 0xCF, 0x5F,
+	0x22, 0x00, 0x18, 0x08, 0x22, 0x00, 0x0B, 0x60, 0x01, 0x2E, 0xB8, 0xA0,
+	0x90, 0x00, 0x73, 0x8B, 0x45, 0x0C, 0x56, 0x8B, 0x75, 0x08, 0x93, 0x00,
+	0x7A, 0x83, 0xF8, 0x01, 0x75, 0x28, 0x6A, 0x15, 0x84, 0x00, 0xD7, 0x68,
+	0xAC, 0x72, 0x40, 0x00, 0x8B, 0xCE, 0xC6, 0x06, 0x00, 0xE8, 0xAA, 0x33,
+	0x5E, 0x00, 0x76, 0x50, 0x56, 0xE8, 0x2A, 0xFF, 0xFF, 0xFF, 0x6E, 0x00,
+	0x2F, 0xB8, 0xC4, 0xF0, 0x00, 0x0C, 0x1F, 0x04, 0xF0, 0x00, 0x1D, 0x18,
+	0x3A, 0x70, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0x18, 0x18, 0x22, 0x00, 0x0B,
+	0xF0, 0x00, 0x82, 0x55, 0x8B, 0xEC, 0x56, 0x8B, 0x75, 0x0C, 0x56, 0x69,
+	0x01, 0x01, 0x76, 0x00, 0xF0, 0x00, 0x8B, 0x45, 0x08, 0x89, 0x30, 0x74,
+	0x0C, 0xC7, 0x40, 0x04, 0x90, 0xA3, 0x40, 0x00, 0x5E, 0x35, 0x00, 0x44,
+	0xC7, 0x40, 0x04, 0x8C, 0x0C, 0x00, 0x0A, 0x40, 0x00, 0xF8, 0x05, 0x8B,
+	0x09, 0x8B, 0x01, 0x8B, 0x40, 0x04, 0x8B, 0x4C, 0x08, 0x38, 0x85, 0xC9,
+	0x74, 0x05, 0x8B, 0x01, 0xFF, 0x60, 0x08, 0xB4, 0x02, 0xC0, 0x55, 0x8B,
+	0xEC, 0x6A, 0xFF, 0x68, 0x5D, 0x61, 0x40, 0x00, 0x64, 0xA1, 0xBD, 0x00,
+	0xF0, 0x0B, 0x50, 0x81, 0xEC, 0xD8, 0x00, 0x00, 0x00, 0xA1, 0x18, 0xA0,
+	0x40, 0x00, 0x33, 0xC5, 0x89, 0x45, 0xEC, 0x53, 0x56, 0x57, 0x50, 0x8D,
+	0x45, 0xF4, 0x64, 0xA3, 0x1E, 0x00, 0x50, 0x8B, 0xDA, 0x89, 0x5D, 0xD0,
+	0xFE, 0x00, 0xE3, 0xEC, 0x08, 0x51, 0x8D, 0x8D, 0x1C, 0xFF, 0xFF, 0xFF,
+	0xE8, 0x5B, 0x18, 0x00, 0x00, 0x1D, 0x01, 0x31, 0xC7, 0x45, 0xE8, 0x07,
+	0x01, 0x21, 0x45, 0xE4, 0x07, 0x01, 0x72, 0x45, 0xD4, 0x00, 0x53, 0x8D,
+	0x55, 0xD4, 0x28, 0x00, 0xB0, 0xC6, 0x45, 0xFC, 0x01, 0xE8, 0x7F, 0x3C,
+	0x00, 0x00, 0x8B, 0xC8, 0xEA, 0x02, 0x00, 0x94, 0x00, 0x30, 0x03, 0xC1,
+	0xB9, 0x28, 0x00, 0xC0, 0xF6, 0x40, 0x0C, 0x06, 0x0F, 0x45, 0xC1, 0x85,
+	0xC0, 0x0F, 0x84, 0xD3, 0x63, 0x00, 0xF2, 0x3C, 0x7E, 0x04, 0x8D, 0x45,
+	0xD4, 0x3B, 0xC7, 0x73, 0x5C, 0x8B, 0x06, 0x8D, 0x4D, 0xD4, 0x3B, 0xC1,
+	0x77, 0x53, 0x2B, 0xC8, 0xB8, 0xAB, 0xAA, 0xAA, 0x2A, 0xF7, 0xE9, 0xC1,
+	0xFA, 0x02, 0x8B, 0xDA, 0xC1, 0xEB, 0x1F, 0x03, 0xDA, 0x3B, 0x7E, 0x08,
+	0x75, 0x08, 0x51, 0x8B, 0xCE, 0xE8, 0xEC, 0x2E, 0x00, 0x00, 0x8B, 0x06,
+	0x8D, 0x0C, 0x5B, 0x8D, 0x04, 0xC8, 0x8B, 0x4E, 0x04, 0xC6, 0x45, 0xFC,
+	0x02, 0x85, 0xC9, 0x74, 0x1B, 0x6A, 0xFF, 0x6A, 0x00, 0xC7, 0x41, 0x96,
+	0x01, 0x11, 0x41, 0x96, 0x01, 0xE5, 0x50, 0xC6, 0x01, 0x00, 0xE8, 0xFE,
+	0x2B, 0x00, 0x00, 0x8B, 0x5D, 0xD0, 0xEB, 0x36, 0x40, 0x00, 0x10, 0xAC,
+	0x40, 0x00, 0x01, 0x38, 0x00, 0x50, 0x03, 0x85, 0xC9, 0x74, 0x1E, 0x38,
+	0x00, 0x3F, 0x8D, 0x45, 0xD4, 0x3B, 0x00, 0x00, 0x20, 0xC3, 0x2B, 0xD3,
+	0x00, 0x66, 0xFC, 0x01, 0x83, 0x46, 0x04, 0x18, 0xD7, 0x00, 0x3F, 0xE8,
+	0xAC, 0x3B, 0xD3, 0x00, 0x0A, 0xE6, 0x85, 0x2D, 0xFF, 0xFF, 0xFF, 0x83,
+	0x7D, 0xE8, 0x10, 0x72, 0x0C, 0xFF, 0x75, 0xD4, 0xEA, 0x03, 0x10, 0x85,
+	0x3D, 0x00, 0x60, 0x8B, 0x40, 0x04, 0xC7, 0x84, 0x05, 0x0A, 0x00, 0x51,
+	0x28, 0x75, 0x40, 0x00, 0x8B, 0x51, 0x00, 0xF0, 0x01, 0x8B, 0x51, 0x04,
+	0x8D, 0x4A, 0x98, 0x89, 0x8C, 0x15, 0x18, 0xFF, 0xFF, 0xFF, 0x8D, 0x8D,
+	0x34, 0x64, 0x00, 0xF0, 0x12, 0xD8, 0x17, 0x00, 0x00, 0x8D, 0x8D, 0x3C,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x88, 0x70, 0x40, 0x00, 0x8D, 0x4D, 0x84,
+	0xFF, 0x15, 0xB0, 0x70, 0x40, 0x00, 0x8B, 0xC6, 0x8B, 0x4D, 0xF4, 0x64,
+	0x89, 0x0D, 0x74, 0x00, 0xF2, 0x02, 0x59, 0x5F, 0x5E, 0x5B, 0x8B, 0x4D,
+	0xEC, 0x33, 0xCD, 0xE8, 0xB9, 0x3F, 0x00, 0x00, 0x8B, 0xE5, 0x5D, 0xE6,
+	0x01, 0xD1, 0x8B, 0x01, 0x56, 0x8B, 0x40, 0x04, 0x8D, 0x71, 0x68, 0xC7,
+	0x44, 0x30, 0x98, 0x67, 0x00, 0xF0, 0x02, 0x46, 0x98, 0x8D, 0x4E, 0xB0,
+	0x8B, 0x50, 0x04, 0x8D, 0x42, 0x98, 0x89, 0x44, 0x32, 0x94, 0xE8, 0x7A,
+	0x5E, 0x00, 0x22, 0x4E, 0xB8, 0x5B, 0x00, 0x50, 0x8B, 0xCE, 0x5E, 0xFF,
+	0x25, 0x5B, 0x00, 0x0A, 0x20, 0x02, 0x16, 0x19, 0x20, 0x02, 0x43, 0x83,
+	0xEC, 0x08, 0x56, 0x1E, 0x02, 0x07, 0x18, 0x02, 0x91, 0xC2, 0x8B, 0xF1,
+	0x89, 0x75, 0xEC, 0xC7, 0x45, 0xF0, 0x08, 0x02, 0x01, 0xDD, 0x07, 0x21,
+	0xC7, 0x46, 0x1F, 0x07, 0x30, 0xC7, 0x46, 0x08, 0x07, 0x00, 0x24, 0x8A,
+	0x55, 0xA0, 0x03, 0x60, 0x56, 0x8B, 0xC8, 0xC7, 0x45, 0xF0, 0xCF, 0x06,
+	0x51, 0xE8, 0x7F, 0xFD, 0xFF, 0xFF, 0xF8, 0x04, 0x07, 0xC7, 0x00, 0x00,
+	0x07, 0x03, 0x07, 0xA1, 0x02, 0xF2, 0x09, 0x53, 0x8B, 0xD9, 0x57, 0x8B,
+	0x4B, 0x14, 0x83, 0xF9, 0x10, 0x72, 0x04, 0x8B, 0x03, 0xEB, 0x02, 0x8B,
+	0xC3, 0x56, 0x8B, 0x73, 0x10, 0x03, 0xF0, 0x11, 0x00, 0xE0, 0x3B, 0xEB,
+	0x02, 0x8B, 0xFB, 0x3B, 0xFE, 0x74, 0x1F, 0xEB, 0x07, 0x8D, 0xA4, 0x24,
+	0x40, 0x00, 0x74, 0x0F, 0xBE, 0x07, 0x50, 0xFF, 0x15, 0xDC, 0x2C, 0x03,
+	0xB7, 0x74, 0x05, 0x47, 0x3B, 0xFE, 0x75, 0xEA, 0x8B, 0x4B, 0x14, 0x5E,
+	0x43, 0x00, 0x02, 0x0B, 0x00, 0xF1, 0x16, 0x13, 0xEB, 0x02, 0x8B, 0xD3,
 	0x85, 0xC0, 0x75, 0x04, 0x33, 0xC9, 0xEB, 0x04, 0x8B, 0xC8, 0x2B, 0xCA,
 	0x85, 0xFF, 0x75, 0x0E, 0x57, 0x51, 0x8B, 0xCB, 0xE8, 0xB7, 0x2A, 0x00,
-	0x00, 0x5F, 0x8B, 0xC3, 0x5B, 0xC3, 0x2B, 0xF8, 0x57, 0x51, 0x8B, 0xCB,
-	0xE8, 0xA7, 0x2A, 0x00, 0x00, 0x5F, 0x8B, 0xC3, 0x5B, 0xC3, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x83, 0xE4, 0xC0, 0x6A, 0xFF, 0x68, 0x44, 0x62, 0x40,
-	0x00, 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x50, 0x81, 0xEC, 0xE8, 0x02,
-	0x00, 0x00, 0xA1, 0x18, 0xA0, 0x40, 0x00, 0x33, 0xC4, 0x89, 0x84, 0x24,
-	0xB0, 0x02, 0x00, 0x00, 0x53, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00,
-	0x33, 0xC4, 0x50, 0x8D, 0x84, 0x24, 0xF8, 0x02, 0x00, 0x00, 0x64, 0xA3,
-	0x00, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x60, 0x02, 0x00, 0x00, 0x0F,
-	0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x5C, 0x02, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xC6, 0x84, 0x24, 0x4C, 0x02, 0x00, 0x00, 0x00, 0xC7, 0x84,
-	0x24, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24,
-	0x60, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x5C,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x4C, 0x01,
-	0x00, 0x00, 0x00, 0x6A, 0x01, 0xC6, 0x84, 0x24, 0x04, 0x03, 0x00, 0x00,
-	0x01, 0xFF, 0x15, 0x40, 0x71, 0x40, 0x00, 0x8B, 0x0D, 0xF8, 0x70, 0x40,
-	0x00, 0x83, 0xC4, 0x04, 0xBA, 0xCC, 0x72, 0x40, 0x00, 0xE8, 0x46, 0x35,
-	0x00, 0x00, 0x8B, 0x35, 0xF4, 0x70, 0x40, 0x00, 0x6A, 0x0A, 0x8B, 0x06,
-	0x8B, 0x48, 0x04, 0x03, 0xCE, 0xFF, 0x15, 0x4C, 0x70, 0x40, 0x00, 0x0F,
-	0xB6, 0xC0, 0x50, 0x8D, 0x94, 0x24, 0x50, 0x01, 0x00, 0x00, 0x8B, 0xCE,
-	0xE8, 0xEF, 0x38, 0x00, 0x00, 0x8B, 0xBC, 0x24, 0x64, 0x01, 0x00, 0x00,
-	0x8B, 0x9C, 0x24, 0x50, 0x01, 0x00, 0x00, 0x8B, 0x8C, 0x24, 0x60, 0x01,
-	0x00, 0x00, 0x83, 0xC4, 0x04, 0x83, 0xFF, 0x10, 0x8D, 0x94, 0x24, 0x4C,
-	0x01, 0x00, 0x00, 0x0F, 0x43, 0xD3, 0x03, 0xD1, 0x83, 0xFF, 0x10, 0x8D,
-	0x84, 0x24, 0x4C, 0x01, 0x00, 0x00, 0x0F, 0x43, 0xC3, 0x03, 0xC8, 0x83,
-	0xFF, 0x10, 0x8D, 0x84, 0x24, 0x4C, 0x01, 0x00, 0x00, 0x0F, 0x43, 0xC3,
-	0x3B, 0xC1, 0x74, 0x35, 0x80, 0x38, 0x22, 0x74, 0x07, 0x40, 0x3B, 0xC1,
-	0x75, 0xF6, 0xEB, 0x29, 0x3B, 0xC1, 0x74, 0x25, 0x8D, 0x70, 0x01, 0x3B,
-	0xF1, 0x74, 0x1E, 0x90, 0x8A, 0x1E, 0x80, 0xFB, 0x22, 0x74, 0x03, 0x88,
-	0x18, 0x40, 0x46, 0x3B, 0xF1, 0x75, 0xF1, 0x8B, 0xBC, 0x24, 0x60, 0x01,
-	0x00, 0x00, 0x8B, 0x9C, 0x24, 0x4C, 0x01, 0x00, 0x00, 0x83, 0xFF, 0x10,
-	0x8D, 0xB4, 0x24, 0x4C, 0x01, 0x00, 0x00, 0x0F, 0x43, 0xF3, 0x85, 0xC0,
-	0x75, 0x04, 0x33, 0xC9, 0xEB, 0x04, 0x8B, 0xC8, 0x2B, 0xCE, 0x85, 0xD2,
-	0x74, 0x02, 0x2B, 0xD0, 0x52, 0x51, 0x8D, 0x8C, 0x24, 0x54, 0x01, 0x00,
-	0x00, 0xE8, 0x26, 0x29, 0x00, 0x00, 0x51, 0x8D, 0x4C, 0x24, 0x68, 0xE8,
-	0x5C, 0x1B, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x00, 0x03, 0x00, 0x00, 0x02,
-	0x83, 0xBC, 0x24, 0x60, 0x01, 0x00, 0x00, 0x10, 0x8D, 0x84, 0x24, 0x4C,
-	0x01, 0x00, 0x00, 0x0F, 0x43, 0x84, 0x24, 0x4C, 0x01, 0x00, 0x00, 0x83,
-	0xEC, 0x08, 0x8D, 0x4C, 0x24, 0x7C, 0x50, 0xE8, 0xB0, 0x31, 0x00, 0x00,
-	0x85, 0xC0, 0x8B, 0x44, 0x24, 0x64, 0x6A, 0x00, 0x8B, 0x40, 0x04, 0x8D,
-	0x4C, 0x24, 0x68, 0x75, 0x0C, 0x6A, 0x02, 0x03, 0xC8, 0xFF, 0x15, 0xA8,
-	0x70, 0x40, 0x00, 0xEB, 0x0A, 0x6A, 0x00, 0x03, 0xC8, 0xFF, 0x15, 0x6C,
-	0x70, 0x40, 0x00, 0x83, 0xBC, 0x24, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x8B,
-	0x1D, 0x48, 0x71, 0x40, 0x00, 0x0F, 0x84, 0x9A, 0x08, 0x00, 0x00, 0x6A,
-	0x02, 0x6A, 0x00, 0x6A, 0x00, 0x8D, 0x4C, 0x24, 0x70, 0xFF, 0x15, 0x90,
-	0x70, 0x40, 0x00, 0x8D, 0x84, 0x24, 0x34, 0x02, 0x00, 0x00, 0x50, 0x8D,
-	0x4C, 0x24, 0x68, 0xFF, 0x15, 0x8C, 0x70, 0x40, 0x00, 0x8B, 0x58, 0x08,
-	0x03, 0x18, 0x8B, 0x70, 0x0C, 0x13, 0x70, 0x04, 0x6A, 0x00, 0x6A, 0x00,
-	0x6A, 0x00, 0x8D, 0x4C, 0x24, 0x70, 0x89, 0x5C, 0x24, 0x50, 0x89, 0x74,
-	0x24, 0x54, 0xFF, 0x15, 0x90, 0x70, 0x40, 0x00, 0xC7, 0x84, 0x24, 0xE8,
-	0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0xE4, 0x01,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x84, 0x24, 0xD4, 0x01, 0x00,
-	0x00, 0x00, 0xC7, 0x84, 0x24, 0x00, 0x02, 0x00, 0x00, 0x0F, 0x00, 0x00,
-	0x00, 0xC7, 0x84, 0x24, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xC6, 0x84, 0x24, 0xEC, 0x01, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x18,
-	0x02, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x14, 0x02,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x04, 0x02, 0x00,
-	0x00, 0x00, 0xC7, 0x84, 0x24, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xC7, 0x84, 0x24, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xC7, 0x84, 0x24, 0x24, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6,
-	0x84, 0x24, 0x00, 0x03, 0x00, 0x00, 0x03, 0x8B, 0x44, 0x24, 0x64, 0x8D,
-	0x4C, 0x24, 0x64, 0x8B, 0x40, 0x04, 0x6A, 0x0A, 0x03, 0xC8, 0xFF, 0x15,
-	0x4C, 0x70, 0x40, 0x00, 0x0F, 0xB6, 0xC0, 0x50, 0x8D, 0x94, 0x24, 0x50,
-	0x02, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x68, 0xE8, 0xE4, 0x36, 0x00, 0x00,
-	0x83, 0xC4, 0x04, 0x8B, 0x08, 0x8B, 0x49, 0x04, 0x03, 0xC8, 0xB8, 0x00,
-	0x00, 0x00, 0x00, 0xF6, 0x41, 0x0C, 0x06, 0x0F, 0x45, 0xC8, 0x85, 0xC9,
-	0x0F, 0x84, 0xA3, 0x08, 0x00, 0x00, 0x8D, 0x9B, 0x00, 0x00, 0x00, 0x00,
-	0x6A, 0x2C, 0x8D, 0x94, 0x24, 0x50, 0x02, 0x00, 0x00, 0x8D, 0x4C, 0x24,
-	0x50, 0xE8, 0xDE, 0xFB, 0xFF, 0xFF, 0x83, 0xC4, 0x04, 0xC6, 0x84, 0x24,
-	0x00, 0x03, 0x00, 0x00, 0x04, 0x8B, 0x4C, 0x24, 0x50, 0x8B, 0x74, 0x24,
-	0x4C, 0x2B, 0xCE, 0xB8, 0xAB, 0xAA, 0xAA, 0x2A, 0xF7, 0xE9, 0xC1, 0xFA,
-	0x02, 0x8B, 0xC2, 0xC1, 0xE8, 0x1F, 0x03, 0xC2, 0x0F, 0x84, 0xF4, 0x07,
-	0x00, 0x00, 0x6A, 0xFF, 0x6A, 0x00, 0x56, 0x8D, 0x8C, 0x24, 0x28, 0x01,
-	0x00, 0x00, 0xC7, 0x84, 0x24, 0x3C, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00,
-	0x00, 0xC7, 0x84, 0x24, 0x38, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xC6, 0x84, 0x24, 0x28, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x53, 0x26, 0x00,
-	0x00, 0xC6, 0x84, 0x24, 0x00, 0x03, 0x00, 0x00, 0x05, 0x83, 0xBC, 0x24,
-	0x30, 0x01, 0x00, 0x00, 0x10, 0x8B, 0x94, 0x24, 0x1C, 0x01, 0x00, 0x00,
-	0x8D, 0xB4, 0x24, 0x1C, 0x01, 0x00, 0x00, 0x0F, 0x43, 0xF2, 0x8D, 0x9C,
-	0x24, 0x1C, 0x01, 0x00, 0x00, 0x0F, 0x43, 0xDA, 0x03, 0xB4, 0x24, 0x2C,
-	0x01, 0x00, 0x00, 0x83, 0xBC, 0x24, 0x30, 0x01, 0x00, 0x00, 0x10, 0x8D,
-	0xBC, 0x24, 0x1C, 0x01, 0x00, 0x00, 0x0F, 0x43, 0xFA, 0x3B, 0xFE, 0x74,
-	0x27, 0x2B, 0xDF, 0xEB, 0x07, 0x8D, 0xA4, 0x24, 0x00, 0x00, 0x00, 0x00,
-	0x0F, 0xBE, 0x07, 0x50, 0xFF, 0x15, 0x28, 0x71, 0x40, 0x00, 0x88, 0x04,
-	0x3B, 0x47, 0x83, 0xC4, 0x04, 0x3B, 0xFE, 0x75, 0xEB, 0x8B, 0x94, 0x24,
-	0x1C, 0x01, 0x00, 0x00, 0x8B, 0xBC, 0x24, 0x30, 0x01, 0x00, 0x00, 0x8B,
-	0x9C, 0x24, 0x2C, 0x01, 0x00, 0x00, 0x83, 0xFF, 0x10, 0x8D, 0x8C, 0x24,
-	0x1C, 0x01, 0x00, 0x00, 0x0F, 0x43, 0xCA, 0xBA, 0x0A, 0x00, 0x00, 0x00,
-	0x3B, 0xDA, 0x0F, 0x42, 0xD3, 0x85, 0xD2, 0x74, 0x5B, 0xBE, 0xE0, 0x72,
-	0x40, 0x00, 0x83, 0xEA, 0x04, 0x72, 0x12, 0x90, 0x8B, 0x01, 0x3B, 0x06,
-	0x75, 0x10, 0x83, 0xC1, 0x04, 0x83, 0xC6, 0x04, 0x83, 0xEA, 0x04, 0x73,
-	0xEF, 0x83, 0xFA, 0xFC, 0x74, 0x34, 0x8A, 0x01, 0x3A, 0x06, 0x75, 0x27,
-	0x83, 0xFA, 0xFD, 0x74, 0x29, 0x8A, 0x41, 0x01, 0x3A, 0x46, 0x01, 0x75,
-	0x1A, 0x83, 0xFA, 0xFE, 0x74, 0x1C, 0x8A, 0x41, 0x02, 0x3A, 0x46, 0x02,
-	0x75, 0x0D, 0x83, 0xFA, 0xFF, 0x74, 0x0F, 0x8A, 0x41, 0x03, 0x3A, 0x46,
-	0x03, 0x74, 0x07, 0x1B, 0xC0, 0x83, 0xC8, 0x01, 0xEB, 0x02, 0x33, 0xC0,
-	0x85, 0xC0, 0x75, 0x14, 0x83, 0xFB, 0x0A, 0x73, 0x05, 0x83, 0xC8, 0xFF,
-	0xEB, 0x08, 0x33, 0xC0, 0x83, 0xFB, 0x0A, 0x0F, 0x95, 0xC0, 0x85, 0xC0,
-	0x0F, 0x94, 0xC0, 0x84, 0xC0, 0x0F, 0x85, 0xBE, 0x06, 0x00, 0x00, 0x8B,
-	0x4C, 0x24, 0x50, 0x8B, 0x74, 0x24, 0x4C, 0x2B, 0xCE, 0xB8, 0xAB, 0xAA,
-	0xAA, 0x2A, 0xF7, 0xE9, 0xC1, 0xFA, 0x02, 0x8B, 0xC2, 0xC1, 0xE8, 0x1F,
-	0x03, 0xC2, 0x83, 0xF8, 0x01, 0x0F, 0x86, 0x8F, 0x06, 0x00, 0x00, 0x8D,
-	0x4E, 0x18, 0xE8, 0xC5, 0xFA, 0xFF, 0xFF, 0x6A, 0xFF, 0x6A, 0x00, 0x50,
-	0x8D, 0x8C, 0x24, 0x40, 0x01, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x54, 0x01,
-	0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x50, 0x01, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x40, 0x01, 0x00, 0x00,
-	0x00, 0xE8, 0xE6, 0x24, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x00, 0x03, 0x00,
-	0x00, 0x06, 0x83, 0xBC, 0x24, 0x30, 0x01, 0x00, 0x00, 0x10, 0x8B, 0xBC,
-	0x24, 0x2C, 0x01, 0x00, 0x00, 0x8D, 0x8C, 0x24, 0x1C, 0x01, 0x00, 0x00,
-	0x0F, 0x43, 0x8C, 0x24, 0x1C, 0x01, 0x00, 0x00, 0xBA, 0x09, 0x00, 0x00,
-	0x00, 0x3B, 0xFA, 0x0F, 0x42, 0xD7, 0x85, 0xD2, 0x74, 0x5A, 0xBE, 0xEC,
-	0x72, 0x40, 0x00, 0x83, 0xEA, 0x04, 0x72, 0x11, 0x8B, 0x01, 0x3B, 0x06,
-	0x75, 0x10, 0x83, 0xC1, 0x04, 0x83, 0xC6, 0x04, 0x83, 0xEA, 0x04, 0x73,
-	0xEF, 0x83, 0xFA, 0xFC, 0x74, 0x34, 0x8A, 0x01, 0x3A, 0x06, 0x75, 0x27,
-	0x83, 0xFA, 0xFD, 0x74, 0x29, 0x8A, 0x41, 0x01, 0x3A, 0x46, 0x01, 0x75,
-	0x1A, 0x83, 0xFA, 0xFE, 0x74, 0x1C, 0x8A, 0x41, 0x02, 0x3A, 0x46, 0x02,
-	0x75, 0x0D, 0x83, 0xFA, 0xFF, 0x74, 0x0F, 0x8A, 0x41, 0x03, 0x3A, 0x46,
-	0x03, 0x74, 0x07, 0x1B, 0xC0, 0x83, 0xC8, 0x01, 0xEB, 0x02, 0x33, 0xC0,
-	0x85, 0xC0, 0x75, 0x14, 0x83, 0xFF, 0x09, 0x73, 0x05, 0x83, 0xC8, 0xFF,
-	0xEB, 0x08, 0x33, 0xC0, 0x83, 0xFF, 0x09, 0x0F, 0x95, 0xC0, 0x85, 0xC0,
-	0x0F, 0x94, 0xC0, 0x84, 0xC0, 0x0F, 0x84, 0x9E, 0x00, 0x00, 0x00, 0x8B,
-	0x94, 0x24, 0x48, 0x01, 0x00, 0x00, 0x8B, 0x8C, 0x24, 0x34, 0x01, 0x00,
-	0x00, 0x8B, 0xB4, 0x24, 0x44, 0x01, 0x00, 0x00, 0x83, 0xFA, 0x10, 0x8D,
-	0x84, 0x24, 0x34, 0x01, 0x00, 0x00, 0x0F, 0x43, 0xC1, 0x8D, 0x9C, 0x24,
-	0x34, 0x01, 0x00, 0x00, 0x0F, 0x43, 0xD9, 0x03, 0xF0, 0x83, 0xFA, 0x10,
-	0x8D, 0xBC, 0x24, 0x34, 0x01, 0x00, 0x00, 0x0F, 0x43, 0xF9, 0x3B, 0xFE,
-	0x74, 0x1F, 0x2B, 0xDF, 0xEB, 0x06, 0x8D, 0x9B, 0x00, 0x00, 0x00, 0x00,
-	0x0F, 0xBE, 0x07, 0x50, 0xFF, 0x15, 0x54, 0x71, 0x40, 0x00, 0x88, 0x04,
-	0x3B, 0x47, 0x83, 0xC4, 0x04, 0x3B, 0xFE, 0x75, 0xEB, 0x6A, 0x08, 0x68,
-	0xF8, 0x72, 0x40, 0x00, 0xFF, 0xB4, 0x24, 0x4C, 0x01, 0x00, 0x00, 0x51,
-	0x8D, 0x8C, 0x24, 0x44, 0x01, 0x00, 0x00, 0xE8, 0x40, 0x25, 0x00, 0x00,
-	0x85, 0xC0, 0x0F, 0x84, 0xE2, 0x03, 0x00, 0x00, 0x6A, 0xFF, 0x6A, 0x00,
-	0x8D, 0x84, 0x24, 0x3C, 0x01, 0x00, 0x00, 0x50, 0x8D, 0x8C, 0x24, 0xE0,
-	0x01, 0x00, 0x00, 0xE8, 0xA0, 0x23, 0x00, 0x00, 0xE9, 0xCA, 0x02, 0x00,
-	0x00, 0x6A, 0x07, 0x68, 0x04, 0x73, 0x40, 0x00, 0x57, 0x51, 0x8D, 0x8C,
-	0x24, 0x2C, 0x01, 0x00, 0x00, 0xE8, 0x06, 0x25, 0x00, 0x00, 0x85, 0xC0,
-	0x75, 0x1C, 0x6A, 0xFF, 0x50, 0x8D, 0x84, 0x24, 0x3C, 0x01, 0x00, 0x00,
-	0x50, 0x8D, 0x8C, 0x24, 0xF8, 0x01, 0x00, 0x00, 0xE8, 0x6B, 0x23, 0x00,
-	0x00, 0xE9, 0x95, 0x02, 0x00, 0x00, 0x6A, 0x09, 0x68, 0x0C, 0x73, 0x40,
-	0x00, 0xFF, 0xB4, 0x24, 0x34, 0x01, 0x00, 0x00, 0x51, 0x8D, 0x8C, 0x24,
-	0x2C, 0x01, 0x00, 0x00, 0xE8, 0xCB, 0x24, 0x00, 0x00, 0x85, 0xC0, 0x75,
-	0x1C, 0x6A, 0xFF, 0x50, 0x8D, 0x84, 0x24, 0x3C, 0x01, 0x00, 0x00, 0x50,
-	0x8D, 0x8C, 0x24, 0x10, 0x02, 0x00, 0x00, 0xE8, 0x30, 0x23, 0x00, 0x00,
-	0xE9, 0x5A, 0x02, 0x00, 0x00, 0x6A, 0x0B, 0x68, 0x18, 0x73, 0x40, 0x00,
-	0xFF, 0xB4, 0x24, 0x34, 0x01, 0x00, 0x00, 0x51, 0x8D, 0x8C, 0x24, 0x2C,
-	0x01, 0x00, 0x00, 0xE8, 0x90, 0x24, 0x00, 0x00, 0x85, 0xC0, 0x75, 0x2D,
-	0x83, 0xBC, 0x24, 0x48, 0x01, 0x00, 0x00, 0x10, 0x8D, 0x84, 0x24, 0x34,
-	0x01, 0x00, 0x00, 0x0F, 0x43, 0x84, 0x24, 0x34, 0x01, 0x00, 0x00, 0x50,
-	0xFF, 0x15, 0x1C, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0x89, 0x84, 0x24,
-	0x28, 0x02, 0x00, 0x00, 0xE9, 0x0E, 0x02, 0x00, 0x00, 0x6A, 0x0D, 0x68,
-	0x24, 0x73, 0x40, 0x00, 0xFF, 0xB4, 0x24, 0x34, 0x01, 0x00, 0x00, 0x51,
-	0x8D, 0x8C, 0x24, 0x2C, 0x01, 0x00, 0x00, 0xE8, 0x44, 0x24, 0x00, 0x00,
-	0x85, 0xC0, 0x75, 0x2D, 0x83, 0xBC, 0x24, 0x48, 0x01, 0x00, 0x00, 0x10,
-	0x8D, 0x84, 0x24, 0x34, 0x01, 0x00, 0x00, 0x0F, 0x43, 0x84, 0x24, 0x34,
-	0x01, 0x00, 0x00, 0x50, 0xFF, 0x15, 0x58, 0x71, 0x40, 0x00, 0xDD, 0x9C,
-	0x24, 0x30, 0x02, 0x00, 0x00, 0x83, 0xC4, 0x04, 0xE9, 0xC2, 0x01, 0x00,
-	0x00, 0x83, 0xEC, 0x08, 0x8D, 0x84, 0x24, 0x3C, 0x02, 0x00, 0x00, 0x50,
-	0x8D, 0x8C, 0x24, 0x28, 0x01, 0x00, 0x00, 0xE8, 0x7C, 0x0D, 0x00, 0x00,
-	0x6A, 0x02, 0x68, 0x34, 0x73, 0x40, 0x00, 0xC6, 0x84, 0x24, 0x08, 0x03,
-	0x00, 0x00, 0x07, 0xFF, 0x70, 0x10, 0x51, 0x8B, 0xC8, 0xE8, 0xE2, 0x23,
-	0x00, 0x00, 0x85, 0xC0, 0x0F, 0x94, 0xC3, 0x83, 0xBC, 0x24, 0x48, 0x02,
-	0x00, 0x00, 0x10, 0x72, 0x12, 0xFF, 0xB4, 0x24, 0x34, 0x02, 0x00, 0x00,
-	0x8B, 0x3D, 0x48, 0x71, 0x40, 0x00, 0xFF, 0xD7, 0x83, 0xC4, 0x04, 0x84,
-	0xDB, 0x0F, 0x84, 0x68, 0x01, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x78, 0x02,
-	0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x74, 0x02, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x64, 0x02, 0x00, 0x00,
-	0x00, 0xC7, 0x84, 0x24, 0xB0, 0x02, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-	0xC7, 0x84, 0x24, 0xAC, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6,
-	0x84, 0x24, 0x9C, 0x02, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0x6A, 0x00, 0x8D,
-	0x84, 0x24, 0x24, 0x01, 0x00, 0x00, 0x50, 0x8D, 0x8C, 0x24, 0x70, 0x02,
-	0x00, 0x00, 0xC6, 0x84, 0x24, 0x0C, 0x03, 0x00, 0x00, 0x08, 0xE8, 0xDD,
-	0x21, 0x00, 0x00, 0x6A, 0x02, 0x8D, 0x4C, 0x24, 0x50, 0xE8, 0xB2, 0x14,
-	0x00, 0x00, 0x83, 0x78, 0x14, 0x10, 0x72, 0x02, 0x8B, 0x00, 0x50, 0xFF,
-	0x15, 0x58, 0x71, 0x40, 0x00, 0xDD, 0x9C, 0x24, 0x80, 0x02, 0x00, 0x00,
-	0x83, 0xC4, 0x04, 0x8D, 0x4C, 0x24, 0x4C, 0x6A, 0x05, 0xE8, 0x8E, 0x14,
-	0x00, 0x00, 0x83, 0x78, 0x14, 0x10, 0x72, 0x02, 0x8B, 0x00, 0x50, 0xFF,
-	0x15, 0x58, 0x71, 0x40, 0x00, 0xDD, 0x9C, 0x24, 0x88, 0x02, 0x00, 0x00,
-	0x83, 0xC4, 0x04, 0x8D, 0x4C, 0x24, 0x4C, 0x6A, 0x08, 0xE8, 0x6A, 0x14,
-	0x00, 0x00, 0x83, 0x78, 0x14, 0x10, 0x72, 0x02, 0x8B, 0x00, 0x50, 0xFF,
-	0x15, 0x58, 0x71, 0x40, 0x00, 0xDD, 0x9C, 0x24, 0x90, 0x02, 0x00, 0x00,
-	0x83, 0xC4, 0x04, 0x8D, 0x4C, 0x24, 0x4C, 0x6A, 0x0B, 0xE8, 0x46, 0x14,
-	0x00, 0x00, 0x83, 0x78, 0x14, 0x10, 0x72, 0x02, 0x8B, 0x00, 0x50, 0xFF,
-	0x15, 0x58, 0x71, 0x40, 0x00, 0xDD, 0x9C, 0x24, 0x98, 0x02, 0x00, 0x00,
-	0x83, 0xC4, 0x04, 0x8D, 0x4C, 0x24, 0x4C, 0x6A, 0x2F, 0x6A, 0x03, 0xE8,
-	0x20, 0x14, 0x00, 0x00, 0x8B, 0xD0, 0x8D, 0x8C, 0x24, 0x68, 0x01, 0x00,
-	0x00, 0xE8, 0x62, 0xF6, 0xFF, 0xFF, 0x83, 0xC4, 0x04, 0x6A, 0x00, 0x8D,
-	0x8C, 0x24, 0x68, 0x01, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x04, 0x03, 0x00,
-	0x00, 0x09, 0xE8, 0xF9, 0x13, 0x00, 0x00, 0x8B, 0xC8, 0xE8, 0xC2, 0xF6,
-	0xFF, 0xFF, 0x8D, 0x8C, 0x24, 0x9C, 0x02, 0x00, 0x00, 0x3B, 0xC8, 0x74,
-	0x0A, 0x6A, 0xFF, 0x6A, 0x00, 0x50, 0xE8, 0xFD, 0x20, 0x00, 0x00, 0x8D,
-	0x84, 0x24, 0x64, 0x02, 0x00, 0x00, 0x50, 0x8D, 0x8C, 0x24, 0x20, 0x02,
-	0x00, 0x00, 0xE8, 0x29, 0x0C, 0x00, 0x00, 0x8D, 0x8C, 0x24, 0x64, 0x01,
-	0x00, 0x00, 0xE8, 0x7D, 0x13, 0x00, 0x00, 0x8D, 0x8C, 0x24, 0x64, 0x02,
-	0x00, 0x00, 0xE8, 0x41, 0x0A, 0x00, 0x00, 0x83, 0xBC, 0x24, 0x48, 0x01,
-	0x00, 0x00, 0x10, 0x8B, 0x1D, 0x48, 0x71, 0x40, 0x00, 0x72, 0x0C, 0xFF,
-	0xB4, 0x24, 0x34, 0x01, 0x00, 0x00, 0xFF, 0xD3, 0x83, 0xC4, 0x04, 0x83,
-	0xBC, 0x24, 0x30, 0x01, 0x00, 0x00, 0x10, 0x72, 0x0C, 0xFF, 0xB4, 0x24,
-	0x1C, 0x01, 0x00, 0x00, 0xFF, 0xD3, 0x83, 0xC4, 0x04, 0xC6, 0x84, 0x24,
-	0x00, 0x03, 0x00, 0x00, 0x03, 0x8B, 0x74, 0x24, 0x4C, 0xC7, 0x84, 0x24,
-	0x30, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x2C,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x1C, 0x01,
-	0x00, 0x00, 0x00, 0x85, 0xF6, 0x74, 0x4F, 0x8B, 0x7C, 0x24, 0x50, 0x3B,
-	0xF7, 0x74, 0x29, 0x83, 0x7E, 0x14, 0x10, 0x72, 0x07, 0xFF, 0x36, 0xFF,
-	0xD3, 0x83, 0xC4, 0x04, 0xC7, 0x46, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xC7,
-	0x46, 0x10, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x06, 0x00, 0x83, 0xC6, 0x18,
-	0x3B, 0xF7, 0x75, 0xDB, 0x8B, 0x74, 0x24, 0x4C, 0x56, 0xFF, 0xD3, 0x83,
-	0xC4, 0x04, 0xC7, 0x44, 0x24, 0x4C, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x44,
-	0x24, 0x50, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x44, 0x24, 0x54, 0x00, 0x00,
-	0x00, 0x00, 0x8B, 0x44, 0x24, 0x64, 0x8D, 0x4C, 0x24, 0x64, 0x8B, 0x40,
-	0x04, 0x6A, 0x0A, 0x03, 0xC8, 0xFF, 0x15, 0x4C, 0x70, 0x40, 0x00, 0x0F,
-	0xB6, 0xC0, 0x50, 0x8D, 0x94, 0x24, 0x50, 0x02, 0x00, 0x00, 0x8D, 0x4C,
-	0x24, 0x68, 0xE8, 0xF9, 0x2F, 0x00, 0x00, 0x83, 0xC4, 0x04, 0x8B, 0x08,
-	0x8B, 0x49, 0x04, 0x03, 0xC8, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x41,
-	0x0C, 0x06, 0x0F, 0x45, 0xC8, 0x85, 0xC9, 0x0F, 0x85, 0x1B, 0xF9, 0xFF,
-	0xFF, 0xE9, 0xAB, 0x01, 0x00, 0x00, 0x83, 0xBC, 0x24, 0x48, 0x01, 0x00,
-	0x00, 0x10, 0x8B, 0x3D, 0x48, 0x71, 0x40, 0x00, 0x72, 0x0C, 0xFF, 0xB4,
-	0x24, 0x34, 0x01, 0x00, 0x00, 0xFF, 0xD7, 0x83, 0xC4, 0x04, 0x83, 0xBC,
-	0x24, 0x30, 0x01, 0x00, 0x00, 0x10, 0xC7, 0x84, 0x24, 0x48, 0x01, 0x00,
-	0x00, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x44, 0x01, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x34, 0x01, 0x00, 0x00, 0x00,
-	0x72, 0x0C, 0xFF, 0xB4, 0x24, 0x1C, 0x01, 0x00, 0x00, 0xFF, 0xD7, 0x83,
-	0xC4, 0x04, 0x8B, 0x44, 0x24, 0x4C, 0xC7, 0x84, 0x24, 0x30, 0x01, 0x00,
-	0x00, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x2C, 0x01, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x1C, 0x01, 0x00, 0x00, 0x00,
-	0x85, 0xC0, 0x74, 0x13, 0xFF, 0x74, 0x24, 0x50, 0x50, 0xE8, 0x06, 0x28,
-	0x00, 0x00, 0xFF, 0x74, 0x24, 0x4C, 0xFF, 0xD7, 0x83, 0xC4, 0x04, 0x8B,
-	0x1D, 0x48, 0x71, 0x40, 0x00, 0x8D, 0x8C, 0x24, 0xD4, 0x01, 0x00, 0x00,
-	0xE8, 0xFB, 0x07, 0x00, 0x00, 0x8B, 0x44, 0x24, 0x64, 0x8B, 0x40, 0x04,
-	0xC7, 0x44, 0x04, 0x64, 0xB0, 0x74, 0x40, 0x00, 0x8B, 0x44, 0x24, 0x64,
-	0x8B, 0x48, 0x04, 0x8D, 0x41, 0x90, 0x89, 0x44, 0x0C, 0x60, 0x8D, 0x4C,
-	0x24, 0x74, 0xE8, 0x85, 0x13, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x7C, 0xFF,
-	0x15, 0x9C, 0x70, 0x40, 0x00, 0x8D, 0x8C, 0x24, 0xD4, 0x00, 0x00, 0x00,
-	0xFF, 0x15, 0xB0, 0x70, 0x40, 0x00, 0x83, 0xBC, 0x24, 0x60, 0x01, 0x00,
-	0x00, 0x10, 0x72, 0x0C, 0xFF, 0xB4, 0x24, 0x4C, 0x01, 0x00, 0x00, 0xFF,
-	0xD3, 0x83, 0xC4, 0x04, 0x83, 0xBC, 0x24, 0x60, 0x02, 0x00, 0x00, 0x10,
-	0xC7, 0x84, 0x24, 0x60, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC7,
-	0x84, 0x24, 0x5C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x84,
-	0x24, 0x4C, 0x01, 0x00, 0x00, 0x00, 0x72, 0x0C, 0xFF, 0xB4, 0x24, 0x4C,
-	0x02, 0x00, 0x00, 0xFF, 0xD3, 0x83, 0xC4, 0x04, 0x33, 0xC0, 0x8B, 0x8C,
-	0x24, 0xF8, 0x02, 0x00, 0x00, 0x64, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00,
-	0x59, 0x5F, 0x5E, 0x5B, 0x8B, 0x8C, 0x24, 0xB0, 0x02, 0x00, 0x00, 0x33,
+	0x00, 0x5F, 0x8B, 0xC3, 0x5B, 0xC3, 0x2B, 0xF8, 0x10, 0x00, 0x14, 0xA7,
+	0x10, 0x00, 0x01, 0x10, 0x01, 0x87, 0x83, 0xE4, 0xC0, 0x6A, 0xFF, 0x68,
+	0x44, 0x62, 0x33, 0x03, 0x24, 0xE8, 0x02, 0x33, 0x03, 0xB3, 0xC4, 0x89,
+	0x84, 0x24, 0xB0, 0x02, 0x00, 0x00, 0x53, 0x56, 0x57, 0x11, 0x00, 0x82,
+	0x50, 0x8D, 0x84, 0x24, 0xF8, 0x02, 0x00, 0x00, 0x2A, 0x01, 0x71, 0xC7,
+	0x84, 0x24, 0x60, 0x02, 0x00, 0x00, 0x5E, 0x02, 0x30, 0x84, 0x24, 0x5C,
+	0xCE, 0x07, 0x00, 0x2C, 0x03, 0x30, 0x84, 0x24, 0x4C, 0x0B, 0x00, 0x52,
+	0xC7, 0x84, 0x24, 0x00, 0x03, 0x13, 0x00, 0x00, 0x29, 0x00, 0x16, 0x01,
+	0x29, 0x00, 0x00, 0x30, 0x01, 0x03, 0x29, 0x00, 0x00, 0x0B, 0x00, 0xD0,
+	0x6A, 0x01, 0xC6, 0x84, 0x24, 0x04, 0x03, 0x00, 0x00, 0x01, 0xFF, 0x15,
+	0x40, 0x92, 0x04, 0x31, 0x0D, 0xF8, 0x70, 0xF3, 0x00, 0xF0, 0x26, 0xBA,
+	0xCC, 0x72, 0x40, 0x00, 0xE8, 0x46, 0x35, 0x00, 0x00, 0x8B, 0x35, 0xF4,
+	0x70, 0x40, 0x00, 0x6A, 0x0A, 0x8B, 0x06, 0x8B, 0x48, 0x04, 0x03, 0xCE,
+	0xFF, 0x15, 0x4C, 0x70, 0x40, 0x00, 0x0F, 0xB6, 0xC0, 0x50, 0x8D, 0x94,
+	0x24, 0x50, 0x01, 0x00, 0x00, 0x8B, 0xCE, 0xE8, 0xEF, 0x38, 0x00, 0x00,
+	0x8B, 0xBC, 0x24, 0x64, 0x0E, 0x00, 0x12, 0x9C, 0x15, 0x00, 0x11, 0x8C,
+	0x76, 0x00, 0x81, 0x83, 0xC4, 0x04, 0x83, 0xFF, 0x10, 0x8D, 0x94, 0x6D,
+	0x00, 0x50, 0x0F, 0x43, 0xD3, 0x03, 0xD1, 0x0F, 0x00, 0x02, 0x7C, 0x00,
+	0x59, 0x0F, 0x43, 0xC3, 0x03, 0xC8, 0x0F, 0x00, 0xF1, 0x1E, 0x3B, 0xC1,
+	0x74, 0x35, 0x80, 0x38, 0x22, 0x74, 0x07, 0x40, 0x3B, 0xC1, 0x75, 0xF6,
+	0xEB, 0x29, 0x3B, 0xC1, 0x74, 0x25, 0x8D, 0x70, 0x01, 0x3B, 0xF1, 0x74,
+	0x1E, 0x90, 0x8A, 0x1E, 0x80, 0xFB, 0x22, 0x74, 0x03, 0x88, 0x18, 0x40,
+	0x46, 0x3B, 0xF1, 0x75, 0xF1, 0x8B, 0xBC, 0x60, 0x00, 0x21, 0x8B, 0x9C,
+	0x3C, 0x00, 0x00, 0x46, 0x00, 0x13, 0xB4, 0x46, 0x00, 0x17, 0xF3, 0x8A,
+	0x01, 0xF1, 0x0E, 0xCE, 0x85, 0xD2, 0x74, 0x02, 0x2B, 0xD0, 0x52, 0x51,
+	0x8D, 0x8C, 0x24, 0x54, 0x01, 0x00, 0x00, 0xE8, 0x26, 0x29, 0x00, 0x00,
+	0x51, 0x8D, 0x4C, 0x24, 0x68, 0xE8, 0x5C, 0x1B, 0x05, 0x01, 0x00, 0x26,
+	0x01, 0x22, 0x02, 0x83, 0x4D, 0x00, 0x06, 0x8A, 0x00, 0x02, 0x08, 0x00,
+	0x00, 0x0E, 0x07, 0xF0, 0x02, 0x4C, 0x24, 0x7C, 0x50, 0xE8, 0xB0, 0x31,
+	0x00, 0x00, 0x85, 0xC0, 0x8B, 0x44, 0x24, 0x64, 0x6A, 0x00, 0x05, 0x03,
+	0xF0, 0x04, 0x4C, 0x24, 0x68, 0x75, 0x0C, 0x6A, 0x02, 0x03, 0xC8, 0xFF,
+	0x15, 0xA8, 0x70, 0x40, 0x00, 0xEB, 0x0A, 0x6A, 0x00, 0x0C, 0x00, 0x10,
+	0x6C, 0x3A, 0x01, 0x31, 0xBC, 0x24, 0xC4, 0xC9, 0x02, 0x10, 0x1D, 0xA2,
+	0x03, 0xF0, 0x04, 0x0F, 0x84, 0x9A, 0x08, 0x00, 0x00, 0x6A, 0x02, 0x6A,
+	0x00, 0x6A, 0x00, 0x8D, 0x4C, 0x24, 0x70, 0xFF, 0x15, 0x90, 0x77, 0x03,
+	0x70, 0x84, 0x24, 0x34, 0x02, 0x00, 0x00, 0x50, 0x48, 0x00, 0x30, 0xFF,
+	0x15, 0x8C, 0x2E, 0x03, 0xA0, 0x58, 0x08, 0x03, 0x18, 0x8B, 0x70, 0x0C,
+	0x13, 0x70, 0x04, 0x2B, 0x00, 0x02, 0x2D, 0x00, 0x82, 0x89, 0x5C, 0x24,
+	0x50, 0x89, 0x74, 0x24, 0x54, 0x35, 0x00, 0x46, 0xC7, 0x84, 0x24, 0xE8,
+	0xC7, 0x01, 0x16, 0xE4, 0xC7, 0x01, 0x10, 0xD4, 0x0B, 0x00, 0x00, 0xF0,
+	0x01, 0x06, 0x0E, 0x02, 0x16, 0xFC, 0x1E, 0x00, 0x13, 0xEC, 0x1E, 0x00,
+	0x16, 0x18, 0x1E, 0x00, 0x16, 0x14, 0x2C, 0x02, 0x13, 0x04, 0x2C, 0x02,
+	0x13, 0x1C, 0x13, 0x00, 0x46, 0xC7, 0x84, 0x24, 0x20, 0x0B, 0x00, 0x16,
+	0x24, 0x29, 0x00, 0x00, 0x27, 0x01, 0x10, 0x03, 0x01, 0x01, 0x90, 0x8D,
+	0x4C, 0x24, 0x64, 0x8B, 0x40, 0x04, 0x6A, 0x0A, 0xF1, 0x00, 0x08, 0x09,
+	0x02, 0x20, 0x02, 0x00, 0xB5, 0x00, 0x41, 0x68, 0xE8, 0xE4, 0x36, 0xF6,
+	0x01, 0x81, 0x8B, 0x08, 0x8B, 0x49, 0x04, 0x03, 0xC8, 0xB8, 0xC6, 0x04,
+	0x10, 0x41, 0xC6, 0x04, 0xB0, 0xC8, 0x85, 0xC9, 0x0F, 0x84, 0xA3, 0x08,
+	0x00, 0x00, 0x8D, 0x9B, 0x15, 0x00, 0x26, 0x6A, 0x2C, 0x36, 0x00, 0x41,
+	0x50, 0xE8, 0xDE, 0xFB, 0xC1, 0x03, 0x03, 0x6A, 0x00, 0xB7, 0x04, 0x8B,
+	0x4C, 0x24, 0x50, 0x8B, 0x74, 0x24, 0x4C, 0x2B, 0xCE, 0xB1, 0x05, 0xC0,
+	0xC2, 0xC1, 0xE8, 0x1F, 0x03, 0xC2, 0x0F, 0x84, 0xF4, 0x07, 0x00, 0x00,
+	0x5F, 0x05, 0x61, 0x56, 0x8D, 0x8C, 0x24, 0x28, 0x01, 0xAA, 0x00, 0x16,
+	0x3C, 0x1A, 0x01, 0x16, 0x38, 0xFC, 0x00, 0x00, 0x1D, 0x00, 0x45, 0x00,
+	0xE8, 0x53, 0x26, 0xC2, 0x00, 0x50, 0x05, 0x83, 0xBC, 0x24, 0x30, 0xE9,
+	0x01, 0x91, 0x8B, 0x94, 0x24, 0x1C, 0x01, 0x00, 0x00, 0x8D, 0xB4, 0x07,
+	0x00, 0x53, 0x0F, 0x43, 0xF2, 0x8D, 0x9C, 0x0A, 0x00, 0x50, 0xDA, 0x03,
+	0xB4, 0x24, 0x2C, 0xFC, 0x01, 0x03, 0x2A, 0x00, 0x23, 0x8D, 0xBC, 0x19,
+	0x00, 0x7B, 0xFA, 0x3B, 0xFE, 0x74, 0x27, 0x2B, 0xDF, 0x20, 0x04, 0xF3,
+	0x00, 0x28, 0x71, 0x40, 0x00, 0x88, 0x04, 0x3B, 0x47, 0x83, 0xC4, 0x04,
+	0x3B, 0xFE, 0x75, 0xEB, 0x58, 0x00, 0x12, 0x8B, 0x3D, 0x00, 0x22, 0x8B,
+	0x9C, 0x4B, 0x00, 0x43, 0xFF, 0x10, 0x8D, 0x8C, 0x46, 0x00, 0xFF, 0x7A,
+	0xCA, 0xBA, 0x0A, 0x00, 0x00, 0x00, 0x3B, 0xDA, 0x0F, 0x42, 0xD3, 0x85,
+	0xD2, 0x74, 0x5B, 0xBE, 0xE0, 0x72, 0x40, 0x00, 0x83, 0xEA, 0x04, 0x72,
+	0x12, 0x90, 0x8B, 0x01, 0x3B, 0x06, 0x75, 0x10, 0x83, 0xC1, 0x04, 0x83,
+	0xC6, 0x04, 0x83, 0xEA, 0x04, 0x73, 0xEF, 0x83, 0xFA, 0xFC, 0x74, 0x34,
+	0x8A, 0x01, 0x3A, 0x06, 0x75, 0x27, 0x83, 0xFA, 0xFD, 0x74, 0x29, 0x8A,
+	0x41, 0x01, 0x3A, 0x46, 0x01, 0x75, 0x1A, 0x83, 0xFA, 0xFE, 0x74, 0x1C,
+	0x8A, 0x41, 0x02, 0x3A, 0x46, 0x02, 0x75, 0x0D, 0x83, 0xFA, 0xFF, 0x74,
+	0x0F, 0x8A, 0x41, 0x03, 0x3A, 0x46, 0x03, 0x74, 0x07, 0x1B, 0xC0, 0x83,
+	0xC8, 0x01, 0xEB, 0x02, 0x33, 0xC0, 0x85, 0xC0, 0x75, 0x14, 0x83, 0xFB,
+	0x0A, 0x73, 0x05, 0x83, 0xC8, 0xFF, 0xEB, 0x08, 0x33, 0xC0, 0x83, 0xFB,
+	0x0A, 0x0F, 0x95, 0xC0, 0x85, 0xC0, 0x0F, 0x94, 0xC0, 0x84, 0xC0, 0x0F,
+	0x85, 0xBE, 0x06, 0x00, 0x00, 0x62, 0x01, 0x08, 0x70, 0x83, 0xF8, 0x01,
+	0x0F, 0x86, 0x8F, 0x06, 0xCD, 0x05, 0x60, 0x18, 0xE8, 0xC5, 0xFA, 0xFF,
+	0xFF, 0x6D, 0x01, 0x52, 0x50, 0x8D, 0x8C, 0x24, 0x40, 0x6D, 0x01, 0x00,
+	0x49, 0x03, 0x03, 0x6D, 0x01, 0x00, 0xEA, 0x03, 0x03, 0x6D, 0x01, 0x00,
+	0x1D, 0x00, 0x45, 0x00, 0xE8, 0xE6, 0x24, 0x6D, 0x01, 0x15, 0x06, 0x6D,
+	0x01, 0x11, 0xBC, 0x07, 0x01, 0x05, 0x04, 0x01, 0x02, 0x08, 0x00, 0x20,
+	0xBA, 0x09, 0x09, 0x01, 0xA3, 0xFA, 0x0F, 0x42, 0xD7, 0x85, 0xD2, 0x74,
+	0x5A, 0xBE, 0xEC, 0x09, 0x01, 0x1F, 0x11, 0x08, 0x01, 0x3E, 0x26, 0xFF,
+	0x09, 0x08, 0x01, 0x27, 0xFF, 0x09, 0x08, 0x01, 0x20, 0x84, 0x9E, 0xA8,
+	0x03, 0x32, 0x94, 0x24, 0x48, 0xAF, 0x04, 0x10, 0x34, 0x07, 0x00, 0x30,
+	0xB4, 0x24, 0x44, 0xB2, 0x01, 0x10, 0xFA, 0x0B, 0x04, 0x00, 0x11, 0x00,
+	0x53, 0x0F, 0x43, 0xC1, 0x8D, 0x9C, 0x0A, 0x00, 0x30, 0xD9, 0x03, 0xF0,
+	0x19, 0x00, 0x13, 0xBC, 0x0F, 0x00, 0x10, 0xF9, 0x2F, 0x06, 0x42, 0x2B,
+	0xDF, 0xEB, 0x06, 0xD0, 0x02, 0x02, 0x10, 0x02, 0x1A, 0x54, 0x10, 0x02,
+	0x82, 0x6A, 0x08, 0x68, 0xF8, 0x72, 0x40, 0x00, 0xFF, 0x9C, 0x04, 0x00,
+	0x86, 0x04, 0x00, 0x5F, 0x00, 0x30, 0xE8, 0x40, 0x25, 0x50, 0x04, 0x42,
+	0x0F, 0x84, 0xE2, 0x03, 0xCA, 0x02, 0x12, 0x8D, 0xC2, 0x02, 0x00, 0x64,
+	0x01, 0x10, 0xE0, 0x20, 0x00, 0xF0, 0x02, 0xA0, 0x23, 0x00, 0x00, 0xE9,
+	0xCA, 0x02, 0x00, 0x00, 0x6A, 0x07, 0x68, 0x04, 0x73, 0x40, 0x00, 0x57,
+	0x3A, 0x00, 0x00, 0x44, 0x01, 0x21, 0xE8, 0x06, 0x3A, 0x00, 0x40, 0x75,
+	0x1C, 0x6A, 0xFF, 0x0E, 0x06, 0x04, 0x35, 0x00, 0x10, 0xF8, 0x1B, 0x00,
+	0x10, 0x6B, 0x35, 0x00, 0x10, 0x95, 0x35, 0x00, 0x41, 0x09, 0x68, 0x0C,
+	0x73, 0x75, 0x00, 0x00, 0xA9, 0x00, 0x05, 0x3B, 0x00, 0x2F, 0xCB, 0x24,
+	0x3B, 0x00, 0x01, 0x60, 0x10, 0x02, 0x00, 0x00, 0xE8, 0x30, 0x3B, 0x00,
+	0x10, 0x5A, 0x3B, 0x00, 0x3F, 0x0B, 0x68, 0x18, 0x3B, 0x00, 0x00, 0x12,
+	0x90, 0x3B, 0x00, 0x31, 0x2D, 0x83, 0xBC, 0x2D, 0x01, 0x06, 0x1D, 0x01,
+	0x02, 0x08, 0x00, 0x42, 0x50, 0xFF, 0x15, 0x1C, 0x28, 0x07, 0x90, 0x89,
+	0x84, 0x24, 0x28, 0x02, 0x00, 0x00, 0xE9, 0x0E, 0x4C, 0x00, 0x3F, 0x0D,
+	0x68, 0x24, 0x4C, 0x00, 0x00, 0x1F, 0x44, 0x4C, 0x00, 0x0E, 0x91, 0x58,
+	0x71, 0x40, 0x00, 0xDD, 0x9C, 0x24, 0x30, 0x02, 0x49, 0x04, 0x23, 0xE9,
+	0xC2, 0x8A, 0x05, 0x31, 0x84, 0x24, 0x3C, 0x35, 0x05, 0x02, 0xF5, 0x03,
+	0x30, 0xE8, 0x7C, 0x0D, 0x59, 0x05, 0x40, 0x68, 0x34, 0x73, 0x40, 0x71,
+	0x02, 0xE1, 0x08, 0x03, 0x00, 0x00, 0x07, 0xFF, 0x70, 0x10, 0x51, 0x8B,
+	0xC8, 0xE8, 0xE2, 0x23, 0x5E, 0x01, 0x20, 0x94, 0xC3, 0x63, 0x00, 0x60,
+	0x02, 0x00, 0x00, 0x10, 0x72, 0x12, 0x85, 0x00, 0x50, 0x02, 0x00, 0x00,
+	0x8B, 0x3D, 0x95, 0x05, 0xA2, 0xFF, 0xD7, 0x83, 0xC4, 0x04, 0x84, 0xDB,
+	0x0F, 0x84, 0x68, 0xD0, 0x02, 0x16, 0x78, 0x1B, 0x05, 0x16, 0x74, 0xF2,
+	0x04, 0x13, 0x64, 0x1B, 0x05, 0x00, 0x84, 0x07, 0x03, 0x1E, 0x00, 0x16,
+	0xAC, 0x1E, 0x00, 0x10, 0x9C, 0x0B, 0x00, 0x03, 0xBB, 0x01, 0x13, 0x24,
+	0x4B, 0x01, 0x21, 0x70, 0x02, 0x1B, 0x00, 0x80, 0x0C, 0x03, 0x00, 0x00,
+	0x08, 0xE8, 0xDD, 0x21, 0x9F, 0x00, 0x01, 0xDC, 0x04, 0xB7, 0xB2, 0x14,
+	0x00, 0x00, 0x83, 0x78, 0x14, 0x10, 0x72, 0x02, 0x8B, 0xDF, 0x00, 0x12,
+	0x80, 0xDF, 0x00, 0x8F, 0x8D, 0x4C, 0x24, 0x4C, 0x6A, 0x05, 0xE8, 0x8E,
+	0x24, 0x00, 0x02, 0x17, 0x88, 0x24, 0x00, 0x3F, 0x08, 0xE8, 0x6A, 0x24,
+	0x00, 0x02, 0x17, 0x90, 0x24, 0x00, 0x3F, 0x0B, 0xE8, 0x46, 0x24, 0x00,
+	0x02, 0x17, 0x98, 0x24, 0x00, 0xD0, 0x2F, 0x6A, 0x03, 0xE8, 0x20, 0x14,
+	0x00, 0x00, 0x8B, 0xD0, 0x8D, 0x8C, 0x24, 0x02, 0x01, 0x31, 0xE8, 0x62,
+	0xF6, 0x7C, 0x05, 0x10, 0x6A, 0xA2, 0x03, 0x00, 0x11, 0x00, 0x00, 0x18,
+	0x06, 0xF1, 0x03, 0x03, 0x00, 0x00, 0x09, 0xE8, 0xF9, 0x13, 0x00, 0x00,
+	0x8B, 0xC8, 0xE8, 0xC2, 0xF6, 0xFF, 0xFF, 0x8D, 0x8C, 0xF3, 0x00, 0x41,
+	0x3B, 0xC8, 0x74, 0x0A, 0x0E, 0x04, 0x40, 0xE8, 0xFD, 0x20, 0x00, 0xFC,
+	0x00, 0x00, 0x26, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x36, 0x06, 0x31, 0xE8,
+	0x29, 0x0C, 0xE6, 0x03, 0x10, 0x64, 0x55, 0x00, 0x22, 0x7D, 0x13, 0x0C,
+	0x00, 0x00, 0x18, 0x00, 0x21, 0x41, 0x0A, 0x50, 0x05, 0x01, 0xEF, 0x01,
+	0x02, 0x18, 0x07, 0x23, 0x72, 0x0C, 0x17, 0x02, 0x54, 0xFF, 0xD3, 0x83,
+	0xC4, 0x04, 0x29, 0x04, 0x01, 0x16, 0x00, 0x00, 0x1C, 0x04, 0x01, 0x16,
+	0x00, 0x05, 0x76, 0x06, 0x51, 0x74, 0x24, 0x4C, 0xC7, 0x84, 0x22, 0x00,
+	0x03, 0x88, 0x01, 0x00, 0x48, 0x02, 0x03, 0x88, 0x01, 0x00, 0x2E, 0x00,
+	0xF1, 0x06, 0x00, 0x85, 0xF6, 0x74, 0x4F, 0x8B, 0x7C, 0x24, 0x50, 0x3B,
+	0xF7, 0x74, 0x29, 0x83, 0x7E, 0x14, 0x10, 0x72, 0x07, 0xFF, 0x36, 0x43,
+	0x00, 0x31, 0xC7, 0x46, 0x14, 0x33, 0x00, 0x21, 0x46, 0x10, 0x2F, 0x00,
+	0x90, 0x06, 0x00, 0x83, 0xC6, 0x18, 0x3B, 0xF7, 0x75, 0xDB, 0x53, 0x00,
+	0x12, 0x56, 0x22, 0x00, 0x31, 0x44, 0x24, 0x4C, 0xEE, 0x06, 0x33, 0x44,
+	0x24, 0x50, 0x08, 0x00, 0x11, 0x54, 0xBF, 0x07, 0x0F, 0xEB, 0x06, 0x11,
+	0x2F, 0xF9, 0x2F, 0xEB, 0x06, 0x08, 0x72, 0x85, 0x1B, 0xF9, 0xFF, 0xFF,
+	0xE9, 0xAB, 0x4B, 0x06, 0x02, 0xFB, 0x00, 0x01, 0x7E, 0x02, 0x06, 0xFB,
+	0x00, 0x00, 0x87, 0x02, 0x04, 0xFB, 0x00, 0x21, 0xC7, 0x84, 0x24, 0x00,
+	0x03, 0xE1, 0x00, 0x00, 0x25, 0x04, 0x03, 0xE1, 0x00, 0x00, 0x2A, 0x00,
+	0x02, 0x34, 0x00, 0x01, 0x19, 0x01, 0x00, 0x34, 0x00, 0x2F, 0x8B, 0x44,
+	0x11, 0x01, 0x0E, 0xF2, 0x02, 0xC0, 0x74, 0x13, 0xFF, 0x74, 0x24, 0x50,
+	0x50, 0xE8, 0x06, 0x28, 0x00, 0x00, 0xFF, 0x74, 0x24, 0x4C, 0x39, 0x00,
+	0x01, 0x7C, 0x01, 0x40, 0x8D, 0x8C, 0x24, 0xD4, 0xA2, 0x01, 0x22, 0xFB,
+	0x07, 0xE7, 0x00, 0xA2, 0x8B, 0x40, 0x04, 0xC7, 0x44, 0x04, 0x64, 0xB0,
+	0x74, 0x40, 0x0F, 0x00, 0xF0, 0x00, 0x48, 0x04, 0x8D, 0x41, 0x90, 0x89,
+	0x44, 0x0C, 0x60, 0x8D, 0x4C, 0x24, 0x74, 0xE8, 0x85, 0xC8, 0x01, 0x72,
+	0x4C, 0x24, 0x7C, 0xFF, 0x15, 0x9C, 0x70, 0x3C, 0x00, 0x80, 0x00, 0x00,
+	0x00, 0xFF, 0x15, 0xB0, 0x70, 0x40, 0xD8, 0x00, 0x15, 0x60, 0xB7, 0x01,
+	0x00, 0xE0, 0x04, 0x04, 0xCD, 0x01, 0x10, 0x60, 0x75, 0x03, 0x21, 0xC7,
+	0x84, 0x1E, 0x00, 0x03, 0xA2, 0x00, 0x16, 0x5C, 0xA2, 0x00, 0x00, 0x2A,
+	0x00, 0x02, 0xD2, 0x00, 0x23, 0x4C, 0x02, 0x34, 0x00, 0xC0, 0x33, 0xC0,
+	0x8B, 0x8C, 0x24, 0xF8, 0x02, 0x00, 0x00, 0x64, 0x89, 0x0D, 0x26, 0x00,
+	0x61, 0x59, 0x5F, 0x5E, 0x5B, 0x8B, 0x8C, 0x7B, 0x03, 0xF2, 0x07, 0x33,
 	0xCC, 0xE8, 0x32, 0x33, 0x00, 0x00, 0x8B, 0xE5, 0x5D, 0xC3, 0x68, 0x48,
-	0x74, 0x40, 0x00, 0xFF, 0x15, 0xEC, 0x70, 0x40, 0x00, 0x8B, 0x1D, 0x48,
-	0x71, 0x40, 0x00, 0x83, 0xFF, 0x10, 0x72, 0x0C, 0xFF, 0xB4, 0x24, 0x1C,
-	0x01, 0x00, 0x00, 0xFF, 0xD3, 0x83, 0xC4, 0x04, 0xC6, 0x84, 0x24, 0x00,
-	0x03, 0x00, 0x00, 0x03, 0x8B, 0x44, 0x24, 0x4C, 0xC7, 0x84, 0x24, 0x30,
-	0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x2C, 0x01,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x1C, 0x01, 0x00,
-	0x00, 0x00, 0x85, 0xC0, 0x74, 0x13, 0xFF, 0x74, 0x24, 0x50, 0x50, 0xE8,
-	0xE4, 0x26, 0x00, 0x00, 0xFF, 0x74, 0x24, 0x4C, 0xFF, 0xD3, 0x83, 0xC4,
-	0x04, 0x8B, 0x5C, 0x24, 0x44, 0x8B, 0x74, 0x24, 0x48, 0x8D, 0x84, 0x24,
-	0x34, 0x02, 0x00, 0x00, 0x50, 0x8D, 0x4C, 0x24, 0x68, 0xFF, 0x15, 0x8C,
-	0x70, 0x40, 0x00, 0x2B, 0x9C, 0x24, 0x34, 0x02, 0x00, 0x00, 0x6A, 0x00,
-	0x1B, 0xB4, 0x24, 0x3C, 0x02, 0x00, 0x00, 0x2B, 0x9C, 0x24, 0x40, 0x02,
-	0x00, 0x00, 0x6A, 0x02, 0x1B, 0xB4, 0x24, 0x48, 0x02, 0x00, 0x00, 0x83,
-	0xEB, 0x01, 0x83, 0xDE, 0x00, 0x56, 0x53, 0xE8, 0xF4, 0x3B, 0x00, 0x00,
-	0x40, 0x89, 0x44, 0x24, 0x60, 0xC7, 0x84, 0x24, 0x78, 0x01, 0x00, 0x00,
-	0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x74, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x64, 0x01, 0x00, 0x00, 0x00, 0xC6,
-	0x84, 0x24, 0x00, 0x03, 0x00, 0x00, 0x0A, 0x8B, 0x0D, 0xF8, 0x70, 0x40,
+	0x74, 0x40, 0x00, 0xFF, 0x15, 0xEC, 0x70, 0x40, 0x00, 0xCA, 0x00, 0x2F,
+	0x83, 0xFF, 0x33, 0x02, 0x05, 0x0F, 0x22, 0x01, 0x18, 0x23, 0xE4, 0x26,
+	0x22, 0x01, 0x00, 0x41, 0x00, 0x80, 0x8B, 0x5C, 0x24, 0x44, 0x8B, 0x74,
+	0x24, 0x48, 0x95, 0x04, 0x01, 0xDA, 0x02, 0xB1, 0x4C, 0x24, 0x68, 0xFF,
+	0x15, 0x8C, 0x70, 0x40, 0x00, 0x2B, 0x9C, 0x12, 0x00, 0x41, 0x6A, 0x00,
+	0x1B, 0xB4, 0x88, 0x04, 0x40, 0x2B, 0x9C, 0x24, 0x40, 0x10, 0x00, 0x31,
+	0x02, 0x1B, 0xB4, 0x65, 0x04, 0xF0, 0x03, 0x83, 0xEB, 0x01, 0x83, 0xDE,
+	0x00, 0x56, 0x53, 0xE8, 0xF4, 0x3B, 0x00, 0x00, 0x40, 0x89, 0x44, 0x24,
+	0x60, 0x5A, 0x04, 0x06, 0x81, 0x00, 0x16, 0x74, 0x81, 0x00, 0x00, 0x20,
+	0x03, 0x04, 0x25, 0x07, 0xF9, 0x11, 0x0A, 0x8B, 0x0D, 0xF8, 0x70, 0x40,
 	0x00, 0xBA, 0x38, 0x73, 0x40, 0x00, 0xE8, 0xD9, 0x29, 0x00, 0x00, 0x8B,
 	0x35, 0xF4, 0x70, 0x40, 0x00, 0x6A, 0x0A, 0x8B, 0x06, 0x8B, 0x48, 0x04,
-	0x03, 0xCE, 0xFF, 0x15, 0x4C, 0x70, 0x40, 0x00, 0x0F, 0xB6, 0xC0, 0x50,
-	0x8D, 0x94, 0x24, 0x68, 0x01, 0x00, 0x00, 0x8B, 0xCE, 0xE8, 0x82, 0x2D,
-	0x00, 0x00, 0x8B, 0xBC, 0x24, 0x7C, 0x01, 0x00, 0x00, 0x8B, 0xB4, 0x24,
-	0x68, 0x01, 0x00, 0x00, 0x8B, 0x8C, 0x24, 0x78, 0x01, 0x00, 0x00, 0x83,
-	0xC4, 0x04, 0x83, 0xFF, 0x10, 0x8D, 0x94, 0x24, 0x64, 0x01, 0x00, 0x00,
-	0x0F, 0x43, 0xD6, 0x03, 0xD1, 0x83, 0xFF, 0x10, 0x8D, 0x84, 0x24, 0x64,
-	0x01, 0x00, 0x00, 0x0F, 0x43, 0xC6, 0x03, 0xC8, 0x83, 0xFF, 0x10, 0x8D,
-	0x84, 0x24, 0x64, 0x01, 0x00, 0x00, 0x0F, 0x43, 0xC6, 0x3B, 0xC1, 0x74,
-	0x2A, 0x80, 0x38, 0x22, 0x74, 0x07, 0x40, 0x3B, 0xC1, 0x75, 0xF6, 0xEB,
-	0x1E, 0x3B, 0xC1, 0x74, 0x1A, 0x8D, 0x70, 0x01, 0x3B, 0xF1, 0x74, 0x13,
-	0x8D, 0x64, 0x24, 0x00, 0x8A, 0x1E, 0x80, 0xFB, 0x22, 0x74, 0x03, 0x88,
-	0x18, 0x40, 0x46, 0x3B, 0xF1, 0x75, 0xF1, 0x52, 0x50, 0x8D, 0x44, 0x24,
-	0x64, 0x50, 0x8D, 0x8C, 0x24, 0x70, 0x01, 0x00, 0x00, 0xE8, 0xAE, 0x07,
-	0x00, 0x00, 0x83, 0xBC, 0x24, 0x78, 0x01, 0x00, 0x00, 0x10, 0x8D, 0x84,
-	0x24, 0x64, 0x01, 0x00, 0x00, 0x0F, 0x43, 0x84, 0x24, 0x64, 0x01, 0x00,
-	0x00, 0x68, 0x48, 0x73, 0x40, 0x00, 0x50, 0x8D, 0x44, 0x24, 0x4C, 0x50,
-	0xFF, 0x15, 0x24, 0x71, 0x40, 0x00, 0x8B, 0x44, 0x24, 0x50, 0x83, 0xC4,
-	0x0C, 0x85, 0xC0, 0x0F, 0x84, 0x19, 0x05, 0x00, 0x00, 0x8B, 0x1D, 0x3C,
-	0x71, 0x40, 0x00, 0x68, 0x4C, 0x73, 0x40, 0x00, 0x50, 0xFF, 0xD3, 0x83,
-	0xBC, 0x24, 0x08, 0x02, 0x00, 0x00, 0x10, 0x8D, 0x84, 0x24, 0xF4, 0x01,
-	0x00, 0x00, 0x0F, 0x43, 0x84, 0x24, 0xF4, 0x01, 0x00, 0x00, 0x50, 0x68,
-	0x64, 0x73, 0x40, 0x00, 0xFF, 0x74, 0x24, 0x54, 0xFF, 0xD3, 0x83, 0xC4,
-	0x14, 0x83, 0xBC, 0x24, 0x18, 0x02, 0x00, 0x00, 0x10, 0x8D, 0x84, 0x24,
-	0x04, 0x02, 0x00, 0x00, 0x0F, 0x43, 0x84, 0x24, 0x04, 0x02, 0x00, 0x00,
-	0x50, 0x68, 0x74, 0x73, 0x40, 0x00, 0xFF, 0x74, 0x24, 0x4C, 0xFF, 0xD3,
-	0x8B, 0x8C, 0x24, 0x2C, 0x02, 0x00, 0x00, 0x2B, 0x8C, 0x24, 0x28, 0x02,
-	0x00, 0x00, 0xB8, 0xE9, 0xA2, 0x8B, 0x2E, 0xF7, 0xE9, 0xC1, 0xFA, 0x04,
-	0x8B, 0xC2, 0xC1, 0xE8, 0x1F, 0x83, 0xC4, 0x0C, 0x33, 0xF6, 0x03, 0xC2,
-	0x0F, 0x84, 0xD5, 0x00, 0x00, 0x00, 0x33, 0xFF, 0x3B, 0xC6, 0x0F, 0x86,
-	0xAE, 0xFD, 0xFF, 0xFF, 0x8B, 0x84, 0x24, 0x1C, 0x02, 0x00, 0x00, 0x03,
-	0xC7, 0x50, 0x8D, 0x8C, 0x24, 0x80, 0x01, 0x00, 0x00, 0xE8, 0xE6, 0x05,
-	0x00, 0x00, 0x83, 0xBC, 0x24, 0xC8, 0x01, 0x00, 0x00, 0x10, 0xF2, 0x0F,
-	0x10, 0x84, 0x24, 0xAC, 0x01, 0x00, 0x00, 0x8D, 0x8C, 0x24, 0xB4, 0x01,
-	0x00, 0x00, 0x0F, 0x43, 0x8C, 0x24, 0xB4, 0x01, 0x00, 0x00, 0x83, 0xBC,
-	0x24, 0x90, 0x01, 0x00, 0x00, 0x10, 0x8D, 0x84, 0x24, 0x7C, 0x01, 0x00,
-	0x00, 0x0F, 0x43, 0x84, 0x24, 0x7C, 0x01, 0x00, 0x00, 0x83, 0xEC, 0x18,
-	0xF2, 0x0F, 0x11, 0x44, 0x24, 0x10, 0xF2, 0x0F, 0x10, 0x84, 0x24, 0xBC,
-	0x01, 0x00, 0x00, 0xF2, 0x0F, 0x11, 0x44, 0x24, 0x08, 0xF2, 0x0F, 0x10,
-	0x84, 0x24, 0xB4, 0x01, 0x00, 0x00, 0xF2, 0x0F, 0x11, 0x04, 0x24, 0xF2,
-	0x0F, 0x10, 0x84, 0x24, 0xAC, 0x01, 0x00, 0x00, 0x51, 0x83, 0xEC, 0x08,
-	0xF2, 0x0F, 0x11, 0x04, 0x24, 0x50, 0x68, 0x88, 0x73, 0x40, 0x00, 0xFF,
-	0x74, 0x24, 0x70, 0xFF, 0xD3, 0x83, 0xC4, 0x30, 0x8D, 0x8C, 0x24, 0x7C,
-	0x01, 0x00, 0x00, 0xE8, 0x0C, 0x05, 0x00, 0x00, 0x8B, 0x8C, 0x24, 0x20,
-	0x02, 0x00, 0x00, 0x2B, 0x8C, 0x24, 0x1C, 0x02, 0x00, 0x00, 0xB8, 0xE9,
+	0x03, 0xCE, 0x79, 0x02, 0x00, 0x9D, 0x03, 0xB2, 0x8B, 0xCE, 0xE8, 0x82,
+	0x2D, 0x00, 0x00, 0x8B, 0xBC, 0x24, 0x7C, 0xB0, 0x06, 0x01, 0x15, 0x00,
+	0x11, 0x8C, 0x6B, 0x00, 0x00, 0x7E, 0x01, 0x41, 0xFF, 0x10, 0x8D, 0x94,
+	0x62, 0x00, 0x50, 0x0F, 0x43, 0xD6, 0x03, 0xD1, 0x0F, 0x00, 0x02, 0x71,
+	0x00, 0x59, 0x0F, 0x43, 0xC6, 0x03, 0xC8, 0x0F, 0x00, 0xF1, 0x25, 0x3B,
+	0xC1, 0x74, 0x2A, 0x80, 0x38, 0x22, 0x74, 0x07, 0x40, 0x3B, 0xC1, 0x75,
+	0xF6, 0xEB, 0x1E, 0x3B, 0xC1, 0x74, 0x1A, 0x8D, 0x70, 0x01, 0x3B, 0xF1,
+	0x74, 0x13, 0x8D, 0x64, 0x24, 0x00, 0x8A, 0x1E, 0x80, 0xFB, 0x22, 0x74,
+	0x03, 0x88, 0x18, 0x40, 0x46, 0x3B, 0xF1, 0x75, 0xF1, 0x52, 0x50, 0x8D,
+	0x44, 0x24, 0x64, 0xE7, 0x04, 0x00, 0x3D, 0x02, 0x21, 0xAE, 0x07, 0xD8,
+	0x02, 0x00, 0x76, 0x00, 0x06, 0x53, 0x00, 0x02, 0x08, 0x00, 0x50, 0x68,
+	0x48, 0x73, 0x40, 0x00, 0x2E, 0x00, 0x61, 0x4C, 0x50, 0xFF, 0x15, 0x24,
+	0x71, 0x56, 0x02, 0x40, 0x50, 0x83, 0xC4, 0x0C, 0xF1, 0x06, 0xC0, 0x19,
+	0x05, 0x00, 0x00, 0x8B, 0x1D, 0x3C, 0x71, 0x40, 0x00, 0x68, 0x4C, 0x26,
+	0x00, 0x60, 0xFF, 0xD3, 0x83, 0xBC, 0x24, 0x08, 0x2F, 0x02, 0x43, 0x8D,
+	0x84, 0x24, 0xF4, 0x45, 0x00, 0x00, 0x08, 0x00, 0x30, 0x50, 0x68, 0x64,
+	0x3C, 0x06, 0x30, 0x74, 0x24, 0x54, 0x98, 0x01, 0x53, 0x14, 0x83, 0xBC,
+	0x24, 0x18, 0x26, 0x00, 0x10, 0x04, 0x90, 0x05, 0x12, 0x43, 0x08, 0x00,
+	0x32, 0x50, 0x68, 0x74, 0x26, 0x00, 0x70, 0x4C, 0xFF, 0xD3, 0x8B, 0x8C,
+	0x24, 0x2C, 0x98, 0x01, 0x11, 0x8C, 0x82, 0x06, 0xF0, 0x20, 0xB8, 0xE9,
 	0xA2, 0x8B, 0x2E, 0xF7, 0xE9, 0xC1, 0xFA, 0x04, 0x8B, 0xC2, 0xC1, 0xE8,
-	0x1F, 0x46, 0x03, 0xC2, 0x83, 0xC7, 0x58, 0x3B, 0xC6, 0x0F, 0x87, 0x35,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x24, 0x28, 0x02, 0x00, 0x00, 0x68, 0xD4,
-	0x73, 0x40, 0x00, 0xFF, 0x74, 0x24, 0x4C, 0xFF, 0xD3, 0xF2, 0x0F, 0x10,
-	0x84, 0x24, 0x38, 0x02, 0x00, 0x00, 0x83, 0xC4, 0x04, 0xF2, 0x0F, 0x11,
-	0x04, 0x24, 0x68, 0xEC, 0x73, 0x40, 0x00, 0xFF, 0x74, 0x24, 0x50, 0xFF,
-	0xD3, 0x68, 0x04, 0x74, 0x40, 0x00, 0xFF, 0x74, 0x24, 0x58, 0xFF, 0xD3,
-	0x68, 0x10, 0x74, 0x40, 0x00, 0xFF, 0x74, 0x24, 0x60, 0xFF, 0xD3, 0x8B,
-	0x8C, 0x24, 0x40, 0x02, 0x00, 0x00, 0x2B, 0x8C, 0x24, 0x3C, 0x02, 0x00,
-	0x00, 0xB8, 0xE9, 0xA2, 0x8B, 0x2E, 0xF7, 0xE9, 0xC1, 0xFA, 0x04, 0x8B,
-	0xC2, 0x33, 0xF6, 0xC1, 0xE8, 0x1F, 0x83, 0xC4, 0x20, 0x89, 0x74, 0x24,
-	0x5C, 0x03, 0xC2, 0x0F, 0x84, 0xC6, 0x01, 0x00, 0x00, 0x8B, 0x3D, 0x48,
-	0x71, 0x40, 0x00, 0x33, 0xC9, 0x89, 0x4C, 0x24, 0x48, 0x8D, 0x49, 0x00,
-	0x3B, 0xC6, 0x0F, 0x86, 0x5A, 0xFC, 0xFF, 0xFF, 0x8B, 0xB4, 0x24, 0x1C,
-	0x02, 0x00, 0x00, 0x6A, 0xFF, 0x03, 0xF1, 0x6A, 0x00, 0x56, 0x8D, 0x8C,
-	0x24, 0x88, 0x01, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x9C, 0x01, 0x00, 0x00,
-	0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x98, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x88, 0x01, 0x00, 0x00, 0x00, 0xE8,
-	0xB0, 0x1A, 0x00, 0x00, 0xC6, 0x84, 0x24, 0x00, 0x03, 0x00, 0x00, 0x0B,
-	0xF2, 0x0F, 0x10, 0x46, 0x18, 0xF2, 0x0F, 0x11, 0x84, 0x24, 0x94, 0x01,
-	0x00, 0x00, 0xF2, 0x0F, 0x10, 0x46, 0x20, 0xF2, 0x0F, 0x11, 0x84, 0x24,
-	0x9C, 0x01, 0x00, 0x00, 0xF2, 0x0F, 0x10, 0x46, 0x28, 0x6A, 0xFF, 0xF2,
-	0x0F, 0x11, 0x84, 0x24, 0xA8, 0x01, 0x00, 0x00, 0xF2, 0x0F, 0x10, 0x46,
-	0x30, 0x6A, 0x00, 0x8D, 0x46, 0x38, 0x50, 0x8D, 0x8C, 0x24, 0xC0, 0x01,
-	0x00, 0x00, 0xF2, 0x0F, 0x11, 0x84, 0x24, 0xB8, 0x01, 0x00, 0x00, 0xC7,
-	0x84, 0x24, 0xD4, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84,
-	0x24, 0xD0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x84, 0x24,
-	0xC0, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x3E, 0x1A, 0x00, 0x00, 0xF2, 0x0F,
-	0x10, 0x46, 0x50, 0xC6, 0x84, 0x24, 0x00, 0x03, 0x00, 0x00, 0x0A, 0x8B,
-	0x74, 0x24, 0x5C, 0xF2, 0x0F, 0x11, 0x84, 0x24, 0xCC, 0x01, 0x00, 0x00,
-	0x8D, 0x8C, 0x24, 0xB4, 0x01, 0x00, 0x00, 0x8D, 0x84, 0x24, 0x7C, 0x01,
-	0x00, 0x00, 0x83, 0xFE, 0x02, 0x73, 0x29, 0x83, 0xBC, 0x24, 0xC8, 0x01,
-	0x00, 0x00, 0x10, 0x0F, 0x43, 0x8C, 0x24, 0xB4, 0x01, 0x00, 0x00, 0x83,
-	0xBC, 0x24, 0x90, 0x01, 0x00, 0x00, 0x10, 0x51, 0x0F, 0x43, 0x84, 0x24,
-	0x80, 0x01, 0x00, 0x00, 0x50, 0x68, 0x1C, 0x74, 0x40, 0x00, 0xEB, 0x27,
-	0x83, 0xBC, 0x24, 0xC8, 0x01, 0x00, 0x00, 0x10, 0x0F, 0x43, 0x8C, 0x24,
-	0xB4, 0x01, 0x00, 0x00, 0x83, 0xBC, 0x24, 0x90, 0x01, 0x00, 0x00, 0x10,
-	0x51, 0x0F, 0x43, 0x84, 0x24, 0x80, 0x01, 0x00, 0x00, 0x50, 0x68, 0x28,
-	0x74, 0x40, 0x00, 0xFF, 0x74, 0x24, 0x50, 0xFF, 0xD3, 0x83, 0xC4, 0x10,
-	0x83, 0xBC, 0x24, 0xC8, 0x01, 0x00, 0x00, 0x10, 0x72, 0x0C, 0xFF, 0xB4,
-	0x24, 0xB4, 0x01, 0x00, 0x00, 0xFF, 0xD7, 0x83, 0xC4, 0x04, 0x83, 0xBC,
-	0x24, 0x90, 0x01, 0x00, 0x00, 0x10, 0xC7, 0x84, 0x24, 0xC8, 0x01, 0x00,
-	0x00, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0xC4, 0x01, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xC6, 0x84, 0x24, 0xB4, 0x01, 0x00, 0x00, 0x00,
-	0x72, 0x0C, 0xFF, 0xB4, 0x24, 0x7C, 0x01, 0x00, 0x00, 0xFF, 0xD7, 0x83,
-	0xC4, 0x04, 0x8B, 0x8C, 0x24, 0x20, 0x02, 0x00, 0x00, 0x2B, 0x8C, 0x24,
-	0x1C, 0x02, 0x00, 0x00, 0x83, 0x44, 0x24, 0x48, 0x58, 0xB8, 0xE9, 0xA2,
-	0x8B, 0x2E, 0xF7, 0xE9, 0x8B, 0x4C, 0x24, 0x48, 0xC1, 0xFA, 0x04, 0x8B,
-	0xC2, 0xC1, 0xE8, 0x1F, 0x46, 0x03, 0xC2, 0x89, 0x74, 0x24, 0x5C, 0x3B,
-	0xF0, 0x0F, 0x82, 0x49, 0xFE, 0xFF, 0xFF, 0x83, 0x7C, 0x24, 0x60, 0x00,
-	0x0F, 0x57, 0xC0, 0xF2, 0x0F, 0x11, 0x44, 0x24, 0x4C, 0x0F, 0x8E, 0x6A,
-	0x01, 0x00, 0x00, 0xEB, 0x03, 0x8D, 0x49, 0x00, 0x83, 0xEC, 0x08, 0xF2,
-	0x0F, 0x11, 0x04, 0x24, 0x68, 0x34, 0x74, 0x40, 0x00, 0xFF, 0x74, 0x24,
-	0x50, 0xFF, 0xD3, 0x8B, 0xBC, 0x24, 0x30, 0x02, 0x00, 0x00, 0x8B, 0xCF,
-	0x2B, 0x8C, 0x24, 0x2C, 0x02, 0x00, 0x00, 0xB8, 0xE9, 0xA2, 0x8B, 0x2E,
-	0xF7, 0xE9, 0xC1, 0xFA, 0x04, 0x8B, 0xC2, 0xC1, 0xE8, 0x1F, 0x83, 0xC4,
-	0x10, 0x33, 0xDB, 0x03, 0xC2, 0x0F, 0x84, 0xE0, 0x00, 0x00, 0x00, 0x33,
-	0xF6, 0x6A, 0x02, 0xE8, 0x32, 0x2D, 0x00, 0x00, 0x83, 0xC4, 0x04, 0x8B,
-	0xF8, 0x6A, 0x00, 0x6A, 0x02, 0x57, 0x8D, 0x4C, 0x24, 0x70, 0x89, 0x7C,
-	0x24, 0x68, 0xFF, 0x15, 0x94, 0x70, 0x40, 0x00, 0x6A, 0x02, 0x8D, 0x44,
-	0x24, 0x4C, 0x57, 0x50, 0xFF, 0x15, 0xE0, 0x71, 0x40, 0x00, 0x8B, 0x8C,
-	0x24, 0x2C, 0x02, 0x00, 0x00, 0x8B, 0xBC, 0x24, 0x28, 0x02, 0x00, 0x00,
-	0x2B, 0xCF, 0xB8, 0xE9, 0xA2, 0x8B, 0x2E, 0xF7, 0xE9, 0xC1, 0xFA, 0x04,
-	0x8B, 0xC2, 0xC1, 0xE8, 0x1F, 0x03, 0xC2, 0x83, 0xC4, 0x0C, 0x3B, 0xC3,
-	0x0F, 0x86, 0xF8, 0xF9, 0xFF, 0xFF, 0x0F, 0xB7, 0x44, 0x24, 0x48, 0x66,
-	0x0F, 0x6E, 0xC0, 0xF3, 0x0F, 0xE6, 0xC0, 0x83, 0xEC, 0x08, 0xF2, 0x0F,
-	0x5C, 0x44, 0x3E, 0x30, 0xF2, 0x0F, 0x59, 0x44, 0x3E, 0x28, 0xF2, 0x0F,
-	0x5C, 0x44, 0x3E, 0x20, 0xF2, 0x0F, 0x59, 0x44, 0x3E, 0x18, 0xF2, 0x0F,
-	0x11, 0x04, 0x24, 0x83, 0xFB, 0x02, 0x73, 0x07, 0x68, 0x38, 0x74, 0x40,
-	0x00, 0xEB, 0x05, 0x68, 0x40, 0x74, 0x40, 0x00, 0xFF, 0x74, 0x24, 0x50,
-	0xFF, 0x15, 0x3C, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x10, 0xFF, 0x74, 0x24,
-	0x5C, 0xFF, 0x15, 0x38, 0x71, 0x40, 0x00, 0x8B, 0xBC, 0x24, 0x24, 0x02,
-	0x00, 0x00, 0x8B, 0xCF, 0x2B, 0x8C, 0x24, 0x20, 0x02, 0x00, 0x00, 0xB8,
-	0xE9, 0xA2, 0x8B, 0x2E, 0xF7, 0xE9, 0xC1, 0xFA, 0x04, 0x8B, 0xC2, 0xC1,
-	0xE8, 0x1F, 0x43, 0x03, 0xC2, 0x83, 0xC4, 0x04, 0x83, 0xC6, 0x58, 0x3B,
-	0xD8, 0x0F, 0x82, 0x22, 0xFF, 0xFF, 0xFF, 0x2B, 0xBC, 0x24, 0x1C, 0x02,
-	0x00, 0x00, 0xF2, 0x0F, 0x10, 0x44, 0x24, 0x4C, 0x8B, 0x4C, 0x24, 0x60,
-	0xF2, 0x0F, 0x58, 0x84, 0x24, 0x2C, 0x02, 0x00, 0x00, 0xB8, 0x17, 0x5D,
-	0x74, 0xD1, 0xF7, 0xEF, 0xC1, 0xFA, 0x04, 0x8B, 0xC2, 0xC1, 0xE8, 0x1F,
-	0x03, 0xC2, 0x03, 0xC8, 0x89, 0x4C, 0x24, 0x60, 0xF2, 0x0F, 0x11, 0x44,
-	0x24, 0x4C, 0x85, 0xC9, 0x7E, 0x0B, 0x8B, 0x1D, 0x3C, 0x71, 0x40, 0x00,
-	0xE9, 0x9B, 0xFE, 0xFF, 0xFF, 0xFF, 0x74, 0x24, 0x44, 0xFF, 0x15, 0x5C,
-	0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0x8D, 0x4C, 0x24, 0x64, 0xE8, 0x95,
-	0x0B, 0x00, 0x00, 0x83, 0xBC, 0x24, 0x78, 0x01, 0x00, 0x00, 0x10, 0x0F,
-	0x82, 0x4A, 0xF8, 0xFF, 0xFF, 0xFF, 0xB4, 0x24, 0x64, 0x01, 0x00, 0x00,
-	0x8B, 0x1D, 0x48, 0x71, 0x40, 0x00, 0xFF, 0xD3, 0x83, 0xC4, 0x04, 0xE9,
-	0x39, 0xF8, 0xFF, 0xFF, 0x8B, 0x01, 0x56, 0x8B, 0x40, 0x04, 0x8D, 0x71,
-	0x70, 0xC7, 0x44, 0x30, 0x90, 0xB0, 0x74, 0x40, 0x00, 0x8B, 0x46, 0x90,
-	0x8D, 0x4E, 0xA0, 0x8B, 0x50, 0x04, 0x8D, 0x42, 0x90, 0x89, 0x44, 0x32,
-	0x8C, 0xE8, 0xCA, 0x0B, 0x00, 0x00, 0x8D, 0x4E, 0xA8, 0xFF, 0x15, 0x9C,
-	0x70, 0x40, 0x00, 0x8B, 0xCE, 0x5E, 0xFF, 0x25, 0xB0, 0x70, 0x40, 0x00,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x51,
-	0x56, 0x8B, 0xF1, 0x57, 0x8B, 0x4E, 0x48, 0x8B, 0x3D, 0x48, 0x71, 0x40,
-	0x00, 0x85, 0xC9, 0x74, 0x29, 0xFF, 0x75, 0xFC, 0x8B, 0x56, 0x4C, 0x51,
-	0xE8, 0x8F, 0x28, 0x00, 0x00, 0xFF, 0x76, 0x48, 0xFF, 0xD7, 0x83, 0xC4,
-	0x0C, 0xC7, 0x46, 0x48, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x46, 0x4C, 0x00,
-	0x00, 0x00, 0x00, 0xC7, 0x46, 0x50, 0x00, 0x00, 0x00, 0x00, 0x83, 0x7E,
-	0x44, 0x10, 0x72, 0x08, 0xFF, 0x76, 0x30, 0xFF, 0xD7, 0x83, 0xC4, 0x04,
-	0xC7, 0x46, 0x44, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x46, 0x40, 0x00, 0x00,
-	0x00, 0x00, 0xC6, 0x46, 0x30, 0x00, 0x83, 0x7E, 0x2C, 0x10, 0x72, 0x08,
-	0xFF, 0x76, 0x18, 0xFF, 0xD7, 0x83, 0xC4, 0x04, 0xC7, 0x46, 0x2C, 0x0F,
-	0x00, 0x00, 0x00, 0xC7, 0x46, 0x28, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x46,
-	0x18, 0x00, 0x83, 0x7E, 0x14, 0x10, 0x72, 0x07, 0xFF, 0x36, 0xFF, 0xD7,
-	0x83, 0xC4, 0x04, 0xC7, 0x46, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x46,
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xC6, 0x06, 0x00, 0x5E, 0x8B, 0xE5,
-	0x5D, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x56, 0x8B, 0xF1, 0x83, 0x7E, 0x4C, 0x10, 0x72,
-	0x0C, 0xFF, 0x76, 0x38, 0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x83, 0xC4,
-	0x04, 0xC7, 0x46, 0x4C, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x46, 0x48, 0x00,
-	0x00, 0x00, 0x00, 0xC6, 0x46, 0x38, 0x00, 0x83, 0x7E, 0x14, 0x10, 0x72,
-	0x0B, 0xFF, 0x36, 0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04,
-	0xC7, 0x46, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x46, 0x10, 0x00, 0x00,
-	0x00, 0x00, 0xC6, 0x06, 0x00, 0x5E, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x6A, 0xFF, 0x68, 0x08, 0x60, 0x40, 0x00, 0x64, 0xA1,
-	0x00, 0x00, 0x00, 0x00, 0x50, 0x51, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40,
-	0x00, 0x33, 0xC5, 0x50, 0x8D, 0x45, 0xF4, 0x64, 0xA3, 0x00, 0x00, 0x00,
-	0x00, 0x8B, 0xF9, 0x89, 0x7D, 0xF0, 0x8B, 0x75, 0x08, 0x6A, 0xFF, 0x6A,
-	0x00, 0xC7, 0x47, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x47, 0x10, 0x00,
-	0x00, 0x00, 0x00, 0x56, 0xC6, 0x07, 0x00, 0xE8, 0xF8, 0x15, 0x00, 0x00,
-	0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x0F, 0x10, 0x46, 0x18,
-	0xF2, 0x0F, 0x11, 0x47, 0x18, 0xF2, 0x0F, 0x10, 0x46, 0x20, 0xF2, 0x0F,
-	0x11, 0x47, 0x20, 0xF2, 0x0F, 0x10, 0x46, 0x28, 0xF2, 0x0F, 0x11, 0x47,
-	0x28, 0xF2, 0x0F, 0x10, 0x46, 0x30, 0x8D, 0x4F, 0x38, 0x6A, 0xFF, 0xF2,
-	0x0F, 0x11, 0x47, 0x30, 0x6A, 0x00, 0x8D, 0x46, 0x38, 0xC7, 0x41, 0x14,
-	0x0F, 0x00, 0x00, 0x00, 0xC7, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x50,
-	0xC6, 0x01, 0x00, 0xE8, 0xA8, 0x15, 0x00, 0x00, 0xF2, 0x0F, 0x10, 0x46,
-	0x50, 0xF2, 0x0F, 0x11, 0x47, 0x50, 0x8B, 0xC7, 0x8B, 0x4D, 0xF4, 0x64,
-	0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5F, 0x5E, 0x8B, 0xE5, 0x5D,
-	0xC2, 0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x56, 0x8B, 0xF1, 0x83, 0x7E, 0x14, 0x10, 0x72, 0x0B, 0xFF, 0x36, 0xFF,
-	0x15, 0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0xC7, 0x46, 0x14, 0x0F,
-	0x00, 0x00, 0x00, 0xC7, 0x46, 0x10, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x06,
-	0x00, 0x5E, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x56, 0x8B, 0xF1, 0x57, 0x83, 0x7E, 0x14, 0x10, 0x72,
-	0x04, 0x8B, 0x06, 0xEB, 0x02, 0x8B, 0xC6, 0x8B, 0x4D, 0x0C, 0x85, 0xC9,
-	0x75, 0x04, 0x33, 0xFF, 0xEB, 0x04, 0x8B, 0xF9, 0x2B, 0xF8, 0x8B, 0x45,
-	0x10, 0x85, 0xC0, 0x74, 0x02, 0x2B, 0xC1, 0x50, 0x57, 0x8B, 0xCE, 0xE8,
-	0xFC, 0x15, 0x00, 0x00, 0x83, 0x7E, 0x14, 0x10, 0x72, 0x02, 0x8B, 0x36,
-	0x8B, 0x45, 0x08, 0x8D, 0x0C, 0x3E, 0x5F, 0x89, 0x08, 0x5E, 0x5D, 0xC2,
-	0x0C, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x51,
-	0x56, 0x8B, 0x75, 0x08, 0x6A, 0x02, 0x6A, 0x00, 0x51, 0xC7, 0x46, 0x14,
-	0x0F, 0x00, 0x00, 0x00, 0xC7, 0x46, 0x10, 0x00, 0x00, 0x00, 0x00, 0x8B,
-	0xCE, 0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x06, 0x00, 0xE8,
-	0xD4, 0x14, 0x00, 0x00, 0x8B, 0xC6, 0x5E, 0x8B, 0xE5, 0x5D, 0xC2, 0x0C,
-	0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x56, 0x8B, 0xF1, 0x57, 0x8B, 0x4E, 0x04, 0x8B, 0x7D,
-	0x08, 0x3B, 0xF9, 0x73, 0x3E, 0x8B, 0x06, 0x3B, 0xC7, 0x77, 0x38, 0x2B,
-	0xF8, 0xB8, 0xE9, 0xA2, 0x8B, 0x2E, 0xF7, 0xEF, 0xC1, 0xFA, 0x04, 0x8B,
-	0xFA, 0xC1, 0xEF, 0x1F, 0x03, 0xFA, 0x3B, 0x4E, 0x08, 0x75, 0x08, 0x51,
-	0x8B, 0xCE, 0xE8, 0xA9, 0x16, 0x00, 0x00, 0x6B, 0xFF, 0x58, 0x03, 0x3E,
-	0x57, 0xFF, 0x76, 0x04, 0xE8, 0xBB, 0x22, 0x00, 0x00, 0x83, 0x46, 0x04,
-	0x58, 0x5F, 0x5E, 0x5D, 0xC2, 0x04, 0x00, 0x3B, 0x4E, 0x08, 0x75, 0x08,
-	0x51, 0x8B, 0xCE, 0xE8, 0x84, 0x16, 0x00, 0x00, 0x57, 0xFF, 0x76, 0x04,
-	0xE8, 0x9B, 0x22, 0x00, 0x00, 0x83, 0x46, 0x04, 0x58, 0x5F, 0x5E, 0x5D,
-	0xC2, 0x04, 0x00, 0xCC, 0x55, 0x8B, 0xEC, 0x6A, 0xFF, 0x68, 0xE2, 0x5F,
-	0x40, 0x00, 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x50, 0x83, 0xEC, 0x0C,
-	0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00, 0x33, 0xC5, 0x50, 0x8D, 0x45,
-	0xF4, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xF1, 0x89, 0x75, 0xEC,
-	0xC7, 0x45, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x4E, 0x68, 0xC7, 0x06,
-	0x34, 0x75, 0x40, 0x00, 0xC7, 0x46, 0x10, 0x74, 0x75, 0x40, 0x00, 0xFF,
-	0x15, 0x68, 0x70, 0x40, 0x00, 0x6A, 0x00, 0x8D, 0x7E, 0x18, 0xC7, 0x45,
-	0xFC, 0x00, 0x00, 0x00, 0x00, 0x57, 0x8B, 0xCE, 0xC7, 0x45, 0xF0, 0x01,
-	0x00, 0x00, 0x00, 0xFF, 0x15, 0x5C, 0x70, 0x40, 0x00, 0xC7, 0x45, 0xFC,
-	0x01, 0x00, 0x00, 0x00, 0x8B, 0x06, 0x89, 0x7D, 0xE8, 0x8B, 0x40, 0x04,
-	0xC7, 0x04, 0x06, 0x28, 0x75, 0x40, 0x00, 0x8B, 0x06, 0x8B, 0x48, 0x04,
-	0x8D, 0x41, 0x98, 0x89, 0x44, 0x31, 0xFC, 0x8B, 0xCF, 0xFF, 0x15, 0x54,
-	0x70, 0x40, 0x00, 0x8B, 0x45, 0x08, 0xC6, 0x45, 0xFC, 0x02, 0xC7, 0x07,
-	0xC4, 0x74, 0x40, 0x00, 0x83, 0x78, 0x14, 0x10, 0x8B, 0x48, 0x10, 0x72,
-	0x02, 0x8B, 0x00, 0xC7, 0x47, 0x38, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x47,
-	0x3C, 0x00, 0x00, 0x00, 0x00, 0x85, 0xC9, 0x74, 0x09, 0x51, 0x50, 0x8B,
-	0xCF, 0xE8, 0x8E, 0x1B, 0x00, 0x00, 0x8B, 0xC6, 0x8B, 0x4D, 0xF4, 0x64,
-	0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5F, 0x5E, 0x8B, 0xE5, 0x5D,
-	0xC2, 0x0C, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x56, 0x8B, 0xF1, 0xF6, 0x46, 0x3C, 0x01, 0xC7, 0x06, 0xC4, 0x74, 0x40,
-	0x00, 0x74, 0x0E, 0x8B, 0x46, 0x0C, 0xFF, 0x30, 0xFF, 0x15, 0x48, 0x71,
-	0x40, 0x00, 0x83, 0xC4, 0x04, 0x8B, 0x46, 0x0C, 0x8B, 0xCE, 0xC7, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x8B, 0x46, 0x1C, 0xC7, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x8B, 0x46, 0x2C, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x46,
-	0x10, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x46, 0x20, 0xC7, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x8B, 0x46, 0x30, 0xC7, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x83, 0x66, 0x3C, 0xFE, 0xC7, 0x46, 0x38, 0x00, 0x00, 0x00, 0x00,
-	0x5E, 0xFF, 0x25, 0xE0, 0x70, 0x40, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x83, 0xEC, 0x08, 0x56, 0x8B,
-	0xF1, 0x8B, 0x46, 0x3C, 0xA8, 0x02, 0x74, 0x0A, 0x83, 0xC8, 0xFF, 0x5E,
-	0x8B, 0xE5, 0x5D, 0xC2, 0x04, 0x00, 0x53, 0x8B, 0x5D, 0x08, 0x83, 0xFB,
-	0xFF, 0x75, 0x0A, 0x5B, 0x33, 0xC0, 0x5E, 0x8B, 0xE5, 0x5D, 0xC2, 0x04,
-	0x00, 0x57, 0xA8, 0x08, 0x74, 0x23, 0x8B, 0x46, 0x20, 0x8B, 0x10, 0x85,
+	0x1F, 0x83, 0xC4, 0x0C, 0x33, 0xF6, 0x03, 0xC2, 0x0F, 0x84, 0xD5, 0x00,
+	0x00, 0x00, 0x33, 0xFF, 0x3B, 0xC6, 0x0F, 0x86, 0xAE, 0xFD, 0xFF, 0xFF,
+	0x8B, 0x84, 0x24, 0x1C, 0x02, 0x00, 0x00, 0x03, 0xC7, 0xD8, 0x00, 0x10,
+	0x80, 0xD8, 0x00, 0x21, 0xE6, 0x05, 0xD8, 0x00, 0x10, 0xC8, 0xD8, 0x00,
+	0x71, 0xF2, 0x0F, 0x10, 0x84, 0x24, 0xAC, 0x01, 0xC8, 0x04, 0x11, 0xB4,
+	0x9C, 0x00, 0x02, 0x08, 0x00, 0x43, 0x83, 0xBC, 0x24, 0x90, 0xF8, 0x00,
+	0x00, 0x84, 0x01, 0x00, 0x8D, 0x00, 0x00, 0x08, 0x00, 0x82, 0x83, 0xEC,
+	0x18, 0xF2, 0x0F, 0x11, 0x44, 0x24, 0x38, 0x00, 0x41, 0xBC, 0x01, 0x00,
+	0x00, 0x0F, 0x00, 0x11, 0x08, 0x0F, 0x00, 0x00, 0x38, 0x00, 0x55, 0xF2,
+	0x0F, 0x11, 0x04, 0x24, 0x55, 0x00, 0x41, 0x51, 0x83, 0xEC, 0x08, 0x12,
+	0x00, 0x32, 0x50, 0x68, 0x88, 0xC5, 0x00, 0x10, 0x70, 0xEB, 0x00, 0x31,
+	0x30, 0x8D, 0x8C, 0x4E, 0x00, 0x20, 0xE8, 0x0C, 0x2B, 0x01, 0x02, 0x59,
+	0x05, 0x21, 0x2B, 0x8C, 0xA7, 0x00, 0x0B, 0xD4, 0x00, 0xF1, 0x01, 0x46,
+	0x03, 0xC2, 0x83, 0xC7, 0x58, 0x3B, 0xC6, 0x0F, 0x87, 0x35, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xB4, 0xF8, 0x00, 0x25, 0x68, 0xD4, 0x11, 0x01, 0x01, 0x6A,
+	0x00, 0x12, 0x38, 0xFA, 0x05, 0x01, 0x69, 0x00, 0x22, 0x68, 0xEC, 0x1C,
+	0x00, 0x50, 0x50, 0xFF, 0xD3, 0x68, 0x04, 0x4B, 0x03, 0x72, 0x74, 0x24,
+	0x58, 0xFF, 0xD3, 0x68, 0x10, 0x0B, 0x00, 0x11, 0x60, 0x43, 0x01, 0x00,
+	0xD4, 0x02, 0x21, 0x2B, 0x8C, 0xE2, 0x02, 0x08, 0x6F, 0x00, 0x21, 0x33,
+	0xF6, 0x45, 0x01, 0x50, 0x20, 0x89, 0x74, 0x24, 0x5C, 0x47, 0x01, 0x10,
+	0xC6, 0x75, 0x02, 0x01, 0xCF, 0x04, 0x90, 0x33, 0xC9, 0x89, 0x4C, 0x24,
+	0x48, 0x8D, 0x49, 0x00, 0x54, 0x01, 0x61, 0x5A, 0xFC, 0xFF, 0xFF, 0x8B,
+	0xB4, 0xAD, 0x00, 0xB2, 0x6A, 0xFF, 0x03, 0xF1, 0x6A, 0x00, 0x56, 0x8D,
+	0x8C, 0x24, 0x88, 0x66, 0x07, 0x16, 0x9C, 0x0C, 0x03, 0x16, 0x98, 0x0C,
+	0x03, 0x00, 0x1D, 0x00, 0x45, 0x00, 0xE8, 0xB0, 0x1A, 0x11, 0x03, 0x50,
+	0x0B, 0xF2, 0x0F, 0x10, 0x46, 0x49, 0x01, 0x31, 0x84, 0x24, 0x94, 0x34,
+	0x01, 0x31, 0x10, 0x46, 0x20, 0x0E, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0E,
+	0x00, 0x31, 0x28, 0x6A, 0xFF, 0x10, 0x00, 0x13, 0xA8, 0x10, 0x00, 0x60,
+	0x30, 0x6A, 0x00, 0x8D, 0x46, 0x38, 0xC1, 0x01, 0x12, 0xC0, 0x64, 0x01,
+	0x32, 0x84, 0x24, 0xB8, 0x72, 0x00, 0x00, 0xE6, 0x04, 0x03, 0x72, 0x00,
+	0x16, 0xD0, 0x72, 0x00, 0x00, 0x26, 0x00, 0x42, 0x00, 0xE8, 0x3E, 0x1A,
+	0x3E, 0x00, 0x15, 0x50, 0x88, 0x03, 0x31, 0x74, 0x24, 0x5C, 0x3D, 0x00,
+	0x16, 0xCC, 0xF1, 0x01, 0x03, 0xE1, 0x01, 0x54, 0x83, 0xFE, 0x02, 0x73,
+	0x29, 0x15, 0x02, 0x0C, 0x05, 0x02, 0x10, 0x51, 0xFF, 0x01, 0x00, 0x3B,
+	0x02, 0x8F, 0x50, 0x68, 0x1C, 0x74, 0x40, 0x00, 0xEB, 0x27, 0x29, 0x00,
+	0x10, 0x12, 0x28, 0x72, 0x01, 0x00, 0xFE, 0x02, 0x24, 0xC4, 0x10, 0x30,
+	0x00, 0x01, 0xCA, 0x04, 0x00, 0x31, 0x00, 0x04, 0x18, 0x06, 0x01, 0x36,
+	0x00, 0x21, 0xC7, 0x84, 0x1E, 0x00, 0x03, 0xC7, 0x00, 0x16, 0xC4, 0xC7,
+	0x00, 0x00, 0x2A, 0x00, 0x02, 0x46, 0x05, 0x00, 0xA3, 0x00, 0x02, 0xDF,
+	0x05, 0x09, 0x2E, 0x02, 0x53, 0x83, 0x44, 0x24, 0x48, 0x58, 0xC4, 0x01,
+	0x47, 0x8B, 0x4C, 0x24, 0x48, 0x37, 0x02, 0x00, 0xC6, 0x01, 0xF1, 0x01,
+	0x3B, 0xF0, 0x0F, 0x82, 0x49, 0xFE, 0xFF, 0xFF, 0x83, 0x7C, 0x24, 0x60,
+	0x00, 0x0F, 0x57, 0xC0, 0xAC, 0x02, 0xC4, 0x4C, 0x0F, 0x8E, 0x6A, 0x01,
+	0x00, 0x00, 0xEB, 0x03, 0x8D, 0x49, 0x00, 0x9F, 0x02, 0x25, 0x68, 0x34,
+	0xAE, 0x00, 0xA2, 0x8B, 0xBC, 0x24, 0x30, 0x02, 0x00, 0x00, 0x8B, 0xCF,
+	0x2B, 0x6C, 0x03, 0x0D, 0x65, 0x03, 0x30, 0x10, 0x33, 0xDB, 0x1E, 0x02,
+	0x10, 0xE0, 0x65, 0x03, 0x62, 0xF6, 0x6A, 0x02, 0xE8, 0x32, 0x2D, 0x21,
+	0x07, 0xC0, 0xF8, 0x6A, 0x00, 0x6A, 0x02, 0x57, 0x8D, 0x4C, 0x24, 0x70,
+	0x89, 0x7C, 0x51, 0x05, 0x10, 0x94, 0xE3, 0x04, 0x10, 0x02, 0x23, 0x04,
+	0x50, 0x57, 0x50, 0xFF, 0x15, 0xE0, 0x24, 0x04, 0x02, 0x52, 0x00, 0x21,
+	0x8B, 0xBC, 0xC6, 0x02, 0x2B, 0x2B, 0xCF, 0x5B, 0x00, 0xF1, 0x0B, 0x03,
+	0xC2, 0x83, 0xC4, 0x0C, 0x3B, 0xC3, 0x0F, 0x86, 0xF8, 0xF9, 0xFF, 0xFF,
+	0x0F, 0xB7, 0x44, 0x24, 0x48, 0x66, 0x0F, 0x6E, 0xC0, 0xF3, 0x0F, 0xE6,
+	0xC0, 0xA7, 0x00, 0xA1, 0x5C, 0x44, 0x3E, 0x30, 0xF2, 0x0F, 0x59, 0x44,
+	0x3E, 0x28, 0x0C, 0x00, 0x11, 0x20, 0x0C, 0x00, 0x00, 0x45, 0x02, 0x90,
+	0x04, 0x24, 0x83, 0xFB, 0x02, 0x73, 0x07, 0x68, 0x38, 0x9B, 0x01, 0x34,
+	0x05, 0x68, 0x40, 0xCB, 0x00, 0x10, 0x15, 0x83, 0x04, 0xA0, 0x83, 0xC4,
+	0x10, 0xFF, 0x74, 0x24, 0x5C, 0xFF, 0x15, 0x38, 0x81, 0x00, 0x34, 0xBC,
+	0x24, 0x24, 0xDC, 0x00, 0x00, 0x46, 0x01, 0x0B, 0x81, 0x00, 0x10, 0x43,
+	0x82, 0x00, 0xE1, 0x04, 0x83, 0xC6, 0x58, 0x3B, 0xD8, 0x0F, 0x82, 0x22,
+	0xFF, 0xFF, 0xFF, 0x2B, 0xBC, 0x66, 0x01, 0xE2, 0xF2, 0x0F, 0x10, 0x44,
+	0x24, 0x4C, 0x8B, 0x4C, 0x24, 0x60, 0xF2, 0x0F, 0x58, 0x84, 0x16, 0x01,
+	0x66, 0x17, 0x5D, 0x74, 0xD1, 0xF7, 0xEF, 0xBB, 0x00, 0x31, 0x03, 0xC8,
+	0x89, 0x20, 0x00, 0x00, 0x61, 0x01, 0x42, 0x85, 0xC9, 0x7E, 0x0B, 0x01,
+	0x05, 0xC1, 0xE9, 0x9B, 0xFE, 0xFF, 0xFF, 0xFF, 0x74, 0x24, 0x44, 0xFF,
+	0x15, 0x5C, 0x8D, 0x00, 0x86, 0x04, 0x8D, 0x4C, 0x24, 0x64, 0xE8, 0x95,
+	0x0B, 0x59, 0x05, 0x41, 0x0F, 0x82, 0x4A, 0xF8, 0xDA, 0x03, 0x00, 0x57,
+	0x05, 0x02, 0xF3, 0x06, 0x01, 0xA6, 0x06, 0xF1, 0x03, 0xE9, 0x39, 0xF8,
+	0xFF, 0xFF, 0x8B, 0x01, 0x56, 0x8B, 0x40, 0x04, 0x8D, 0x71, 0x70, 0xC7,
+	0x44, 0x30, 0x90, 0xBD, 0x07, 0xF2, 0x08, 0x46, 0x90, 0x8D, 0x4E, 0xA0,
+	0x8B, 0x50, 0x04, 0x8D, 0x42, 0x90, 0x89, 0x44, 0x32, 0x8C, 0xE8, 0xCA,
+	0x0B, 0x00, 0x00, 0x8D, 0x4E, 0xA8, 0xBA, 0x07, 0x50, 0x8B, 0xCE, 0x5E,
+	0xFF, 0x25, 0xB6, 0x07, 0x13, 0xCC, 0x01, 0x00, 0xB2, 0x55, 0x8B, 0xEC,
+	0x51, 0x56, 0x8B, 0xF1, 0x57, 0x8B, 0x4E, 0x48, 0xCA, 0x03, 0xF0, 0x04,
+	0x85, 0xC9, 0x74, 0x29, 0xFF, 0x75, 0xFC, 0x8B, 0x56, 0x4C, 0x51, 0xE8,
+	0x8F, 0x28, 0x00, 0x00, 0xFF, 0x76, 0x48, 0x57, 0x02, 0x40, 0x0C, 0xC7,
+	0x46, 0x48, 0x74, 0x02, 0x32, 0xC7, 0x46, 0x4C, 0x07, 0x00, 0x10, 0x50,
+	0x07, 0x00, 0x91, 0x83, 0x7E, 0x44, 0x10, 0x72, 0x08, 0xFF, 0x76, 0x30,
+	0x7A, 0x02, 0x31, 0xC7, 0x46, 0x44, 0xA2, 0x02, 0x21, 0x46, 0x40, 0x9E,
+	0x02, 0x61, 0x46, 0x30, 0x00, 0x83, 0x7E, 0x2C, 0x20, 0x00, 0x13, 0x18,
+	0x20, 0x00, 0x12, 0x2C, 0x20, 0x00, 0x12, 0x28, 0x20, 0x00, 0xA3, 0x18,
+	0x00, 0x83, 0x7E, 0x14, 0x10, 0x72, 0x07, 0xFF, 0x36, 0x1F, 0x00, 0x12,
+	0x14, 0x1F, 0x00, 0x10, 0x10, 0x1F, 0x00, 0x50, 0x5F, 0xC6, 0x06, 0x00,
+	0x5E, 0xF0, 0x07, 0x04, 0xAA, 0x00, 0x02, 0x01, 0x00, 0x60, 0x56, 0x8B,
+	0xF1, 0x83, 0x7E, 0x4C, 0x27, 0x03, 0x41, 0x76, 0x38, 0xFF, 0x15, 0xFF,
+	0x07, 0x00, 0x3A, 0x00, 0x12, 0x4C, 0x3A, 0x00, 0x01, 0xA3, 0x00, 0x32,
+	0xC6, 0x46, 0x38, 0x59, 0x00, 0x37, 0x0B, 0xFF, 0x36, 0x23, 0x00, 0x08,
+	0x5D, 0x00, 0x00, 0x5C, 0x00, 0x02, 0x59, 0x00, 0xC0, 0x55, 0x8B, 0xEC,
+	0x6A, 0xFF, 0x68, 0x08, 0x60, 0x40, 0x00, 0x64, 0xA1, 0x1A, 0x00, 0xF0,
+	0x02, 0x50, 0x51, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00, 0x33, 0xC5,
+	0x50, 0x8D, 0x45, 0xF4, 0x64, 0xA3, 0x15, 0x00, 0xE2, 0x8B, 0xF9, 0x89,
+	0x7D, 0xF0, 0x8B, 0x75, 0x08, 0x6A, 0xFF, 0x6A, 0x00, 0xC7, 0x47, 0x49,
+	0x00, 0x11, 0x47, 0x49, 0x00, 0xC0, 0x56, 0xC6, 0x07, 0x00, 0xE8, 0xF8,
+	0x15, 0x00, 0x00, 0xC7, 0x45, 0xFC, 0x10, 0x00, 0x04, 0xB7, 0x04, 0x24,
+	0x47, 0x18, 0xB3, 0x04, 0x21, 0x47, 0x20, 0xAF, 0x04, 0x00, 0x0A, 0x00,
+	0x11, 0x28, 0xA9, 0x04, 0x31, 0x8D, 0x4F, 0x38, 0xBC, 0x04, 0x12, 0x47,
+	0xB3, 0x04, 0x22, 0xC7, 0x41, 0x50, 0x00, 0x11, 0x41, 0x50, 0x00, 0x73,
+	0x50, 0xC6, 0x01, 0x00, 0xE8, 0xA8, 0x15, 0x96, 0x04, 0x00, 0x26, 0x00,
+	0x90, 0x50, 0x8B, 0xC7, 0x8B, 0x4D, 0xF4, 0x64, 0x89, 0x0D, 0x1F, 0x00,
+	0x20, 0x59, 0x5F, 0x13, 0x01, 0x25, 0xC2, 0x04, 0xBF, 0x01, 0x02, 0x10,
+	0x01, 0x0F, 0xEC, 0x00, 0x14, 0x03, 0xF0, 0x00, 0x00, 0xEF, 0x01, 0x01,
+	0x34, 0x00, 0xF0, 0x17, 0x04, 0x8B, 0x06, 0xEB, 0x02, 0x8B, 0xC6, 0x8B,
+	0x4D, 0x0C, 0x85, 0xC9, 0x75, 0x04, 0x33, 0xFF, 0xEB, 0x04, 0x8B, 0xF9,
+	0x2B, 0xF8, 0x8B, 0x45, 0x10, 0x85, 0xC0, 0x74, 0x02, 0x2B, 0xC1, 0x50,
+	0x57, 0x8B, 0xCE, 0xE8, 0xFC, 0x15, 0xE6, 0x01, 0xF3, 0x04, 0x14, 0x10,
+	0x72, 0x02, 0x8B, 0x36, 0x8B, 0x45, 0x08, 0x8D, 0x0C, 0x3E, 0x5F, 0x89,
+	0x08, 0x5E, 0x5D, 0xC2, 0x0C, 0x83, 0x00, 0x02, 0x40, 0x02, 0x7A, 0x75,
+	0x08, 0x6A, 0x02, 0x6A, 0x00, 0x51, 0x79, 0x00, 0x23, 0x8B, 0xCE, 0x15,
+	0x01, 0xA1, 0xC6, 0x06, 0x00, 0xE8, 0xD4, 0x14, 0x00, 0x00, 0x8B, 0xC6,
+	0xBE, 0x00, 0x04, 0x3B, 0x00, 0x08, 0x90, 0x00, 0xF2, 0x03, 0x8B, 0x4E,
+	0x04, 0x8B, 0x7D, 0x08, 0x3B, 0xF9, 0x73, 0x3E, 0x8B, 0x06, 0x3B, 0xC7,
+	0x77, 0x38, 0x2B, 0xF8, 0x7A, 0x03, 0x01, 0x40, 0x03, 0xF0, 0x18, 0xFA,
+	0xC1, 0xEF, 0x1F, 0x03, 0xFA, 0x3B, 0x4E, 0x08, 0x75, 0x08, 0x51, 0x8B,
+	0xCE, 0xE8, 0xA9, 0x16, 0x00, 0x00, 0x6B, 0xFF, 0x58, 0x03, 0x3E, 0x57,
+	0xFF, 0x76, 0x04, 0xE8, 0xBB, 0x22, 0x00, 0x00, 0x83, 0x46, 0x04, 0x58,
+	0x5F, 0x5E, 0x18, 0x01, 0x05, 0x25, 0x00, 0x41, 0x84, 0x16, 0x00, 0x00,
+	0x20, 0x00, 0x19, 0x9B, 0x20, 0x00, 0x03, 0xF0, 0x01, 0x25, 0xE2, 0x5F,
+	0xF0, 0x01, 0x3F, 0x83, 0xEC, 0x0C, 0xF2, 0x01, 0x01, 0x70, 0xF1, 0x89,
+	0x75, 0xEC, 0xC7, 0x45, 0xF0, 0x0C, 0x00, 0x80, 0x8D, 0x4E, 0x68, 0xC7,
+	0x06, 0x34, 0x75, 0x40, 0xD8, 0x00, 0x70, 0x74, 0x75, 0x40, 0x00, 0xFF,
+	0x15, 0x68, 0xB9, 0x04, 0x43, 0x00, 0x8D, 0x7E, 0x18, 0xE1, 0x00, 0x10,
+	0x57, 0xEB, 0x00, 0x10, 0xF0, 0x8B, 0x05, 0x50, 0xFF, 0x15, 0x5C, 0x70,
+	0x40, 0x0D, 0x02, 0x00, 0x0D, 0x00, 0xF0, 0x11, 0x8B, 0x06, 0x89, 0x7D,
+	0xE8, 0x8B, 0x40, 0x04, 0xC7, 0x04, 0x06, 0x28, 0x75, 0x40, 0x00, 0x8B,
+	0x06, 0x8B, 0x48, 0x04, 0x8D, 0x41, 0x98, 0x89, 0x44, 0x31, 0xFC, 0x8B,
+	0xCF, 0xFF, 0x15, 0x54, 0x90, 0x03, 0xF0, 0x03, 0x45, 0x08, 0xC6, 0x45,
+	0xFC, 0x02, 0xC7, 0x07, 0xC4, 0x74, 0x40, 0x00, 0x83, 0x78, 0x14, 0x10,
+	0x8B, 0x48, 0x6B, 0x01, 0x41, 0x00, 0xC7, 0x47, 0x38, 0x67, 0x03, 0x20,
+	0x47, 0x3C, 0x07, 0x00, 0xB0, 0x85, 0xC9, 0x74, 0x09, 0x51, 0x50, 0x8B,
+	0xCF, 0xE8, 0x8E, 0x1B, 0x46, 0x01, 0x0D, 0x10, 0x02, 0x07, 0x52, 0x01,
+	0x90, 0x56, 0x8B, 0xF1, 0xF6, 0x46, 0x3C, 0x01, 0xC7, 0x06, 0x51, 0x00,
+	0x75, 0x74, 0x0E, 0x8B, 0x46, 0x0C, 0xFF, 0x30, 0x19, 0x02, 0x61, 0x8B,
+	0x46, 0x0C, 0x8B, 0xCE, 0xC7, 0x3C, 0x06, 0x34, 0x8B, 0x46, 0x1C, 0x09,
+	0x00, 0x14, 0x2C, 0x09, 0x00, 0x14, 0x10, 0x09, 0x00, 0x14, 0x20, 0x09,
+	0x00, 0x12, 0x30, 0x09, 0x00, 0x61, 0x83, 0x66, 0x3C, 0xFE, 0xC7, 0x46,
+	0x92, 0x00, 0x47, 0x5E, 0xFF, 0x25, 0xE0, 0x3F, 0x04, 0x00, 0x50, 0x01,
+	0xF3, 0x01, 0x83, 0xEC, 0x08, 0x56, 0x8B, 0xF1, 0x8B, 0x46, 0x3C, 0xA8,
+	0x02, 0x74, 0x0A, 0x83, 0xC8, 0xFF, 0xA3, 0x02, 0xC3, 0x53, 0x8B, 0x5D,
+	0x08, 0x83, 0xFB, 0xFF, 0x75, 0x0A, 0x5B, 0x33, 0xC0, 0x13, 0x00, 0xF0,
+	0x18, 0x57, 0xA8, 0x08, 0x74, 0x23, 0x8B, 0x46, 0x20, 0x8B, 0x10, 0x85,
 	0xD2, 0x74, 0x1A, 0x8B, 0x7E, 0x38, 0x3B, 0xD7, 0x73, 0x13, 0x8B, 0x46,
 	0x30, 0x8B, 0x08, 0x8B, 0x46, 0x20, 0x03, 0xCA, 0x89, 0x38, 0x8B, 0x46,
-	0x30, 0x2B, 0xCF, 0x89, 0x08, 0x8B, 0x46, 0x20, 0x8B, 0x10, 0x85, 0xD2,
-	0x74, 0x24, 0x8B, 0x4E, 0x30, 0x8B, 0x09, 0x03, 0xCA, 0x3B, 0xD1, 0x73,
-	0x15, 0x8B, 0xCE, 0xFF, 0x15, 0x70, 0x70, 0x40, 0x00, 0x88, 0x18, 0x5F,
-	0x8B, 0xC3, 0x5B, 0x5E, 0x8B, 0xE5, 0x5D, 0xC2, 0x04, 0x00, 0x85, 0xD2,
-	0x75, 0x04, 0x33, 0xFF, 0xEB, 0x0C, 0x8B, 0x46, 0x30, 0x8B, 0x4E, 0x0C,
-	0x8B, 0x38, 0x2B, 0x39, 0x03, 0xFA, 0x8B, 0xCF, 0xD1, 0xE9, 0x83, 0xF9,
-	0x20, 0x73, 0x07, 0xB9, 0x20, 0x00, 0x00, 0x00, 0xEB, 0x04, 0x85, 0xC9,
-	0x74, 0x13, 0xB8, 0xFF, 0xFF, 0xFF, 0x7F, 0x2B, 0xC1, 0x3B, 0xC7, 0x73,
-	0x04, 0xD1, 0xE9, 0x75, 0xF1, 0x85, 0xC9, 0x75, 0x0C, 0x5F, 0x5B, 0x83,
-	0xC8, 0xFF, 0x5E, 0x8B, 0xE5, 0x5D, 0xC2, 0x04, 0x00, 0x8D, 0x04, 0x39,
-	0x33, 0xDB, 0x89, 0x45, 0xF8, 0x85, 0xC0, 0x74, 0x1B, 0x83, 0xF8, 0xFF,
-	0x77, 0x10, 0x50, 0xFF, 0x15, 0x60, 0x71, 0x40, 0x00, 0x8B, 0xD8, 0x83,
-	0xC4, 0x04, 0x85, 0xDB, 0x75, 0x06, 0xFF, 0x15, 0xF0, 0x70, 0x40, 0x00,
-	0x8B, 0x46, 0x0C, 0x8B, 0x08, 0x89, 0x4D, 0xFC, 0x85, 0xFF, 0x74, 0x12,
-	0x57, 0x51, 0x53, 0xE8, 0xBA, 0x30, 0x00, 0x00, 0x8B, 0x4D, 0xFC, 0x83,
-	0xC4, 0x0C, 0x85, 0xFF, 0x75, 0x40, 0x8B, 0x46, 0x10, 0x8B, 0x55, 0xF8,
-	0x8B, 0x7D, 0xFC, 0x89, 0x5E, 0x38, 0x89, 0x18, 0x8B, 0x46, 0x20, 0x89,
-	0x18, 0x8B, 0x46, 0x30, 0x89, 0x10, 0x8B, 0x46, 0x0C, 0xF6, 0x46, 0x3C,
-	0x04, 0x89, 0x18, 0x8B, 0x46, 0x1C, 0x74, 0x0D, 0xC7, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x8B, 0x46, 0x2C, 0x89, 0x18, 0xEB, 0x75, 0x89, 0x18, 0x8B,
-	0x46, 0x2C, 0xC7, 0x00, 0x01, 0x00, 0x00, 0x00, 0xEB, 0x68, 0x8B, 0x7D,
-	0xFC, 0x8B, 0xC3, 0x2B, 0xC1, 0x01, 0x46, 0x38, 0x8B, 0x46, 0x20, 0x8B,
-	0x10, 0x2B, 0xD1, 0x8B, 0x4E, 0x10, 0x8B, 0xC3, 0x2B, 0xC7, 0x01, 0x01,
-	0x8B, 0x46, 0x20, 0x03, 0xD3, 0x8B, 0xCB, 0x89, 0x10, 0x8B, 0x46, 0x30,
-	0x2B, 0xCA, 0x03, 0x4D, 0xF8, 0x89, 0x08, 0xF6, 0x46, 0x3C, 0x04, 0x74,
-	0x15, 0x8B, 0x46, 0x0C, 0x89, 0x18, 0x8B, 0x46, 0x1C, 0xC7, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x8B, 0x46, 0x2C, 0x89, 0x18, 0xEB, 0x20, 0x8B, 0x46,
-	0x20, 0x8B, 0x10, 0x8B, 0x46, 0x1C, 0x8B, 0x08, 0x8B, 0x46, 0x0C, 0x2B,
-	0xCF, 0x89, 0x18, 0x8B, 0x46, 0x1C, 0x03, 0xCB, 0x89, 0x08, 0x8B, 0x46,
-	0x2C, 0x2B, 0xD1, 0x42, 0x89, 0x10, 0xF6, 0x46, 0x3C, 0x01, 0x74, 0x0A,
-	0x57, 0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0x83, 0x4E,
-	0x3C, 0x01, 0x8B, 0xCE, 0xFF, 0x15, 0x70, 0x70, 0x40, 0x00, 0x8B, 0x4D,
-	0x08, 0x5F, 0x5B, 0x88, 0x08, 0x8B, 0xC1, 0x5E, 0x8B, 0xE5, 0x5D, 0xC2,
-	0x04, 0x00, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x8B, 0xD1, 0x56, 0x8B, 0x42,
-	0x1C, 0x8B, 0x30, 0x85, 0xF6, 0x74, 0x40, 0x8B, 0x42, 0x0C, 0x3B, 0x30,
-	0x76, 0x39, 0x8B, 0x4D, 0x08, 0x83, 0xF9, 0xFF, 0x74, 0x0B, 0x3A, 0x4E,
-	0xFF, 0x74, 0x06, 0xF6, 0x42, 0x3C, 0x02, 0x75, 0x26, 0x8B, 0x42, 0x2C,
-	0xFF, 0x00, 0x8B, 0x42, 0x1C, 0xFF, 0x08, 0x83, 0xF9, 0xFF, 0x74, 0x0E,
-	0x8B, 0x42, 0x1C, 0x5E, 0x8B, 0x00, 0x88, 0x08, 0x8B, 0xC1, 0x5D, 0xC2,
-	0x04, 0x00, 0x33, 0xC9, 0x8B, 0xC1, 0x5E, 0x5D, 0xC2, 0x04, 0x00, 0x83,
-	0xC8, 0xFF, 0x5E, 0x5D, 0xC2, 0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x56, 0x8B, 0x71, 0x1C, 0x8B, 0x16, 0x85, 0xD2,
-	0x75, 0x05, 0x83, 0xC8, 0xFF, 0x5E, 0xC3, 0x57, 0x8B, 0x79, 0x2C, 0x8B,
-	0x07, 0x03, 0xC2, 0x3B, 0xD0, 0x73, 0x06, 0x0F, 0xB6, 0x02, 0x5F, 0x5E,
-	0xC3, 0xF6, 0x41, 0x3C, 0x04, 0x75, 0x2C, 0x8B, 0x41, 0x20, 0x8B, 0x00,
-	0x85, 0xC0, 0x74, 0x23, 0x3B, 0xC2, 0x77, 0x05, 0x39, 0x51, 0x38, 0x76,
-	0x1A, 0x39, 0x41, 0x38, 0x73, 0x03, 0x89, 0x41, 0x38, 0x8B, 0x41, 0x38,
-	0x2B, 0x06, 0x89, 0x07, 0x8B, 0x41, 0x1C, 0x5F, 0x8B, 0x00, 0x5E, 0x0F,
-	0xB6, 0x00, 0xC3, 0x5F, 0x83, 0xC8, 0xFF, 0x5E, 0xC3, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x51, 0x53, 0x8B, 0xD9, 0x56,
-	0x8B, 0x53, 0x20, 0x57, 0x8B, 0x02, 0x85, 0xC0, 0x74, 0x08, 0x39, 0x43,
-	0x38, 0x73, 0x03, 0x89, 0x43, 0x38, 0x8B, 0x4D, 0x18, 0xF6, 0xC1, 0x01,
-	0x0F, 0x84, 0xD0, 0x00, 0x00, 0x00, 0x8B, 0x43, 0x1C, 0x8B, 0x30, 0x89,
-	0x75, 0xFC, 0x85, 0xF6, 0x0F, 0x84, 0xC0, 0x00, 0x00, 0x00, 0x8B, 0x45,
-	0x14, 0x83, 0xF8, 0x02, 0x75, 0x15, 0x8B, 0x4B, 0x0C, 0x8B, 0x43, 0x38,
-	0x2B, 0x01, 0x8B, 0x75, 0x0C, 0x8B, 0x7D, 0x10, 0x99, 0x03, 0xF0, 0x13,
-	0xFA, 0xEB, 0x35, 0x83, 0xF8, 0x01, 0x75, 0x19, 0xF6, 0xC1, 0x02, 0x75,
-	0x18, 0x8B, 0x4B, 0x0C, 0x8B, 0x7D, 0x10, 0x8B, 0xC6, 0x2B, 0x01, 0x8B,
-	0x75, 0x0C, 0x99, 0x03, 0xF0, 0x13, 0xFA, 0xEB, 0x17, 0x85, 0xC0, 0x74,
-	0x0D, 0x8B, 0x3D, 0xFC, 0x70, 0x40, 0x00, 0x8B, 0x37, 0x8B, 0x7F, 0x04,
-	0xEB, 0x06, 0x8B, 0x7D, 0x10, 0x8B, 0x75, 0x0C, 0x85, 0xFF, 0x0F, 0x8C,
-	0x01, 0x01, 0x00, 0x00, 0x7F, 0x08, 0x85, 0xF6, 0x0F, 0x82, 0xF7, 0x00,
-	0x00, 0x00, 0x8B, 0x43, 0x0C, 0x8B, 0x08, 0x8B, 0x43, 0x38, 0x2B, 0xC1,
-	0x99, 0x3B, 0xFA, 0x0F, 0x8F, 0xE4, 0x00, 0x00, 0x00, 0x7C, 0x08, 0x3B,
-	0xF0, 0x0F, 0x87, 0xDA, 0x00, 0x00, 0x00, 0x2B, 0x4D, 0xFC, 0x8B, 0x43,
-	0x2C, 0x03, 0xCE, 0x29, 0x08, 0x8B, 0x43, 0x1C, 0x01, 0x08, 0xF6, 0x45,
-	0x18, 0x02, 0x0F, 0x84, 0xCB, 0x00, 0x00, 0x00, 0x8B, 0x53, 0x20, 0x83,
-	0x3A, 0x00, 0x0F, 0x84, 0xBF, 0x00, 0x00, 0x00, 0x8B, 0x43, 0x30, 0x8B,
-	0x08, 0x8B, 0x43, 0x1C, 0x03, 0x0A, 0x8B, 0x00, 0x89, 0x02, 0x2B, 0xC8,
-	0x8B, 0x43, 0x30, 0x89, 0x08, 0xE9, 0xA5, 0x00, 0x00, 0x00, 0xF6, 0xC1,
-	0x02, 0x0F, 0x84, 0x86, 0x00, 0x00, 0x00, 0x8B, 0x12, 0x89, 0x55, 0x18,
-	0x85, 0xD2, 0x74, 0x7D, 0x8B, 0x45, 0x14, 0x83, 0xF8, 0x02, 0x75, 0x15,
-	0x8B, 0x4B, 0x0C, 0x8B, 0x43, 0x38, 0x2B, 0x01, 0x8B, 0x75, 0x0C, 0x8B,
-	0x7D, 0x10, 0x99, 0x03, 0xF0, 0x13, 0xFA, 0xEB, 0x30, 0x83, 0xF8, 0x01,
-	0x75, 0x14, 0x8B, 0x4B, 0x0C, 0x8B, 0x75, 0x0C, 0x8B, 0x7D, 0x10, 0x8B,
-	0xC2, 0x2B, 0x01, 0x99, 0x03, 0xF0, 0x13, 0xFA, 0xEB, 0x17, 0x85, 0xC0,
-	0x74, 0x0D, 0x8B, 0x3D, 0xFC, 0x70, 0x40, 0x00, 0x8B, 0x37, 0x8B, 0x7F,
-	0x04, 0xEB, 0x06, 0x8B, 0x7D, 0x10, 0x8B, 0x75, 0x0C, 0x85, 0xFF, 0x7C,
-	0x38, 0x7F, 0x04, 0x85, 0xF6, 0x72, 0x32, 0x8B, 0x43, 0x0C, 0x8B, 0x08,
-	0x8B, 0x43, 0x38, 0x2B, 0xC1, 0x99, 0x3B, 0xFA, 0x7F, 0x23, 0x7C, 0x04,
-	0x3B, 0xF0, 0x77, 0x1D, 0x2B, 0x4D, 0x18, 0x8B, 0x43, 0x30, 0x03, 0xCE,
-	0x29, 0x08, 0x8B, 0x43, 0x20, 0x01, 0x08, 0xEB, 0x16, 0x8B, 0x75, 0x0C,
-	0x8B, 0x7D, 0x10, 0x8B, 0xC6, 0x0B, 0xC7, 0x74, 0x0A, 0xA1, 0xFC, 0x70,
-	0x40, 0x00, 0x8B, 0x30, 0x8B, 0x78, 0x04, 0x8B, 0x45, 0x08, 0x89, 0x78,
-	0x04, 0x5F, 0x89, 0x30, 0x5E, 0xC7, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00,
-	0xC7, 0x40, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x40, 0x10, 0x00, 0x00,
-	0x00, 0x00, 0x5B, 0x8B, 0xE5, 0x5D, 0xC2, 0x14, 0x00, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x83, 0xE4, 0xF8, 0x83, 0xEC, 0x0C, 0x53, 0x8B, 0x5D,
-	0x18, 0x56, 0x8B, 0x75, 0x14, 0x03, 0x75, 0x0C, 0x57, 0x13, 0x5D, 0x10,
-	0x8B, 0xF9, 0x8B, 0x47, 0x20, 0x8B, 0x00, 0x85, 0xC0, 0x74, 0x08, 0x39,
-	0x47, 0x38, 0x73, 0x03, 0x89, 0x47, 0x38, 0xA1, 0xFC, 0x70, 0x40, 0x00,
-	0x8B, 0x08, 0x8B, 0x40, 0x04, 0x89, 0x4C, 0x24, 0x0C, 0x89, 0x44, 0x24,
-	0x10, 0x3B, 0xF1, 0x75, 0x08, 0x3B, 0xD8, 0x0F, 0x84, 0xBA, 0x00, 0x00,
-	0x00, 0x8B, 0x55, 0x24, 0xF6, 0xC2, 0x01, 0x74, 0x6F, 0x8B, 0x47, 0x1C,
-	0x8B, 0x00, 0x89, 0x44, 0x24, 0x14, 0x85, 0xC0, 0x74, 0x5E, 0x85, 0xDB,
-	0x7C, 0x54, 0x7F, 0x04, 0x85, 0xF6, 0x72, 0x4E, 0x8B, 0x47, 0x0C, 0x8B,
-	0x08, 0x8B, 0x47, 0x38, 0x2B, 0xC1, 0x99, 0x3B, 0xDA, 0x7F, 0x3B, 0x7C,
-	0x04, 0x3B, 0xF0, 0x77, 0x35, 0x2B, 0x4C, 0x24, 0x14, 0x8B, 0x47, 0x2C,
-	0x03, 0xCE, 0x29, 0x08, 0x8B, 0x47, 0x1C, 0x01, 0x08, 0xF6, 0x45, 0x24,
-	0x02, 0x74, 0x70, 0x8B, 0x57, 0x20, 0x83, 0x3A, 0x00, 0x74, 0x68, 0x8B,
-	0x47, 0x30, 0x8B, 0x08, 0x8B, 0x47, 0x1C, 0x03, 0x0A, 0x8B, 0x00, 0x89,
-	0x02, 0x2B, 0xC8, 0x8B, 0x47, 0x30, 0x89, 0x08, 0xEB, 0x51, 0x8B, 0x4C,
+	0x30, 0x2B, 0xCF, 0x89, 0x0E, 0x00, 0x01, 0x23, 0x00, 0xF3, 0x0B, 0x24,
+	0x8B, 0x4E, 0x30, 0x8B, 0x09, 0x03, 0xCA, 0x3B, 0xD1, 0x73, 0x15, 0x8B,
+	0xCE, 0xFF, 0x15, 0x70, 0x70, 0x40, 0x00, 0x88, 0x18, 0x5F, 0x8B, 0xC3,
+	0x5B, 0x51, 0x00, 0x21, 0x85, 0xD2, 0xB8, 0x02, 0x10, 0x0C, 0x44, 0x00,
+	0xF6, 0x22, 0x4E, 0x0C, 0x8B, 0x38, 0x2B, 0x39, 0x03, 0xFA, 0x8B, 0xCF,
+	0xD1, 0xE9, 0x83, 0xF9, 0x20, 0x73, 0x07, 0xB9, 0x20, 0x00, 0x00, 0x00,
+	0xEB, 0x04, 0x85, 0xC9, 0x74, 0x13, 0xB8, 0xFF, 0xFF, 0xFF, 0x7F, 0x2B,
+	0xC1, 0x3B, 0xC7, 0x73, 0x04, 0xD1, 0xE9, 0x75, 0xF1, 0x85, 0xC9, 0x75,
+	0x0C, 0x5F, 0x5B, 0xAB, 0x00, 0xF0, 0x06, 0x8D, 0x04, 0x39, 0x33, 0xDB,
+	0x89, 0x45, 0xF8, 0x85, 0xC0, 0x74, 0x1B, 0x83, 0xF8, 0xFF, 0x77, 0x10,
+	0x50, 0xFF, 0x15, 0x60, 0x0E, 0x06, 0xB0, 0xD8, 0x83, 0xC4, 0x04, 0x85,
+	0xDB, 0x75, 0x06, 0xFF, 0x15, 0xF0, 0xAD, 0x01, 0xF0, 0x1F, 0x46, 0x0C,
+	0x8B, 0x08, 0x89, 0x4D, 0xFC, 0x85, 0xFF, 0x74, 0x12, 0x57, 0x51, 0x53,
+	0xE8, 0xBA, 0x30, 0x00, 0x00, 0x8B, 0x4D, 0xFC, 0x83, 0xC4, 0x0C, 0x85,
+	0xFF, 0x75, 0x40, 0x8B, 0x46, 0x10, 0x8B, 0x55, 0xF8, 0x8B, 0x7D, 0xFC,
+	0x89, 0x5E, 0x38, 0x89, 0x18, 0x8B, 0x46, 0x20, 0x05, 0x00, 0xA0, 0x30,
+	0x89, 0x10, 0x8B, 0x46, 0x0C, 0xF6, 0x46, 0x3C, 0x04, 0x0E, 0x00, 0x35,
+	0x1C, 0x74, 0x0D, 0x75, 0x01, 0x40, 0x89, 0x18, 0xEB, 0x75, 0x14, 0x00,
+	0x30, 0x2C, 0xC7, 0x00, 0x2C, 0x02, 0xC1, 0xEB, 0x68, 0x8B, 0x7D, 0xFC,
+	0x8B, 0xC3, 0x2B, 0xC1, 0x01, 0x46, 0x38, 0xFF, 0x00, 0xB0, 0x2B, 0xD1,
+	0x8B, 0x4E, 0x10, 0x8B, 0xC3, 0x2B, 0xC7, 0x01, 0x01, 0x1D, 0x01, 0x30,
+	0xD3, 0x8B, 0xCB, 0x4B, 0x00, 0x80, 0x30, 0x2B, 0xCA, 0x03, 0x4D, 0xF8,
+	0x89, 0x08, 0x52, 0x00, 0x51, 0x74, 0x15, 0x8B, 0x46, 0x0C, 0x57, 0x00,
+	0x08, 0x55, 0x00, 0x11, 0x20, 0x3E, 0x00, 0x30, 0x8B, 0x46, 0x1C, 0x55,
+	0x01, 0x31, 0x0C, 0x2B, 0xCF, 0x21, 0x00, 0x20, 0x03, 0xCB, 0x55, 0x01,
+	0x60, 0x2C, 0x2B, 0xD1, 0x42, 0x89, 0x10, 0x1F, 0x02, 0x35, 0x74, 0x0A,
+	0x57, 0x15, 0x02, 0x44, 0x83, 0x4E, 0x3C, 0x01, 0x5D, 0x01, 0x95, 0x8B,
+	0x4D, 0x08, 0x5F, 0x5B, 0x88, 0x08, 0x8B, 0xC1, 0x67, 0x04, 0xF1, 0x23,
+	0x55, 0x8B, 0xEC, 0x8B, 0xD1, 0x56, 0x8B, 0x42, 0x1C, 0x8B, 0x30, 0x85,
+	0xF6, 0x74, 0x40, 0x8B, 0x42, 0x0C, 0x3B, 0x30, 0x76, 0x39, 0x8B, 0x4D,
+	0x08, 0x83, 0xF9, 0xFF, 0x74, 0x0B, 0x3A, 0x4E, 0xFF, 0x74, 0x06, 0xF6,
+	0x42, 0x3C, 0x02, 0x75, 0x26, 0x8B, 0x42, 0x2C, 0xFF, 0x00, 0x8B, 0x42,
+	0x1C, 0xFF, 0x1A, 0x00, 0x70, 0x0E, 0x8B, 0x42, 0x1C, 0x5E, 0x8B, 0x00,
+	0x4B, 0x00, 0x00, 0x48, 0x00, 0x41, 0x33, 0xC9, 0x8B, 0xC1, 0x80, 0x03,
+	0x00, 0x74, 0x01, 0x0B, 0xC0, 0x04, 0x80, 0x71, 0x1C, 0x8B, 0x16, 0x85,
+	0xD2, 0x75, 0x05, 0x1B, 0x00, 0xF1, 0x37, 0xC3, 0x57, 0x8B, 0x79, 0x2C,
+	0x8B, 0x07, 0x03, 0xC2, 0x3B, 0xD0, 0x73, 0x06, 0x0F, 0xB6, 0x02, 0x5F,
+	0x5E, 0xC3, 0xF6, 0x41, 0x3C, 0x04, 0x75, 0x2C, 0x8B, 0x41, 0x20, 0x8B,
+	0x00, 0x85, 0xC0, 0x74, 0x23, 0x3B, 0xC2, 0x77, 0x05, 0x39, 0x51, 0x38,
+	0x76, 0x1A, 0x39, 0x41, 0x38, 0x73, 0x03, 0x89, 0x41, 0x38, 0x8B, 0x41,
+	0x38, 0x2B, 0x06, 0x89, 0x07, 0x8B, 0x41, 0x1C, 0x5F, 0x8B, 0x00, 0x5E,
+	0x0F, 0xB6, 0x00, 0xC3, 0x5F, 0x4A, 0x00, 0x07, 0xE0, 0x06, 0xF0, 0x01,
+	0x53, 0x8B, 0xD9, 0x56, 0x8B, 0x53, 0x20, 0x57, 0x8B, 0x02, 0x85, 0xC0,
+	0x74, 0x08, 0x39, 0x43, 0x39, 0x00, 0xB0, 0x43, 0x38, 0x8B, 0x4D, 0x18,
+	0xF6, 0xC1, 0x01, 0x0F, 0x84, 0xD0, 0x3B, 0x01, 0xC0, 0x43, 0x1C, 0x8B,
+	0x30, 0x89, 0x75, 0xFC, 0x85, 0xF6, 0x0F, 0x84, 0xC0, 0x10, 0x00, 0xF0,
+	0x17, 0x45, 0x14, 0x83, 0xF8, 0x02, 0x75, 0x15, 0x8B, 0x4B, 0x0C, 0x8B,
+	0x43, 0x38, 0x2B, 0x01, 0x8B, 0x75, 0x0C, 0x8B, 0x7D, 0x10, 0x99, 0x03,
+	0xF0, 0x13, 0xFA, 0xEB, 0x35, 0x83, 0xF8, 0x01, 0x75, 0x19, 0xF6, 0xC1,
+	0x02, 0x75, 0x18, 0x1F, 0x00, 0x41, 0x7D, 0x10, 0x8B, 0xC6, 0x21, 0x00,
+	0x02, 0x1E, 0x00, 0x80, 0x17, 0x85, 0xC0, 0x74, 0x0D, 0x8B, 0x3D, 0xFC,
+	0x4D, 0x01, 0x60, 0x37, 0x8B, 0x7F, 0x04, 0xEB, 0x06, 0x22, 0x00, 0xF1,
+	0x02, 0x75, 0x0C, 0x85, 0xFF, 0x0F, 0x8C, 0x01, 0x01, 0x00, 0x00, 0x7F,
+	0x08, 0x85, 0xF6, 0x0F, 0x82, 0xF7, 0x74, 0x00, 0x30, 0x0C, 0x8B, 0x08,
+	0x5E, 0x00, 0xF0, 0x1B, 0xC1, 0x99, 0x3B, 0xFA, 0x0F, 0x8F, 0xE4, 0x00,
+	0x00, 0x00, 0x7C, 0x08, 0x3B, 0xF0, 0x0F, 0x87, 0xDA, 0x00, 0x00, 0x00,
+	0x2B, 0x4D, 0xFC, 0x8B, 0x43, 0x2C, 0x03, 0xCE, 0x29, 0x08, 0x8B, 0x43,
+	0x1C, 0x01, 0x08, 0xF6, 0x45, 0x18, 0x02, 0x0F, 0x84, 0xCB, 0x36, 0x00,
+	0x81, 0x53, 0x20, 0x83, 0x3A, 0x00, 0x0F, 0x84, 0xBF, 0x42, 0x00, 0x00,
+	0x3A, 0x03, 0xF0, 0x0B, 0x43, 0x1C, 0x03, 0x0A, 0x8B, 0x00, 0x89, 0x02,
+	0x2B, 0xC8, 0x8B, 0x43, 0x30, 0x89, 0x08, 0xE9, 0xA5, 0x00, 0x00, 0x00,
+	0xF6, 0xC1, 0x02, 0x0F, 0x84, 0x86, 0x23, 0x00, 0x8F, 0x12, 0x89, 0x55,
+	0x18, 0x85, 0xD2, 0x74, 0x7D, 0xD2, 0x00, 0x09, 0x10, 0x30, 0xD2, 0x00,
+	0x10, 0x14, 0x1A, 0x00, 0x01, 0x15, 0x00, 0x4F, 0x8B, 0xC2, 0x2B, 0x01,
+	0xCD, 0x00, 0x0D, 0x89, 0x7C, 0x38, 0x7F, 0x04, 0x85, 0xF6, 0x72, 0x32,
+	0xC5, 0x00, 0xE2, 0x7F, 0x23, 0x7C, 0x04, 0x3B, 0xF0, 0x77, 0x1D, 0x2B,
+	0x4D, 0x18, 0x8B, 0x43, 0x30, 0xBD, 0x00, 0x53, 0x20, 0x01, 0x08, 0xEB,
+	0x16, 0x58, 0x00, 0x61, 0xC6, 0x0B, 0xC7, 0x74, 0x0A, 0xA1, 0x4E, 0x00,
+	0xF1, 0x02, 0x30, 0x8B, 0x78, 0x04, 0x8B, 0x45, 0x08, 0x89, 0x78, 0x04,
+	0x5F, 0x89, 0x30, 0x5E, 0xC7, 0x40, 0x08, 0xEE, 0x04, 0x22, 0x40, 0x0C,
+	0x07, 0x00, 0x01, 0x3F, 0x06, 0x10, 0x5B, 0x83, 0x02, 0x18, 0x14, 0x2C,
+	0x06, 0x04, 0x70, 0x04, 0xF2, 0x09, 0xE4, 0xF8, 0x83, 0xEC, 0x0C, 0x53,
+	0x8B, 0x5D, 0x18, 0x56, 0x8B, 0x75, 0x14, 0x03, 0x75, 0x0C, 0x57, 0x13,
+	0x5D, 0x10, 0x8B, 0xF9, 0x8B, 0x47, 0x23, 0x02, 0x30, 0x08, 0x39, 0x47,
+	0xE1, 0x01, 0x22, 0x47, 0x38, 0x6A, 0x00, 0xF0, 0x06, 0x08, 0x8B, 0x40,
+	0x04, 0x89, 0x4C, 0x24, 0x0C, 0x89, 0x44, 0x24, 0x10, 0x3B, 0xF1, 0x75,
+	0x08, 0x3B, 0xD8, 0x0F, 0x84, 0xBA, 0x1A, 0x01, 0xF1, 0x09, 0x55, 0x24,
+	0xF6, 0xC2, 0x01, 0x74, 0x6F, 0x8B, 0x47, 0x1C, 0x8B, 0x00, 0x89, 0x44,
+	0x24, 0x14, 0x85, 0xC0, 0x74, 0x5E, 0x85, 0xDB, 0x7C, 0x54, 0xD9, 0x00,
+	0x30, 0x4E, 0x8B, 0x47, 0xD9, 0x00, 0x11, 0x47, 0xD9, 0x00, 0x31, 0xDA,
+	0x7F, 0x3B, 0xD9, 0x00, 0x72, 0x35, 0x2B, 0x4C, 0x24, 0x14, 0x8B, 0x47,
+	0x97, 0x01, 0x11, 0x47, 0x97, 0x01, 0x60, 0x24, 0x02, 0x74, 0x70, 0x8B,
+	0x57, 0x93, 0x01, 0x40, 0x74, 0x68, 0x8B, 0x47, 0x8F, 0x01, 0x16, 0x47,
+	0x8F, 0x01, 0xF3, 0x0A, 0x47, 0x30, 0x89, 0x08, 0xEB, 0x51, 0x8B, 0x4C,
 	0x24, 0x0C, 0x8B, 0x5C, 0x24, 0x10, 0xEB, 0x45, 0x8B, 0x44, 0x24, 0x10,
-	0xF6, 0xC2, 0x02, 0x74, 0x3A, 0x8B, 0x57, 0x20, 0x83, 0x3A, 0x00, 0x74,
-	0x32, 0x85, 0xDB, 0x7C, 0xE5, 0x7F, 0x04, 0x85, 0xF6, 0x72, 0xDF, 0x8B,
-	0x47, 0x0C, 0x8B, 0x08, 0x8B, 0x47, 0x38, 0x2B, 0xC1, 0x99, 0x3B, 0xDA,
-	0x7F, 0xCC, 0x7C, 0x04, 0x3B, 0xF0, 0x77, 0xC6, 0x8B, 0x47, 0x20, 0x2B,
-	0x08, 0x8B, 0x47, 0x30, 0x03, 0xCE, 0x29, 0x08, 0x8B, 0x47, 0x20, 0x01,
-	0x08, 0xEB, 0x04, 0x8B, 0xD8, 0x8B, 0xF1, 0x8B, 0x45, 0x08, 0x5F, 0x89,
-	0x30, 0x5E, 0x89, 0x58, 0x04, 0xC7, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00,
-	0xC7, 0x40, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x40, 0x10, 0x00, 0x00,
-	0x00, 0x00, 0x5B, 0x8B, 0xE5, 0x5D, 0xC2, 0x20, 0x00, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x56, 0x8B, 0xF1, 0x8B, 0x06, 0x85, 0xC0, 0x74,
-	0x28, 0xFF, 0x76, 0x04, 0x50, 0xE8, 0xFE, 0x15, 0x00, 0x00, 0xFF, 0x36,
-	0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0xC7, 0x06, 0x00,
-	0x00, 0x00, 0x00, 0xC7, 0x46, 0x04, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x46,
-	0x08, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x56,
-	0x8B, 0x31, 0x8B, 0x49, 0x04, 0x2B, 0xCE, 0xB8, 0xAB, 0xAA, 0xAA, 0x2A,
-	0xF7, 0xE9, 0x8B, 0x4D, 0x08, 0xC1, 0xFA, 0x02, 0x8B, 0xC2, 0xC1, 0xE8,
-	0x1F, 0x03, 0xC2, 0x3B, 0xC1, 0x77, 0x0B, 0x68, 0x48, 0x74, 0x40, 0x00,
-	0xFF, 0x15, 0xEC, 0x70, 0x40, 0x00, 0x8D, 0x04, 0x49, 0x8D, 0x04, 0xC6,
-	0x5E, 0x5D, 0xC2, 0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x6A, 0xFF, 0x68, 0x92, 0x5F, 0x40, 0x00, 0x64, 0xA1,
-	0x00, 0x00, 0x00, 0x00, 0x50, 0x83, 0xEC, 0x0C, 0x56, 0x57, 0xA1, 0x18,
-	0xA0, 0x40, 0x00, 0x33, 0xC5, 0x50, 0x8D, 0x45, 0xF4, 0x64, 0xA3, 0x00,
-	0x00, 0x00, 0x00, 0x8B, 0xF9, 0x89, 0x7D, 0xEC, 0xC7, 0x45, 0xF0, 0x00,
-	0x00, 0x00, 0x00, 0x8D, 0x4F, 0x70, 0xC7, 0x07, 0x1C, 0x75, 0x40, 0x00,
-	0xFF, 0x15, 0x68, 0x70, 0x40, 0x00, 0x6A, 0x00, 0x6A, 0x00, 0x8D, 0x77,
-	0x10, 0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x56, 0x8B, 0xCF, 0xC7,
-	0x45, 0xF0, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x15, 0x64, 0x70, 0x40, 0x00,
-	0xC7, 0x45, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x8B, 0x07, 0x89, 0x75, 0xE8,
-	0x8B, 0x40, 0x04, 0xC7, 0x04, 0x07, 0xB0, 0x74, 0x40, 0x00, 0x8B, 0x07,
-	0x8B, 0x48, 0x04, 0x8D, 0x41, 0x90, 0x89, 0x44, 0x39, 0xFC, 0x8B, 0xCE,
-	0xFF, 0x15, 0x54, 0x70, 0x40, 0x00, 0xC6, 0x45, 0xFC, 0x02, 0x8B, 0xCE,
-	0xC7, 0x06, 0x9C, 0x75, 0x40, 0x00, 0xC6, 0x46, 0x4C, 0x00, 0xC6, 0x46,
-	0x45, 0x00, 0xFF, 0x15, 0x50, 0x70, 0x40, 0x00, 0xA1, 0x08, 0xA7, 0x40,
-	0x00, 0x89, 0x46, 0x48, 0xC7, 0x46, 0x50, 0x00, 0x00, 0x00, 0x00, 0xC7,
-	0x46, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xC7, 0x8B, 0x4D, 0xF4, 0x64,
-	0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5F, 0x5E, 0x8B, 0xE5, 0x5D,
-	0xC2, 0x04, 0x00, 0xCC, 0x53, 0x56, 0x57, 0x8B, 0xF9, 0x83, 0x7F, 0x60,
-	0x00, 0x75, 0x04, 0x33, 0xDB, 0xEB, 0x25, 0x8D, 0x4F, 0x10, 0xE8, 0x59,
-	0x0F, 0x00, 0x00, 0xFF, 0x77, 0x60, 0x33, 0xC9, 0x84, 0xC0, 0x8D, 0x5F,
-	0x10, 0x0F, 0x44, 0xD9, 0xFF, 0x15, 0x5C, 0x71, 0x40, 0x00, 0x33, 0xC9,
-	0x83, 0xC4, 0x04, 0x85, 0xC0, 0x0F, 0x45, 0xD9, 0x8D, 0x4F, 0x10, 0xC6,
-	0x47, 0x5C, 0x00, 0xC6, 0x47, 0x55, 0x00, 0xFF, 0x15, 0x50, 0x70, 0x40,
-	0x00, 0xA1, 0x08, 0xA7, 0x40, 0x00, 0xC7, 0x47, 0x60, 0x00, 0x00, 0x00,
-	0x00, 0x89, 0x47, 0x58, 0xC7, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x85,
-	0xDB, 0x75, 0x10, 0x8B, 0x07, 0x53, 0x8B, 0x48, 0x04, 0x6A, 0x02, 0x03,
-	0xCF, 0xFF, 0x15, 0xA8, 0x70, 0x40, 0x00, 0x5F, 0x5E, 0x5B, 0xC3, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x56, 0x8B, 0xF1, 0x83, 0x7E, 0x50, 0x00, 0xC7, 0x06, 0x9C, 0x75, 0x40,
-	0x00, 0x74, 0x1E, 0x8B, 0x56, 0x0C, 0x8D, 0x46, 0x44, 0x39, 0x02, 0x75,
-	0x14, 0x8B, 0x46, 0x38, 0x8B, 0x4E, 0x3C, 0x89, 0x02, 0x8B, 0x46, 0x1C,
-	0x89, 0x08, 0x8B, 0x46, 0x2C, 0x2B, 0xC9, 0x89, 0x08, 0x80, 0x7E, 0x4C,
-	0x00, 0x74, 0x3F, 0x83, 0x7E, 0x50, 0x00, 0x74, 0x13, 0x8B, 0xCE, 0xE8,
-	0xB0, 0x0E, 0x00, 0x00, 0xFF, 0x76, 0x50, 0xFF, 0x15, 0x5C, 0x71, 0x40,
-	0x00, 0x83, 0xC4, 0x04, 0x8B, 0xCE, 0xC6, 0x46, 0x4C, 0x00, 0xC6, 0x46,
-	0x45, 0x00, 0xFF, 0x15, 0x50, 0x70, 0x40, 0x00, 0xA1, 0x08, 0xA7, 0x40,
-	0x00, 0xC7, 0x46, 0x50, 0x00, 0x00, 0x00, 0x00, 0x89, 0x46, 0x48, 0xC7,
-	0x46, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xCE, 0x5E, 0xFF, 0x25, 0xE0,
-	0x70, 0x40, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x8B, 0x41, 0x50, 0x85,
-	0xC0, 0x74, 0x08, 0x50, 0xFF, 0x15, 0x34, 0x71, 0x40, 0x00, 0x59, 0xC3,
-	0x8B, 0x41, 0x50, 0x85, 0xC0, 0x74, 0x08, 0x50, 0xFF, 0x15, 0xD8, 0x71,
-	0x40, 0x00, 0x59, 0xC3, 0x55, 0x8B, 0xEC, 0x83, 0xE4, 0xF8, 0x6A, 0xFF,
-	0x68, 0xD8, 0x60, 0x40, 0x00, 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x50,
-	0x83, 0xEC, 0x30, 0xA1, 0x18, 0xA0, 0x40, 0x00, 0x33, 0xC4, 0x89, 0x44,
-	0x24, 0x28, 0x53, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00, 0x33, 0xC4,
-	0x50, 0x8D, 0x44, 0x24, 0x40, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x8B,
-	0xF1, 0x8B, 0x5D, 0x08, 0x83, 0xFB, 0xFF, 0x75, 0x07, 0x33, 0xC0, 0xE9,
-	0xEB, 0x01, 0x00, 0x00, 0x8B, 0x46, 0x20, 0x8B, 0x08, 0x85, 0xC9, 0x74,
-	0x22, 0x8B, 0x56, 0x30, 0x8B, 0x3A, 0x8D, 0x04, 0x0F, 0x3B, 0xC8, 0x73,
-	0x16, 0x8D, 0x47, 0xFF, 0x89, 0x02, 0x8B, 0x4E, 0x20, 0x8B, 0x11, 0x8D,
-	0x42, 0x01, 0x89, 0x01, 0x88, 0x1A, 0xE9, 0xBE, 0x01, 0x00, 0x00, 0x83,
-	0x7E, 0x50, 0x00, 0x75, 0x08, 0x83, 0xC8, 0xFF, 0xE9, 0xB2, 0x01, 0x00,
-	0x00, 0x8B, 0x46, 0x0C, 0x8B, 0x08, 0x8D, 0x46, 0x44, 0x3B, 0xC8, 0x75,
-	0x10, 0x8B, 0x46, 0x3C, 0x50, 0x50, 0xFF, 0x76, 0x38, 0x8B, 0xCE, 0xFF,
-	0x15, 0x74, 0x70, 0x40, 0x00, 0x83, 0x7E, 0x40, 0x00, 0x75, 0x1F, 0xFF,
-	0x76, 0x50, 0x0F, 0xBE, 0xC3, 0x50, 0xFF, 0x15, 0xF4, 0x71, 0x40, 0x00,
-	0x83, 0xC9, 0xFF, 0x83, 0xC4, 0x08, 0x3B, 0xC1, 0x0F, 0x45, 0xCB, 0x8B,
-	0xC1, 0xE9, 0x71, 0x01, 0x00, 0x00, 0x83, 0xEC, 0x08, 0x8D, 0x4C, 0x24,
-	0x28, 0x88, 0x5C, 0x24, 0x1F, 0xE8, 0x4E, 0x09, 0x00, 0x00, 0xC7, 0x44,
-	0x24, 0x48, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x9B, 0x00, 0x00, 0x00, 0x00,
-	0x83, 0x7C, 0x24, 0x34, 0x10, 0x8D, 0x44, 0x24, 0x18, 0x50, 0x8B, 0x44,
-	0x24, 0x34, 0x8D, 0x54, 0x24, 0x24, 0x0F, 0x43, 0x54, 0x24, 0x24, 0x8D,
-	0x4C, 0x24, 0x24, 0x0F, 0x43, 0x4C, 0x24, 0x24, 0x03, 0xC2, 0x50, 0x51,
-	0x8B, 0x4E, 0x40, 0x8D, 0x44, 0x24, 0x28, 0x50, 0x8D, 0x44, 0x24, 0x28,
-	0x50, 0x8D, 0x44, 0x24, 0x2B, 0x50, 0x8D, 0x46, 0x48, 0x50, 0xFF, 0x15,
-	0x80, 0x70, 0x40, 0x00, 0x85, 0xC0, 0x0F, 0x88, 0xF2, 0x00, 0x00, 0x00,
-	0x83, 0xF8, 0x01, 0x0F, 0x8F, 0xC4, 0x00, 0x00, 0x00, 0x8B, 0x5C, 0x24,
-	0x34, 0x8B, 0x4C, 0x24, 0x20, 0x8B, 0x7C, 0x24, 0x18, 0x83, 0xFB, 0x10,
-	0x8D, 0x44, 0x24, 0x20, 0x0F, 0x43, 0xC1, 0x2B, 0xF8, 0x74, 0x22, 0xFF,
-	0x76, 0x50, 0x8D, 0x44, 0x24, 0x24, 0x57, 0x83, 0xFB, 0x10, 0x0F, 0x43,
-	0xC1, 0x6A, 0x01, 0x50, 0xFF, 0x15, 0x50, 0x71, 0x40, 0x00, 0x83, 0xC4,
-	0x10, 0x3B, 0xF8, 0x0F, 0x85, 0xAD, 0x00, 0x00, 0x00, 0x8D, 0x44, 0x24,
+	0xF6, 0xC2, 0x02, 0x74, 0x3A, 0x32, 0x00, 0x51, 0x32, 0x85, 0xDB, 0x7C,
+	0xE5, 0x6F, 0x00, 0x1A, 0xDF, 0x6F, 0x00, 0x11, 0xCC, 0x6F, 0x00, 0x82,
+	0xC6, 0x8B, 0x47, 0x20, 0x2B, 0x08, 0x8B, 0x47, 0x4A, 0x01, 0x10, 0x47,
+	0x4A, 0x01, 0x80, 0x04, 0x8B, 0xD8, 0x8B, 0xF1, 0x8B, 0x45, 0x08, 0x35,
+	0x01, 0x3F, 0x89, 0x58, 0x04, 0x38, 0x01, 0x07, 0x14, 0x20, 0x38, 0x01,
+	0x00, 0x9A, 0x05, 0xF5, 0x01, 0x06, 0x85, 0xC0, 0x74, 0x28, 0xFF, 0x76,
+	0x04, 0x50, 0xE8, 0xFE, 0x15, 0x00, 0x00, 0xFF, 0x36, 0xFB, 0x03, 0x21,
+	0xC7, 0x06, 0x38, 0x00, 0x22, 0x46, 0x04, 0x07, 0x00, 0x01, 0x4D, 0x00,
+	0x05, 0x3A, 0x03, 0x07, 0xA0, 0x07, 0xF0, 0x12, 0x31, 0x8B, 0x49, 0x04,
+	0x2B, 0xCE, 0xB8, 0xAB, 0xAA, 0xAA, 0x2A, 0xF7, 0xE9, 0x8B, 0x4D, 0x08,
+	0xC1, 0xFA, 0x02, 0x8B, 0xC2, 0xC1, 0xE8, 0x1F, 0x03, 0xC2, 0x3B, 0xC1,
+	0x77, 0x0B, 0x68, 0x48, 0x74, 0x15, 0x07, 0xA8, 0xEC, 0x70, 0x40, 0x00,
+	0x8D, 0x04, 0x49, 0x8D, 0x04, 0xC6, 0xE2, 0x03, 0x02, 0x70, 0x07, 0x1F,
+	0x92, 0x70, 0x07, 0x0E, 0x35, 0xF9, 0x89, 0x7D, 0x70, 0x07, 0x57, 0x4F,
+	0x70, 0xC7, 0x07, 0x1C, 0x69, 0x07, 0x53, 0x6A, 0x00, 0x8D, 0x77, 0x10,
+	0x6B, 0x07, 0x35, 0x56, 0x8B, 0xCF, 0x6B, 0x07, 0x17, 0x64, 0x6B, 0x07,
+	0x32, 0x07, 0x89, 0x75, 0x6B, 0x07, 0x71, 0x07, 0xB0, 0x74, 0x40, 0x00,
+	0x8B, 0x07, 0x6B, 0x07, 0x50, 0x90, 0x89, 0x44, 0x39, 0xFC, 0xDC, 0x04,
+	0x00, 0x6B, 0x07, 0x00, 0x68, 0x07, 0xF2, 0x12, 0x8B, 0xCE, 0xC7, 0x06,
+	0x9C, 0x75, 0x40, 0x00, 0xC6, 0x46, 0x4C, 0x00, 0xC6, 0x46, 0x45, 0x00,
+	0xFF, 0x15, 0x50, 0x70, 0x40, 0x00, 0xA1, 0x08, 0xA7, 0x40, 0x00, 0x89,
+	0x46, 0x48, 0xC7, 0x46, 0x50, 0x09, 0x01, 0x11, 0x40, 0x93, 0x00, 0x1D,
+	0xC7, 0x68, 0x07, 0xF0, 0x20, 0x04, 0x00, 0xCC, 0x53, 0x56, 0x57, 0x8B,
+	0xF9, 0x83, 0x7F, 0x60, 0x00, 0x75, 0x04, 0x33, 0xDB, 0xEB, 0x25, 0x8D,
+	0x4F, 0x10, 0xE8, 0x59, 0x0F, 0x00, 0x00, 0xFF, 0x77, 0x60, 0x33, 0xC9,
+	0x84, 0xC0, 0x8D, 0x5F, 0x10, 0x0F, 0x44, 0xD9, 0xFF, 0x15, 0x5C, 0x71,
+	0x40, 0x00, 0x33, 0xC9, 0x3D, 0x06, 0xE8, 0xC0, 0x0F, 0x45, 0xD9, 0x8D,
+	0x4F, 0x10, 0xC6, 0x47, 0x5C, 0x00, 0xC6, 0x47, 0x55, 0x71, 0x00, 0x30,
+	0xC7, 0x47, 0x60, 0x5B, 0x00, 0x51, 0x89, 0x47, 0x58, 0xC7, 0x47, 0x78,
+	0x00, 0xFA, 0x08, 0x85, 0xDB, 0x75, 0x10, 0x8B, 0x07, 0x53, 0x8B, 0x48,
+	0x04, 0x6A, 0x02, 0x03, 0xCF, 0xFF, 0x15, 0xA8, 0x70, 0x40, 0x00, 0x5F,
+	0x5E, 0x5B, 0x90, 0x01, 0x72, 0x56, 0x8B, 0xF1, 0x83, 0x7E, 0x50, 0x00,
+	0xC7, 0x00, 0xF2, 0x08, 0x74, 0x1E, 0x8B, 0x56, 0x0C, 0x8D, 0x46, 0x44,
+	0x39, 0x02, 0x75, 0x14, 0x8B, 0x46, 0x38, 0x8B, 0x4E, 0x3C, 0x89, 0x02,
+	0x8B, 0x46, 0x1C, 0xEC, 0x05, 0x90, 0xC9, 0x89, 0x08, 0x80, 0x7E, 0x4C,
+	0x00, 0x74, 0x3F, 0x30, 0x00, 0xC2, 0x74, 0x13, 0x8B, 0xCE, 0xE8, 0xB0,
+	0x0E, 0x00, 0x00, 0xFF, 0x76, 0x50, 0x9F, 0x00, 0x5F, 0x83, 0xC4, 0x04,
+	0x8B, 0xCE, 0x08, 0x01, 0x00, 0x03, 0x05, 0x01, 0x01, 0x0F, 0x01, 0x02,
+	0x08, 0x01, 0x18, 0xCE, 0xF4, 0x07, 0x30, 0x8B, 0x41, 0x50, 0x64, 0x03,
+	0x96, 0x50, 0xFF, 0x15, 0x34, 0x71, 0x40, 0x00, 0x59, 0xC3, 0x10, 0x00,
+	0x11, 0xD8, 0x10, 0x00, 0x02, 0xA0, 0x03, 0x57, 0x6A, 0xFF, 0x68, 0xD8,
+	0x60, 0xF3, 0x01, 0x12, 0x30, 0xF1, 0x01, 0x64, 0xC4, 0x89, 0x44, 0x24,
+	0x28, 0x53, 0xFF, 0x01, 0x63, 0xC4, 0x50, 0x8D, 0x44, 0x24, 0x40, 0x00,
+	0x02, 0xE0, 0xF1, 0x8B, 0x5D, 0x08, 0x83, 0xFB, 0xFF, 0x75, 0x07, 0x33,
+	0xC0, 0xE9, 0xEB, 0x01, 0xCD, 0x06, 0xF0, 0x1A, 0x20, 0x8B, 0x08, 0x85,
+	0xC9, 0x74, 0x22, 0x8B, 0x56, 0x30, 0x8B, 0x3A, 0x8D, 0x04, 0x0F, 0x3B,
+	0xC8, 0x73, 0x16, 0x8D, 0x47, 0xFF, 0x89, 0x02, 0x8B, 0x4E, 0x20, 0x8B,
+	0x11, 0x8D, 0x42, 0x01, 0x89, 0x01, 0x88, 0x1A, 0xE9, 0xBE, 0x01, 0x00,
+	0x00, 0xE0, 0x00, 0x71, 0x75, 0x08, 0x83, 0xC8, 0xFF, 0xE9, 0xB2, 0x39,
+	0x00, 0xF0, 0x03, 0x0C, 0x8B, 0x08, 0x8D, 0x46, 0x44, 0x3B, 0xC8, 0x75,
+	0x10, 0x8B, 0x46, 0x3C, 0x50, 0x50, 0xFF, 0x76, 0x38, 0x03, 0x02, 0xF0,
+	0x05, 0x74, 0x70, 0x40, 0x00, 0x83, 0x7E, 0x40, 0x00, 0x75, 0x1F, 0xFF,
+	0x76, 0x50, 0x0F, 0xBE, 0xC3, 0x50, 0xFF, 0x15, 0xF4, 0x07, 0x01, 0xE0,
+	0xC9, 0xFF, 0x83, 0xC4, 0x08, 0x3B, 0xC1, 0x0F, 0x45, 0xCB, 0x8B, 0xC1,
+	0xE9, 0x71, 0x4F, 0x00, 0xF1, 0x04, 0xEC, 0x08, 0x8D, 0x4C, 0x24, 0x28,
+	0x88, 0x5C, 0x24, 0x1F, 0xE8, 0x4E, 0x09, 0x00, 0x00, 0xC7, 0x44, 0x24,
+	0x48, 0x97, 0x02, 0x10, 0x9B, 0x06, 0x00, 0xF0, 0x0A, 0x83, 0x7C, 0x24,
+	0x34, 0x10, 0x8D, 0x44, 0x24, 0x18, 0x50, 0x8B, 0x44, 0x24, 0x34, 0x8D,
+	0x54, 0x24, 0x24, 0x0F, 0x43, 0x54, 0x24, 0x24, 0x8D, 0x4C, 0x09, 0x00,
+	0xE0, 0x4C, 0x24, 0x24, 0x03, 0xC2, 0x50, 0x51, 0x8B, 0x4E, 0x40, 0x8D,
+	0x44, 0x24, 0x28, 0xDF, 0x00, 0x01, 0x05, 0x00, 0xF0, 0x02, 0x2B, 0x50,
+	0x8D, 0x46, 0x48, 0x50, 0xFF, 0x15, 0x80, 0x70, 0x40, 0x00, 0x85, 0xC0,
+	0x0F, 0x88, 0xF2, 0x48, 0x00, 0x50, 0xF8, 0x01, 0x0F, 0x8F, 0xC4, 0xFA,
+	0x00, 0xD0, 0x5C, 0x24, 0x34, 0x8B, 0x4C, 0x24, 0x20, 0x8B, 0x7C, 0x24,
+	0x18, 0x83, 0xFB, 0x5B, 0x00, 0xA0, 0x20, 0x0F, 0x43, 0xC1, 0x2B, 0xF8,
+	0x74, 0x22, 0xFF, 0x76, 0x3D, 0x00, 0xE1, 0x24, 0x57, 0x83, 0xFB, 0x10,
+	0x0F, 0x43, 0xC1, 0x6A, 0x01, 0x50, 0xFF, 0x15, 0x50, 0xB9, 0x01, 0x60,
+	0x10, 0x3B, 0xF8, 0x0F, 0x85, 0xAD, 0x93, 0x00, 0xF0, 0x10, 0x44, 0x24,
 	0x17, 0xC6, 0x46, 0x45, 0x01, 0x39, 0x44, 0x24, 0x1C, 0x75, 0x75, 0x85,
 	0xFF, 0x0F, 0x85, 0x5D, 0xFF, 0xFF, 0xFF, 0x8B, 0x4C, 0x24, 0x30, 0x83,
-	0xF9, 0x20, 0x0F, 0x83, 0x8A, 0x00, 0x00, 0x00, 0x83, 0xC8, 0xFF, 0x2B,
-	0xC1, 0x83, 0xF8, 0x08, 0x76, 0x4B, 0x8D, 0x79, 0x08, 0x51, 0x57, 0x8D,
-	0x4C, 0x24, 0x28, 0xE8, 0xF8, 0x0F, 0x00, 0x00, 0x84, 0xC0, 0x0F, 0x84,
-	0x30, 0xFF, 0xFF, 0xFF, 0x83, 0x7C, 0x24, 0x34, 0x10, 0x8B, 0x44, 0x24,
-	0x30, 0x8D, 0x4C, 0x24, 0x20, 0x0F, 0x43, 0x4C, 0x24, 0x20, 0x0F, 0x57,
-	0xC0, 0x66, 0x0F, 0xD6, 0x04, 0x01, 0x83, 0x7C, 0x24, 0x34, 0x10, 0x8D,
-	0x44, 0x24, 0x20, 0x0F, 0x43, 0x44, 0x24, 0x20, 0x89, 0x7C, 0x24, 0x30,
-	0xC6, 0x04, 0x38, 0x00, 0xE9, 0xFB, 0xFE, 0xFF, 0xFF, 0x68, 0x64, 0x74,
-	0x40, 0x00, 0xFF, 0x15, 0x28, 0x70, 0x40, 0x00, 0x8B, 0x5D, 0x08, 0xEB,
+	0xF9, 0x20, 0x0F, 0x83, 0x8A, 0x68, 0x00, 0xE0, 0xC8, 0xFF, 0x2B, 0xC1,
+	0x83, 0xF8, 0x08, 0x76, 0x4B, 0x8D, 0x79, 0x08, 0x51, 0x57, 0xDA, 0x00,
+	0xD1, 0xE8, 0xF8, 0x0F, 0x00, 0x00, 0x84, 0xC0, 0x0F, 0x84, 0x30, 0xFF,
+	0xFF, 0xFF, 0xD0, 0x00, 0x60, 0x8B, 0x44, 0x24, 0x30, 0x8D, 0x4C, 0x79,
+	0x00, 0x00, 0x05, 0x00, 0x74, 0x57, 0xC0, 0x66, 0x0F, 0xD6, 0x04, 0x01,
+	0xEA, 0x00, 0xF1, 0x06, 0x20, 0x0F, 0x43, 0x44, 0x24, 0x20, 0x89, 0x7C,
+	0x24, 0x30, 0xC6, 0x04, 0x38, 0x00, 0xE9, 0xFB, 0xFE, 0xFF, 0xFF, 0x68,
+	0x64, 0xF2, 0x03, 0x10, 0x28, 0x60, 0x05, 0xF4, 0x02, 0x5D, 0x08, 0xEB,
 	0x28, 0x83, 0xF8, 0x03, 0x75, 0x20, 0x0F, 0xBE, 0x44, 0x24, 0x17, 0xFF,
-	0x76, 0x50, 0x50, 0xFF, 0x15, 0xF4, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x08,
-	0x83, 0xF8, 0xFF, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x45, 0x5D, 0x08,
-	0xEB, 0x03, 0x83, 0xCB, 0xFF, 0x83, 0x7C, 0x24, 0x34, 0x10, 0x72, 0x0D,
-	0xFF, 0x74, 0x24, 0x20, 0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x83, 0xC4,
-	0x04, 0x8B, 0xC3, 0x8B, 0x4C, 0x24, 0x40, 0x64, 0x89, 0x0D, 0x00, 0x00,
-	0x00, 0x00, 0x59, 0x5F, 0x5E, 0x5B, 0x8B, 0x4C, 0x24, 0x28, 0x33, 0xCC,
-	0xE8, 0x43, 0x1D, 0x00, 0x00, 0x8B, 0xE5, 0x5D, 0xC2, 0x04, 0x00, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x53, 0x8B, 0x5D, 0x08, 0x56, 0x8B, 0xF1, 0x8B, 0x46,
-	0x1C, 0x8B, 0x08, 0x85, 0xC9, 0x74, 0x2C, 0x8B, 0x46, 0x0C, 0x39, 0x08,
-	0x73, 0x25, 0x83, 0xFB, 0xFF, 0x74, 0x08, 0x0F, 0xB6, 0x41, 0xFF, 0x3B,
-	0xC3, 0x75, 0x18, 0x8B, 0x46, 0x2C, 0xFF, 0x00, 0x8B, 0x46, 0x1C, 0x5E,
-	0xFF, 0x08, 0x33, 0xC0, 0x83, 0xFB, 0xFF, 0x0F, 0x45, 0xC3, 0x5B, 0x5D,
-	0xC2, 0x04, 0x00, 0x8B, 0x46, 0x50, 0x85, 0xC0, 0x74, 0x39, 0x83, 0xFB,
-	0xFF, 0x74, 0x34, 0x83, 0x7E, 0x40, 0x00, 0x75, 0x13, 0x0F, 0xB6, 0xCB,
-	0x50, 0x51, 0xFF, 0x15, 0xD4, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x08, 0x83,
-	0xF8, 0xFF, 0x75, 0x13, 0x8B, 0x46, 0x1C, 0x8D, 0x4E, 0x44, 0x39, 0x08,
+	0x76, 0x50, 0x59, 0x01, 0xF2, 0x03, 0xC4, 0x08, 0x83, 0xF8, 0xFF, 0xBB,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x45, 0x5D, 0x08, 0xEB, 0x03, 0x83, 0xCB,
+	0x6D, 0x00, 0x65, 0x72, 0x0D, 0xFF, 0x74, 0x24, 0x20, 0x84, 0x04, 0x66,
+	0x8B, 0xC3, 0x8B, 0x4C, 0x24, 0x40, 0x68, 0x03, 0xC3, 0x5B, 0x8B, 0x4C,
+	0x24, 0x28, 0x33, 0xCC, 0xE8, 0x43, 0x1D, 0x00, 0x00, 0x74, 0x03, 0x0B,
+	0x90, 0x04, 0x40, 0x53, 0x8B, 0x5D, 0x08, 0xD7, 0x04, 0x21, 0x46, 0x1C,
+	0x22, 0x02, 0xF0, 0x1A, 0x2C, 0x8B, 0x46, 0x0C, 0x39, 0x08, 0x73, 0x25,
+	0x83, 0xFB, 0xFF, 0x74, 0x08, 0x0F, 0xB6, 0x41, 0xFF, 0x3B, 0xC3, 0x75,
+	0x18, 0x8B, 0x46, 0x2C, 0xFF, 0x00, 0x8B, 0x46, 0x1C, 0x5E, 0xFF, 0x08,
+	0x33, 0xC0, 0x83, 0xFB, 0xFF, 0x0F, 0x45, 0xC3, 0x5B, 0x4C, 0x00, 0x20,
+	0x8B, 0x46, 0xAF, 0x02, 0x10, 0x39, 0x2C, 0x00, 0x11, 0x34, 0x0E, 0x02,
+	0x95, 0x13, 0x0F, 0xB6, 0xCB, 0x50, 0x51, 0xFF, 0x15, 0xD4, 0xB3, 0x00,
+	0xF2, 0x08, 0x75, 0x13, 0x8B, 0x46, 0x1C, 0x8D, 0x4E, 0x44, 0x39, 0x08,
 	0x74, 0x11, 0x88, 0x19, 0x8B, 0xCE, 0xE8, 0x59, 0x0D, 0x00, 0x00, 0x5E,
-	0x8B, 0xC3, 0x5B, 0x5D, 0xC2, 0x04, 0x00, 0x5E, 0x83, 0xC8, 0xFF, 0x5B,
-	0x5D, 0xC2, 0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x56, 0x8B, 0xF1, 0x8B, 0x46, 0x1C, 0x8B, 0x08, 0x85, 0xC9, 0x74, 0x10,
-	0x8B, 0x46, 0x2C, 0x8B, 0x00, 0x03, 0xC1, 0x3B, 0xC8, 0x73, 0x05, 0x0F,
-	0xB6, 0x01, 0x5E, 0xC3, 0x8B, 0x06, 0x57, 0x8B, 0xCE, 0xFF, 0x50, 0x1C,
-	0x8B, 0xF8, 0x83, 0xFF, 0xFF, 0x75, 0x05, 0x5F, 0x0B, 0xC0, 0x5E, 0xC3,
-	0x8B, 0x06, 0x57, 0x8B, 0xCE, 0xFF, 0x50, 0x10, 0x8B, 0xC7, 0x5F, 0x5E,
-	0xC3, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x83, 0xE4, 0xF8, 0x6A, 0xFF,
-	0x68, 0x98, 0x61, 0x40, 0x00, 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x50,
-	0x83, 0xEC, 0x38, 0xA1, 0x18, 0xA0, 0x40, 0x00, 0x33, 0xC4, 0x89, 0x44,
-	0x24, 0x30, 0x53, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00, 0x33, 0xC4,
-	0x50, 0x8D, 0x44, 0x24, 0x48, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x8B,
-	0xD9, 0x89, 0x5C, 0x24, 0x24, 0x8B, 0x43, 0x1C, 0x8B, 0x08, 0x85, 0xC9,
-	0x74, 0x23, 0x8B, 0x53, 0x2C, 0x8B, 0x32, 0x8D, 0x04, 0x0E, 0x3B, 0xC8,
-	0x73, 0x17, 0x8D, 0x46, 0xFF, 0x89, 0x02, 0x8B, 0x4B, 0x1C, 0x8B, 0x11,
-	0x8D, 0x42, 0x01, 0x89, 0x01, 0x0F, 0xB6, 0x02, 0xE9, 0xFB, 0x01, 0x00,
-	0x00, 0x83, 0x7B, 0x50, 0x00, 0x75, 0x08, 0x83, 0xC8, 0xFF, 0xE9, 0xED,
-	0x01, 0x00, 0x00, 0x8B, 0x43, 0x0C, 0x8B, 0x08, 0x8D, 0x43, 0x44, 0x3B,
-	0xC8, 0x75, 0x10, 0x8B, 0x43, 0x3C, 0x50, 0x50, 0xFF, 0x73, 0x38, 0x8B,
-	0xCB, 0xFF, 0x15, 0x74, 0x70, 0x40, 0x00, 0x83, 0x7B, 0x40, 0x00, 0x75,
-	0x19, 0xFF, 0x73, 0x50, 0xFF, 0x15, 0x20, 0x71, 0x40, 0x00, 0x83, 0xC4,
-	0x04, 0x83, 0xF8, 0xFF, 0x74, 0xC5, 0x0F, 0xB6, 0xC0, 0xE9, 0xB2, 0x01,
-	0x00, 0x00, 0xC7, 0x44, 0x24, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x44,
-	0x24, 0x38, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x44, 0x24, 0x28, 0x00, 0xC7,
-	0x44, 0x24, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x73, 0x50, 0xFF, 0x15,
-	0x20, 0x71, 0x40, 0x00, 0x8B, 0xD0, 0x83, 0xC4, 0x04, 0x89, 0x54, 0x24,
-	0x1C, 0x83, 0xFA, 0xFF, 0x0F, 0x84, 0x61, 0x01, 0x00, 0x00, 0x8D, 0x9B,
-	0x00, 0x00, 0x00, 0x00, 0x8B, 0x7C, 0x24, 0x38, 0x83, 0xC9, 0xFF, 0x2B,
-	0xCF, 0x83, 0xF9, 0x01, 0x0F, 0x86, 0xBF, 0x01, 0x00, 0x00, 0x8D, 0x77,
-	0x01, 0x83, 0xFE, 0xFE, 0x0F, 0x87, 0xB3, 0x01, 0x00, 0x00, 0x8B, 0x5C,
-	0x24, 0x3C, 0x3B, 0xDE, 0x0F, 0x83, 0xCC, 0x00, 0x00, 0x00, 0x57, 0x56,
-	0x8D, 0x4C, 0x24, 0x30, 0xE8, 0x4B, 0x11, 0x00, 0x00, 0x8B, 0x5C, 0x24,
-	0x3C, 0x8B, 0x7C, 0x24, 0x38, 0x8B, 0x54, 0x24, 0x1C, 0x85, 0xF6, 0x74,
-	0x2D, 0x83, 0xFB, 0x10, 0x8D, 0x44, 0x24, 0x28, 0x0F, 0x43, 0x44, 0x24,
-	0x28, 0x88, 0x14, 0x38, 0x83, 0x7C, 0x24, 0x3C, 0x10, 0x8D, 0x44, 0x24,
-	0x28, 0x0F, 0x43, 0x44, 0x24, 0x28, 0x89, 0x74, 0x24, 0x38, 0xC6, 0x04,
-	0x30, 0x00, 0x8B, 0x7C, 0x24, 0x38, 0x8B, 0x5C, 0x24, 0x3C, 0x8D, 0x44,
-	0x24, 0x20, 0x50, 0x8D, 0x44, 0x24, 0x1C, 0x50, 0x83, 0xFB, 0x10, 0x8B,
-	0x5C, 0x24, 0x2C, 0x8D, 0x44, 0x24, 0x1F, 0x50, 0x8D, 0x54, 0x24, 0x34,
-	0x0F, 0x43, 0x54, 0x24, 0x34, 0x8D, 0x44, 0x24, 0x24, 0x50, 0x8D, 0x04,
-	0x17, 0x50, 0x8D, 0x4C, 0x24, 0x3C, 0x0F, 0x43, 0x4C, 0x24, 0x3C, 0x51,
-	0x8B, 0x4B, 0x40, 0x8D, 0x43, 0x48, 0x50, 0xFF, 0x15, 0x84, 0x70, 0x40,
-	0x00, 0x85, 0xC0, 0x0F, 0x88, 0xA2, 0x00, 0x00, 0x00, 0x83, 0xF8, 0x01,
-	0x7E, 0x58, 0x83, 0xF8, 0x03, 0x0F, 0x85, 0x94, 0x00, 0x00, 0x00, 0x83,
-	0x7C, 0x24, 0x38, 0x01, 0x72, 0x72, 0x83, 0x7C, 0x24, 0x3C, 0x10, 0x8D,
-	0x44, 0x24, 0x28, 0x0F, 0x43, 0x44, 0x24, 0x28, 0x6A, 0x01, 0x50, 0x8D,
-	0x44, 0x24, 0x1F, 0x6A, 0x01, 0x50, 0xFF, 0x15, 0x4C, 0x71, 0x40, 0x00,
-	0x83, 0xC4, 0x10, 0x0F, 0xB6, 0x74, 0x24, 0x17, 0xEB, 0x68, 0x85, 0xF6,
-	0x0F, 0x85, 0x47, 0xFF, 0xFF, 0xFF, 0x8D, 0x44, 0x24, 0x28, 0x83, 0xFB,
-	0x10, 0x0F, 0x43, 0x44, 0x24, 0x28, 0x89, 0x74, 0x24, 0x38, 0xC6, 0x00,
-	0x00, 0xE9, 0x54, 0xFF, 0xFF, 0xFF, 0x8D, 0x44, 0x24, 0x17, 0x39, 0x44,
-	0x24, 0x20, 0x8B, 0x44, 0x24, 0x18, 0x75, 0x6E, 0x83, 0x7C, 0x24, 0x3C,
-	0x10, 0x8D, 0x4C, 0x24, 0x28, 0x0F, 0x43, 0x4C, 0x24, 0x28, 0x2B, 0xC1,
-	0x50, 0x6A, 0x00, 0x8D, 0x4C, 0x24, 0x30, 0xE8, 0x70, 0x06, 0x00, 0x00,
-	0xFF, 0x73, 0x50, 0xFF, 0x15, 0x20, 0x71, 0x40, 0x00, 0x8B, 0xD0, 0x83,
-	0xC4, 0x04, 0x89, 0x54, 0x24, 0x1C, 0x83, 0xFA, 0xFF, 0x0F, 0x85, 0xA5,
-	0xFE, 0xFF, 0xFF, 0x83, 0xCE, 0xFF, 0x83, 0x7C, 0x24, 0x3C, 0x10, 0x72,
-	0x0D, 0xFF, 0x74, 0x24, 0x28, 0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x83,
-	0xC4, 0x04, 0x8B, 0xC6, 0x8B, 0x4C, 0x24, 0x48, 0x64, 0x89, 0x0D, 0x00,
-	0x00, 0x00, 0x00, 0x59, 0x5F, 0x5E, 0x5B, 0x8B, 0x4C, 0x24, 0x30, 0x33,
-	0xCC, 0xE8, 0xE2, 0x19, 0x00, 0x00, 0x8B, 0xE5, 0x5D, 0xC3, 0x83, 0x7C,
-	0x24, 0x3C, 0x10, 0x8D, 0x74, 0x24, 0x28, 0x0F, 0x43, 0x74, 0x24, 0x28,
-	0x2B, 0xF0, 0x03, 0x74, 0x24, 0x38, 0x85, 0xF6, 0x0F, 0x8E, 0x41, 0xFF,
-	0xFF, 0xFF, 0x8B, 0x3D, 0xD4, 0x71, 0x40, 0x00, 0x0F, 0xBE, 0x44, 0x06,
-	0xFF, 0xFF, 0x73, 0x50, 0x4E, 0x50, 0xFF, 0xD7, 0x83, 0xC4, 0x08, 0x85,
-	0xF6, 0x0F, 0x8E, 0x24, 0xFF, 0xFF, 0xFF, 0x8B, 0x44, 0x24, 0x18, 0xEB,
-	0xE3, 0x68, 0x64, 0x74, 0x40, 0x00, 0xFF, 0x15, 0x28, 0x70, 0x40, 0x00,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x83, 0xE4, 0xF8, 0x83, 0xEC,
-	0x0C, 0x53, 0x56, 0x8B, 0xF1, 0x57, 0x8B, 0x46, 0x1C, 0x8D, 0x4E, 0x44,
-	0x39, 0x08, 0x75, 0x1A, 0x83, 0x7D, 0x14, 0x01, 0x75, 0x14, 0x83, 0x7E,
-	0x40, 0x00, 0x75, 0x0E, 0x8B, 0x7D, 0x0C, 0x8B, 0x5D, 0x10, 0x83, 0xC7,
-	0xFF, 0x83, 0xD3, 0xFF, 0xEB, 0x06, 0x8B, 0x5D, 0x10, 0x8B, 0x7D, 0x0C,
-	0x83, 0x7E, 0x50, 0x00, 0x0F, 0x84, 0x90, 0x00, 0x00, 0x00, 0x8B, 0xCE,
-	0xE8, 0x07, 0x08, 0x00, 0x00, 0x84, 0xC0, 0x0F, 0x84, 0x81, 0x00, 0x00,
-	0x00, 0x8B, 0xC7, 0x0B, 0xC3, 0x8B, 0x45, 0x14, 0x75, 0x05, 0x83, 0xF8,
-	0x01, 0x74, 0x13, 0x50, 0x53, 0x57, 0xFF, 0x76, 0x50, 0xFF, 0x15, 0x14,
-	0x71, 0x40, 0x00, 0x83, 0xC4, 0x10, 0x85, 0xC0, 0x75, 0x60, 0x8D, 0x44,
-	0x24, 0x10, 0x50, 0xFF, 0x76, 0x50, 0xFF, 0x15, 0x10, 0x71, 0x40, 0x00,
-	0x83, 0xC4, 0x08, 0x85, 0xC0, 0x75, 0x4B, 0x8B, 0x56, 0x0C, 0x8D, 0x46,
-	0x44, 0x39, 0x02, 0x75, 0x14, 0x8B, 0x46, 0x38, 0x8B, 0x4E, 0x3C, 0x89,
-	0x02, 0x8B, 0x46, 0x1C, 0x89, 0x08, 0x8B, 0x46, 0x2C, 0x2B, 0xC9, 0x89,
-	0x08, 0x8B, 0x45, 0x08, 0x8B, 0x4C, 0x24, 0x10, 0x89, 0x48, 0x08, 0x8B,
-	0x4C, 0x24, 0x14, 0x89, 0x48, 0x0C, 0x8B, 0x4E, 0x48, 0xC7, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xC7, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x89, 0x48,
-	0x10, 0x5F, 0x5E, 0x5B, 0x8B, 0xE5, 0x5D, 0xC2, 0x14, 0x00, 0x8B, 0x45,
-	0x08, 0x8B, 0x15, 0xFC, 0x70, 0x40, 0x00, 0x5F, 0x8B, 0x0A, 0x89, 0x08,
-	0x8B, 0x4A, 0x04, 0x5E, 0x89, 0x48, 0x04, 0xC7, 0x40, 0x08, 0x00, 0x00,
-	0x00, 0x00, 0xC7, 0x40, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x40, 0x10,
-	0x00, 0x00, 0x00, 0x00, 0x5B, 0x8B, 0xE5, 0x5D, 0xC2, 0x14, 0x00, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x83, 0xE4, 0xF8, 0x83, 0xEC, 0x0C, 0x8B, 0x45, 0x14,
-	0x53, 0x8B, 0x5D, 0x10, 0x56, 0x8B, 0xF1, 0x89, 0x44, 0x24, 0x0C, 0x83,
-	0x7E, 0x50, 0x00, 0x8B, 0x45, 0x18, 0x57, 0x8B, 0x7D, 0x0C, 0x89, 0x44,
-	0x24, 0x14, 0x0F, 0x84, 0x87, 0x00, 0x00, 0x00, 0xE8, 0x0F, 0x07, 0x00,
-	0x00, 0x84, 0xC0, 0x74, 0x7E, 0x8D, 0x44, 0x24, 0x10, 0x50, 0xFF, 0x76,
-	0x50, 0xFF, 0x15, 0x2C, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x08, 0x85, 0xC0,
-	0x75, 0x69, 0x8B, 0xC7, 0x0B, 0xC3, 0x74, 0x14, 0x6A, 0x01, 0x53, 0x57,
-	0xFF, 0x76, 0x50, 0xFF, 0x15, 0x14, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x10,
-	0x85, 0xC0, 0x75, 0x4F, 0x8D, 0x44, 0x24, 0x10, 0x50, 0xFF, 0x76, 0x50,
-	0xFF, 0x15, 0x10, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x08, 0x85, 0xC0, 0x75,
-	0x3A, 0x8B, 0x45, 0x1C, 0x8B, 0xCE, 0x89, 0x46, 0x48, 0xE8, 0x6A, 0x08,
-	0x00, 0x00, 0x8B, 0x45, 0x08, 0x8B, 0x4C, 0x24, 0x10, 0x89, 0x48, 0x08,
-	0x8B, 0x4C, 0x24, 0x14, 0x89, 0x48, 0x0C, 0x8B, 0x4E, 0x48, 0xC7, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xC7, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x89,
-	0x48, 0x10, 0x5F, 0x5E, 0x5B, 0x8B, 0xE5, 0x5D, 0xC2, 0x20, 0x00, 0x8B,
-	0x45, 0x08, 0x8B, 0x15, 0xFC, 0x70, 0x40, 0x00, 0x5F, 0x8B, 0x0A, 0x89,
-	0x08, 0x8B, 0x4A, 0x04, 0x5E, 0x89, 0x48, 0x04, 0xC7, 0x40, 0x08, 0x00,
-	0x00, 0x00, 0x00, 0xC7, 0x40, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x40,
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x8B, 0xE5, 0x5D, 0xC2, 0x20, 0x00,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x56, 0x8B, 0xF1, 0x57, 0x8B, 0x4E, 0x50, 0x85, 0xC9,
-	0x74, 0x73, 0x8B, 0x55, 0x08, 0x8B, 0x7D, 0x0C, 0x85, 0xD2, 0x75, 0x0E,
-	0x8B, 0xC7, 0x0B, 0x45, 0x10, 0x75, 0x07, 0xB8, 0x04, 0x00, 0x00, 0x00,
-	0xEB, 0x02, 0x33, 0xC0, 0x57, 0x50, 0x52, 0x51, 0xFF, 0x15, 0x30, 0x71,
-	0x40, 0x00, 0x83, 0xC4, 0x10, 0x85, 0xC0, 0x75, 0x48, 0x8B, 0x7E, 0x50,
-	0x8B, 0xCE, 0xC6, 0x46, 0x4C, 0x01, 0x88, 0x46, 0x45, 0xFF, 0x15, 0x50,
-	0x70, 0x40, 0x00, 0x85, 0xFF, 0x74, 0x18, 0x8D, 0x47, 0x08, 0x89, 0x46,
-	0x0C, 0x89, 0x46, 0x10, 0x8D, 0x47, 0x04, 0x89, 0x7E, 0x1C, 0x89, 0x7E,
-	0x20, 0x89, 0x46, 0x2C, 0x89, 0x46, 0x30, 0xA1, 0x08, 0xA7, 0x40, 0x00,
-	0x89, 0x7E, 0x50, 0x89, 0x46, 0x48, 0x5F, 0xC7, 0x46, 0x40, 0x00, 0x00,
-	0x00, 0x00, 0x8B, 0xC6, 0x5E, 0x5D, 0xC2, 0x0C, 0x00, 0x5F, 0x33, 0xC0,
-	0x5E, 0x5D, 0xC2, 0x0C, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x56, 0x8B, 0xF1, 0x83, 0x7E, 0x50, 0x00, 0x74, 0x21, 0x8B, 0x06, 0x6A,
-	0xFF, 0xFF, 0x50, 0x0C, 0x83, 0xF8, 0xFF, 0x74, 0x15, 0xFF, 0x76, 0x50,
-	0xFF, 0x15, 0x18, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0x85, 0xC0, 0x79,
-	0x05, 0x83, 0xC8, 0xFF, 0x5E, 0xC3, 0x33, 0xC0, 0x5E, 0xC3, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x56, 0x8B, 0xF1, 0x8B, 0x4D, 0x08, 0x57, 0xE8, 0x21,
-	0x11, 0x00, 0x00, 0x8B, 0xF8, 0x8B, 0xCF, 0xFF, 0x15, 0xE4, 0x70, 0x40,
-	0x00, 0x84, 0xC0, 0x74, 0x0D, 0x5F, 0xC7, 0x46, 0x40, 0x00, 0x00, 0x00,
-	0x00, 0x5E, 0x5D, 0xC2, 0x04, 0x00, 0x8B, 0xCE, 0x89, 0x7E, 0x40, 0xFF,
-	0x15, 0x50, 0x70, 0x40, 0x00, 0x5F, 0x5E, 0x5D, 0xC2, 0x04, 0x00, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x8B, 0x41, 0x98, 0x56, 0x8B,
-	0x40, 0x04, 0x57, 0x8D, 0x79, 0x98, 0xC7, 0x04, 0x38, 0x28, 0x75, 0x40,
-	0x00, 0x8B, 0x07, 0x8D, 0x4F, 0x18, 0x8B, 0x50, 0x04, 0x8D, 0x42, 0x98,
-	0x89, 0x44, 0x3A, 0xFC, 0xE8, 0x57, 0xEE, 0xFF, 0xFF, 0x8D, 0x4F, 0x20,
-	0xFF, 0x15, 0x88, 0x70, 0x40, 0x00, 0x8D, 0x4F, 0x68, 0xFF, 0x15, 0xB0,
-	0x70, 0x40, 0x00, 0xF6, 0x45, 0x08, 0x01, 0x74, 0x0A, 0x57, 0xFF, 0x15,
-	0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0x8B, 0xC7, 0x5F, 0x5E, 0x5D,
-	0xC2, 0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x56, 0x8B, 0xF1, 0xE8, 0x15,
-	0xEE, 0xFF, 0xFF, 0xF6, 0x45, 0x08, 0x01, 0x74, 0x0A, 0x56, 0xFF, 0x15,
-	0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0x8B, 0xC6, 0x5E, 0x5D, 0xC2,
-	0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x8B, 0x41, 0x90, 0x56, 0x8B,
-	0x40, 0x04, 0x57, 0x8D, 0x79, 0x90, 0xC7, 0x04, 0x38, 0xB0, 0x74, 0x40,
-	0x00, 0x8B, 0x07, 0x8D, 0x4F, 0x10, 0x8B, 0x50, 0x04, 0x8D, 0x42, 0x90,
-	0x89, 0x44, 0x3A, 0xFC, 0xE8, 0xA7, 0xF5, 0xFF, 0xFF, 0x8D, 0x4F, 0x18,
-	0xFF, 0x15, 0x9C, 0x70, 0x40, 0x00, 0x8D, 0x4F, 0x70, 0xFF, 0x15, 0xB0,
-	0x70, 0x40, 0x00, 0xF6, 0x45, 0x08, 0x01, 0x74, 0x0A, 0x57, 0xFF, 0x15,
-	0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0x8B, 0xC7, 0x5F, 0x5E, 0x5D,
-	0xC2, 0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x56, 0x8B, 0xF1, 0xE8, 0x65,
-	0xF5, 0xFF, 0xFF, 0xF6, 0x45, 0x08, 0x01, 0x74, 0x0A, 0x56, 0xFF, 0x15,
-	0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0x8B, 0xC6, 0x5E, 0x5D, 0xC2,
-	0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x56, 0x8B, 0xF1, 0xC7, 0x46, 0x14, 0x0F, 0x00,
-	0x00, 0x00, 0xC7, 0x46, 0x10, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x06, 0x00,
-	0x83, 0x7E, 0x14, 0x08, 0x73, 0x0A, 0xFF, 0x76, 0x10, 0x6A, 0x08, 0xE8,
-	0x5C, 0x0B, 0x00, 0x00, 0x83, 0x7E, 0x14, 0x10, 0x72, 0x04, 0x8B, 0x06,
-	0xEB, 0x02, 0x8B, 0xC6, 0x0F, 0x57, 0xC0, 0x66, 0x0F, 0xD6, 0x00, 0x83,
-	0x7E, 0x14, 0x10, 0xC7, 0x46, 0x10, 0x08, 0x00, 0x00, 0x00, 0x72, 0x0C,
-	0x8B, 0x06, 0xC6, 0x40, 0x08, 0x00, 0x8B, 0xC6, 0x5E, 0xC2, 0x08, 0x00,
-	0xC6, 0x46, 0x08, 0x00, 0x8B, 0xC6, 0x5E, 0xC2, 0x08, 0x00, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x56, 0x8B, 0xF1, 0x57, 0x8B,
-	0x7E, 0x10, 0x83, 0xC8, 0xFF, 0x2B, 0xC7, 0x83, 0xF8, 0x01, 0x77, 0x0B,
-	0x68, 0x64, 0x74, 0x40, 0x00, 0xFF, 0x15, 0x28, 0x70, 0x40, 0x00, 0x51,
-	0x47, 0x57, 0xE8, 0xF9, 0x06, 0x00, 0x00, 0x84, 0xC0, 0x74, 0x32, 0x83,
-	0x7E, 0x14, 0x10, 0x8B, 0x56, 0x10, 0x72, 0x04, 0x8B, 0x0E, 0xEB, 0x02,
-	0x8B, 0xCE, 0x8A, 0x45, 0x08, 0x88, 0x04, 0x11, 0x83, 0x7E, 0x14, 0x10,
-	0x89, 0x7E, 0x10, 0x72, 0x0E, 0x8B, 0x06, 0xC6, 0x04, 0x38, 0x00, 0x5F,
-	0x8B, 0xC6, 0x5E, 0x5D, 0xC2, 0x04, 0x00, 0x8B, 0xC6, 0xC6, 0x04, 0x38,
-	0x00, 0x5F, 0x8B, 0xC6, 0x5E, 0x5D, 0xC2, 0x04, 0x00, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x53,
-	0x8B, 0x5D, 0x08, 0x56, 0x57, 0x8B, 0x7B, 0x10, 0x8B, 0xF1, 0x8B, 0x4D,
-	0x0C, 0x3B, 0xF9, 0x73, 0x0B, 0x68, 0x74, 0x74, 0x40, 0x00, 0xFF, 0x15,
-	0xEC, 0x70, 0x40, 0x00, 0x2B, 0xF9, 0x39, 0x7D, 0x10, 0x0F, 0x42, 0x7D,
-	0x10, 0x3B, 0xF3, 0x75, 0x4E, 0x8D, 0x04, 0x0F, 0x39, 0x46, 0x10, 0x73,
-	0x0B, 0x68, 0x74, 0x74, 0x40, 0x00, 0xFF, 0x15, 0xEC, 0x70, 0x40, 0x00,
-	0x83, 0x7E, 0x14, 0x10, 0x89, 0x46, 0x10, 0x72, 0x19, 0x8B, 0x16, 0x51,
-	0x6A, 0x00, 0x8B, 0xCE, 0xC6, 0x04, 0x10, 0x00, 0xE8, 0x87, 0x00, 0x00,
-	0x00, 0x5F, 0x8B, 0xC6, 0x5E, 0x5B, 0x5D, 0xC2, 0x0C, 0x00, 0x51, 0x8B,
-	0xD6, 0x6A, 0x00, 0x8B, 0xCE, 0xC6, 0x04, 0x10, 0x00, 0xE8, 0x6E, 0x00,
-	0x00, 0x00, 0x5F, 0x8B, 0xC6, 0x5E, 0x5B, 0x5D, 0xC2, 0x0C, 0x00, 0x51,
-	0x57, 0x8B, 0xCE, 0xE8, 0x2C, 0x06, 0x00, 0x00, 0x84, 0xC0, 0x74, 0x46,
-	0x83, 0x7B, 0x14, 0x10, 0x72, 0x02, 0x8B, 0x1B, 0x83, 0x7E, 0x14, 0x10,
-	0x72, 0x04, 0x8B, 0x0E, 0xEB, 0x02, 0x8B, 0xCE, 0x85, 0xFF, 0x74, 0x10,
-	0x8B, 0x45, 0x0C, 0x57, 0x03, 0xC3, 0x50, 0x51, 0xE8, 0x0D, 0x1E, 0x00,
-	0x00, 0x83, 0xC4, 0x0C, 0x83, 0x7E, 0x14, 0x10, 0x89, 0x7E, 0x10, 0x72,
-	0x0F, 0x8B, 0x06, 0xC6, 0x04, 0x38, 0x00, 0x5F, 0x8B, 0xC6, 0x5E, 0x5B,
-	0x5D, 0xC2, 0x0C, 0x00, 0x8B, 0xC6, 0xC6, 0x04, 0x38, 0x00, 0x5F, 0x8B,
-	0xC6, 0x5E, 0x5B, 0x5D, 0xC2, 0x0C, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x56, 0x8B, 0xF1, 0x8B, 0x4D,
-	0x08, 0x57, 0x8B, 0x7E, 0x10, 0x3B, 0xF9, 0x73, 0x0B, 0x68, 0x74, 0x74,
-	0x40, 0x00, 0xFF, 0x15, 0xEC, 0x70, 0x40, 0x00, 0x8B, 0x55, 0x0C, 0x8B,
-	0xC7, 0x2B, 0xC1, 0x3B, 0xC2, 0x77, 0x23, 0x83, 0x7E, 0x14, 0x10, 0x89,
-	0x4E, 0x10, 0x72, 0x0E, 0x8B, 0x06, 0x5F, 0xC6, 0x04, 0x08, 0x00, 0x8B,
-	0xC6, 0x5E, 0x5D, 0xC2, 0x08, 0x00, 0x8B, 0xC6, 0x5F, 0xC6, 0x04, 0x08,
-	0x00, 0x5E, 0x5D, 0xC2, 0x08, 0x00, 0x85, 0xD2, 0x74, 0x45, 0x83, 0x7E,
-	0x14, 0x10, 0x72, 0x04, 0x8B, 0x06, 0xEB, 0x02, 0x8B, 0xC6, 0x2B, 0xFA,
-	0x53, 0x8D, 0x1C, 0x08, 0x8B, 0xC7, 0x2B, 0xC1, 0x74, 0x0F, 0x50, 0x8D,
-	0x04, 0x13, 0x50, 0x53, 0xFF, 0x15, 0xE0, 0x71, 0x40, 0x00, 0x83, 0xC4,
-	0x0C, 0x83, 0x7E, 0x14, 0x10, 0x89, 0x7E, 0x10, 0x5B, 0x72, 0x0E, 0x8B,
-	0x06, 0xC6, 0x04, 0x38, 0x00, 0x5F, 0x8B, 0xC6, 0x5E, 0x5D, 0xC2, 0x08,
-	0x00, 0x8B, 0xC6, 0xC6, 0x04, 0x38, 0x00, 0x5F, 0x8B, 0xC6, 0x5E, 0x5D,
-	0xC2, 0x08, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x53,
-	0x57, 0x8B, 0x7D, 0x0C, 0x39, 0x79, 0x10, 0x0F, 0x42, 0x79, 0x10, 0x83,
-	0x79, 0x14, 0x10, 0x72, 0x02, 0x8B, 0x09, 0x8B, 0x5D, 0x14, 0x3B, 0xFB,
-	0x8B, 0xD3, 0x0F, 0x42, 0xD7, 0x85, 0xD2, 0x74, 0x5C, 0x56, 0x8B, 0x75,
-	0x10, 0x83, 0xEA, 0x04, 0x72, 0x13, 0x8B, 0xFF, 0x8B, 0x01, 0x3B, 0x06,
-	0x75, 0x10, 0x83, 0xC1, 0x04, 0x83, 0xC6, 0x04, 0x83, 0xEA, 0x04, 0x73,
-	0xEF, 0x83, 0xFA, 0xFC, 0x74, 0x34, 0x8A, 0x01, 0x3A, 0x06, 0x75, 0x27,
-	0x83, 0xFA, 0xFD, 0x74, 0x29, 0x8A, 0x41, 0x01, 0x3A, 0x46, 0x01, 0x75,
-	0x1A, 0x83, 0xFA, 0xFE, 0x74, 0x1C, 0x8A, 0x41, 0x02, 0x3A, 0x46, 0x02,
-	0x75, 0x0D, 0x83, 0xFA, 0xFF, 0x74, 0x0F, 0x8A, 0x41, 0x03, 0x3A, 0x46,
-	0x03, 0x74, 0x07, 0x1B, 0xC0, 0x83, 0xC8, 0x01, 0xEB, 0x02, 0x33, 0xC0,
-	0x5E, 0x85, 0xC0, 0x75, 0x14, 0x3B, 0xFB, 0x73, 0x09, 0x5F, 0x83, 0xC8,
-	0xFF, 0x5B, 0x5D, 0xC2, 0x10, 0x00, 0x33, 0xC0, 0x3B, 0xFB, 0x0F, 0x95,
-	0xC0, 0x5F, 0x5B, 0x5D, 0xC2, 0x10, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x56, 0x8B, 0x71, 0x04, 0x57, 0x8B, 0x79, 0x08, 0x8B, 0xD7, 0x2B, 0xD6,
-	0xB8, 0xE9, 0xA2, 0x8B, 0x2E, 0xF7, 0xEA, 0xC1, 0xFA, 0x04, 0x8B, 0xC2,
-	0xC1, 0xE8, 0x1F, 0x03, 0xC2, 0x83, 0xF8, 0x01, 0x73, 0x6B, 0x2B, 0x31,
-	0xB8, 0xE9, 0xA2, 0x8B, 0x2E, 0xF7, 0xEE, 0xC1, 0xFA, 0x04, 0x8B, 0xF2,
-	0x53, 0xC1, 0xEE, 0x1F, 0xBB, 0x2E, 0xBA, 0xE8, 0x02, 0x03, 0xF2, 0x8B,
-	0xC3, 0x2B, 0xC6, 0x83, 0xF8, 0x01, 0x73, 0x0B, 0x68, 0x8C, 0x74, 0x40,
-	0x00, 0xFF, 0x15, 0x28, 0x70, 0x40, 0x00, 0x2B, 0x39, 0xB8, 0xE9, 0xA2,
-	0x8B, 0x2E, 0xF7, 0xEF, 0xC1, 0xFA, 0x04, 0x8B, 0xC2, 0xC1, 0xE8, 0x1F,
-	0x03, 0xC2, 0x8B, 0xD0, 0xD1, 0xEA, 0x2B, 0xDA, 0x46, 0x3B, 0xD8, 0x5B,
-	0x73, 0x12, 0x33, 0xC0, 0x3B, 0xC6, 0x0F, 0x42, 0xC6, 0x50, 0xE8, 0x75,
-	0x04, 0x00, 0x00, 0x5F, 0x5E, 0xC2, 0x04, 0x00, 0x03, 0xC2, 0x3B, 0xC6,
-	0x0F, 0x42, 0xC6, 0x50, 0xE8, 0x63, 0x04, 0x00, 0x00, 0x5F, 0x5E, 0xC2,
-	0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x56, 0x8B, 0x71, 0x04, 0x57, 0x8B, 0x79, 0x08,
-	0x8B, 0xD7, 0x2B, 0xD6, 0xB8, 0xAB, 0xAA, 0xAA, 0x2A, 0xF7, 0xEA, 0xC1,
-	0xFA, 0x02, 0x8B, 0xC2, 0xC1, 0xE8, 0x1F, 0x03, 0xC2, 0x83, 0xF8, 0x01,
-	0x73, 0x6B, 0x2B, 0x31, 0xB8, 0xAB, 0xAA, 0xAA, 0x2A, 0xF7, 0xEE, 0xC1,
-	0xFA, 0x02, 0x8B, 0xF2, 0x53, 0xC1, 0xEE, 0x1F, 0xBB, 0xAA, 0xAA, 0xAA,
-	0x0A, 0x03, 0xF2, 0x8B, 0xC3, 0x2B, 0xC6, 0x83, 0xF8, 0x01, 0x73, 0x0B,
-	0x68, 0x8C, 0x74, 0x40, 0x00, 0xFF, 0x15, 0x28, 0x70, 0x40, 0x00, 0x2B,
-	0x39, 0xB8, 0xAB, 0xAA, 0xAA, 0x2A, 0xF7, 0xEF, 0xC1, 0xFA, 0x02, 0x8B,
-	0xC2, 0xC1, 0xE8, 0x1F, 0x03, 0xC2, 0x8B, 0xD0, 0xD1, 0xEA, 0x2B, 0xDA,
-	0x46, 0x3B, 0xD8, 0x5B, 0x73, 0x12, 0x33, 0xC0, 0x3B, 0xC6, 0x0F, 0x42,
-	0xC6, 0x50, 0xE8, 0xC5, 0x05, 0x00, 0x00, 0x5F, 0x5E, 0xC2, 0x04, 0x00,
-	0x03, 0xC2, 0x3B, 0xC6, 0x0F, 0x42, 0xC6, 0x50, 0xE8, 0xB3, 0x05, 0x00,
-	0x00, 0x5F, 0x5E, 0xC2, 0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x83,
-	0xE4, 0xF8, 0x6A, 0xFF, 0x68, 0x58, 0x60, 0x40, 0x00, 0x64, 0xA1, 0x00,
-	0x00, 0x00, 0x00, 0x50, 0x83, 0xEC, 0x28, 0xA1, 0x18, 0xA0, 0x40, 0x00,
-	0x33, 0xC4, 0x89, 0x44, 0x24, 0x20, 0x53, 0x56, 0x57, 0xA1, 0x18, 0xA0,
-	0x40, 0x00, 0x33, 0xC4, 0x50, 0x8D, 0x44, 0x24, 0x38, 0x64, 0xA3, 0x00,
-	0x00, 0x00, 0x00, 0x8B, 0xF9, 0x83, 0x7F, 0x40, 0x00, 0x0F, 0x84, 0x44,
-	0x01, 0x00, 0x00, 0x80, 0x7F, 0x45, 0x00, 0x0F, 0x84, 0x3A, 0x01, 0x00,
-	0x00, 0x8B, 0x07, 0x6A, 0xFF, 0xFF, 0x50, 0x0C, 0x83, 0xF8, 0xFF, 0x75,
-	0x07, 0x32, 0xC0, 0xE9, 0x29, 0x01, 0x00, 0x00, 0x83, 0xEC, 0x08, 0x8D,
-	0x4C, 0x24, 0x20, 0xE8, 0x64, 0xFB, 0xFF, 0xFF, 0xC7, 0x44, 0x24, 0x40,
-	0x00, 0x00, 0x00, 0x00, 0x8B, 0x5C, 0x24, 0x2C, 0x8D, 0x44, 0x24, 0x14,
-	0x50, 0x8B, 0x44, 0x24, 0x2C, 0x83, 0xFB, 0x10, 0x8D, 0x54, 0x24, 0x1C,
-	0x0F, 0x43, 0x54, 0x24, 0x1C, 0x8D, 0x4C, 0x24, 0x1C, 0x0F, 0x43, 0x4C,
-	0x24, 0x1C, 0x03, 0xC2, 0x50, 0x51, 0x8B, 0x4F, 0x40, 0x8D, 0x47, 0x48,
-	0x50, 0xFF, 0x15, 0x58, 0x70, 0x40, 0x00, 0x83, 0xE8, 0x00, 0x74, 0x13,
-	0x48, 0x74, 0x14, 0x83, 0xE8, 0x02, 0x0F, 0x84, 0xB5, 0x00, 0x00, 0x00,
-	0x32, 0xDB, 0xE9, 0xB0, 0x00, 0x00, 0x00, 0xC6, 0x47, 0x45, 0x00, 0x8B,
-	0x5C, 0x24, 0x2C, 0x8B, 0x4C, 0x24, 0x18, 0x8B, 0x74, 0x24, 0x14, 0x83,
-	0xFB, 0x10, 0x8D, 0x44, 0x24, 0x18, 0x0F, 0x43, 0xC1, 0x2B, 0xF0, 0x74,
-	0x1E, 0xFF, 0x77, 0x50, 0x8D, 0x44, 0x24, 0x1C, 0x56, 0x83, 0xFB, 0x10,
-	0x0F, 0x43, 0xC1, 0x6A, 0x01, 0x50, 0xFF, 0x15, 0x50, 0x71, 0x40, 0x00,
-	0x83, 0xC4, 0x10, 0x3B, 0xF0, 0x75, 0xBD, 0x80, 0x7F, 0x45, 0x00, 0x74,
-	0x6C, 0x85, 0xF6, 0x0F, 0x85, 0x6B, 0xFF, 0xFF, 0xFF, 0x8B, 0x4C, 0x24,
-	0x28, 0x83, 0xC8, 0xFF, 0x2B, 0xC1, 0x83, 0xF8, 0x08, 0x76, 0x4B, 0x8D,
-	0x71, 0x08, 0x51, 0x56, 0x8D, 0x4C, 0x24, 0x20, 0xE8, 0x2B, 0x02, 0x00,
-	0x00, 0x84, 0xC0, 0x0F, 0x84, 0x47, 0xFF, 0xFF, 0xFF, 0x83, 0x7C, 0x24,
-	0x2C, 0x10, 0x8B, 0x44, 0x24, 0x28, 0x8D, 0x4C, 0x24, 0x18, 0x0F, 0x43,
-	0x4C, 0x24, 0x18, 0x0F, 0x57, 0xC0, 0x66, 0x0F, 0xD6, 0x04, 0x01, 0x83,
-	0x7C, 0x24, 0x2C, 0x10, 0x8D, 0x44, 0x24, 0x18, 0x0F, 0x43, 0x44, 0x24,
-	0x18, 0x89, 0x74, 0x24, 0x28, 0xC6, 0x04, 0x30, 0x00, 0xE9, 0x12, 0xFF,
-	0xFF, 0xFF, 0x68, 0x64, 0x74, 0x40, 0x00, 0xFF, 0x15, 0x28, 0x70, 0x40,
-	0x00, 0xB3, 0x01, 0x83, 0x7C, 0x24, 0x2C, 0x10, 0x72, 0x0D, 0xFF, 0x74,
-	0x24, 0x18, 0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0x8A,
-	0xC3, 0xEB, 0x02, 0xB0, 0x01, 0x8B, 0x4C, 0x24, 0x38, 0x64, 0x89, 0x0D,
-	0x00, 0x00, 0x00, 0x00, 0x59, 0x5F, 0x5E, 0x5B, 0x8B, 0x4C, 0x24, 0x20,
-	0x33, 0xCC, 0xE8, 0x9D, 0x0F, 0x00, 0x00, 0x8B, 0xE5, 0x5D, 0xC3, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x56, 0x8B, 0x71, 0x0C,
-	0x8D, 0x41, 0x44, 0x39, 0x06, 0x75, 0x14, 0x8B, 0x41, 0x38, 0x8B, 0x51,
-	0x3C, 0x89, 0x06, 0x8B, 0x41, 0x1C, 0x89, 0x10, 0x8B, 0x41, 0x2C, 0x2B,
-	0xD2, 0x89, 0x10, 0x5E, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x56, 0x8B, 0xD1, 0x57,
-	0x8B, 0x7A, 0x0C, 0x8D, 0x72, 0x44, 0x8B, 0x07, 0x3B, 0xC6, 0x74, 0x10,
-	0x8B, 0x4A, 0x1C, 0x89, 0x42, 0x38, 0x8B, 0x42, 0x2C, 0x8B, 0x00, 0x03,
-	0x01, 0x89, 0x42, 0x3C, 0x89, 0x37, 0x8B, 0x42, 0x1C, 0x8B, 0xCA, 0x89,
-	0x30, 0x8B, 0x42, 0x2C, 0x2B, 0xCE, 0x83, 0xC1, 0x45, 0x5F, 0x89, 0x08,
-	0x5E, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x56, 0x8B, 0xF1, 0xFF, 0x15, 0x2C, 0x70, 0x40, 0x00, 0x84, 0xC0, 0x75,
-	0x08, 0x8B, 0x0E, 0xFF, 0x15, 0x48, 0x70, 0x40, 0x00, 0x8B, 0x0E, 0x5E,
-	0x8B, 0x01, 0x8B, 0x40, 0x04, 0x8B, 0x4C, 0x08, 0x38, 0x85, 0xC9, 0x74,
-	0x05, 0x8B, 0x01, 0xFF, 0x60, 0x08, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x53, 0x8B, 0x5D, 0x08, 0x56, 0x8B, 0xF1, 0x85, 0xDB,
-	0x74, 0x57, 0x8B, 0x4E, 0x14, 0x83, 0xF9, 0x10, 0x72, 0x04, 0x8B, 0x06,
-	0xEB, 0x02, 0x8B, 0xC6, 0x3B, 0xD8, 0x72, 0x45, 0x83, 0xF9, 0x10, 0x72,
-	0x04, 0x8B, 0x16, 0xEB, 0x02, 0x8B, 0xD6, 0x8B, 0x46, 0x10, 0x03, 0xC2,
-	0x3B, 0xC3, 0x76, 0x31, 0x83, 0xF9, 0x10, 0x72, 0x16, 0x8B, 0x06, 0xFF,
-	0x75, 0x0C, 0x2B, 0xD8, 0x53, 0x56, 0x8B, 0xCE, 0xE8, 0x07, 0xFA, 0xFF,
-	0xFF, 0x5E, 0x5B, 0x5D, 0xC2, 0x08, 0x00, 0xFF, 0x75, 0x0C, 0x8B, 0xC6,
-	0x2B, 0xD8, 0x53, 0x56, 0x8B, 0xCE, 0xE8, 0xF1, 0xF9, 0xFF, 0xFF, 0x5E,
-	0x5B, 0x5D, 0xC2, 0x08, 0x00, 0x57, 0x8B, 0x7D, 0x0C, 0x83, 0xFF, 0xFE,
-	0x76, 0x0B, 0x68, 0x64, 0x74, 0x40, 0x00, 0xFF, 0x15, 0x28, 0x70, 0x40,
-	0x00, 0x8B, 0x46, 0x14, 0x3B, 0xC7, 0x73, 0x19, 0xFF, 0x76, 0x10, 0x8B,
-	0xCE, 0x57, 0xE8, 0x75, 0x04, 0x00, 0x00, 0x85, 0xFF, 0x74, 0x5F, 0x83,
-	0x7E, 0x14, 0x10, 0x72, 0x2A, 0x8B, 0x06, 0xEB, 0x28, 0x85, 0xFF, 0x75,
-	0xF2, 0x89, 0x7E, 0x10, 0x83, 0xF8, 0x10, 0x72, 0x0E, 0x8B, 0x06, 0x5F,
-	0xC6, 0x00, 0x00, 0x8B, 0xC6, 0x5E, 0x5B, 0x5D, 0xC2, 0x08, 0x00, 0x5F,
-	0x8B, 0xC6, 0x5E, 0xC6, 0x00, 0x00, 0x5B, 0x5D, 0xC2, 0x08, 0x00, 0x8B,
-	0xC6, 0x85, 0xFF, 0x74, 0x0B, 0x57, 0x53, 0x50, 0xE8, 0x3D, 0x18, 0x00,
-	0x00, 0x83, 0xC4, 0x0C, 0x83, 0x7E, 0x14, 0x10, 0x89, 0x7E, 0x10, 0x72,
-	0x0F, 0x8B, 0x06, 0xC6, 0x04, 0x38, 0x00, 0x5F, 0x8B, 0xC6, 0x5E, 0x5B,
-	0x5D, 0xC2, 0x08, 0x00, 0x8B, 0xC6, 0xC6, 0x04, 0x38, 0x00, 0x5F, 0x8B,
-	0xC6, 0x5E, 0x5B, 0x5D, 0xC2, 0x08, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x56, 0x8B, 0x75, 0x08, 0x83,
-	0xFE, 0xFE, 0x76, 0x0B, 0x68, 0x64, 0x74, 0x40, 0x00, 0xFF, 0x15, 0x28,
-	0x70, 0x40, 0x00, 0x8B, 0x41, 0x14, 0x3B, 0xC6, 0x73, 0x16, 0xFF, 0x71,
-	0x10, 0x56, 0xE8, 0xD9, 0x03, 0x00, 0x00, 0x33, 0xC0, 0x3B, 0xC6, 0x1B,
-	0xC0, 0xF7, 0xD8, 0x5E, 0x5D, 0xC2, 0x08, 0x00, 0x85, 0xF6, 0x75, 0x0D,
-	0x89, 0x71, 0x10, 0x83, 0xF8, 0x10, 0x72, 0x02, 0x8B, 0x09, 0xC6, 0x01,
-	0x00, 0x33, 0xC0, 0x3B, 0xC6, 0x1B, 0xC0, 0xF7, 0xD8, 0x5E, 0x5D, 0xC2,
-	0x08, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x6A, 0xFF, 0x68, 0x80, 0x60,
-	0x40, 0x00, 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x50, 0x83, 0xEC, 0x08,
-	0x53, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00, 0x33, 0xC5, 0x50, 0x8D,
-	0x45, 0xF4, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x89, 0x65, 0xF0, 0x8B,
-	0xD9, 0x8B, 0x75, 0x08, 0x33, 0xFF, 0x89, 0x7D, 0xEC, 0x85, 0xF6, 0x74,
-	0x26, 0x81, 0xFE, 0x2E, 0xBA, 0xE8, 0x02, 0x77, 0x18, 0x8B, 0xC6, 0x6B,
-	0xC0, 0x58, 0x50, 0xFF, 0x15, 0x60, 0x71, 0x40, 0x00, 0x8B, 0xF8, 0x83,
-	0xC4, 0x04, 0x89, 0x7D, 0xEC, 0x85, 0xFF, 0x75, 0x06, 0xFF, 0x15, 0xF0,
-	0x70, 0x40, 0x00, 0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x75,
-	0x08, 0x8B, 0x53, 0x04, 0x8B, 0x0B, 0x83, 0xEC, 0x08, 0x57, 0xE8, 0xA9,
-	0x0A, 0x00, 0x00, 0x8B, 0x4B, 0x04, 0x2B, 0x0B, 0xB8, 0xE9, 0xA2, 0x8B,
-	0x2E, 0xF7, 0xE9, 0x8B, 0x0B, 0xC1, 0xFA, 0x04, 0x8B, 0xC2, 0xC1, 0xE8,
-	0x1F, 0x03, 0xC2, 0x83, 0xC4, 0x10, 0x89, 0x45, 0x08, 0x85, 0xC9, 0x74,
-	0x1A, 0xFF, 0x75, 0x08, 0x8B, 0x53, 0x04, 0x51, 0xE8, 0xBB, 0x09, 0x00,
-	0x00, 0xFF, 0x33, 0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x8B, 0x45, 0x08,
-	0x83, 0xC4, 0x0C, 0x6B, 0xF6, 0x58, 0x6B, 0xC0, 0x58, 0x03, 0xF7, 0x03,
-	0xC7, 0x89, 0x73, 0x08, 0x89, 0x43, 0x04, 0x89, 0x3B, 0x8B, 0x4D, 0xF4,
-	0x64, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5F, 0x5E, 0x5B, 0x8B,
-	0xE5, 0x5D, 0xC2, 0x04, 0x00, 0xFF, 0x75, 0xEC, 0xFF, 0x15, 0x48, 0x71,
-	0x40, 0x00, 0x83, 0xC4, 0x04, 0x6A, 0x00, 0x6A, 0x00, 0xE8, 0x06, 0x16,
-	0x00, 0x00, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x56, 0x8B, 0xF1, 0x8B, 0x46,
-	0x3C, 0x83, 0xE0, 0x06, 0x3C, 0x06, 0x0F, 0x84, 0x8A, 0x00, 0x00, 0x00,
-	0x53, 0x8B, 0x5D, 0x0C, 0x57, 0x83, 0xFB, 0xFF, 0x0F, 0x87, 0x81, 0x00,
-	0x00, 0x00, 0x53, 0xFF, 0x15, 0x60, 0x71, 0x40, 0x00, 0x8B, 0xF8, 0x83,
-	0xC4, 0x04, 0x85, 0xFF, 0x74, 0x71, 0x53, 0xFF, 0x75, 0x08, 0x57, 0xE8,
-	0x7E, 0x16, 0x00, 0x00, 0x83, 0xC4, 0x0C, 0xF6, 0x46, 0x3C, 0x04, 0x8D,
-	0x0C, 0x1F, 0x89, 0x4E, 0x38, 0x75, 0x0F, 0x8B, 0x46, 0x0C, 0x89, 0x38,
-	0x8B, 0x46, 0x1C, 0x89, 0x38, 0x8B, 0x46, 0x2C, 0x89, 0x18, 0x8B, 0x46,
-	0x3C, 0xA8, 0x02, 0x75, 0x37, 0xA8, 0x10, 0x8B, 0x46, 0x10, 0x8B, 0xD7,
-	0x89, 0x38, 0x8B, 0x46, 0x20, 0x0F, 0x45, 0xD1, 0x89, 0x10, 0x8B, 0x46,
-	0x30, 0x8B, 0xCF, 0x2B, 0xCA, 0x03, 0xCB, 0x89, 0x08, 0x8B, 0x46, 0x1C,
-	0x83, 0x38, 0x00, 0x75, 0x13, 0x8B, 0x46, 0x0C, 0x89, 0x38, 0x8B, 0x46,
-	0x1C, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x46, 0x2C, 0x89, 0x38,
-	0x83, 0x4E, 0x3C, 0x01, 0x5F, 0x5B, 0x5E, 0x5D, 0xC2, 0x08, 0x00, 0xFF,
-	0x15, 0xF0, 0x70, 0x40, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x56, 0x8B, 0x75, 0x08, 0x57, 0x8B, 0x7D, 0x0C, 0x3B,
-	0xF7, 0x74, 0x2D, 0x53, 0x8B, 0x1D, 0x48, 0x71, 0x40, 0x00, 0x83, 0x7E,
-	0x14, 0x10, 0x72, 0x07, 0xFF, 0x36, 0xFF, 0xD3, 0x83, 0xC4, 0x04, 0xC7,
-	0x46, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x46, 0x10, 0x00, 0x00, 0x00,
-	0x00, 0xC6, 0x06, 0x00, 0x83, 0xC6, 0x18, 0x3B, 0xF7, 0x75, 0xDB, 0x5B,
-	0x5F, 0x5E, 0x5D, 0xC2, 0x08, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x53,
-	0x56, 0x8B, 0x75, 0x08, 0x57, 0x33, 0xFF, 0x8B, 0xD9, 0x85, 0xF6, 0x74,
-	0x24, 0x81, 0xFE, 0xAA, 0xAA, 0xAA, 0x0A, 0x77, 0x16, 0x8D, 0x04, 0x76,
-	0xC1, 0xE0, 0x03, 0x50, 0xFF, 0x15, 0x60, 0x71, 0x40, 0x00, 0x8B, 0xF8,
-	0x83, 0xC4, 0x04, 0x85, 0xFF, 0x75, 0x06, 0xFF, 0x15, 0xF0, 0x70, 0x40,
-	0x00, 0xFF, 0x75, 0x08, 0x8B, 0x53, 0x04, 0x8B, 0x0B, 0x83, 0xEC, 0x08,
-	0x57, 0xE8, 0xFA, 0x09, 0x00, 0x00, 0x8B, 0x4B, 0x04, 0x2B, 0x0B, 0xB8,
-	0xAB, 0xAA, 0xAA, 0x2A, 0xF7, 0xE9, 0x8B, 0x03, 0xC1, 0xFA, 0x02, 0x8B,
-	0xCA, 0xC1, 0xE9, 0x1F, 0x03, 0xCA, 0x83, 0xC4, 0x10, 0x89, 0x4D, 0x08,
-	0x85, 0xC0, 0x74, 0x17, 0xFF, 0x73, 0x04, 0x50, 0xE8, 0x3F, 0xFF, 0xFF,
-	0xFF, 0xFF, 0x33, 0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x8B, 0x4D, 0x08,
-	0x83, 0xC4, 0x04, 0x8D, 0x04, 0x76, 0x89, 0x3B, 0x8D, 0x04, 0xC7, 0x89,
-	0x43, 0x08, 0x8D, 0x04, 0x49, 0x8D, 0x04, 0xC7, 0x5F, 0x5E, 0x89, 0x43,
-	0x04, 0x5B, 0x5D, 0xC2, 0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x6A, 0xFF, 0x68, 0xA8, 0x60, 0x40, 0x00, 0x64, 0xA1,
-	0x00, 0x00, 0x00, 0x00, 0x50, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00,
-	0x33, 0xC5, 0x50, 0x8D, 0x45, 0xF4, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00,
-	0x8B, 0xF1, 0x83, 0x7E, 0x50, 0x00, 0x0F, 0x85, 0xC4, 0x00, 0x00, 0x00,
-	0x6A, 0x40, 0x6A, 0x21, 0xFF, 0x75, 0x08, 0xFF, 0x15, 0x34, 0x70, 0x40,
-	0x00, 0x8B, 0xF8, 0x83, 0xC4, 0x0C, 0x85, 0xFF, 0x0F, 0x84, 0xAA, 0x00,
-	0x00, 0x00, 0x8B, 0xCE, 0xC6, 0x46, 0x4C, 0x01, 0xC6, 0x46, 0x45, 0x00,
-	0xFF, 0x15, 0x50, 0x70, 0x40, 0x00, 0x8D, 0x47, 0x04, 0x89, 0x46, 0x2C,
-	0x89, 0x46, 0x30, 0xA1, 0x08, 0xA7, 0x40, 0x00, 0x8D, 0x4F, 0x08, 0x89,
-	0x46, 0x48, 0x8D, 0x45, 0x08, 0x89, 0x4E, 0x0C, 0x89, 0x4E, 0x10, 0x50,
-	0x8B, 0xCE, 0x89, 0x7E, 0x1C, 0x89, 0x7E, 0x20, 0x89, 0x7E, 0x50, 0xC7,
-	0x46, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x15, 0x44, 0x70, 0x40, 0x00,
-	0x8B, 0xC8, 0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xC2, 0x04,
-	0x00, 0x00, 0x8B, 0xF8, 0x8B, 0xCF, 0xFF, 0x15, 0xE4, 0x70, 0x40, 0x00,
-	0x84, 0xC0, 0x74, 0x09, 0xC7, 0x46, 0x40, 0x00, 0x00, 0x00, 0x00, 0xEB,
-	0x0B, 0x8B, 0xCE, 0x89, 0x7E, 0x40, 0xFF, 0x15, 0x50, 0x70, 0x40, 0x00,
-	0xC7, 0x45, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x4D, 0x08, 0x85, 0xC9,
-	0x74, 0x11, 0x8B, 0x01, 0xFF, 0x50, 0x08, 0x85, 0xC0, 0x74, 0x08, 0x8B,
-	0x10, 0x6A, 0x01, 0x8B, 0xC8, 0xFF, 0x12, 0x8B, 0xC6, 0x8B, 0x4D, 0xF4,
-	0x64, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5F, 0x5E, 0x8B, 0xE5,
-	0x5D, 0xC2, 0x0C, 0x00, 0x33, 0xC0, 0x8B, 0x4D, 0xF4, 0x64, 0x89, 0x0D,
-	0x00, 0x00, 0x00, 0x00, 0x59, 0x5F, 0x5E, 0x8B, 0xE5, 0x5D, 0xC2, 0x0C,
-	0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x6A,
-	0xFF, 0x68, 0x30, 0x60, 0x40, 0x00, 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00,
-	0x50, 0x83, 0xEC, 0x0C, 0x53, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00,
-	0x33, 0xC5, 0x50, 0x8D, 0x45, 0xF4, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00,
-	0x89, 0x65, 0xF0, 0x8B, 0xF1, 0x89, 0x75, 0xE8, 0x8B, 0x45, 0x08, 0x8B,
-	0xF8, 0x83, 0xCF, 0x0F, 0x83, 0xFF, 0xFE, 0x76, 0x04, 0x8B, 0xF8, 0xEB,
-	0x27, 0x8B, 0x5E, 0x14, 0xB8, 0xAB, 0xAA, 0xAA, 0xAA, 0xF7, 0xE7, 0x8B,
-	0xCB, 0xD1, 0xE9, 0xD1, 0xEA, 0x3B, 0xCA, 0x76, 0x13, 0xB8, 0xFE, 0xFF,
-	0xFF, 0xFF, 0x2B, 0xC1, 0x8D, 0x3C, 0x19, 0x3B, 0xD8, 0x76, 0x05, 0xBF,
-	0xFE, 0xFF, 0xFF, 0xFF, 0x8D, 0x4F, 0x01, 0x33, 0xC0, 0xC7, 0x45, 0xFC,
-	0x00, 0x00, 0x00, 0x00, 0x89, 0x45, 0xEC, 0x85, 0xC9, 0x74, 0x45, 0x83,
-	0xF9, 0xFF, 0x77, 0x11, 0x51, 0xFF, 0x15, 0x60, 0x71, 0x40, 0x00, 0x83,
-	0xC4, 0x04, 0x89, 0x45, 0xEC, 0x85, 0xC0, 0x75, 0x2F, 0xFF, 0x15, 0xF0,
-	0x70, 0x40, 0x00, 0x8B, 0x45, 0x08, 0x89, 0x45, 0x08, 0x40, 0x89, 0x65,
-	0xF0, 0x50, 0xC6, 0x45, 0xFC, 0x02, 0xE8, 0xA5, 0x00, 0x00, 0x00, 0x89,
-	0x45, 0xEC, 0xB8, 0x14, 0x4B, 0x40, 0x00, 0xC3, 0x8B, 0x45, 0xEC, 0x8B,
-	0x75, 0xE8, 0x8B, 0x7D, 0x08, 0x89, 0x45, 0xEC, 0x8B, 0x5D, 0x0C, 0x85,
-	0xDB, 0x74, 0x49, 0x83, 0x7E, 0x14, 0x10, 0x72, 0x32, 0x8B, 0x0E, 0xEB,
-	0x30, 0x8B, 0x75, 0xE8, 0x83, 0x7E, 0x14, 0x10, 0x72, 0x0B, 0xFF, 0x36,
-	0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0x6A, 0x00, 0xC7,
-	0x46, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x46, 0x10, 0x00, 0x00, 0x00,
-	0x00, 0x6A, 0x00, 0xC6, 0x06, 0x00, 0xE8, 0x55, 0x12, 0x00, 0x00, 0x8B,
-	0xCE, 0x85, 0xDB, 0x74, 0x0B, 0x53, 0x51, 0x50, 0xE8, 0xFD, 0x12, 0x00,
-	0x00, 0x83, 0xC4, 0x0C, 0x83, 0x7E, 0x14, 0x10, 0x72, 0x0B, 0xFF, 0x36,
-	0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0x8B, 0x45, 0xEC,
+	0x8B, 0x40, 0x00, 0x41, 0x5E, 0x83, 0xC8, 0xFF, 0x09, 0x00, 0x07, 0x90,
+	0x03, 0x04, 0x89, 0x00, 0xF5, 0x14, 0x10, 0x8B, 0x46, 0x2C, 0x8B, 0x00,
+	0x03, 0xC1, 0x3B, 0xC8, 0x73, 0x05, 0x0F, 0xB6, 0x01, 0x5E, 0xC3, 0x8B,
+	0x06, 0x57, 0x8B, 0xCE, 0xFF, 0x50, 0x1C, 0x8B, 0xF8, 0x83, 0xFF, 0xFF,
+	0x75, 0x05, 0x5F, 0x0B, 0xC0, 0x14, 0x00, 0x41, 0x10, 0x8B, 0xC7, 0x5F,
+	0x6A, 0x05, 0x05, 0x30, 0x03, 0x27, 0x98, 0x61, 0x30, 0x03, 0x16, 0x38,
+	0x30, 0x03, 0x1A, 0x30, 0x30, 0x03, 0x13, 0x48, 0x30, 0x03, 0x72, 0xD9,
+	0x89, 0x5C, 0x24, 0x24, 0x8B, 0x43, 0x7A, 0x00, 0xF0, 0x00, 0x23, 0x8B,
+	0x53, 0x2C, 0x8B, 0x32, 0x8D, 0x04, 0x0E, 0x3B, 0xC8, 0x73, 0x17, 0x8D,
+	0x46, 0x25, 0x03, 0x23, 0x4B, 0x1C, 0x25, 0x03, 0x50, 0x0F, 0xB6, 0x02,
+	0xE9, 0xFB, 0xD7, 0x02, 0x14, 0x7B, 0x26, 0x03, 0x10, 0xED, 0x26, 0x03,
+	0x00, 0xB8, 0x07, 0x22, 0x8D, 0x43, 0x26, 0x03, 0x10, 0x43, 0x26, 0x03,
+	0x43, 0x73, 0x38, 0x8B, 0xCB, 0x26, 0x03, 0xB2, 0x7B, 0x40, 0x00, 0x75,
+	0x19, 0xFF, 0x73, 0x50, 0xFF, 0x15, 0x20, 0xA4, 0x01, 0x81, 0x83, 0xF8,
+	0xFF, 0x74, 0xC5, 0x0F, 0xB6, 0xC0, 0x61, 0x03, 0x50, 0xC7, 0x44, 0x24,
+	0x3C, 0x0F, 0x27, 0x05, 0x30, 0x44, 0x24, 0x38, 0x8B, 0x00, 0x40, 0xC6,
+	0x44, 0x24, 0x28, 0x0D, 0x00, 0x01, 0x37, 0x04, 0x05, 0x36, 0x00, 0xF4,
+	0x01, 0x8B, 0xD0, 0x83, 0xC4, 0x04, 0x89, 0x54, 0x24, 0x1C, 0x83, 0xFA,
+	0xFF, 0x0F, 0x84, 0x61, 0x01, 0x40, 0x03, 0xF0, 0x00, 0x8B, 0x7C, 0x24,
+	0x38, 0x83, 0xC9, 0xFF, 0x2B, 0xCF, 0x83, 0xF9, 0x01, 0x0F, 0x86, 0xBF,
+	0x18, 0x00, 0x80, 0x77, 0x01, 0x83, 0xFE, 0xFE, 0x0F, 0x87, 0xB3, 0x97,
+	0x00, 0xF2, 0x05, 0x5C, 0x24, 0x3C, 0x3B, 0xDE, 0x0F, 0x83, 0xCC, 0x00,
+	0x00, 0x00, 0x57, 0x56, 0x8D, 0x4C, 0x24, 0x30, 0xE8, 0x4B, 0x11, 0x17,
+	0x00, 0x00, 0x39, 0x00, 0x82, 0x8B, 0x54, 0x24, 0x1C, 0x85, 0xF6, 0x74,
+	0x2D, 0x28, 0x03, 0x10, 0x28, 0x99, 0x02, 0x86, 0x28, 0x88, 0x14, 0x38,
+	0x83, 0x7C, 0x24, 0x3C, 0x11, 0x00, 0x71, 0x89, 0x74, 0x24, 0x38, 0xC6,
+	0x04, 0x30, 0x6A, 0x00, 0x00, 0x39, 0x00, 0x00, 0xC3, 0x02, 0x00, 0x3A,
+	0x01, 0xF0, 0x03, 0x1C, 0x50, 0x83, 0xFB, 0x10, 0x8B, 0x5C, 0x24, 0x2C,
+	0x8D, 0x44, 0x24, 0x1F, 0x50, 0x8D, 0x54, 0x24, 0x34, 0xBA, 0x03, 0x10,
+	0x34, 0x63, 0x03, 0x90, 0x50, 0x8D, 0x04, 0x17, 0x50, 0x8D, 0x4C, 0x24,
+	0x3C, 0x01, 0x03, 0x70, 0x3C, 0x51, 0x8B, 0x4B, 0x40, 0x8D, 0x43, 0xB1,
+	0x03, 0x13, 0x84, 0xB1, 0x03, 0x12, 0xA2, 0xB1, 0x03, 0x82, 0x7E, 0x58,
+	0x83, 0xF8, 0x03, 0x0F, 0x85, 0x94, 0x07, 0x04, 0x4A, 0x38, 0x01, 0x72,
+	0x72, 0x7A, 0x00, 0x20, 0x6A, 0x01, 0x68, 0x00, 0x11, 0x1F, 0xAA, 0x03,
+	0x12, 0x4C, 0xAA, 0x03, 0xF0, 0x00, 0x0F, 0xB6, 0x74, 0x24, 0x17, 0xEB,
+	0x68, 0x85, 0xF6, 0x0F, 0x85, 0x47, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x01,
+	0xCF, 0x03, 0x04, 0xA8, 0x00, 0x42, 0x00, 0x00, 0xE9, 0x54, 0x18, 0x00,
+	0xB2, 0x17, 0x39, 0x44, 0x24, 0x20, 0x8B, 0x44, 0x24, 0x18, 0x75, 0x6E,
+	0x56, 0x00, 0x10, 0x4C, 0x56, 0x00, 0x81, 0x4C, 0x24, 0x28, 0x2B, 0xC1,
+	0x50, 0x6A, 0x00, 0x0B, 0x01, 0x2F, 0x70, 0x06, 0x61, 0x01, 0x05, 0x70,
+	0x85, 0xA5, 0xFE, 0xFF, 0xFF, 0x83, 0xCE, 0x61, 0x03, 0x12, 0x3C, 0x61,
+	0x03, 0x16, 0x28, 0x61, 0x03, 0x5A, 0xC6, 0x8B, 0x4C, 0x24, 0x48, 0x61,
+	0x03, 0x61, 0x30, 0x33, 0xCC, 0xE8, 0xE2, 0x19, 0x61, 0x03, 0x12, 0xC3,
+	0x6E, 0x00, 0x10, 0x74, 0x6E, 0x00, 0xE0, 0x74, 0x24, 0x28, 0x2B, 0xF0,
+	0x03, 0x74, 0x24, 0x38, 0x85, 0xF6, 0x0F, 0x8E, 0x41, 0x4B, 0x04, 0x10,
+	0x3D, 0x18, 0x03, 0xF0, 0x00, 0x0F, 0xBE, 0x44, 0x06, 0xFF, 0xFF, 0x73,
+	0x50, 0x4E, 0x50, 0xFF, 0xD7, 0x83, 0xC4, 0x08, 0x1D, 0x00, 0x10, 0x24,
+	0x1D, 0x00, 0x57, 0x44, 0x24, 0x18, 0xEB, 0xE3, 0x0C, 0x04, 0x03, 0xA0,
+	0x03, 0xB4, 0x83, 0xE4, 0xF8, 0x83, 0xEC, 0x0C, 0x53, 0x56, 0x8B, 0xF1,
+	0x57, 0x4A, 0x03, 0x81, 0x75, 0x1A, 0x83, 0x7D, 0x14, 0x01, 0x75, 0x14,
+	0x73, 0x03, 0xF0, 0x06, 0x0E, 0x8B, 0x7D, 0x0C, 0x8B, 0x5D, 0x10, 0x83,
+	0xC7, 0xFF, 0x83, 0xD3, 0xFF, 0xEB, 0x06, 0x8B, 0x5D, 0x10, 0x8B, 0x7D,
+	0x0C, 0xC5, 0x05, 0x31, 0x0F, 0x84, 0x90, 0x70, 0x06, 0x32, 0xE8, 0x07,
+	0x08, 0xA1, 0x04, 0x11, 0x81, 0x87, 0x07, 0xF1, 0x00, 0x0B, 0xC3, 0x8B,
+	0x45, 0x14, 0x75, 0x05, 0x83, 0xF8, 0x01, 0x74, 0x13, 0x50, 0x53, 0x57,
+	0xC2, 0x06, 0x12, 0x14, 0x5F, 0x01, 0x91, 0x85, 0xC0, 0x75, 0x60, 0x8D,
+	0x44, 0x24, 0x10, 0x50, 0x15, 0x00, 0x12, 0x10, 0xC4, 0x03, 0x4F, 0x85,
+	0xC0, 0x75, 0x4B, 0x18, 0x07, 0x0B, 0x90, 0x8B, 0x45, 0x08, 0x8B, 0x4C,
+	0x24, 0x10, 0x89, 0x48, 0x07, 0x00, 0x80, 0x14, 0x89, 0x48, 0x0C, 0x8B,
+	0x4E, 0x48, 0xC7, 0x1F, 0x01, 0x41, 0x00, 0xC7, 0x40, 0x04, 0xFE, 0x06,
+	0x20, 0x48, 0x10, 0x29, 0x01, 0x50, 0xE5, 0x5D, 0xC2, 0x14, 0x00, 0x2D,
+	0x00, 0x20, 0x15, 0xFC, 0x8C, 0x07, 0xE2, 0x8B, 0x0A, 0x89, 0x08, 0x8B,
+	0x4A, 0x04, 0x5E, 0x89, 0x48, 0x04, 0xC7, 0x40, 0x08, 0x2F, 0x00, 0x12,
+	0x0C, 0x07, 0x00, 0x10, 0x10, 0x07, 0x00, 0x03, 0x31, 0x00, 0x0C, 0xB0,
+	0x04, 0x02, 0x10, 0x01, 0xD1, 0x8B, 0x45, 0x14, 0x53, 0x8B, 0x5D, 0x10,
+	0x56, 0x8B, 0xF1, 0x89, 0x44, 0x24, 0xEF, 0x00, 0xF0, 0x05, 0x8B, 0x45,
+	0x18, 0x57, 0x8B, 0x7D, 0x0C, 0x89, 0x44, 0x24, 0x14, 0x0F, 0x84, 0x87,
+	0x00, 0x00, 0x00, 0xE8, 0x0F, 0x07, 0xF8, 0x00, 0x26, 0x74, 0x7E, 0xD3,
+	0x00, 0x15, 0x2C, 0xD3, 0x00, 0x10, 0x69, 0x09, 0x01, 0x4D, 0x74, 0x14,
+	0x6A, 0x01, 0x02, 0x01, 0x1F, 0x4F, 0x02, 0x01, 0x01, 0xD1, 0x3A, 0x8B,
+	0x45, 0x1C, 0x8B, 0xCE, 0x89, 0x46, 0x48, 0xE8, 0x6A, 0x08, 0x00, 0xC4,
+	0x00, 0x0F, 0xF1, 0x00, 0x14, 0x1F, 0x20, 0xF1, 0x00, 0x1D, 0x19, 0x20,
+	0xF1, 0x00, 0x31, 0x55, 0x8B, 0xEC, 0xF9, 0x01, 0xF0, 0x09, 0x4E, 0x50,
+	0x85, 0xC9, 0x74, 0x73, 0x8B, 0x55, 0x08, 0x8B, 0x7D, 0x0C, 0x85, 0xD2,
+	0x75, 0x0E, 0x8B, 0xC7, 0x0B, 0x45, 0x10, 0x75, 0x07, 0xB8, 0x6E, 0x00,
+	0xB5, 0xEB, 0x02, 0x33, 0xC0, 0x57, 0x50, 0x52, 0x51, 0xFF, 0x15, 0x30,
+	0xC5, 0x00, 0xF0, 0x01, 0x48, 0x8B, 0x7E, 0x50, 0x8B, 0xCE, 0xC6, 0x46,
+	0x4C, 0x01, 0x88, 0x46, 0x45, 0xFF, 0x15, 0x50, 0x7A, 0x03, 0xF1, 0x1B,
+	0xFF, 0x74, 0x18, 0x8D, 0x47, 0x08, 0x89, 0x46, 0x0C, 0x89, 0x46, 0x10,
+	0x8D, 0x47, 0x04, 0x89, 0x7E, 0x1C, 0x89, 0x7E, 0x20, 0x89, 0x46, 0x2C,
+	0x89, 0x46, 0x30, 0xA1, 0x08, 0xA7, 0x40, 0x00, 0x89, 0x7E, 0x50, 0x89,
+	0x46, 0x48, 0x5F, 0xC7, 0x46, 0x40, 0x5A, 0x04, 0x91, 0xC6, 0x5E, 0x5D,
+	0xC2, 0x0C, 0x00, 0x5F, 0x33, 0xC0, 0x08, 0x00, 0x06, 0xA0, 0x05, 0x00,
+	0x6C, 0x01, 0x90, 0x74, 0x21, 0x8B, 0x06, 0x6A, 0xFF, 0xFF, 0x50, 0x0C,
+	0xCB, 0x04, 0x11, 0x15, 0x2C, 0x01, 0x12, 0x18, 0x1F, 0x03, 0xB0, 0x85,
+	0xC0, 0x79, 0x05, 0x83, 0xC8, 0xFF, 0x5E, 0xC3, 0x33, 0xC0, 0x91, 0x05,
+	0x02, 0xC0, 0x00, 0x60, 0x8B, 0x4D, 0x08, 0x57, 0xE8, 0x21, 0x7A, 0x04,
+	0x80, 0xF8, 0x8B, 0xCF, 0xFF, 0x15, 0xE4, 0x70, 0x40, 0x98, 0x01, 0x14,
+	0x0D, 0x6B, 0x00, 0x11, 0x5E, 0x4B, 0x06, 0x42, 0xCE, 0x89, 0x7E, 0x40,
+	0xAA, 0x00, 0x11, 0x5F, 0x11, 0x00, 0x04, 0x00, 0x01, 0xF6, 0x30, 0x8B,
+	0x41, 0x98, 0x56, 0x8B, 0x40, 0x04, 0x57, 0x8D, 0x79, 0x98, 0xC7, 0x04,
+	0x38, 0x28, 0x75, 0x40, 0x00, 0x8B, 0x07, 0x8D, 0x4F, 0x18, 0x8B, 0x50,
+	0x04, 0x8D, 0x42, 0x98, 0x89, 0x44, 0x3A, 0xFC, 0xE8, 0x57, 0xEE, 0xFF,
+	0xFF, 0x8D, 0x4F, 0x20, 0xFF, 0x15, 0x88, 0x70, 0x40, 0x00, 0x8D, 0x4F,
+	0x68, 0xFF, 0x15, 0xB0, 0x70, 0x40, 0x00, 0xF6, 0x45, 0x08, 0x01, 0x74,
+	0x0A, 0x57, 0xB9, 0x03, 0x17, 0xC7, 0x58, 0x00, 0x0A, 0x60, 0x01, 0x52,
+	0xE8, 0x15, 0xEE, 0xFF, 0xFF, 0x30, 0x00, 0x17, 0x56, 0xE9, 0x03, 0x0E,
+	0x2F, 0x00, 0x02, 0x90, 0x00, 0x13, 0x90, 0x90, 0x00, 0x62, 0x90, 0xC7,
+	0x04, 0x38, 0xB0, 0x74, 0x90, 0x00, 0x11, 0x10, 0x90, 0x00, 0x11, 0x90,
+	0x90, 0x00, 0x20, 0xA7, 0xF5, 0x90, 0x00, 0x41, 0x18, 0xFF, 0x15, 0x9C,
+	0x90, 0x00, 0x1F, 0x70, 0x90, 0x00, 0x1F, 0x2F, 0x65, 0xF5, 0x90, 0x00,
+	0x14, 0x61, 0x56, 0x8B, 0xF1, 0xC7, 0x46, 0x14, 0x40, 0x06, 0x11, 0x46,
+	0x44, 0x02, 0xF0, 0x03, 0xC6, 0x06, 0x00, 0x83, 0x7E, 0x14, 0x08, 0x73,
+	0x0A, 0xFF, 0x76, 0x10, 0x6A, 0x08, 0xE8, 0x5C, 0x0B, 0x00, 0x10, 0x00,
+	0xF1, 0x00, 0x10, 0x72, 0x04, 0x8B, 0x06, 0xEB, 0x02, 0x8B, 0xC6, 0x0F,
+	0x57, 0xC0, 0x66, 0x0F, 0xD6, 0x13, 0x00, 0x30, 0xC7, 0x46, 0x10, 0x84,
+	0x02, 0x70, 0x72, 0x0C, 0x8B, 0x06, 0xC6, 0x40, 0x08, 0xF0, 0x01, 0x54,
+	0xC2, 0x08, 0x00, 0xC6, 0x46, 0x0A, 0x00, 0x0A, 0x80, 0x02, 0xC7, 0x7E,
+	0x10, 0x83, 0xC8, 0xFF, 0x2B, 0xC7, 0x83, 0xF8, 0x01, 0x77, 0x0B, 0xA3,
+	0x04, 0x61, 0x51, 0x47, 0x57, 0xE8, 0xF9, 0x06, 0x66, 0x03, 0x10, 0x32,
+	0x54, 0x00, 0x20, 0x8B, 0x56, 0x6A, 0x00, 0xB0, 0x0E, 0xEB, 0x02, 0x8B,
+	0xCE, 0x8A, 0x45, 0x08, 0x88, 0x04, 0x11, 0x15, 0x00, 0xC3, 0x89, 0x7E,
+	0x10, 0x72, 0x0E, 0x8B, 0x06, 0xC6, 0x04, 0x38, 0x00, 0x5F, 0xC5, 0x00,
+	0x28, 0x8B, 0xC6, 0x0E, 0x00, 0x0A, 0x00, 0x01, 0x90, 0x53, 0x8B, 0x5D,
+	0x08, 0x56, 0x57, 0x8B, 0x7B, 0x10, 0x38, 0x02, 0x71, 0x0C, 0x3B, 0xF9,
+	0x73, 0x0B, 0x68, 0x74, 0x71, 0x00, 0xF9, 0x08, 0xEC, 0x70, 0x40, 0x00,
+	0x2B, 0xF9, 0x39, 0x7D, 0x10, 0x0F, 0x42, 0x7D, 0x10, 0x3B, 0xF3, 0x75,
+	0x4E, 0x8D, 0x04, 0x0F, 0x39, 0x46, 0x10, 0x20, 0x00, 0x01, 0x70, 0x00,
+	0xF0, 0x01, 0x46, 0x10, 0x72, 0x19, 0x8B, 0x16, 0x51, 0x6A, 0x00, 0x8B,
+	0xCE, 0xC6, 0x04, 0x10, 0x00, 0xE8, 0x0D, 0x04, 0x00, 0x6C, 0x00, 0x10,
+	0x5B, 0xC9, 0x02, 0x35, 0x51, 0x8B, 0xD6, 0x19, 0x00, 0x19, 0x6E, 0x19,
+	0x00, 0x52, 0x57, 0x8B, 0xCE, 0xE8, 0x2C, 0xCD, 0x00, 0x93, 0x46, 0x83,
+	0x7B, 0x14, 0x10, 0x72, 0x02, 0x8B, 0x1B, 0x3C, 0x01, 0x01, 0xD2, 0x00,
+	0xF4, 0x05, 0x85, 0xFF, 0x74, 0x10, 0x8B, 0x45, 0x0C, 0x57, 0x03, 0xC3,
+	0x50, 0x51, 0xE8, 0x0D, 0x1E, 0x00, 0x00, 0x83, 0xC4, 0x0C, 0xE0, 0x00,
+	0x16, 0x0F, 0xE0, 0x00, 0x01, 0x4D, 0x00, 0x06, 0xE1, 0x00, 0x01, 0x0F,
+	0x00, 0x0B, 0xE0, 0x01, 0x00, 0x10, 0x03, 0x3B, 0x8B, 0x7E, 0x10, 0xDC,
+	0x00, 0xB1, 0x8B, 0x55, 0x0C, 0x8B, 0xC7, 0x2B, 0xC1, 0x3B, 0xC2, 0x77,
+	0x23, 0x57, 0x00, 0x11, 0x4E, 0x37, 0x01, 0x31, 0x5F, 0xC6, 0x04, 0x93,
+	0x01, 0x20, 0x5D, 0xC2, 0x07, 0x00, 0x01, 0x0E, 0x00, 0x01, 0x0C, 0x00,
+	0x48, 0x85, 0xD2, 0x74, 0x45, 0xDA, 0x01, 0x60, 0x2B, 0xFA, 0x53, 0x8D,
+	0x1C, 0x08, 0x41, 0x00, 0xB1, 0x74, 0x0F, 0x50, 0x8D, 0x04, 0x13, 0x50,
+	0x53, 0xFF, 0x15, 0xE0, 0x3A, 0x02, 0x04, 0xA5, 0x00, 0x1A, 0x5B, 0x86,
+	0x01, 0x00, 0x4F, 0x00, 0x08, 0x0E, 0x00, 0x05, 0x80, 0x01, 0x00, 0x46,
+	0x05, 0x91, 0x39, 0x79, 0x10, 0x0F, 0x42, 0x79, 0x10, 0x83, 0x79, 0x07,
+	0x01, 0xF0, 0x53, 0x09, 0x8B, 0x5D, 0x14, 0x3B, 0xFB, 0x8B, 0xD3, 0x0F,
+	0x42, 0xD7, 0x85, 0xD2, 0x74, 0x5C, 0x56, 0x8B, 0x75, 0x10, 0x83, 0xEA,
+	0x04, 0x72, 0x13, 0x8B, 0xFF, 0x8B, 0x01, 0x3B, 0x06, 0x75, 0x10, 0x83,
+	0xC1, 0x04, 0x83, 0xC6, 0x04, 0x83, 0xEA, 0x04, 0x73, 0xEF, 0x83, 0xFA,
+	0xFC, 0x74, 0x34, 0x8A, 0x01, 0x3A, 0x06, 0x75, 0x27, 0x83, 0xFA, 0xFD,
+	0x74, 0x29, 0x8A, 0x41, 0x01, 0x3A, 0x46, 0x01, 0x75, 0x1A, 0x83, 0xFA,
+	0xFE, 0x74, 0x1C, 0x8A, 0x41, 0x02, 0x3A, 0x46, 0x02, 0x75, 0x0D, 0x83,
+	0xFA, 0xFF, 0x74, 0x0F, 0x8A, 0x41, 0x03, 0x3A, 0x46, 0x03, 0x74, 0x07,
+	0x1B, 0xC0, 0x83, 0xC8, 0x01, 0xC4, 0x04, 0xF1, 0x0B, 0x5E, 0x85, 0xC0,
+	0x75, 0x14, 0x3B, 0xFB, 0x73, 0x09, 0x5F, 0x83, 0xC8, 0xFF, 0x5B, 0x5D,
+	0xC2, 0x10, 0x00, 0x33, 0xC0, 0x3B, 0xFB, 0x0F, 0x95, 0xC0, 0x5F, 0x0D,
+	0x00, 0x03, 0xF0, 0x02, 0xF2, 0x13, 0x71, 0x04, 0x57, 0x8B, 0x79, 0x08,
+	0x8B, 0xD7, 0x2B, 0xD6, 0xB8, 0xE9, 0xA2, 0x8B, 0x2E, 0xF7, 0xEA, 0xC1,
+	0xFA, 0x04, 0x8B, 0xC2, 0xC1, 0xE8, 0x1F, 0x03, 0xC2, 0x83, 0xF8, 0x01,
+	0x73, 0x6B, 0x2B, 0x31, 0x18, 0x00, 0x10, 0xEE, 0x18, 0x00, 0xF0, 0x01,
+	0xF2, 0x53, 0xC1, 0xEE, 0x1F, 0xBB, 0x2E, 0xBA, 0xE8, 0x02, 0x03, 0xF2,
+	0x8B, 0xC3, 0x2B, 0xC6, 0x22, 0x00, 0x35, 0x0B, 0x68, 0x8C, 0xC0, 0x02,
+	0x22, 0x2B, 0x39, 0x2D, 0x00, 0x16, 0xEF, 0x45, 0x00, 0xF3, 0x11, 0x8B,
+	0xD0, 0xD1, 0xEA, 0x2B, 0xDA, 0x46, 0x3B, 0xD8, 0x5B, 0x73, 0x12, 0x33,
+	0xC0, 0x3B, 0xC6, 0x0F, 0x42, 0xC6, 0x50, 0xE8, 0x75, 0x04, 0x00, 0x00,
+	0x5F, 0x5E, 0xC2, 0x04, 0x00, 0x03, 0xC2, 0x12, 0x00, 0x14, 0x63, 0x12,
+	0x00, 0x0C, 0x90, 0x03, 0x07, 0xA0, 0x00, 0x40, 0xAB, 0xAA, 0xAA, 0x2A,
+	0xA0, 0x00, 0x1B, 0x02, 0xA0, 0x00, 0x01, 0x18, 0x00, 0x10, 0xEE, 0x18,
+	0x00, 0x02, 0xA0, 0x00, 0x4F, 0xAA, 0xAA, 0xAA, 0x0A, 0xA0, 0x00, 0x06,
+	0x01, 0x2D, 0x00, 0x16, 0xEF, 0x45, 0x00, 0x0F, 0xA0, 0x00, 0x02, 0x2C,
+	0xC5, 0x05, 0xA0, 0x00, 0x14, 0xB3, 0x12, 0x00, 0x0D, 0xC0, 0x04, 0xC0,
+	0x83, 0xE4, 0xF8, 0x6A, 0xFF, 0x68, 0x58, 0x60, 0x40, 0x00, 0x64, 0xA1,
+	0x32, 0x04, 0xF3, 0x03, 0x50, 0x83, 0xEC, 0x28, 0xA1, 0x18, 0xA0, 0x40,
+	0x00, 0x33, 0xC4, 0x89, 0x44, 0x24, 0x20, 0x53, 0x56, 0x57, 0x0E, 0x00,
+	0x71, 0x50, 0x8D, 0x44, 0x24, 0x38, 0x64, 0xA3, 0x0D, 0x06, 0xF4, 0x08,
+	0xF9, 0x83, 0x7F, 0x40, 0x00, 0x0F, 0x84, 0x44, 0x01, 0x00, 0x00, 0x80,
+	0x7F, 0x45, 0x00, 0x0F, 0x84, 0x3A, 0x01, 0x00, 0x00, 0x8B, 0x07, 0x04,
+	0x06, 0xF2, 0x09, 0x75, 0x07, 0x32, 0xC0, 0xE9, 0x29, 0x01, 0x00, 0x00,
+	0x83, 0xEC, 0x08, 0x8D, 0x4C, 0x24, 0x20, 0xE8, 0x64, 0xFB, 0xFF, 0xFF,
+	0xC7, 0x44, 0x24, 0x4A, 0x06, 0xF0, 0x0B, 0x5C, 0x24, 0x2C, 0x8D, 0x44,
+	0x24, 0x14, 0x50, 0x8B, 0x44, 0x24, 0x2C, 0x83, 0xFB, 0x10, 0x8D, 0x54,
+	0x24, 0x1C, 0x0F, 0x43, 0x54, 0x24, 0x1C, 0x8D, 0x4C, 0x09, 0x00, 0xF0,
+	0x02, 0x4C, 0x24, 0x1C, 0x03, 0xC2, 0x50, 0x51, 0x8B, 0x4F, 0x40, 0x8D,
+	0x47, 0x48, 0x50, 0xFF, 0x15, 0x58, 0xC7, 0x03, 0xF0, 0x05, 0xE8, 0x00,
+	0x74, 0x13, 0x48, 0x74, 0x14, 0x83, 0xE8, 0x02, 0x0F, 0x84, 0xB5, 0x00,
+	0x00, 0x00, 0x32, 0xDB, 0xE9, 0xB0, 0xDE, 0x04, 0x21, 0x47, 0x45, 0x4F,
+	0x00, 0x80, 0x8B, 0x4C, 0x24, 0x18, 0x8B, 0x74, 0x24, 0x14, 0x4E, 0x00,
+	0xC0, 0x44, 0x24, 0x18, 0x0F, 0x43, 0xC1, 0x2B, 0xF0, 0x74, 0x1E, 0xFF,
+	0x77, 0xB3, 0x00, 0xE2, 0x1C, 0x56, 0x83, 0xFB, 0x10, 0x0F, 0x43, 0xC1,
+	0x6A, 0x01, 0x50, 0xFF, 0x15, 0x50, 0x12, 0x07, 0x40, 0x3B, 0xF0, 0x75,
+	0xBD, 0xB8, 0x00, 0xE0, 0x74, 0x6C, 0x85, 0xF6, 0x0F, 0x85, 0x6B, 0xFF,
+	0xFF, 0xFF, 0x8B, 0x4C, 0x24, 0x28, 0xD3, 0x04, 0xB1, 0xC1, 0x83, 0xF8,
+	0x08, 0x76, 0x4B, 0x8D, 0x71, 0x08, 0x51, 0x56, 0xB9, 0x00, 0x20, 0x2B,
+	0x02, 0x01, 0x04, 0xF0, 0x02, 0x0F, 0x84, 0x47, 0xFF, 0xFF, 0xFF, 0x83,
+	0x7C, 0x24, 0x2C, 0x10, 0x8B, 0x44, 0x24, 0x28, 0x8D, 0x4C, 0x64, 0x00,
+	0x00, 0x05, 0x00, 0x01, 0x3F, 0x05, 0x21, 0x04, 0x01, 0x1A, 0x00, 0x02,
+	0x7A, 0x00, 0xF7, 0x01, 0x44, 0x24, 0x18, 0x89, 0x74, 0x24, 0x28, 0xC6,
+	0x04, 0x30, 0x00, 0xE9, 0x12, 0xFF, 0xFF, 0xFF, 0x1E, 0x05, 0x12, 0xB3,
+	0x28, 0x00, 0x65, 0x72, 0x0D, 0xFF, 0x74, 0x24, 0x18, 0xC8, 0x05, 0xD0,
+	0x8A, 0xC3, 0xEB, 0x02, 0xB0, 0x01, 0x8B, 0x4C, 0x24, 0x38, 0x64, 0x89,
+	0x0D, 0x20, 0x01, 0xF8, 0x04, 0x59, 0x5F, 0x5E, 0x5B, 0x8B, 0x4C, 0x24,
+	0x20, 0x33, 0xCC, 0xE8, 0x9D, 0x0F, 0x00, 0x00, 0x8B, 0xE5, 0x5D, 0xC3,
+	0x50, 0x02, 0xF0, 0x0D, 0x0C, 0x8D, 0x41, 0x44, 0x39, 0x06, 0x75, 0x14,
+	0x8B, 0x41, 0x38, 0x8B, 0x51, 0x3C, 0x89, 0x06, 0x8B, 0x41, 0x1C, 0x89,
+	0x10, 0x8B, 0x41, 0x2C, 0x2B, 0xD2, 0x89, 0x10, 0x63, 0x07, 0x0B, 0x80,
+	0x02, 0xF8, 0x23, 0xD1, 0x57, 0x8B, 0x7A, 0x0C, 0x8D, 0x72, 0x44, 0x8B,
+	0x07, 0x3B, 0xC6, 0x74, 0x10, 0x8B, 0x4A, 0x1C, 0x89, 0x42, 0x38, 0x8B,
+	0x42, 0x2C, 0x8B, 0x00, 0x03, 0x01, 0x89, 0x42, 0x3C, 0x89, 0x37, 0x8B,
+	0x42, 0x1C, 0x8B, 0xCA, 0x89, 0x30, 0x8B, 0x42, 0x2C, 0x2B, 0xCE, 0x83,
+	0xC1, 0x45, 0x5F, 0x89, 0x08, 0x45, 0x00, 0x61, 0x56, 0x8B, 0xF1, 0xFF,
+	0x15, 0x2C, 0xA0, 0x07, 0x70, 0x75, 0x08, 0x8B, 0x0E, 0xFF, 0x15, 0x48,
+	0x99, 0x04, 0xF2, 0x05, 0x0E, 0x5E, 0x8B, 0x01, 0x8B, 0x40, 0x04, 0x8B,
+	0x4C, 0x08, 0x38, 0x85, 0xC9, 0x74, 0x05, 0x8B, 0x01, 0xFF, 0x60, 0x08,
+	0x35, 0x00, 0x04, 0xB0, 0x05, 0xB5, 0x8B, 0xF1, 0x85, 0xDB, 0x74, 0x57,
+	0x8B, 0x4E, 0x14, 0x83, 0xF9, 0x92, 0x04, 0x42, 0x3B, 0xD8, 0x72, 0x45,
+	0x0F, 0x00, 0xE0, 0x16, 0xEB, 0x02, 0x8B, 0xD6, 0x8B, 0x46, 0x10, 0x03,
+	0xC2, 0x3B, 0xC3, 0x76, 0x31, 0x14, 0x00, 0xF0, 0x02, 0x16, 0x8B, 0x06,
+	0xFF, 0x75, 0x0C, 0x2B, 0xD8, 0x53, 0x56, 0x8B, 0xCE, 0xE8, 0x07, 0xFA,
+	0xFF, 0xFF, 0x28, 0x05, 0x73, 0x08, 0x00, 0xFF, 0x75, 0x0C, 0x8B, 0xC6,
+	0x16, 0x00, 0x24, 0xF1, 0xF9, 0x16, 0x00, 0x00, 0x91, 0x04, 0x48, 0x83,
+	0xFF, 0xFE, 0x76, 0x7A, 0x06, 0xD1, 0x8B, 0x46, 0x14, 0x3B, 0xC7, 0x73,
+	0x19, 0xFF, 0x76, 0x10, 0x8B, 0xCE, 0x57, 0xA0, 0x03, 0x41, 0x85, 0xFF,
+	0x74, 0x5F, 0x11, 0x05, 0xE3, 0x2A, 0x8B, 0x06, 0xEB, 0x28, 0x85, 0xFF,
+	0x75, 0xF2, 0x89, 0x7E, 0x10, 0x83, 0xF8, 0x45, 0x05, 0x10, 0x00, 0x44,
+	0x05, 0x01, 0x4E, 0x00, 0x00, 0xF0, 0x04, 0x31, 0xC6, 0x00, 0x00, 0x0C,
+	0x00, 0xCF, 0x8B, 0xC6, 0x85, 0xFF, 0x74, 0x0B, 0x57, 0x53, 0x50, 0xE8,
+	0x3D, 0x18, 0xD0, 0x05, 0x08, 0x08, 0x2B, 0x05, 0x01, 0x0F, 0x00, 0x0A,
+	0xD0, 0x05, 0x4B, 0x75, 0x08, 0x83, 0xFE, 0x9E, 0x00, 0xE0, 0x41, 0x14,
+	0x3B, 0xC6, 0x73, 0x16, 0xFF, 0x71, 0x10, 0x56, 0xE8, 0xD9, 0x03, 0x00,
+	0xC9, 0x04, 0x52, 0xC6, 0x1B, 0xC0, 0xF7, 0xD8, 0xBA, 0x05, 0x51, 0xF6,
+	0x75, 0x0D, 0x89, 0x71, 0x9B, 0x00, 0x5A, 0x02, 0x8B, 0x09, 0xC6, 0x01,
+	0x1E, 0x00, 0x0D, 0xB0, 0x03, 0x48, 0x6A, 0xFF, 0x68, 0x80, 0xAD, 0x03,
+	0x15, 0x08, 0xA2, 0x03, 0x52, 0xC5, 0x50, 0x8D, 0x45, 0xF4, 0xA1, 0x03,
+	0xF0, 0x04, 0x89, 0x65, 0xF0, 0x8B, 0xD9, 0x8B, 0x75, 0x08, 0x33, 0xFF,
+	0x89, 0x7D, 0xEC, 0x85, 0xF6, 0x74, 0x26, 0x81, 0xFE, 0xF6, 0x04, 0xF0,
+	0x04, 0x77, 0x18, 0x8B, 0xC6, 0x6B, 0xC0, 0x58, 0x50, 0xFF, 0x15, 0x60,
+	0x71, 0x40, 0x00, 0x8B, 0xF8, 0x83, 0xC4, 0x04, 0x20, 0x00, 0xC0, 0xFF,
+	0x75, 0x06, 0xFF, 0x15, 0xF0, 0x70, 0x40, 0x00, 0xC7, 0x45, 0xFC, 0x3E,
+	0x00, 0xF2, 0x07, 0xFF, 0x75, 0x08, 0x8B, 0x53, 0x04, 0x8B, 0x0B, 0x83,
+	0xEC, 0x08, 0x57, 0xE8, 0xA9, 0x0A, 0x00, 0x00, 0x8B, 0x4B, 0x04, 0x2B,
+	0x0B, 0x1B, 0x05, 0x37, 0xE9, 0x8B, 0x0B, 0x62, 0x05, 0x92, 0xC4, 0x10,
+	0x89, 0x45, 0x08, 0x85, 0xC9, 0x74, 0x1A, 0x33, 0x00, 0x82, 0x51, 0xE8,
+	0xBB, 0x09, 0x00, 0x00, 0xFF, 0x33, 0xDD, 0x02, 0xF8, 0x0C, 0x8B, 0x45,
+	0x08, 0x83, 0xC4, 0x0C, 0x6B, 0xF6, 0x58, 0x6B, 0xC0, 0x58, 0x03, 0xF7,
+	0x03, 0xC7, 0x89, 0x73, 0x08, 0x89, 0x43, 0x04, 0x89, 0x3B, 0x8B, 0x4D,
+	0xF4, 0xEB, 0x02, 0x10, 0xE5, 0xF4, 0x07, 0x35, 0xFF, 0x75, 0xEC, 0x12,
+	0x03, 0x95, 0x6A, 0x00, 0x6A, 0x00, 0xE8, 0x06, 0x16, 0x00, 0x00, 0x20,
+	0x07, 0xF0, 0x09, 0x46, 0x3C, 0x83, 0xE0, 0x06, 0x3C, 0x06, 0x0F, 0x84,
+	0x8A, 0x00, 0x00, 0x00, 0x53, 0x8B, 0x5D, 0x0C, 0x57, 0x83, 0xFB, 0xFF,
+	0x0F, 0x87, 0x81, 0x0E, 0x00, 0x07, 0xCC, 0x00, 0xC1, 0x85, 0xFF, 0x74,
+	0x71, 0x53, 0xFF, 0x75, 0x08, 0x57, 0xE8, 0x7E, 0x16, 0xBF, 0x01, 0xF0,
+	0x05, 0xF6, 0x46, 0x3C, 0x04, 0x8D, 0x0C, 0x1F, 0x89, 0x4E, 0x38, 0x75,
+	0x0F, 0x8B, 0x46, 0x0C, 0x89, 0x38, 0x8B, 0x46, 0x1C, 0x05, 0x00, 0xF0,
+	0x02, 0x2C, 0x89, 0x18, 0x8B, 0x46, 0x3C, 0xA8, 0x02, 0x75, 0x37, 0xA8,
+	0x10, 0x8B, 0x46, 0x10, 0x8B, 0xD7, 0x15, 0x00, 0xF4, 0x0A, 0x20, 0x0F,
+	0x45, 0xD1, 0x89, 0x10, 0x8B, 0x46, 0x30, 0x8B, 0xCF, 0x2B, 0xCA, 0x03,
+	0xCB, 0x89, 0x08, 0x8B, 0x46, 0x1C, 0x83, 0x38, 0x00, 0x75, 0x13, 0x3A,
+	0x00, 0x10, 0xC7, 0xB3, 0x00, 0x10, 0x00, 0x3E, 0x00, 0x71, 0x38, 0x83,
+	0x4E, 0x3C, 0x01, 0x5F, 0x5B, 0xA1, 0x01, 0x02, 0x3A, 0x01, 0x0A, 0x00,
+	0x02, 0x00, 0xA2, 0x02, 0x71, 0x3B, 0xF7, 0x74, 0x2D, 0x53, 0x8B, 0x1D,
+	0xD4, 0x00, 0x00, 0x87, 0x02, 0xF0, 0x03, 0x07, 0xFF, 0x36, 0xFF, 0xD3,
+	0x83, 0xC4, 0x04, 0xC7, 0x46, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x46,
+	0x10, 0x4E, 0x00, 0xCF, 0xC6, 0x06, 0x00, 0x83, 0xC6, 0x18, 0x3B, 0xF7,
+	0x75, 0xDB, 0x5B, 0x5F, 0xF0, 0x01, 0x03, 0x11, 0x53, 0x51, 0x00, 0xA0,
+	0x33, 0xFF, 0x8B, 0xD9, 0x85, 0xF6, 0x74, 0x24, 0x81, 0xFE, 0x1E, 0x06,
+	0x88, 0x77, 0x16, 0x8D, 0x04, 0x76, 0xC1, 0xE0, 0x03, 0xC9, 0x01, 0x06,
+	0xC6, 0x01, 0x09, 0xBF, 0x01, 0x24, 0xFA, 0x09, 0xBF, 0x01, 0x01, 0x3A,
+	0x06, 0x30, 0xE9, 0x8B, 0x03, 0x3C, 0x06, 0x60, 0xCA, 0xC1, 0xE9, 0x1F,
+	0x03, 0xCA, 0xBF, 0x01, 0xF5, 0x00, 0x4D, 0x08, 0x85, 0xC0, 0x74, 0x17,
+	0xFF, 0x73, 0x04, 0x50, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xBC, 0x01, 0xF0,
+	0x0D, 0x4D, 0x08, 0x83, 0xC4, 0x04, 0x8D, 0x04, 0x76, 0x89, 0x3B, 0x8D,
+	0x04, 0xC7, 0x89, 0x43, 0x08, 0x8D, 0x04, 0x49, 0x8D, 0x04, 0xC7, 0x5F,
+	0x5E, 0x89, 0x43, 0x04, 0x5B, 0xB1, 0x01, 0x08, 0x90, 0x02, 0x16, 0xA8,
+	0x90, 0x02, 0x0F, 0x8C, 0x02, 0x00, 0xF0, 0x07, 0x8B, 0xF1, 0x83, 0x7E,
+	0x50, 0x00, 0x0F, 0x85, 0xC4, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x6A, 0x21,
+	0xFF, 0x75, 0x08, 0xFF, 0x15, 0x34, 0x16, 0x03, 0x90, 0xF8, 0x83, 0xC4,
+	0x0C, 0x85, 0xFF, 0x0F, 0x84, 0xAA, 0x26, 0x00, 0xF1, 0x2B, 0xCE, 0xC6,
+	0x46, 0x4C, 0x01, 0xC6, 0x46, 0x45, 0x00, 0xFF, 0x15, 0x50, 0x70, 0x40,
+	0x00, 0x8D, 0x47, 0x04, 0x89, 0x46, 0x2C, 0x89, 0x46, 0x30, 0xA1, 0x08,
+	0xA7, 0x40, 0x00, 0x8D, 0x4F, 0x08, 0x89, 0x46, 0x48, 0x8D, 0x45, 0x08,
+	0x89, 0x4E, 0x0C, 0x89, 0x4E, 0x10, 0x50, 0x8B, 0xCE, 0x89, 0x7E, 0x1C,
+	0x89, 0x7E, 0x20, 0x89, 0x7E, 0x50, 0xC7, 0x46, 0x56, 0x06, 0x30, 0xFF,
+	0x15, 0x44, 0x53, 0x00, 0x13, 0xC8, 0xC3, 0x02, 0xC1, 0xE8, 0xC2, 0x04,
+	0x00, 0x00, 0x8B, 0xF8, 0x8B, 0xCF, 0xFF, 0x15, 0xE4, 0xBF, 0x04, 0x23,
+	0x74, 0x09, 0x29, 0x00, 0x20, 0xEB, 0x0B, 0x3D, 0x00, 0x12, 0x40, 0x66,
+	0x00, 0x30, 0xC7, 0x45, 0xFC, 0xF5, 0x00, 0x20, 0x8B, 0x4D, 0xC5, 0x02,
+	0x50, 0x11, 0x8B, 0x01, 0xFF, 0x50, 0x0F, 0x01, 0xB9, 0x08, 0x8B, 0x10,
+	0x6A, 0x01, 0x8B, 0xC8, 0xFF, 0x12, 0x8B, 0xC6, 0xAC, 0x02, 0x00, 0xAB,
+	0x02, 0x4F, 0x0C, 0x00, 0x33, 0xC0, 0x15, 0x00, 0x00, 0x09, 0xA0, 0x03,
+	0x18, 0x30, 0xA0, 0x03, 0x1F, 0x0C, 0xA0, 0x03, 0x05, 0xC0, 0xF1, 0x89,
+	0x75, 0xE8, 0x8B, 0x45, 0x08, 0x8B, 0xF8, 0x83, 0xCF, 0x0F, 0xCF, 0x04,
+	0x80, 0x04, 0x8B, 0xF8, 0xEB, 0x27, 0x8B, 0x5E, 0x14, 0xA9, 0x01, 0xF0,
+	0x0D, 0xAA, 0xF7, 0xE7, 0x8B, 0xCB, 0xD1, 0xE9, 0xD1, 0xEA, 0x3B, 0xCA,
+	0x76, 0x13, 0xB8, 0xFE, 0xFF, 0xFF, 0xFF, 0x2B, 0xC1, 0x8D, 0x3C, 0x19,
+	0x3B, 0xD8, 0x76, 0x05, 0xBF, 0x0E, 0x00, 0x53, 0x8D, 0x4F, 0x01, 0x33,
+	0xC0, 0xEB, 0x00, 0xD2, 0x89, 0x45, 0xEC, 0x85, 0xC9, 0x74, 0x45, 0x83,
+	0xF9, 0xFF, 0x77, 0x11, 0x51, 0x11, 0x02, 0x00, 0xD8, 0x03, 0x62, 0x45,
+	0xEC, 0x85, 0xC0, 0x75, 0x2F, 0x12, 0x02, 0xF2, 0x02, 0x8B, 0x45, 0x08,
+	0x89, 0x45, 0x08, 0x40, 0x89, 0x65, 0xF0, 0x50, 0xC6, 0x45, 0xFC, 0x02,
+	0xE8, 0xA5, 0x37, 0x00, 0xF1, 0x0A, 0xB8, 0x14, 0x4B, 0x40, 0x00, 0xC3,
+	0x8B, 0x45, 0xEC, 0x8B, 0x75, 0xE8, 0x8B, 0x7D, 0x08, 0x89, 0x45, 0xEC,
+	0x8B, 0x5D, 0x0C, 0x85, 0xDB, 0x74, 0x49, 0xB1, 0x02, 0x81, 0x32, 0x8B,
+	0x0E, 0xEB, 0x30, 0x8B, 0x75, 0xE8, 0x0D, 0x00, 0x37, 0x0B, 0xFF, 0x36,
+	0xA0, 0x03, 0x0A, 0xC4, 0x02, 0x10, 0x6A, 0xC6, 0x02, 0x30, 0xE8, 0x55,
+	0x12, 0xC5, 0x01, 0xA5, 0x85, 0xDB, 0x74, 0x0B, 0x53, 0x51, 0x50, 0xE8,
+	0xFD, 0x12, 0x40, 0x05, 0x09, 0x3C, 0x00, 0xF0, 0x01, 0x8B, 0x45, 0xEC,
 	0xC6, 0x06, 0x00, 0x89, 0x06, 0x89, 0x7E, 0x14, 0x89, 0x5E, 0x10, 0x83,
-	0xFF, 0x10, 0x72, 0x02, 0x8B, 0xF0, 0xC6, 0x04, 0x1E, 0x00, 0x8B, 0x4D,
-	0xF4, 0x64, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5F, 0x5E, 0x5B,
-	0x8B, 0xE5, 0x5D, 0xC2, 0x08, 0x00, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x8B,
-	0x45, 0x08, 0x33, 0xC9, 0x85, 0xC0, 0x74, 0x1B, 0x83, 0xF8, 0xFF, 0x77,
-	0x10, 0x50, 0xFF, 0x15, 0x60, 0x71, 0x40, 0x00, 0x8B, 0xC8, 0x83, 0xC4,
-	0x04, 0x85, 0xC9, 0x75, 0x06, 0xFF, 0x15, 0xF0, 0x70, 0x40, 0x00, 0x8B,
-	0xC1, 0x5D, 0xC2, 0x04, 0x00, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x6A,
-	0xFF, 0x68, 0x80, 0x5E, 0x40, 0x00, 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00,
-	0x50, 0x83, 0xEC, 0x1C, 0x53, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00,
-	0x33, 0xC5, 0x50, 0x8D, 0x45, 0xF4, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00,
-	0x8B, 0xC2, 0x89, 0x45, 0xE4, 0x8B, 0xD9, 0x80, 0x38, 0x00, 0x75, 0x04,
-	0x33, 0xC9, 0xEB, 0x11, 0x8B, 0xC8, 0x8D, 0x51, 0x01, 0x8D, 0x49, 0x00,
-	0x8A, 0x01, 0x41, 0x84, 0xC0, 0x75, 0xF9, 0x2B, 0xCA, 0x8B, 0x03, 0x89,
-	0x4D, 0xF0, 0x8B, 0x40, 0x04, 0x8B, 0x7C, 0x18, 0x24, 0x8B, 0x74, 0x18,
-	0x20, 0x85, 0xFF, 0x7C, 0x17, 0x7F, 0x0E, 0x85, 0xF6, 0x74, 0x11, 0x85,
-	0xFF, 0x7C, 0x0D, 0x7F, 0x04, 0x3B, 0xF1, 0x76, 0x07, 0x2B, 0xF1, 0x83,
-	0xDF, 0x00, 0xEB, 0x0E, 0x0F, 0x57, 0xC0, 0x66, 0x0F, 0x13, 0x45, 0xE8,
-	0x8B, 0x7D, 0xEC, 0x8B, 0x75, 0xE8, 0x8B, 0x4C, 0x18, 0x38, 0x89, 0x5D,
-	0xDC, 0x85, 0xC9, 0x74, 0x05, 0x8B, 0x01, 0xFF, 0x50, 0x04, 0xC7, 0x45,
-	0xFC, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x03, 0x8B, 0x40, 0x04, 0x83, 0x7C,
-	0x18, 0x0C, 0x00, 0x75, 0x0E, 0x8B, 0x4C, 0x18, 0x3C, 0x85, 0xC9, 0x74,
-	0x06, 0xFF, 0x15, 0xA0, 0x70, 0x40, 0x00, 0x8B, 0x03, 0x8B, 0x48, 0x04,
-	0x83, 0x7C, 0x19, 0x0C, 0x00, 0x0F, 0x94, 0xC0, 0x88, 0x45, 0xE0, 0xC7,
-	0x45, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x84, 0xC0, 0x75, 0x0A, 0xB9, 0x04,
-	0x00, 0x00, 0x00, 0xE9, 0xD4, 0x00, 0x00, 0x00, 0xC6, 0x45, 0xFC, 0x02,
-	0x8B, 0x44, 0x19, 0x14, 0x25, 0xC0, 0x01, 0x00, 0x00, 0x83, 0xF8, 0x40,
-	0x74, 0x3C, 0x85, 0xFF, 0x7C, 0x38, 0x7F, 0x04, 0x85, 0xF6, 0x74, 0x32,
-	0x8B, 0x03, 0x8B, 0x48, 0x04, 0x8A, 0x44, 0x19, 0x40, 0x8B, 0x4C, 0x19,
-	0x38, 0x88, 0x45, 0xEC, 0xFF, 0x75, 0xEC, 0xFF, 0x15, 0x78, 0x70, 0x40,
-	0x00, 0x83, 0xF8, 0xFF, 0x0F, 0x84, 0xE5, 0x00, 0x00, 0x00, 0x83, 0xC6,
-	0xFF, 0x83, 0xD7, 0xFF, 0x85, 0xFF, 0x7F, 0xD4, 0x7C, 0x04, 0x85, 0xF6,
-	0x75, 0xCE, 0x8B, 0x03, 0x6A, 0x00, 0xFF, 0x75, 0xF0, 0x8B, 0x40, 0x04,
-	0xFF, 0x75, 0xE4, 0x8B, 0x4C, 0x18, 0x38, 0xFF, 0x15, 0x3C, 0x70, 0x40,
+	0xFF, 0xF4, 0x04, 0x5E, 0xF0, 0xC6, 0x04, 0x1E, 0x00, 0x15, 0x04, 0x00,
+	0x0C, 0x03, 0xF4, 0x02, 0x55, 0x8B, 0xEC, 0x8B, 0x45, 0x08, 0x33, 0xC9,
+	0x85, 0xC0, 0x74, 0x1B, 0x83, 0xF8, 0xFF, 0x77, 0x10, 0xF2, 0x02, 0x10,
+	0xC8, 0xF2, 0x02, 0x14, 0xC9, 0xF2, 0x02, 0x23, 0x8B, 0xC1, 0x93, 0x02,
+	0x03, 0x20, 0x05, 0x17, 0x5E, 0x80, 0x01, 0x1F, 0x1C, 0x80, 0x01, 0x01,
+	0xF0, 0x17, 0x8B, 0xC2, 0x89, 0x45, 0xE4, 0x8B, 0xD9, 0x80, 0x38, 0x00,
+	0x75, 0x04, 0x33, 0xC9, 0xEB, 0x11, 0x8B, 0xC8, 0x8D, 0x51, 0x01, 0x8D,
+	0x49, 0x00, 0x8A, 0x01, 0x41, 0x84, 0xC0, 0x75, 0xF9, 0x2B, 0xCA, 0x8B,
+	0x03, 0x89, 0x4D, 0xF0, 0xE4, 0x06, 0xF1, 0x1D, 0x7C, 0x18, 0x24, 0x8B,
+	0x74, 0x18, 0x20, 0x85, 0xFF, 0x7C, 0x17, 0x7F, 0x0E, 0x85, 0xF6, 0x74,
+	0x11, 0x85, 0xFF, 0x7C, 0x0D, 0x7F, 0x04, 0x3B, 0xF1, 0x76, 0x07, 0x2B,
+	0xF1, 0x83, 0xDF, 0x00, 0xEB, 0x0E, 0x0F, 0x57, 0xC0, 0x66, 0x0F, 0x13,
+	0x45, 0xE8, 0x8B, 0x7D, 0x48, 0x01, 0x63, 0x4C, 0x18, 0x38, 0x89, 0x5D,
+	0xDC, 0x18, 0x07, 0x23, 0x50, 0x04, 0xA5, 0x01, 0xF0, 0x08, 0x8B, 0x03,
+	0x8B, 0x40, 0x04, 0x83, 0x7C, 0x18, 0x0C, 0x00, 0x75, 0x0E, 0x8B, 0x4C,
+	0x18, 0x3C, 0x85, 0xC9, 0x74, 0x06, 0xFF, 0x15, 0xA0, 0xBC, 0x00, 0xF0,
+	0x06, 0x03, 0x8B, 0x48, 0x04, 0x83, 0x7C, 0x19, 0x0C, 0x00, 0x0F, 0x94,
+	0xC0, 0x88, 0x45, 0xE0, 0xC7, 0x45, 0xFC, 0x01, 0x00, 0x00, 0x71, 0x07,
+	0x80, 0x0A, 0xB9, 0x04, 0x00, 0x00, 0x00, 0xE9, 0xD4, 0x27, 0x04, 0xF1,
+	0x0C, 0x45, 0xFC, 0x02, 0x8B, 0x44, 0x19, 0x14, 0x25, 0xC0, 0x01, 0x00,
+	0x00, 0x83, 0xF8, 0x40, 0x74, 0x3C, 0x85, 0xFF, 0x7C, 0x38, 0x7F, 0x04,
+	0x85, 0xF6, 0x74, 0x32, 0x41, 0x00, 0xB1, 0x8A, 0x44, 0x19, 0x40, 0x8B,
+	0x4C, 0x19, 0x38, 0x88, 0x45, 0xEC, 0x4B, 0x05, 0xF0, 0x14, 0x78, 0x70,
+	0x40, 0x00, 0x83, 0xF8, 0xFF, 0x0F, 0x84, 0xE5, 0x00, 0x00, 0x00, 0x83,
+	0xC6, 0xFF, 0x83, 0xD7, 0xFF, 0x85, 0xFF, 0x7F, 0xD4, 0x7C, 0x04, 0x85,
+	0xF6, 0x75, 0xCE, 0x8B, 0x03, 0x6A, 0x00, 0xFF, 0x75, 0xDF, 0x00, 0x30,
+	0xFF, 0x75, 0xE4, 0xB1, 0x00, 0xF0, 0x05, 0xFF, 0x15, 0x3C, 0x70, 0x40,
 	0x00, 0x3B, 0x45, 0xF0, 0x0F, 0x85, 0xB5, 0x00, 0x00, 0x00, 0x85, 0xD2,
-	0x0F, 0x85, 0xAD, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x7C, 0x3C, 0x7F, 0x0C,
-	0x85, 0xF6, 0x74, 0x36, 0xEB, 0x06, 0x8D, 0x9B, 0x00, 0x00, 0x00, 0x00,
-	0x8B, 0x03, 0x8B, 0x48, 0x04, 0x8A, 0x44, 0x19, 0x40, 0x8B, 0x4C, 0x19,
-	0x38, 0x88, 0x45, 0xE4, 0xFF, 0x75, 0xE4, 0xFF, 0x15, 0x78, 0x70, 0x40,
-	0x00, 0x83, 0xF8, 0xFF, 0x74, 0x7D, 0x83, 0xC6, 0xFF, 0x83, 0xD7, 0xFF,
-	0x85, 0xFF, 0x7F, 0xD8, 0x7C, 0x04, 0x85, 0xF6, 0x75, 0xD2, 0x33, 0xC9,
-	0x8B, 0x03, 0x8B, 0x40, 0x04, 0xC7, 0x45, 0xFC, 0x01, 0x00, 0x00, 0x00,
-	0xC7, 0x44, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x44, 0x18, 0x24,
-	0x00, 0x00, 0x00, 0x00, 0x8B, 0x03, 0x6A, 0x00, 0x51, 0x8B, 0x48, 0x04,
-	0x03, 0xCB, 0xFF, 0x15, 0xA8, 0x70, 0x40, 0x00, 0xC7, 0x45, 0xFC, 0xFF,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x2C, 0x70, 0x40, 0x00, 0x84, 0xC0, 0x75,
-	0x08, 0x8B, 0xCB, 0xFF, 0x15, 0x48, 0x70, 0x40, 0x00, 0x8B, 0x03, 0x8B,
-	0x40, 0x04, 0x8B, 0x4C, 0x18, 0x38, 0x85, 0xC9, 0x74, 0x05, 0x8B, 0x01,
-	0xFF, 0x50, 0x08, 0x8B, 0xC3, 0x8B, 0x4D, 0xF4, 0x64, 0x89, 0x0D, 0x00,
-	0x00, 0x00, 0x00, 0x59, 0x5F, 0x5E, 0x5B, 0x8B, 0xE5, 0x5D, 0xC3, 0xB9,
-	0x04, 0x00, 0x00, 0x00, 0xEB, 0x8E, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x6A,
-	0xFF, 0x68, 0xDD, 0x5E, 0x40, 0x00, 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00,
-	0x50, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00, 0x33, 0xC5, 0x50, 0x8D,
-	0x45, 0xF4, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x7D, 0x08, 0x89,
-	0x7D, 0x08, 0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x74,
-	0x77, 0x8B, 0x75, 0x0C, 0x6A, 0xFF, 0x6A, 0x00, 0xC7, 0x47, 0x14, 0x0F,
-	0x00, 0x00, 0x00, 0xC7, 0x47, 0x10, 0x00, 0x00, 0x00, 0x00, 0x56, 0x8B,
-	0xCF, 0xC6, 0x07, 0x00, 0xE8, 0x6B, 0xF1, 0xFF, 0xFF, 0xC6, 0x45, 0xFC,
-	0x01, 0xF2, 0x0F, 0x10, 0x46, 0x18, 0xF2, 0x0F, 0x11, 0x47, 0x18, 0xF2,
-	0x0F, 0x10, 0x46, 0x20, 0xF2, 0x0F, 0x11, 0x47, 0x20, 0xF2, 0x0F, 0x10,
-	0x46, 0x28, 0xF2, 0x0F, 0x11, 0x47, 0x28, 0xF2, 0x0F, 0x10, 0x46, 0x30,
-	0x8D, 0x4F, 0x38, 0x6A, 0xFF, 0xF2, 0x0F, 0x11, 0x47, 0x30, 0x6A, 0x00,
-	0x8D, 0x46, 0x38, 0xC7, 0x41, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x41,
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x50, 0xC6, 0x01, 0x00, 0xE8, 0x1E, 0xF1,
-	0xFF, 0xFF, 0xF2, 0x0F, 0x10, 0x46, 0x50, 0xF2, 0x0F, 0x11, 0x47, 0x50,
-	0x8B, 0x4D, 0xF4, 0x64, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5F,
-	0x5E, 0x8B, 0xE5, 0x5D, 0xC2, 0x08, 0x00, 0xCC, 0x55, 0x8B, 0xEC, 0x6A,
-	0xFF, 0x68, 0x39, 0x5F, 0x40, 0x00, 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00,
-	0x50, 0x83, 0xEC, 0x14, 0x53, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00,
-	0x33, 0xC5, 0x50, 0x8D, 0x45, 0xF4, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00,
-	0x8B, 0xD9, 0x6A, 0x00, 0x8D, 0x4D, 0xEC, 0xFF, 0x15, 0x24, 0x70, 0x40,
-	0x00, 0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xF8, 0xA6, 0x40,
-	0x00, 0x8B, 0x0D, 0x38, 0x70, 0x40, 0x00, 0x89, 0x45, 0xF0, 0xFF, 0x15,
-	0xE8, 0x70, 0x40, 0x00, 0x8B, 0xF8, 0x8B, 0x03, 0x3B, 0x78, 0x0C, 0x73,
-	0x0C, 0x8B, 0x48, 0x08, 0x8B, 0x34, 0xB9, 0x85, 0xF6, 0x75, 0x6E, 0xEB,
-	0x02, 0x33, 0xF6, 0x80, 0x78, 0x14, 0x00, 0x74, 0x11, 0xFF, 0x15, 0x30,
-	0x70, 0x40, 0x00, 0x3B, 0x78, 0x0C, 0x73, 0x0A, 0x8B, 0x40, 0x08, 0x8B,
-	0x34, 0xB8, 0x85, 0xF6, 0x75, 0x4F, 0x8B, 0x75, 0xF0, 0x85, 0xF6, 0x75,
-	0x48, 0x8D, 0x45, 0xF0, 0x53, 0x50, 0xFF, 0x15, 0x40, 0x70, 0x40, 0x00,
-	0x83, 0xC4, 0x08, 0x83, 0xF8, 0xFF, 0x75, 0x1C, 0x68, 0xA0, 0x74, 0x40,
-	0x00, 0x8D, 0x4D, 0xE0, 0xFF, 0x15, 0xEC, 0x71, 0x40, 0x00, 0x68, 0xA4,
-	0x7C, 0x40, 0x00, 0x8D, 0x45, 0xE0, 0x50, 0xE8, 0x4C, 0x0E, 0x00, 0x00,
-	0x8B, 0x75, 0xF0, 0x8B, 0xCE, 0x8B, 0x16, 0x89, 0x35, 0xF8, 0xA6, 0x40,
-	0x00, 0xFF, 0x52, 0x04, 0x56, 0xE8, 0x64, 0x04, 0x00, 0x00, 0x83, 0xC4,
-	0x04, 0x8D, 0x4D, 0xEC, 0xFF, 0x15, 0x7C, 0x70, 0x40, 0x00, 0x8B, 0xC6,
-	0x8B, 0x4D, 0xF4, 0x64, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5F,
-	0x5E, 0x5B, 0x8B, 0xE5, 0x5D, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x6A, 0xFF, 0x68, 0x10, 0x5F, 0x40, 0x00, 0x64, 0xA1,
-	0x00, 0x00, 0x00, 0x00, 0x50, 0x83, 0xEC, 0x20, 0x53, 0x56, 0x57, 0xA1,
-	0x18, 0xA0, 0x40, 0x00, 0x33, 0xC5, 0x50, 0x8D, 0x45, 0xF4, 0x64, 0xA3,
-	0x00, 0x00, 0x00, 0x00, 0x89, 0x65, 0xF0, 0x89, 0x55, 0xE8, 0x8B, 0xF9,
-	0x89, 0x7D, 0xE4, 0x8B, 0x07, 0x33, 0xF6, 0x8B, 0x40, 0x04, 0x32, 0xDB,
-	0x8B, 0x4C, 0x38, 0x38, 0x89, 0x75, 0xDC, 0x88, 0x5D, 0xEF, 0x89, 0x7D,
-	0xD4, 0x85, 0xC9, 0x74, 0x05, 0x8B, 0x01, 0xFF, 0x50, 0x04, 0x6A, 0x01,
-	0x8B, 0xCF, 0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x15, 0x60,
-	0x70, 0x40, 0x00, 0x88, 0x45, 0xD8, 0xC7, 0x45, 0xFC, 0x01, 0x00, 0x00,
-	0x00, 0x84, 0xC0, 0x0F, 0x84, 0xAC, 0x00, 0x00, 0x00, 0x8B, 0x45, 0xE8,
-	0xC6, 0x45, 0xFC, 0x02, 0x83, 0x78, 0x14, 0x10, 0xC7, 0x40, 0x10, 0x00,
-	0x00, 0x00, 0x00, 0x72, 0x02, 0x8B, 0x00, 0xC6, 0x00, 0x00, 0x0F, 0xB6,
-	0x45, 0x08, 0x89, 0x45, 0xE0, 0x8B, 0x07, 0x8B, 0x40, 0x04, 0x8B, 0x4C,
-	0x38, 0x38, 0xFF, 0x15, 0xDC, 0x70, 0x40, 0x00, 0x83, 0xF8, 0xFF, 0x75,
-	0x05, 0x83, 0xCE, 0x01, 0xEB, 0x68, 0x3B, 0x45, 0xE0, 0x75, 0x16, 0x8B,
-	0x07, 0xB3, 0x01, 0x8B, 0x40, 0x04, 0x88, 0x5D, 0xEF, 0x8B, 0x4C, 0x38,
-	0x38, 0xFF, 0x15, 0x08, 0x71, 0x40, 0x00, 0xEB, 0x4D, 0x8B, 0x4D, 0xE8,
-	0x83, 0x79, 0x10, 0xFE, 0x72, 0x05, 0x83, 0xCE, 0x02, 0xEB, 0x3F, 0x50,
-	0xE8, 0xB3, 0xEE, 0xFF, 0xFF, 0x8B, 0x07, 0xB3, 0x01, 0x8B, 0x40, 0x04,
-	0x88, 0x5D, 0xEF, 0x8B, 0x4C, 0x38, 0x38, 0xFF, 0x15, 0xD8, 0x70, 0x40,
-	0x00, 0xEB, 0xB1, 0x8B, 0x55, 0xE4, 0x6A, 0x01, 0x8B, 0x02, 0x6A, 0x04,
-	0x8B, 0x48, 0x04, 0x03, 0xCA, 0xFF, 0x15, 0xA8, 0x70, 0x40, 0x00, 0xB8,
-	0xBD, 0x50, 0x40, 0x00, 0xC3, 0x8B, 0x7D, 0xE4, 0x8B, 0x75, 0xDC, 0x8A,
-	0x5D, 0xEF, 0xC7, 0x45, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x84, 0xDB, 0x75,
-	0x03, 0x83, 0xCE, 0x02, 0x8B, 0x07, 0x6A, 0x00, 0x8B, 0x48, 0x04, 0x56,
-	0x03, 0xCF, 0xFF, 0x15, 0xA8, 0x70, 0x40, 0x00, 0xC7, 0x45, 0xFC, 0xFF,
-	0xFF, 0xFF, 0xFF, 0x8B, 0x4D, 0xD4, 0x8B, 0x01, 0x8B, 0x40, 0x04, 0x8B,
-	0x4C, 0x08, 0x38, 0x85, 0xC9, 0x74, 0x05, 0x8B, 0x01, 0xFF, 0x50, 0x08,
-	0x8B, 0xC7, 0x8B, 0x4D, 0xF4, 0x64, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00,
-	0x59, 0x5F, 0x5E, 0x5B, 0x8B, 0xE5, 0x5D, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x53, 0x8B, 0xDA, 0x3B,
-	0xCB, 0x74, 0x55, 0x56, 0x57, 0x8B, 0x3D, 0x48, 0x71, 0x40, 0x00, 0x8D,
-	0x71, 0x4C, 0x83, 0x3E, 0x10, 0x72, 0x08, 0xFF, 0x76, 0xEC, 0xFF, 0xD7,
-	0x83, 0xC4, 0x04, 0xC7, 0x06, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x46, 0xFC,
-	0x00, 0x00, 0x00, 0x00, 0xC6, 0x46, 0xEC, 0x00, 0x83, 0x7E, 0xC8, 0x10,
-	0x72, 0x08, 0xFF, 0x76, 0xB4, 0xFF, 0xD7, 0x83, 0xC4, 0x04, 0xC7, 0x46,
-	0xC8, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x46, 0xC4, 0x00, 0x00, 0x00, 0x00,
-	0xC6, 0x46, 0xB4, 0x00, 0x83, 0xC6, 0x58, 0x8D, 0x46, 0xB4, 0x3B, 0xC3,
-	0x75, 0xB8, 0x5F, 0x5E, 0x5B, 0xC3, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x56,
-	0x8B, 0x75, 0x08, 0x83, 0x7E, 0x4C, 0x10, 0x72, 0x0C, 0xFF, 0x76, 0x38,
-	0xFF, 0x15, 0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0xC7, 0x46, 0x4C,
-	0x0F, 0x00, 0x00, 0x00, 0xC7, 0x46, 0x48, 0x00, 0x00, 0x00, 0x00, 0xC6,
-	0x46, 0x38, 0x00, 0x83, 0x7E, 0x14, 0x10, 0x72, 0x0B, 0xFF, 0x36, 0xFF,
-	0x15, 0x48, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x04, 0xC7, 0x46, 0x14, 0x0F,
-	0x00, 0x00, 0x00, 0xC7, 0x46, 0x10, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x06,
-	0x00, 0x5E, 0x5D, 0xC2, 0x04, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x6A,
-	0xFF, 0x68, 0xAD, 0x5E, 0x40, 0x00, 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00,
-	0x50, 0x83, 0xEC, 0x0C, 0x53, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00,
-	0x33, 0xC5, 0x50, 0x8D, 0x45, 0xF4, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00,
-	0x89, 0x65, 0xF0, 0x8B, 0xDA, 0x8B, 0xF9, 0x8B, 0x75, 0x08, 0x89, 0x75,
-	0xEC, 0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x64, 0x24, 0x00,
-	0x3B, 0xFB, 0x0F, 0x84, 0xB1, 0x00, 0x00, 0x00, 0x89, 0x75, 0xE8, 0xC6,
-	0x45, 0xFC, 0x01, 0x85, 0xF6, 0x74, 0x74, 0x6A, 0xFF, 0x6A, 0x00, 0xC7,
-	0x46, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x46, 0x10, 0x00, 0x00, 0x00,
-	0x00, 0x57, 0x8B, 0xCE, 0xC6, 0x06, 0x00, 0xE8, 0x60, 0xED, 0xFF, 0xFF,
-	0xC6, 0x45, 0xFC, 0x02, 0xF2, 0x0F, 0x10, 0x47, 0x18, 0xF2, 0x0F, 0x11,
-	0x46, 0x18, 0xF2, 0x0F, 0x10, 0x47, 0x20, 0xF2, 0x0F, 0x11, 0x46, 0x20,
-	0xF2, 0x0F, 0x10, 0x47, 0x28, 0xF2, 0x0F, 0x11, 0x46, 0x28, 0xF2, 0x0F,
-	0x10, 0x47, 0x30, 0x8D, 0x4E, 0x38, 0x6A, 0xFF, 0xF2, 0x0F, 0x11, 0x46,
-	0x30, 0x6A, 0x00, 0x8D, 0x47, 0x38, 0xC7, 0x41, 0x14, 0x0F, 0x00, 0x00,
-	0x00, 0xC7, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x50, 0xC6, 0x01, 0x00,
-	0xE8, 0x13, 0xED, 0xFF, 0xFF, 0xF2, 0x0F, 0x10, 0x47, 0x50, 0xF2, 0x0F,
-	0x11, 0x46, 0x50, 0x83, 0xC6, 0x58, 0xC6, 0x45, 0xFC, 0x00, 0x89, 0x75,
-	0x08, 0x83, 0xC7, 0x58, 0xE9, 0x67, 0xFF, 0xFF, 0xFF, 0x8B, 0x75, 0xEC,
-	0x8B, 0x7D, 0x08, 0x3B, 0xF7, 0x74, 0x0D, 0x56, 0xE8, 0xB7, 0xFE, 0xFF,
-	0xFF, 0x83, 0xC6, 0x58, 0x3B, 0xF7, 0x75, 0xF3, 0x6A, 0x00, 0x6A, 0x00,
-	0xE8, 0xDB, 0x0A, 0x00, 0x00, 0x8B, 0xC6, 0x8B, 0x4D, 0xF4, 0x64, 0x89,
-	0x0D, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5F, 0x5E, 0x5B, 0x8B, 0xE5, 0x5D,
-	0xC3, 0xCC, 0xCC, 0xCC, 0x55, 0x8B, 0xEC, 0x53, 0x8B, 0xDA, 0x3B, 0xCB,
-	0x74, 0x75, 0x56, 0x57, 0x8B, 0x7D, 0x08, 0x8D, 0x71, 0x10, 0x85, 0xFF,
-	0x74, 0x55, 0xC7, 0x47, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x47, 0x10,
-	0x00, 0x00, 0x00, 0x00, 0xC6, 0x07, 0x00, 0x83, 0x7E, 0x04, 0x10, 0x73,
-	0x16, 0x8B, 0x06, 0x40, 0x74, 0x1D, 0x50, 0x8D, 0x46, 0xF0, 0x50, 0x57,
-	0xFF, 0x15, 0xE0, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x0C, 0xEB, 0x0C, 0x8B,
-	0x46, 0xF0, 0x89, 0x07, 0xC7, 0x46, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8B,
-	0x06, 0x89, 0x47, 0x10, 0x8B, 0x46, 0x04, 0x89, 0x47, 0x14, 0xC7, 0x46,
-	0x04, 0x0F, 0x00, 0x00, 0x00, 0xC7, 0x06, 0x00, 0x00, 0x00, 0x00, 0xC6,
-	0x46, 0xF0, 0x00, 0x83, 0xC6, 0x18, 0x83, 0xC7, 0x18, 0x8D, 0x4E, 0xF0,
+	0x0F, 0x85, 0xAD, 0x08, 0x00, 0xD3, 0xFF, 0x7C, 0x3C, 0x7F, 0x0C, 0x85,
+	0xF6, 0x74, 0x36, 0xEB, 0x06, 0x8D, 0x9B, 0xC7, 0x00, 0x08, 0x6C, 0x00,
+	0x45, 0xE4, 0xFF, 0x75, 0xE4, 0x6C, 0x00, 0x25, 0x74, 0x7D, 0x68, 0x00,
+	0x11, 0xD8, 0x68, 0x00, 0x31, 0xD2, 0x33, 0xC9, 0xF7, 0x00, 0x03, 0xD2,
+	0x00, 0x40, 0xC7, 0x44, 0x18, 0x20, 0x44, 0x00, 0x42, 0xC7, 0x44, 0x18,
+	0x24, 0x4C, 0x00, 0xB6, 0x6A, 0x00, 0x51, 0x8B, 0x48, 0x04, 0x03, 0xCB,
+	0xFF, 0x15, 0xA8, 0x8C, 0x03, 0x31, 0xFF, 0x15, 0x2C, 0xB1, 0x03, 0x72,
+	0x75, 0x08, 0x8B, 0xCB, 0xFF, 0x15, 0x48, 0x22, 0x01, 0x20, 0x40, 0x04,
+	0xA7, 0x00, 0x04, 0x55, 0x01, 0x3D, 0x08, 0x8B, 0xC3, 0x2F, 0x02, 0x11,
+	0xC3, 0x2D, 0x01, 0x2F, 0xEB, 0x8E, 0x30, 0x07, 0x01, 0x16, 0xDD, 0x10,
+	0x02, 0x0F, 0x0C, 0x02, 0x01, 0x53, 0x7D, 0x08, 0x89, 0x7D, 0x08, 0xA8,
+	0x01, 0xD2, 0x85, 0xFF, 0x74, 0x77, 0x8B, 0x75, 0x0C, 0x6A, 0xFF, 0x6A,
+	0x00, 0xC7, 0x47, 0xE5, 0x02, 0x11, 0x47, 0xE5, 0x02, 0xF0, 0x0A, 0x56,
+	0x8B, 0xCF, 0xC6, 0x07, 0x00, 0xE8, 0x6B, 0xF1, 0xFF, 0xFF, 0xC6, 0x45,
+	0xFC, 0x01, 0xF2, 0x0F, 0x10, 0x46, 0x18, 0xF2, 0x0F, 0x11, 0x47, 0x18,
+	0x0A, 0x00, 0x10, 0x20, 0x0A, 0x00, 0x10, 0x20, 0x0A, 0x00, 0x10, 0x28,
+	0x0A, 0x00, 0x10, 0x28, 0x0A, 0x00, 0x60, 0x30, 0x8D, 0x4F, 0x38, 0x6A,
+	0xFF, 0x0F, 0x00, 0x82, 0x30, 0x6A, 0x00, 0x8D, 0x46, 0x38, 0xC7, 0x41,
+	0x4F, 0x00, 0x11, 0x41, 0x4F, 0x00, 0x90, 0x50, 0xC6, 0x01, 0x00, 0xE8,
+	0x1E, 0xF1, 0xFF, 0xFF, 0x2B, 0x00, 0x10, 0x50, 0x26, 0x00, 0x1D, 0x50,
+	0x56, 0x04, 0x23, 0x08, 0x00, 0xC0, 0x00, 0x27, 0x39, 0x5F, 0xD0, 0x02,
+	0x1F, 0x14, 0xD0, 0x02, 0x02, 0x96, 0xD9, 0x6A, 0x00, 0x8D, 0x4D, 0xEC,
+	0xFF, 0x15, 0x24, 0xC6, 0x07, 0xF1, 0x02, 0xA1, 0xF8, 0xA6, 0x40, 0x00,
+	0x8B, 0x0D, 0x38, 0x70, 0x40, 0x00, 0x89, 0x45, 0xF0, 0xFF, 0x15, 0xE8,
+	0x73, 0x05, 0xF0, 0x0F, 0x8B, 0x03, 0x3B, 0x78, 0x0C, 0x73, 0x0C, 0x8B,
+	0x48, 0x08, 0x8B, 0x34, 0xB9, 0x85, 0xF6, 0x75, 0x6E, 0xEB, 0x02, 0x33,
+	0xF6, 0x80, 0x78, 0x14, 0x00, 0x74, 0x11, 0xFF, 0x15, 0x30, 0x06, 0x02,
+	0xF0, 0x0E, 0x78, 0x0C, 0x73, 0x0A, 0x8B, 0x40, 0x08, 0x8B, 0x34, 0xB8,
+	0x85, 0xF6, 0x75, 0x4F, 0x8B, 0x75, 0xF0, 0x85, 0xF6, 0x75, 0x48, 0x8D,
+	0x45, 0xF0, 0x53, 0x50, 0xFF, 0x15, 0x40, 0xEB, 0x01, 0xF0, 0x1D, 0xC4,
+	0x08, 0x83, 0xF8, 0xFF, 0x75, 0x1C, 0x68, 0xA0, 0x74, 0x40, 0x00, 0x8D,
+	0x4D, 0xE0, 0xFF, 0x15, 0xEC, 0x71, 0x40, 0x00, 0x68, 0xA4, 0x7C, 0x40,
+	0x00, 0x8D, 0x45, 0xE0, 0x50, 0xE8, 0x4C, 0x0E, 0x00, 0x00, 0x8B, 0x75,
+	0xF0, 0x8B, 0xCE, 0x8B, 0x16, 0x89, 0x35, 0x84, 0x00, 0x70, 0xFF, 0x52,
+	0x04, 0x56, 0xE8, 0x64, 0x04, 0x11, 0x04, 0x11, 0x04, 0xA5, 0x00, 0x10,
+	0x7C, 0x8A, 0x00, 0x0A, 0x5B, 0x05, 0x01, 0xC3, 0x01, 0x0A, 0xBC, 0x01,
+	0x06, 0xC0, 0x01, 0x18, 0x10, 0x00, 0x01, 0x1F, 0x20, 0x50, 0x05, 0x04,
+	0xF5, 0x0F, 0x89, 0x55, 0xE8, 0x8B, 0xF9, 0x89, 0x7D, 0xE4, 0x8B, 0x07,
+	0x33, 0xF6, 0x8B, 0x40, 0x04, 0x32, 0xDB, 0x8B, 0x4C, 0x38, 0x38, 0x89,
+	0x75, 0xDC, 0x88, 0x5D, 0xEF, 0x89, 0x7D, 0xD4, 0x90, 0x03, 0x43, 0x6A,
+	0x01, 0x8B, 0xCF, 0x21, 0x01, 0x95, 0xFF, 0x15, 0x60, 0x70, 0x40, 0x00,
+	0x88, 0x45, 0xD8, 0x73, 0x03, 0x30, 0x0F, 0x84, 0xAC, 0x4D, 0x01, 0x20,
+	0x45, 0xE8, 0x70, 0x03, 0x61, 0x83, 0x78, 0x14, 0x10, 0xC7, 0x40, 0xAE,
+	0x01, 0x90, 0x72, 0x02, 0x8B, 0x00, 0xC6, 0x00, 0x00, 0x0F, 0xB6, 0x48,
+	0x05, 0x31, 0xE0, 0x8B, 0x07, 0x90, 0x02, 0x52, 0x38, 0x38, 0xFF, 0x15,
+	0xDC, 0xFB, 0x02, 0xF2, 0x07, 0x75, 0x05, 0x83, 0xCE, 0x01, 0xEB, 0x68,
+	0x3B, 0x45, 0xE0, 0x75, 0x16, 0x8B, 0x07, 0xB3, 0x01, 0x8B, 0x40, 0x04,
+	0x88, 0x5D, 0xEF, 0x23, 0x00, 0xFC, 0x0B, 0x08, 0x71, 0x40, 0x00, 0xEB,
+	0x4D, 0x8B, 0x4D, 0xE8, 0x83, 0x79, 0x10, 0xFE, 0x72, 0x05, 0x83, 0xCE,
+	0x02, 0xEB, 0x3F, 0x50, 0xE8, 0xB3, 0xEE, 0xFF, 0xFF, 0x2A, 0x00, 0xF0,
+	0x00, 0xD8, 0x70, 0x40, 0x00, 0xEB, 0xB1, 0x8B, 0x55, 0xE4, 0x6A, 0x01,
+	0x8B, 0x02, 0x6A, 0x04, 0x1B, 0x03, 0x12, 0xCA, 0x1B, 0x03, 0x30, 0xB8,
+	0xBD, 0x50, 0xA9, 0x05, 0x84, 0x7D, 0xE4, 0x8B, 0x75, 0xDC, 0x8A, 0x5D,
+	0xEF, 0xB0, 0x00, 0xF9, 0x01, 0xDB, 0x75, 0x03, 0x83, 0xCE, 0x02, 0x8B,
+	0x07, 0x6A, 0x00, 0x8B, 0x48, 0x04, 0x56, 0x03, 0xCF, 0x48, 0x03, 0x40,
+	0x8B, 0x4D, 0xD4, 0x8B, 0x5F, 0x00, 0x37, 0x8B, 0x4C, 0x08, 0x39, 0x03,
+	0x1F, 0xC7, 0x76, 0x01, 0x0B, 0xB0, 0x53, 0x8B, 0xDA, 0x3B, 0xCB, 0x74,
+	0x55, 0x56, 0x57, 0x8B, 0x3D, 0xB1, 0x05, 0xF2, 0x03, 0x8D, 0x71, 0x4C,
+	0x83, 0x3E, 0x10, 0x72, 0x08, 0xFF, 0x76, 0xEC, 0xFF, 0xD7, 0x83, 0xC4,
+	0x04, 0xC7, 0x06, 0xF7, 0x05, 0x01, 0x3F, 0x01, 0x71, 0xC6, 0x46, 0xEC,
+	0x00, 0x83, 0x7E, 0xC8, 0x1F, 0x00, 0x12, 0xB4, 0x1F, 0x00, 0x22, 0x46,
+	0xC8, 0x20, 0x00, 0x00, 0xEB, 0x07, 0xF1, 0x04, 0x00, 0xC6, 0x46, 0xB4,
+	0x00, 0x83, 0xC6, 0x58, 0x8D, 0x46, 0xB4, 0x3B, 0xC3, 0x75, 0xB8, 0x5F,
+	0x5E, 0x5B, 0xC3, 0xD0, 0x01, 0xD5, 0x56, 0x8B, 0x75, 0x08, 0x83, 0x7E,
+	0x4C, 0x10, 0x72, 0x0C, 0xFF, 0x76, 0x38, 0x18, 0x06, 0x32, 0xC7, 0x46,
+	0x4C, 0x3B, 0x00, 0x12, 0x48, 0x3B, 0x00, 0x2D, 0x38, 0x00, 0x3B, 0x06,
+	0x0A, 0x75, 0x06, 0x43, 0xC6, 0x06, 0x00, 0x5E, 0xF5, 0x05, 0x0D, 0x30,
+	0x02, 0x18, 0xAD, 0x00, 0x06, 0x0F, 0x80, 0x07, 0x06, 0x93, 0xDA, 0x8B,
+	0xF9, 0x8B, 0x75, 0x08, 0x89, 0x75, 0xEC, 0x0F, 0x02, 0x90, 0x8D, 0x64,
+	0x24, 0x00, 0x3B, 0xFB, 0x0F, 0x84, 0xB1, 0x20, 0x00, 0x10, 0x75, 0x03,
+	0x02, 0x51, 0x01, 0x85, 0xF6, 0x74, 0x74, 0x0B, 0x04, 0x09, 0x7B, 0x00,
+	0x30, 0x57, 0x8B, 0xCE, 0xF1, 0x06, 0x21, 0x60, 0xED, 0x0B, 0x04, 0x40,
+	0x02, 0xF2, 0x0F, 0x10, 0x06, 0x04, 0x10, 0x11, 0x10, 0x04, 0x10, 0x10,
+	0x06, 0x04, 0x10, 0x11, 0x10, 0x04, 0x10, 0x10, 0x06, 0x04, 0x10, 0x11,
+	0x10, 0x04, 0x52, 0x10, 0x47, 0x30, 0x8D, 0x4E, 0x0B, 0x04, 0x10, 0x46,
+	0x0B, 0x04, 0x1F, 0x47, 0x0B, 0x04, 0x01, 0x21, 0x13, 0xED, 0x0B, 0x04,
+	0x10, 0x47, 0x0B, 0x04, 0xF0, 0x02, 0x46, 0x50, 0x83, 0xC6, 0x58, 0xC6,
+	0x45, 0xFC, 0x00, 0x89, 0x75, 0x08, 0x83, 0xC7, 0x58, 0xE9, 0x67, 0xCE,
+	0x01, 0xFF, 0x0F, 0x75, 0xEC, 0x8B, 0x7D, 0x08, 0x3B, 0xF7, 0x74, 0x0D,
+	0x56, 0xE8, 0xB7, 0xFE, 0xFF, 0xFF, 0x83, 0xC6, 0x58, 0x3B, 0xF7, 0x75,
+	0xF3, 0x6A, 0x00, 0x6A, 0x00, 0xE8, 0xDB, 0x0A, 0x00, 0x4F, 0x03, 0x05,
+	0x32, 0x55, 0x8B, 0xEC, 0xD3, 0x01, 0xDA, 0x75, 0x56, 0x57, 0x8B, 0x7D,
+	0x08, 0x8D, 0x71, 0x10, 0x85, 0xFF, 0x74, 0x55, 0xDA, 0x04, 0xF1, 0x08,
+	0xC6, 0x07, 0x00, 0x83, 0x7E, 0x04, 0x10, 0x73, 0x16, 0x8B, 0x06, 0x40,
+	0x74, 0x1D, 0x50, 0x8D, 0x46, 0xF0, 0x50, 0x57, 0xFF, 0x15, 0xE0, 0x75,
+	0x01, 0xB1, 0x0C, 0xEB, 0x0C, 0x8B, 0x46, 0xF0, 0x89, 0x07, 0xC7, 0x46,
+	0xF0, 0x67, 0x04, 0xD1, 0x06, 0x89, 0x47, 0x10, 0x8B, 0x46, 0x04, 0x89,
+	0x47, 0x14, 0xC7, 0x46, 0x04, 0x44, 0x00, 0x12, 0x06, 0xB0, 0x01, 0xF0,
+	0x21, 0xF0, 0x00, 0x83, 0xC6, 0x18, 0x83, 0xC7, 0x18, 0x8D, 0x4E, 0xF0,
 	0x3B, 0xCB, 0x75, 0x9A, 0x8B, 0xC7, 0x5F, 0x5E, 0x5B, 0x5D, 0xC3, 0x8B,
 	0x45, 0x08, 0x5B, 0x5D, 0xC3, 0x2B, 0x49, 0xFC, 0xE9, 0x43, 0xEA, 0xFF,
 	0xFF, 0x2B, 0x49, 0xFC, 0x83, 0xE9, 0x58, 0xFF, 0x25, 0x98, 0x70, 0x40,
-	0x00, 0x2B, 0x49, 0xFC, 0xE9, 0xBF, 0xEA, 0xFF, 0xFF, 0x2B, 0x49, 0xFC,
-	0x83, 0xE9, 0x50, 0xFF, 0x25, 0xA4, 0x70, 0x40, 0x00, 0x2B, 0x49, 0xFC,
-	0x83, 0xE9, 0x50, 0xFF, 0x25, 0x98, 0x70, 0x40, 0x00, 0x8B, 0x49, 0x04,
-	0x8B, 0x01, 0xFF, 0x50, 0x08, 0x85, 0xC0, 0x74, 0x08, 0x8B, 0x10, 0x6A,
-	0x01, 0x8B, 0xC8, 0xFF, 0x12, 0xC3, 0x56, 0xEB, 0x15, 0x8B, 0x06, 0x8B,
-	0xCE, 0xA3, 0xA0, 0xA3, 0x40, 0x00, 0xE8, 0xDA, 0xFF, 0xFF, 0xFF, 0x56,
-	0xE8, 0x99, 0x01, 0x00, 0x00, 0x59, 0x8B, 0x35, 0xA0, 0xA3, 0x40, 0x00,
-	0x85, 0xF6, 0x75, 0xE1, 0x5E, 0xC3, 0x55, 0x8B, 0xEC, 0x6A, 0x08, 0xE8,
-	0xD2, 0x01, 0x00, 0x00, 0x59, 0x85, 0xC0, 0x74, 0x10, 0x8B, 0x0D, 0xA0,
-	0xA3, 0x40, 0x00, 0x89, 0x08, 0x8B, 0x4D, 0x08, 0x89, 0x48, 0x04, 0xEB,
-	0x02, 0x33, 0xC0, 0xA3, 0xA0, 0xA3, 0x40, 0x00, 0x5D, 0xC3, 0x55, 0x8B,
-	0xEC, 0x5D, 0xE9, 0xAB, 0x01, 0x00, 0x00, 0xCC, 0xFF, 0x25, 0xAC, 0x70,
-	0x40, 0x00, 0xFF, 0x25, 0xB4, 0x70, 0x40, 0x00, 0xFF, 0x25, 0xB8, 0x70,
-	0x40, 0x00, 0xFF, 0x25, 0xBC, 0x70, 0x40, 0x00, 0xFF, 0x25, 0xC0, 0x70,
-	0x40, 0x00, 0xFF, 0x25, 0xC4, 0x70, 0x40, 0x00, 0xFF, 0x25, 0xC8, 0x70,
-	0x40, 0x00, 0xFF, 0x25, 0xCC, 0x70, 0x40, 0x00, 0xFF, 0x25, 0xD0, 0x70,
-	0x40, 0x00, 0xFF, 0x25, 0xD4, 0x70, 0x40, 0x00, 0x3B, 0x0D, 0x18, 0xA0,
-	0x40, 0x00, 0x75, 0x02, 0xF3, 0xC3, 0xE9, 0x15, 0x04, 0x00, 0x00, 0xCC,
-	0xFF, 0x25, 0xF0, 0x71, 0x40, 0x00, 0xFF, 0x25, 0xE8, 0x71, 0x40, 0x00,
-	0xFF, 0x25, 0xE4, 0x71, 0x40, 0x00, 0x83, 0x3D, 0x1C, 0xA7, 0x40, 0x00,
-	0x00, 0x74, 0x03, 0x33, 0xC0, 0xC3, 0x56, 0x6A, 0x04, 0x6A, 0x20, 0xFF,
-	0x15, 0x6C, 0x71, 0x40, 0x00, 0x59, 0x59, 0x8B, 0xF0, 0x56, 0xFF, 0x15,
-	0x00, 0x70, 0x40, 0x00, 0xA3, 0x1C, 0xA7, 0x40, 0x00, 0xA3, 0x18, 0xA7,
-	0x40, 0x00, 0x85, 0xF6, 0x75, 0x05, 0x6A, 0x18, 0x58, 0x5E, 0xC3, 0x83,
-	0x26, 0x00, 0x33, 0xC0, 0x5E, 0xC3, 0x6A, 0x14, 0x68, 0x08, 0x7C, 0x40,
-	0x00, 0xE8, 0xC6, 0x04, 0x00, 0x00, 0xFF, 0x35, 0x1C, 0xA7, 0x40, 0x00,
-	0x8B, 0x35, 0x1C, 0x70, 0x40, 0x00, 0xFF, 0xD6, 0x89, 0x45, 0xE4, 0x83,
-	0xF8, 0xFF, 0x75, 0x0C, 0xFF, 0x75, 0x08, 0xFF, 0x15, 0x74, 0x71, 0x40,
-	0x00, 0x59, 0xEB, 0x65, 0x6A, 0x08, 0xE8, 0x8B, 0x04, 0x00, 0x00, 0x59,
-	0x83, 0x65, 0xFC, 0x00, 0xFF, 0x35, 0x1C, 0xA7, 0x40, 0x00, 0xFF, 0xD6,
-	0x89, 0x45, 0xE4, 0xFF, 0x35, 0x18, 0xA7, 0x40, 0x00, 0xFF, 0xD6, 0x89,
-	0x45, 0xE0, 0x8D, 0x45, 0xE0, 0x50, 0x8D, 0x45, 0xE4, 0x50, 0xFF, 0x75,
-	0x08, 0x8B, 0x35, 0x00, 0x70, 0x40, 0x00, 0xFF, 0xD6, 0x50, 0xE8, 0x63,
-	0x04, 0x00, 0x00, 0x83, 0xC4, 0x0C, 0x8B, 0xF8, 0x89, 0x7D, 0xDC, 0xFF,
-	0x75, 0xE4, 0xFF, 0xD6, 0xA3, 0x1C, 0xA7, 0x40, 0x00, 0xFF, 0x75, 0xE0,
-	0xFF, 0xD6, 0xA3, 0x18, 0xA7, 0x40, 0x00, 0xC7, 0x45, 0xFC, 0xFE, 0xFF,
-	0xFF, 0xFF, 0xE8, 0x0B, 0x00, 0x00, 0x00, 0x8B, 0xC7, 0xE8, 0x7F, 0x04,
-	0x00, 0x00, 0xC3, 0x8B, 0x7D, 0xDC, 0x6A, 0x08, 0xE8, 0x23, 0x04, 0x00,
-	0x00, 0x59, 0xC3, 0x55, 0x8B, 0xEC, 0xFF, 0x75, 0x08, 0xE8, 0x50, 0xFF,
-	0xFF, 0xFF, 0xF7, 0xD8, 0x1B, 0xC0, 0xF7, 0xD8, 0x59, 0x48, 0x5D, 0xC3,
-	0xFF, 0x25, 0x44, 0x71, 0x40, 0x00, 0xFF, 0x25, 0x48, 0x71, 0x40, 0x00,
-	0x55, 0x8B, 0xEC, 0xF6, 0x45, 0x08, 0x02, 0x56, 0x8B, 0xF1, 0x74, 0x25,
-	0x57, 0x68, 0xCA, 0x5A, 0x40, 0x00, 0x8D, 0x7E, 0xFC, 0xFF, 0x37, 0x6A,
-	0x0C, 0x56, 0xE8, 0x69, 0x04, 0x00, 0x00, 0xF6, 0x45, 0x08, 0x01, 0x74,
-	0x07, 0x57, 0xE8, 0xCF, 0xFF, 0xFF, 0xFF, 0x59, 0x8B, 0xC7, 0x5F, 0xEB,
-	0x14, 0xE8, 0x20, 0x05, 0x00, 0x00, 0xF6, 0x45, 0x08, 0x01, 0x74, 0x07,
-	0x56, 0xE8, 0xB8, 0xFF, 0xFF, 0xFF, 0x59, 0x8B, 0xC6, 0x5E, 0x5D, 0xC2,
-	0x04, 0x00, 0xFF, 0x25, 0x60, 0x71, 0x40, 0x00, 0xB8, 0x4D, 0x5A, 0x00,
-	0x00, 0x66, 0x39, 0x05, 0x00, 0x00, 0x40, 0x00, 0x74, 0x04, 0x33, 0xC0,
-	0xEB, 0x34, 0x8B, 0x0D, 0x3C, 0x00, 0x40, 0x00, 0x81, 0xB9, 0x00, 0x00,
-	0x40, 0x00, 0x50, 0x45, 0x00, 0x00, 0x75, 0xEA, 0xB8, 0x0B, 0x01, 0x00,
-	0x00, 0x66, 0x39, 0x81, 0x18, 0x00, 0x40, 0x00, 0x75, 0xDC, 0x33, 0xC0,
-	0x83, 0xB9, 0x74, 0x00, 0x40, 0x00, 0x0E, 0x76, 0x09, 0x39, 0x81, 0xE8,
-	0x00, 0x40, 0x00, 0x0F, 0x95, 0xC0, 0x6A, 0x01, 0xA3, 0xC0, 0xA3, 0x40,
-	0x00, 0xFF, 0x15, 0x88, 0x71, 0x40, 0x00, 0x59, 0x6A, 0xFF, 0xFF, 0x15,
-	0x00, 0x70, 0x40, 0x00, 0x8B, 0x0D, 0xAC, 0x71, 0x40, 0x00, 0xA3, 0x18,
-	0xA7, 0x40, 0x00, 0xA3, 0x1C, 0xA7, 0x40, 0x00, 0xA1, 0xF4, 0xA6, 0x40,
-	0x00, 0x89, 0x01, 0x8B, 0x0D, 0xB0, 0x71, 0x40, 0x00, 0xA1, 0xE8, 0xA6,
-	0x40, 0x00, 0x89, 0x01, 0xE8, 0xC2, 0x06, 0x00, 0x00, 0xE8, 0xDE, 0x04,
-	0x00, 0x00, 0x83, 0x3D, 0x20, 0xA0, 0x40, 0x00, 0x00, 0x75, 0x0C, 0x68,
-	0x2C, 0x5B, 0x40, 0x00, 0xFF, 0x15, 0x9C, 0x71, 0x40, 0x00, 0x59, 0xE8,
-	0xE3, 0x06, 0x00, 0x00, 0x83, 0x3D, 0x24, 0xA0, 0x40, 0x00, 0xFF, 0x75,
-	0x09, 0x6A, 0xFF, 0xFF, 0x15, 0x98, 0x71, 0x40, 0x00, 0x59, 0x33, 0xC0,
+	0x00, 0x14, 0x00, 0x14, 0xBF, 0x14, 0x00, 0x42, 0x50, 0xFF, 0x25, 0xA4,
+	0x14, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x31, 0x8B, 0x49, 0x04,
+	0xB1, 0x02, 0xF0, 0x18, 0x85, 0xC0, 0x74, 0x08, 0x8B, 0x10, 0x6A, 0x01,
+	0x8B, 0xC8, 0xFF, 0x12, 0xC3, 0x56, 0xEB, 0x15, 0x8B, 0x06, 0x8B, 0xCE,
+	0xA3, 0xA0, 0xA3, 0x40, 0x00, 0xE8, 0xDA, 0xFF, 0xFF, 0xFF, 0x56, 0xE8,
+	0x99, 0x01, 0x00, 0x00, 0x59, 0x8B, 0x35, 0x12, 0x00, 0x60, 0x85, 0xF6,
+	0x75, 0xE1, 0x5E, 0xC3, 0x02, 0x02, 0x30, 0x08, 0xE8, 0xD2, 0x17, 0x00,
+	0x60, 0x85, 0xC0, 0x74, 0x10, 0x8B, 0x0D, 0x1B, 0x00, 0xC1, 0x89, 0x08,
+	0x8B, 0x4D, 0x08, 0x89, 0x48, 0x04, 0xEB, 0x02, 0x33, 0xC0, 0x3E, 0x00,
+	0x10, 0x5D, 0x28, 0x00, 0xF1, 0x01, 0x5D, 0xE9, 0xAB, 0x01, 0x00, 0x00,
+	0xCC, 0xFF, 0x25, 0xAC, 0x70, 0x40, 0x00, 0xFF, 0x25, 0xB4, 0x06, 0x00,
+	0x11, 0xB8, 0x06, 0x00, 0x11, 0xBC, 0x06, 0x00, 0x11, 0xC0, 0x06, 0x00,
+	0x11, 0xC4, 0x06, 0x00, 0x11, 0xC8, 0x06, 0x00, 0x11, 0xCC, 0x06, 0x00,
+	0x11, 0xD0, 0x06, 0x00, 0x10, 0xD4, 0x2D, 0x05, 0x10, 0x0D, 0x5A, 0x02,
+	0x71, 0x75, 0x02, 0xF3, 0xC3, 0xE9, 0x15, 0x04, 0x4C, 0x00, 0x20, 0xF0,
+	0x71, 0x1C, 0x00, 0x11, 0xE8, 0x06, 0x00, 0x10, 0xE4, 0x44, 0x01, 0xF0,
+	0x13, 0x3D, 0x1C, 0xA7, 0x40, 0x00, 0x00, 0x74, 0x03, 0x33, 0xC0, 0xC3,
+	0x56, 0x6A, 0x04, 0x6A, 0x20, 0xFF, 0x15, 0x6C, 0x71, 0x40, 0x00, 0x59,
+	0x59, 0x8B, 0xF0, 0x56, 0xFF, 0x15, 0x00, 0x70, 0x40, 0x00, 0xA3, 0x21,
+	0x00, 0x31, 0xA3, 0x18, 0xA7, 0xC2, 0x00, 0xF0, 0x0C, 0x05, 0x6A, 0x18,
+	0x58, 0x5E, 0xC3, 0x83, 0x26, 0x00, 0x33, 0xC0, 0x5E, 0xC3, 0x6A, 0x14,
+	0x68, 0x08, 0x7C, 0x40, 0x00, 0xE8, 0xC6, 0x04, 0x00, 0x00, 0xFF, 0x35,
+	0x27, 0x00, 0x30, 0x8B, 0x35, 0x1C, 0x7C, 0x00, 0x40, 0xD6, 0x89, 0x45,
+	0xE4, 0x77, 0x04, 0x70, 0x0C, 0xFF, 0x75, 0x08, 0xFF, 0x15, 0x74, 0x50,
+	0x00, 0xD3, 0xEB, 0x65, 0x6A, 0x08, 0xE8, 0x8B, 0x04, 0x00, 0x00, 0x59,
+	0x83, 0x65, 0xFC, 0x2E, 0x00, 0x01, 0x28, 0x00, 0x20, 0xFF, 0x35, 0x5B,
+	0x00, 0x00, 0x0B, 0x00, 0x10, 0xE0, 0x9F, 0x05, 0x90, 0x8D, 0x45, 0xE4,
+	0x50, 0xFF, 0x75, 0x08, 0x8B, 0x35, 0x7B, 0x00, 0x51, 0xFF, 0xD6, 0x50,
+	0xE8, 0x63, 0x99, 0x05, 0x60, 0x0C, 0x8B, 0xF8, 0x89, 0x7D, 0xDC, 0xCF,
+	0x07, 0x11, 0xD6, 0x90, 0x00, 0x51, 0xFF, 0x75, 0xE0, 0xFF, 0xD6, 0x95,
+	0x00, 0x90, 0xC7, 0x45, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xE8, 0x0B, 0x00,
+	0x02, 0x50, 0xC7, 0xE8, 0x7F, 0x04, 0x00, 0x8A, 0x04, 0x50, 0xDC, 0x6A,
+	0x08, 0xE8, 0x23, 0x6E, 0x00, 0x00, 0x49, 0x01, 0xF1, 0x06, 0xFF, 0x75,
+	0x08, 0xE8, 0x50, 0xFF, 0xFF, 0xFF, 0xF7, 0xD8, 0x1B, 0xC0, 0xF7, 0xD8,
+	0x59, 0x48, 0x5D, 0xC3, 0xFF, 0x25, 0x44, 0x02, 0x01, 0x00, 0xBB, 0x03,
+	0xF4, 0x25, 0x55, 0x8B, 0xEC, 0xF6, 0x45, 0x08, 0x02, 0x56, 0x8B, 0xF1,
+	0x74, 0x25, 0x57, 0x68, 0xCA, 0x5A, 0x40, 0x00, 0x8D, 0x7E, 0xFC, 0xFF,
+	0x37, 0x6A, 0x0C, 0x56, 0xE8, 0x69, 0x04, 0x00, 0x00, 0xF6, 0x45, 0x08,
+	0x01, 0x74, 0x07, 0x57, 0xE8, 0xCF, 0xFF, 0xFF, 0xFF, 0x59, 0x8B, 0xC7,
+	0x5F, 0xEB, 0x14, 0xE8, 0x20, 0x05, 0x17, 0x00, 0x31, 0x56, 0xE8, 0xB8,
+	0x17, 0x00, 0x11, 0xC6, 0xEC, 0x03, 0xF0, 0x11, 0xFF, 0x25, 0x60, 0x71,
+	0x40, 0x00, 0xB8, 0x4D, 0x5A, 0x00, 0x00, 0x66, 0x39, 0x05, 0x00, 0x00,
+	0x40, 0x00, 0x74, 0x04, 0x33, 0xC0, 0xEB, 0x34, 0x8B, 0x0D, 0x3C, 0x00,
+	0x40, 0x00, 0x81, 0xB9, 0x12, 0x00, 0x90, 0x50, 0x45, 0x00, 0x00, 0x75,
+	0xEA, 0xB8, 0x0B, 0x01, 0x24, 0x00, 0xF0, 0x16, 0x81, 0x18, 0x00, 0x40,
+	0x00, 0x75, 0xDC, 0x33, 0xC0, 0x83, 0xB9, 0x74, 0x00, 0x40, 0x00, 0x0E,
+	0x76, 0x09, 0x39, 0x81, 0xE8, 0x00, 0x40, 0x00, 0x0F, 0x95, 0xC0, 0x6A,
+	0x01, 0xA3, 0xC0, 0xA3, 0x40, 0x00, 0xFF, 0x15, 0x88, 0x3E, 0x01, 0x22,
+	0x6A, 0xFF, 0x8C, 0x01, 0x43, 0x8B, 0x0D, 0xAC, 0x71, 0x8D, 0x01, 0x01,
+	0x07, 0x01, 0xF1, 0x00, 0xA1, 0xF4, 0xA6, 0x40, 0x00, 0x89, 0x01, 0x8B,
+	0x0D, 0xB0, 0x71, 0x40, 0x00, 0xA1, 0xE8, 0x0D, 0x00, 0x70, 0xE8, 0xC2,
+	0x06, 0x00, 0x00, 0xE8, 0xDE, 0x37, 0x01, 0xB0, 0x3D, 0x20, 0xA0, 0x40,
+	0x00, 0x00, 0x75, 0x0C, 0x68, 0x2C, 0x5B, 0x4B, 0x00, 0x10, 0x9C, 0x4B,
+	0x00, 0x30, 0xE8, 0xE3, 0x06, 0x1A, 0x00, 0x20, 0x24, 0xA0, 0x45, 0x01,
+	0x10, 0x09, 0x59, 0x00, 0x10, 0x98, 0x17, 0x00, 0xF0, 0x07, 0x33, 0xC0,
 	0xC3, 0x68, 0x2B, 0x5D, 0x40, 0x00, 0xE8, 0xCC, 0xFE, 0xFF, 0xFF, 0xA1,
-	0xF0, 0xA6, 0x40, 0x00, 0xC7, 0x04, 0x24, 0xC4, 0xA3, 0x40, 0x00, 0xFF,
-	0x35, 0xEC, 0xA6, 0x40, 0x00, 0xA3, 0xC4, 0xA3, 0x40, 0x00, 0x68, 0xB8,
-	0xA3, 0x40, 0x00, 0x68, 0xB4, 0xA3, 0x40, 0x00, 0x68, 0xB0, 0xA3, 0x40,
-	0x00, 0xFF, 0x15, 0x84, 0x71, 0x40, 0x00, 0x83, 0xC4, 0x14, 0xA3, 0xBC,
-	0xA3, 0x40, 0x00, 0x85, 0xC0, 0x79, 0x08, 0x6A, 0x08, 0xE8, 0x60, 0x04,
-	0x00, 0x00, 0x59, 0xC3, 0x6A, 0x0C, 0x68, 0x28, 0x7C, 0x40, 0x00, 0xE8,
+	0xF0, 0xA6, 0x40, 0x00, 0xC7, 0x04, 0x24, 0xC4, 0x82, 0x00, 0x60, 0x35,
+	0xEC, 0xA6, 0x40, 0x00, 0xA3, 0x0B, 0x00, 0x20, 0x68, 0xB8, 0x05, 0x00,
+	0x10, 0xB4, 0x05, 0x00, 0x11, 0xB0, 0x9C, 0x00, 0x11, 0x84, 0x85, 0x03,
+	0x30, 0x14, 0xA3, 0xBC, 0xDF, 0x02, 0x71, 0xC0, 0x79, 0x08, 0x6A, 0x08,
+	0xE8, 0x60, 0x75, 0x01, 0x40, 0x6A, 0x0C, 0x68, 0x28, 0x1A, 0x02, 0xC0,
 	0xAC, 0x02, 0x00, 0x00, 0x33, 0xDB, 0x89, 0x5D, 0xFC, 0x64, 0xA1, 0x18,
-	0x00, 0x00, 0x00, 0x8B, 0x50, 0x04, 0x8B, 0xFB, 0xBE, 0x0C, 0xA7, 0x40,
-	0x00, 0x8B, 0xCA, 0x33, 0xC0, 0xF0, 0x0F, 0xB1, 0x0E, 0x85, 0xC0, 0x74,
-	0x0B, 0x3B, 0xC2, 0x75, 0xF0, 0x33, 0xF6, 0x46, 0x8B, 0xFE, 0xEB, 0x03,
-	0x33, 0xF6, 0x46, 0x39, 0x35, 0x10, 0xA7, 0x40, 0x00, 0x75, 0x0A, 0x6A,
-	0x1F, 0xE8, 0x14, 0x04, 0x00, 0x00, 0x59, 0xEB, 0x3A, 0x39, 0x1D, 0x10,
-	0xA7, 0x40, 0x00, 0x75, 0x2C, 0x89, 0x35, 0x10, 0xA7, 0x40, 0x00, 0x68,
-	0x3C, 0x72, 0x40, 0x00, 0x68, 0x2C, 0x72, 0x40, 0x00, 0xE8, 0x40, 0x06,
-	0x00, 0x00, 0x59, 0x59, 0x85, 0xC0, 0x74, 0x17, 0xC7, 0x45, 0xFC, 0xFE,
-	0xFF, 0xFF, 0xFF, 0xB8, 0xFF, 0x00, 0x00, 0x00, 0xE9, 0xDE, 0x00, 0x00,
-	0x00, 0x89, 0x35, 0xAC, 0xA3, 0x40, 0x00, 0x39, 0x35, 0x10, 0xA7, 0x40,
-	0x00, 0x75, 0x1B, 0x68, 0x28, 0x72, 0x40, 0x00, 0x68, 0x08, 0x72, 0x40,
-	0x00, 0xE8, 0x12, 0x06, 0x00, 0x00, 0x59, 0x59, 0xC7, 0x05, 0x10, 0xA7,
-	0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x75, 0x09, 0x33, 0xC0,
-	0xB9, 0x0C, 0xA7, 0x40, 0x00, 0x87, 0x01, 0x83, 0x3D, 0x14, 0xA7, 0x40,
-	0x00, 0x00, 0x74, 0x19, 0x68, 0x14, 0xA7, 0x40, 0x00, 0xE8, 0xEE, 0x03,
-	0x00, 0x00, 0x59, 0x85, 0xC0, 0x74, 0x0A, 0x53, 0x6A, 0x02, 0x53, 0xFF,
-	0x15, 0x14, 0xA7, 0x40, 0x00, 0x8B, 0x0D, 0xB8, 0xA3, 0x40, 0x00, 0xA1,
-	0xA8, 0x71, 0x40, 0x00, 0x89, 0x08, 0xFF, 0x35, 0xB8, 0xA3, 0x40, 0x00,
-	0xFF, 0x35, 0xB4, 0xA3, 0x40, 0x00, 0xFF, 0x35, 0xB0, 0xA3, 0x40, 0x00,
-	0xE8, 0x2B, 0xBE, 0xFF, 0xFF, 0x83, 0xC4, 0x0C, 0xA3, 0xA8, 0xA3, 0x40,
-	0x00, 0x83, 0x3D, 0xC0, 0xA3, 0x40, 0x00, 0x00, 0x75, 0x36, 0x50, 0xFF,
-	0x15, 0x8C, 0x71, 0x40, 0x00, 0x8B, 0x4D, 0xEC, 0x8B, 0x01, 0x8B, 0x00,
-	0x89, 0x45, 0xE4, 0x51, 0x50, 0xE8, 0x32, 0x03, 0x00, 0x00, 0x59, 0x59,
-	0xC3, 0x8B, 0x65, 0xE8, 0x8B, 0x45, 0xE4, 0xA3, 0xA8, 0xA3, 0x40, 0x00,
-	0x83, 0x3D, 0xC0, 0xA3, 0x40, 0x00, 0x00, 0x75, 0x07, 0x50, 0xFF, 0x15,
-	0x90, 0x71, 0x40, 0x00, 0x83, 0x3D, 0xAC, 0xA3, 0x40, 0x00, 0x00, 0x75,
-	0x0B, 0xFF, 0x15, 0x94, 0x71, 0x40, 0x00, 0xA1, 0xA8, 0xA3, 0x40, 0x00,
-	0xC7, 0x45, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xE8, 0x99, 0x01, 0x00, 0x00,
-	0xC3, 0xE8, 0x3F, 0x04, 0x00, 0x00, 0xE9, 0x91, 0xFE, 0xFF, 0xFF, 0x55,
-	0x8B, 0xEC, 0xFF, 0x15, 0x04, 0x70, 0x40, 0x00, 0x6A, 0x01, 0xA3, 0xE4,
-	0xA6, 0x40, 0x00, 0xE8, 0x32, 0x05, 0x00, 0x00, 0xFF, 0x75, 0x08, 0xE8,
-	0x30, 0x05, 0x00, 0x00, 0x83, 0x3D, 0xE4, 0xA6, 0x40, 0x00, 0x00, 0x59,
-	0x59, 0x75, 0x08, 0x6A, 0x01, 0xE8, 0x18, 0x05, 0x00, 0x00, 0x59, 0x68,
-	0x09, 0x04, 0x00, 0xC0, 0xE8, 0x19, 0x05, 0x00, 0x00, 0x59, 0x5D, 0xC3,
-	0x55, 0x8B, 0xEC, 0x81, 0xEC, 0x24, 0x03, 0x00, 0x00, 0x6A, 0x17, 0xE8,
+	0xA0, 0x01, 0x60, 0x50, 0x04, 0x8B, 0xFB, 0xBE, 0x0C, 0x29, 0x02, 0xF0,
+	0x16, 0xCA, 0x33, 0xC0, 0xF0, 0x0F, 0xB1, 0x0E, 0x85, 0xC0, 0x74, 0x0B,
+	0x3B, 0xC2, 0x75, 0xF0, 0x33, 0xF6, 0x46, 0x8B, 0xFE, 0xEB, 0x03, 0x33,
+	0xF6, 0x46, 0x39, 0x35, 0x10, 0xA7, 0x40, 0x00, 0x75, 0x0A, 0x6A, 0x1F,
+	0xE8, 0x14, 0x4C, 0x00, 0x41, 0xEB, 0x3A, 0x39, 0x1D, 0x12, 0x00, 0x21,
+	0x2C, 0x89, 0x1A, 0x00, 0xF0, 0x01, 0x68, 0x3C, 0x72, 0x40, 0x00, 0x68,
+	0x2C, 0x72, 0x40, 0x00, 0xE8, 0x40, 0x06, 0x00, 0x00, 0x59, 0x47, 0x03,
+	0x13, 0x17, 0x05, 0x02, 0x70, 0xB8, 0xFF, 0x00, 0x00, 0x00, 0xE9, 0xDE,
+	0x21, 0x05, 0x53, 0x35, 0xAC, 0xA3, 0x40, 0x00, 0x4C, 0x00, 0x30, 0x1B,
+	0x68, 0x28, 0x34, 0x00, 0x10, 0x08, 0x34, 0x00, 0x11, 0x12, 0x34, 0x00,
+	0x20, 0xC7, 0x05, 0x19, 0x00, 0xB0, 0x02, 0x00, 0x00, 0x00, 0x85, 0xFF,
+	0x75, 0x09, 0x33, 0xC0, 0xB9, 0x94, 0x00, 0x51, 0x87, 0x01, 0x83, 0x3D,
+	0x14, 0x0D, 0x03, 0x20, 0x19, 0x68, 0x08, 0x00, 0x32, 0xE8, 0xEE, 0x03,
+	0xA6, 0x03, 0x70, 0x0A, 0x53, 0x6A, 0x02, 0x53, 0xFF, 0x15, 0x14, 0x00,
+	0x20, 0x8B, 0x0D, 0x04, 0x01, 0x30, 0xA1, 0xA8, 0x71, 0xB5, 0x03, 0x20,
+	0xFF, 0x35, 0x0D, 0x00, 0x20, 0xFF, 0x35, 0x12, 0x01, 0x20, 0xFF, 0x35,
+	0x13, 0x01, 0xB0, 0xE8, 0x2B, 0xBE, 0xFF, 0xFF, 0x83, 0xC4, 0x0C, 0xA3,
+	0xA8, 0xA3, 0x5B, 0x03, 0x00, 0xC2, 0x01, 0xF0, 0x09, 0x00, 0x75, 0x36,
+	0x50, 0xFF, 0x15, 0x8C, 0x71, 0x40, 0x00, 0x8B, 0x4D, 0xEC, 0x8B, 0x01,
+	0x8B, 0x00, 0x89, 0x45, 0xE4, 0x51, 0x50, 0xE8, 0x32, 0x5C, 0x00, 0x89,
+	0x59, 0xC3, 0x8B, 0x65, 0xE8, 0x8B, 0x45, 0xE4, 0x2F, 0x00, 0x51, 0x07,
+	0x50, 0xFF, 0x15, 0x90, 0x9A, 0x03, 0x00, 0xC3, 0x00, 0x60, 0x00, 0x75,
+	0x0B, 0xFF, 0x15, 0x94, 0xDE, 0x01, 0x00, 0x24, 0x00, 0x04, 0xED, 0x02,
+	0x00, 0x57, 0x04, 0xB0, 0xC3, 0xE8, 0x3F, 0x04, 0x00, 0x00, 0xE9, 0x91,
+	0xFE, 0xFF, 0xFF, 0xE4, 0x02, 0xF0, 0x02, 0x15, 0x04, 0x70, 0x40, 0x00,
+	0x6A, 0x01, 0xA3, 0xE4, 0xA6, 0x40, 0x00, 0xE8, 0x32, 0x05, 0x00, 0x00,
+	0xF6, 0x02, 0x20, 0x30, 0x05, 0xEC, 0x01, 0x00, 0x13, 0x00, 0xF0, 0x05,
+	0x00, 0x59, 0x59, 0x75, 0x08, 0x6A, 0x01, 0xE8, 0x18, 0x05, 0x00, 0x00,
+	0x59, 0x68, 0x09, 0x04, 0x00, 0xC0, 0xE8, 0x19, 0x0B, 0x00, 0x01, 0x6A,
+	0x04, 0xF0, 0x0F, 0x81, 0xEC, 0x24, 0x03, 0x00, 0x00, 0x6A, 0x17, 0xE8,
 	0x2A, 0x05, 0x00, 0x00, 0x85, 0xC0, 0x74, 0x05, 0x6A, 0x02, 0x59, 0xCD,
-	0x29, 0xA3, 0xC8, 0xA4, 0x40, 0x00, 0x89, 0x0D, 0xC4, 0xA4, 0x40, 0x00,
-	0x89, 0x15, 0xC0, 0xA4, 0x40, 0x00, 0x89, 0x1D, 0xBC, 0xA4, 0x40, 0x00,
-	0x89, 0x35, 0xB8, 0xA4, 0x40, 0x00, 0x89, 0x3D, 0xB4, 0xA4, 0x40, 0x00,
-	0x66, 0x8C, 0x15, 0xE0, 0xA4, 0x40, 0x00, 0x66, 0x8C, 0x0D, 0xD4, 0xA4,
-	0x40, 0x00, 0x66, 0x8C, 0x1D, 0xB0, 0xA4, 0x40, 0x00, 0x66, 0x8C, 0x05,
-	0xAC, 0xA4, 0x40, 0x00, 0x66, 0x8C, 0x25, 0xA8, 0xA4, 0x40, 0x00, 0x66,
-	0x8C, 0x2D, 0xA4, 0xA4, 0x40, 0x00, 0x9C, 0x8F, 0x05, 0xD8, 0xA4, 0x40,
-	0x00, 0x8B, 0x45, 0x00, 0xA3, 0xCC, 0xA4, 0x40, 0x00, 0x8B, 0x45, 0x04,
-	0xA3, 0xD0, 0xA4, 0x40, 0x00, 0x8D, 0x45, 0x08, 0xA3, 0xDC, 0xA4, 0x40,
-	0x00, 0x8B, 0x85, 0xDC, 0xFC, 0xFF, 0xFF, 0xC7, 0x05, 0x18, 0xA4, 0x40,
-	0x00, 0x01, 0x00, 0x01, 0x00, 0xA1, 0xD0, 0xA4, 0x40, 0x00, 0xA3, 0xD4,
-	0xA3, 0x40, 0x00, 0xC7, 0x05, 0xC8, 0xA3, 0x40, 0x00, 0x09, 0x04, 0x00,
-	0xC0, 0xC7, 0x05, 0xCC, 0xA3, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC7,
-	0x05, 0xD8, 0xA3, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6A, 0x04, 0x58,
-	0x6B, 0xC0, 0x00, 0xC7, 0x80, 0xDC, 0xA3, 0x40, 0x00, 0x02, 0x00, 0x00,
-	0x00, 0x6A, 0x04, 0x58, 0x6B, 0xC0, 0x00, 0x8B, 0x0D, 0x18, 0xA0, 0x40,
-	0x00, 0x89, 0x4C, 0x05, 0xF8, 0x6A, 0x04, 0x58, 0xC1, 0xE0, 0x00, 0x8B,
-	0x0D, 0x1C, 0xA0, 0x40, 0x00, 0x89, 0x4C, 0x05, 0xF8, 0x68, 0x80, 0x72,
-	0x40, 0x00, 0xE8, 0xCC, 0xFE, 0xFF, 0xFF, 0xC9, 0xC3, 0xCC, 0xFF, 0x25,
-	0x64, 0x71, 0x40, 0x00, 0xFF, 0x25, 0x68, 0x71, 0x40, 0x00, 0xFF, 0x25,
-	0x70, 0x71, 0x40, 0x00, 0x68, 0xD9, 0x59, 0x40, 0x00, 0x64, 0xFF, 0x35,
-	0x00, 0x00, 0x00, 0x00, 0x8B, 0x44, 0x24, 0x10, 0x89, 0x6C, 0x24, 0x10,
-	0x8D, 0x6C, 0x24, 0x10, 0x2B, 0xE0, 0x53, 0x56, 0x57, 0xA1, 0x18, 0xA0,
-	0x40, 0x00, 0x31, 0x45, 0xFC, 0x33, 0xC5, 0x50, 0x89, 0x65, 0xE8, 0xFF,
-	0x75, 0xF8, 0x8B, 0x45, 0xFC, 0xC7, 0x45, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF,
-	0x89, 0x45, 0xF8, 0x8D, 0x45, 0xF0, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00,
-	0xC3, 0x8B, 0x4D, 0xF0, 0x64, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x59,
-	0x5F, 0x5F, 0x5E, 0x5B, 0x8B, 0xE5, 0x5D, 0x51, 0xC3, 0x55, 0x8B, 0xEC,
-	0xFF, 0x75, 0x14, 0xFF, 0x75, 0x10, 0xFF, 0x75, 0x0C, 0xFF, 0x75, 0x08,
-	0x68, 0x50, 0x54, 0x40, 0x00, 0x68, 0x18, 0xA0, 0x40, 0x00, 0xE8, 0x99,
-	0x03, 0x00, 0x00, 0x83, 0xC4, 0x18, 0x5D, 0xC3, 0x6A, 0x0C, 0x68, 0x48,
-	0x7C, 0x40, 0x00, 0xE8, 0x78, 0xFF, 0xFF, 0xFF, 0x83, 0x65, 0xE4, 0x00,
+	0x29, 0xA3, 0xC8, 0xA4, 0x40, 0x00, 0x89, 0x0D, 0xC4, 0x06, 0x00, 0x20,
+	0x15, 0xC0, 0x06, 0x00, 0x20, 0x1D, 0xBC, 0x06, 0x00, 0x20, 0x35, 0xB8,
+	0x06, 0x00, 0x91, 0x3D, 0xB4, 0xA4, 0x40, 0x00, 0x66, 0x8C, 0x15, 0xE0,
+	0x07, 0x00, 0x21, 0x0D, 0xD4, 0x07, 0x00, 0x21, 0x1D, 0xB0, 0x07, 0x00,
+	0x21, 0x05, 0xAC, 0x07, 0x00, 0x21, 0x25, 0xA8, 0x07, 0x00, 0xF1, 0x02,
+	0x2D, 0xA4, 0xA4, 0x40, 0x00, 0x9C, 0x8F, 0x05, 0xD8, 0xA4, 0x40, 0x00,
+	0x8B, 0x45, 0x00, 0xA3, 0xCC, 0x08, 0x00, 0xB0, 0x04, 0xA3, 0xD0, 0xA4,
+	0x40, 0x00, 0x8D, 0x45, 0x08, 0xA3, 0xDC, 0x10, 0x00, 0xF0, 0x01, 0x85,
+	0xDC, 0xFC, 0xFF, 0xFF, 0xC7, 0x05, 0x18, 0xA4, 0x40, 0x00, 0x01, 0x00,
+	0x01, 0x00, 0xA1, 0x1D, 0x00, 0x20, 0xA3, 0xD4, 0xF3, 0x00, 0x50, 0x05,
+	0xC8, 0xA3, 0x40, 0x00, 0xB1, 0x00, 0x40, 0xC7, 0x05, 0xCC, 0xA3, 0x1E,
+	0x00, 0x53, 0x00, 0x00, 0xC7, 0x05, 0xD8, 0x0A, 0x00, 0xA2, 0x6A, 0x04,
+	0x58, 0x6B, 0xC0, 0x00, 0xC7, 0x80, 0xDC, 0xA3, 0xCF, 0x01, 0x02, 0x10,
+	0x00, 0x11, 0x8B, 0xF7, 0x04, 0xD3, 0x89, 0x4C, 0x05, 0xF8, 0x6A, 0x04,
+	0x58, 0xC1, 0xE0, 0x00, 0x8B, 0x0D, 0x1C, 0x10, 0x00, 0x20, 0x68, 0x80,
+	0x05, 0x02, 0x00, 0xE4, 0x02, 0x61, 0xC9, 0xC3, 0xCC, 0xFF, 0x25, 0x64,
+	0x06, 0x04, 0x11, 0x68, 0x06, 0x00, 0xC1, 0x70, 0x71, 0x40, 0x00, 0x68,
+	0xD9, 0x59, 0x40, 0x00, 0x64, 0xFF, 0x35, 0x4D, 0x06, 0xD4, 0x44, 0x24,
+	0x10, 0x89, 0x6C, 0x24, 0x10, 0x8D, 0x6C, 0x24, 0x10, 0x2B, 0xE0, 0xA6,
+	0x07, 0xF3, 0x00, 0x31, 0x45, 0xFC, 0x33, 0xC5, 0x50, 0x89, 0x65, 0xE8,
+	0xFF, 0x75, 0xF8, 0x8B, 0x45, 0xFC, 0x91, 0x01, 0x62, 0x89, 0x45, 0xF8,
+	0x8D, 0x45, 0xF0, 0xBC, 0x07, 0x45, 0xC3, 0x8B, 0x4D, 0xF0, 0xEA, 0x06,
+	0x02, 0xEB, 0x06, 0x12, 0x51, 0x86, 0x04, 0x42, 0x14, 0xFF, 0x75, 0x10,
+	0x15, 0x05, 0x60, 0x68, 0x50, 0x54, 0x40, 0x00, 0x68, 0x50, 0x00, 0x30,
+	0xE8, 0x99, 0x03, 0xE0, 0x04, 0x20, 0x18, 0x5D, 0x34, 0x03, 0x10, 0x48,
+	0x34, 0x03, 0xF0, 0x09, 0x78, 0xFF, 0xFF, 0xFF, 0x83, 0x65, 0xE4, 0x00,
 	0x8B, 0x5D, 0x0C, 0x8B, 0xC3, 0x8B, 0x7D, 0x10, 0x0F, 0xAF, 0xC7, 0x8B,
-	0x75, 0x08, 0x03, 0xF0, 0x89, 0x75, 0x08, 0x83, 0x65, 0xFC, 0x00, 0x4F,
+	0x75, 0x08, 0x03, 0xF0, 0x6E, 0x07, 0xF4, 0x0C, 0x65, 0xFC, 0x00, 0x4F,
 	0x89, 0x7D, 0x10, 0x78, 0x0C, 0x2B, 0xF3, 0x89, 0x75, 0x08, 0x8B, 0xCE,
-	0xFF, 0x55, 0x14, 0xEB, 0xEE, 0x33, 0xC0, 0x40, 0x89, 0x45, 0xE4, 0xC7,
-	0x45, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xE8, 0x14, 0x00, 0x00, 0x00, 0xE8,
-	0x79, 0xFF, 0xFF, 0xFF, 0xC2, 0x10, 0x00, 0x8B, 0x7D, 0x10, 0x8B, 0x5D,
-	0x0C, 0x8B, 0x75, 0x08, 0x8B, 0x45, 0xE4, 0x85, 0xC0, 0x75, 0x0B, 0xFF,
-	0x75, 0x14, 0x57, 0x53, 0x56, 0xE8, 0x01, 0x00, 0x00, 0x00, 0xC3, 0x6A,
-	0x14, 0x68, 0x68, 0x7C, 0x40, 0x00, 0xE8, 0x09, 0xFF, 0xFF, 0xFF, 0x83,
-	0x65, 0xFC, 0x00, 0xFF, 0x4D, 0x10, 0x78, 0x3A, 0x8B, 0x4D, 0x08, 0x2B,
-	0x4D, 0x0C, 0x89, 0x4D, 0x08, 0xFF, 0x55, 0x14, 0xEB, 0xED, 0x8B, 0x45,
-	0xEC, 0x89, 0x45, 0xE4, 0x8B, 0x45, 0xE4, 0x8B, 0x00, 0x89, 0x45, 0xE0,
-	0x8B, 0x45, 0xE0, 0x81, 0x38, 0x63, 0x73, 0x6D, 0xE0, 0x74, 0x0B, 0xC7,
-	0x45, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x45, 0xDC, 0xC3, 0xE8, 0xDF,
-	0x02, 0x00, 0x00, 0x8B, 0x65, 0xE8, 0xC7, 0x45, 0xFC, 0xFE, 0xFF, 0xFF,
-	0xFF, 0xE8, 0xFF, 0xFE, 0xFF, 0xFF, 0xC2, 0x10, 0x00, 0xCC, 0xFF, 0x25,
-	0x78, 0x71, 0x40, 0x00, 0x55, 0x8B, 0xEC, 0x8B, 0x45, 0x08, 0x8B, 0x00,
-	0x81, 0x38, 0x63, 0x73, 0x6D, 0xE0, 0x75, 0x25, 0x83, 0x78, 0x10, 0x03,
-	0x75, 0x1F, 0x8B, 0x40, 0x14, 0x3D, 0x20, 0x05, 0x93, 0x19, 0x74, 0x1B,
-	0x3D, 0x21, 0x05, 0x93, 0x19, 0x74, 0x14, 0x3D, 0x22, 0x05, 0x93, 0x19,
-	0x74, 0x0D, 0x3D, 0x00, 0x40, 0x99, 0x01, 0x74, 0x06, 0x33, 0xC0, 0x5D,
-	0xC2, 0x04, 0x00, 0xE8, 0x86, 0x02, 0x00, 0x00, 0xCC, 0x68, 0xD0, 0x5A,
-	0x40, 0x00, 0xE8, 0x81, 0x02, 0x00, 0x00, 0x59, 0x33, 0xC0, 0xC3, 0xCC,
-	0xFF, 0x25, 0x7C, 0x71, 0x40, 0x00, 0xFF, 0x25, 0x80, 0x71, 0x40, 0x00,
-	0x33, 0xC0, 0xC3, 0xCC, 0x55, 0x8B, 0xEC, 0x8B, 0x45, 0x08, 0x53, 0x8B,
-	0x48, 0x3C, 0x03, 0xC8, 0x56, 0x0F, 0xB7, 0x41, 0x14, 0x0F, 0xB7, 0x59,
-	0x06, 0x83, 0xC0, 0x18, 0x33, 0xD2, 0x03, 0xC1, 0x57, 0x85, 0xDB, 0x74,
-	0x1B, 0x8B, 0x7D, 0x0C, 0x8B, 0x70, 0x0C, 0x3B, 0xFE, 0x72, 0x09, 0x8B,
-	0x48, 0x08, 0x03, 0xCE, 0x3B, 0xF9, 0x72, 0x0A, 0x42, 0x83, 0xC0, 0x28,
-	0x3B, 0xD3, 0x72, 0xE8, 0x33, 0xC0, 0x5F, 0x5E, 0x5B, 0x5D, 0xC3, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x6A, 0xFE, 0x68, 0x88, 0x7C, 0x40, 0x00, 0x68, 0xD9,
-	0x59, 0x40, 0x00, 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x50, 0x83, 0xEC,
-	0x08, 0x53, 0x56, 0x57, 0xA1, 0x18, 0xA0, 0x40, 0x00, 0x31, 0x45, 0xF8,
-	0x33, 0xC5, 0x50, 0x8D, 0x45, 0xF0, 0x64, 0xA3, 0x00, 0x00, 0x00, 0x00,
-	0x89, 0x65, 0xE8, 0xC7, 0x45, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
-	0x00, 0x40, 0x00, 0xE8, 0x7C, 0x00, 0x00, 0x00, 0x83, 0xC4, 0x04, 0x85,
-	0xC0, 0x74, 0x54, 0x8B, 0x45, 0x08, 0x2D, 0x00, 0x00, 0x40, 0x00, 0x50,
-	0x68, 0x00, 0x00, 0x40, 0x00, 0xE8, 0x52, 0xFF, 0xFF, 0xFF, 0x83, 0xC4,
-	0x08, 0x85, 0xC0, 0x74, 0x3A, 0x8B, 0x40, 0x24, 0xC1, 0xE8, 0x1F, 0xF7,
-	0xD0, 0x83, 0xE0, 0x01, 0xC7, 0x45, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0x8B,
-	0x4D, 0xF0, 0x64, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5F, 0x5E,
-	0x5B, 0x8B, 0xE5, 0x5D, 0xC3, 0x8B, 0x45, 0xEC, 0x8B, 0x00, 0x33, 0xC9,
-	0x81, 0x38, 0x05, 0x00, 0x00, 0xC0, 0x0F, 0x94, 0xC1, 0x8B, 0xC1, 0xC3,
-	0x8B, 0x65, 0xE8, 0xC7, 0x45, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0x33, 0xC0,
-	0x8B, 0x4D, 0xF0, 0x64, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5F,
-	0x5E, 0x5B, 0x8B, 0xE5, 0x5D, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x55, 0x8B, 0xEC, 0x8B, 0x45, 0x08, 0xB9, 0x4D, 0x5A, 0x00, 0x00, 0x66,
-	0x39, 0x08, 0x74, 0x04, 0x33, 0xC0, 0x5D, 0xC3, 0x8B, 0x48, 0x3C, 0x03,
-	0xC8, 0x33, 0xC0, 0x81, 0x39, 0x50, 0x45, 0x00, 0x00, 0x75, 0x0C, 0xBA,
-	0x0B, 0x01, 0x00, 0x00, 0x66, 0x39, 0x51, 0x18, 0x0F, 0x94, 0xC0, 0x5D,
-	0xC3, 0x55, 0x8B, 0xEC, 0x83, 0xEC, 0x14, 0xA1, 0x18, 0xA0, 0x40, 0x00,
-	0x83, 0x65, 0xF4, 0x00, 0x83, 0x65, 0xF8, 0x00, 0x56, 0x57, 0xBF, 0x4E,
-	0xE6, 0x40, 0xBB, 0xBE, 0x00, 0x00, 0xFF, 0xFF, 0x3B, 0xC7, 0x74, 0x0D,
-	0x85, 0xC6, 0x74, 0x09, 0xF7, 0xD0, 0xA3, 0x1C, 0xA0, 0x40, 0x00, 0xEB,
-	0x66, 0x8D, 0x45, 0xF4, 0x50, 0xFF, 0x15, 0x14, 0x70, 0x40, 0x00, 0x8B,
-	0x45, 0xF8, 0x33, 0x45, 0xF4, 0x89, 0x45, 0xFC, 0xFF, 0x15, 0x10, 0x70,
-	0x40, 0x00, 0x31, 0x45, 0xFC, 0xFF, 0x15, 0x18, 0x70, 0x40, 0x00, 0x31,
-	0x45, 0xFC, 0x8D, 0x45, 0xEC, 0x50, 0xFF, 0x15, 0x0C, 0x70, 0x40, 0x00,
-	0x8B, 0x4D, 0xF0, 0x33, 0x4D, 0xEC, 0x8D, 0x45, 0xFC, 0x33, 0x4D, 0xFC,
+	0xFF, 0x55, 0x14, 0xEB, 0xEE, 0x33, 0xC0, 0x40, 0x89, 0x45, 0xE4, 0x1B,
+	0x02, 0xF0, 0x00, 0x14, 0x00, 0x00, 0x00, 0xE8, 0x79, 0xFF, 0xFF, 0xFF,
+	0xC2, 0x10, 0x00, 0x8B, 0x7D, 0x10, 0x46, 0x00, 0xF0, 0x01, 0x75, 0x08,
+	0x8B, 0x45, 0xE4, 0x85, 0xC0, 0x75, 0x0B, 0xFF, 0x75, 0x14, 0x57, 0x53,
+	0x56, 0xE8, 0x39, 0x01, 0x00, 0xBD, 0x05, 0x10, 0x68, 0x6F, 0x00, 0x11,
+	0x09, 0x6F, 0x00, 0xF0, 0x01, 0xFC, 0x00, 0xFF, 0x4D, 0x10, 0x78, 0x3A,
+	0x8B, 0x4D, 0x08, 0x2B, 0x4D, 0x0C, 0x89, 0x4D, 0x08, 0x59, 0x00, 0xA0,
+	0xED, 0x8B, 0x45, 0xEC, 0x89, 0x45, 0xE4, 0x8B, 0x45, 0xE4, 0xB5, 0x02,
+	0xF1, 0x00, 0xE0, 0x8B, 0x45, 0xE0, 0x81, 0x38, 0x63, 0x73, 0x6D, 0xE0,
+	0x74, 0x0B, 0xC7, 0x45, 0xDC, 0x22, 0x01, 0xB4, 0x45, 0xDC, 0xC3, 0xE8,
+	0xDF, 0x02, 0x00, 0x00, 0x8B, 0x65, 0xE8, 0x7F, 0x00, 0x21, 0xFF, 0xFE,
+	0x7A, 0x00, 0x42, 0xCC, 0xFF, 0x25, 0x78, 0x5C, 0x05, 0x52, 0x8B, 0x45,
+	0x08, 0x8B, 0x00, 0x39, 0x00, 0xF0, 0x05, 0x75, 0x25, 0x83, 0x78, 0x10,
+	0x03, 0x75, 0x1F, 0x8B, 0x40, 0x14, 0x3D, 0x20, 0x05, 0x93, 0x19, 0x74,
+	0x1B, 0x3D, 0x21, 0x07, 0x00, 0x30, 0x14, 0x3D, 0x22, 0x07, 0x00, 0xA0,
+	0x0D, 0x3D, 0x00, 0x40, 0x99, 0x01, 0x74, 0x06, 0x33, 0xC0, 0x4D, 0x05,
+	0xF1, 0x00, 0xE8, 0x86, 0x02, 0x00, 0x00, 0xCC, 0x68, 0xD0, 0x5A, 0x40,
+	0x00, 0xE8, 0x81, 0x02, 0x00, 0xA2, 0x04, 0x41, 0xCC, 0xFF, 0x25, 0x7C,
+	0xAC, 0x01, 0x40, 0x80, 0x71, 0x40, 0x00, 0x10, 0x00, 0x02, 0x60, 0x00,
+	0xF8, 0x2F, 0x53, 0x8B, 0x48, 0x3C, 0x03, 0xC8, 0x56, 0x0F, 0xB7, 0x41,
+	0x14, 0x0F, 0xB7, 0x59, 0x06, 0x83, 0xC0, 0x18, 0x33, 0xD2, 0x03, 0xC1,
+	0x57, 0x85, 0xDB, 0x74, 0x1B, 0x8B, 0x7D, 0x0C, 0x8B, 0x70, 0x0C, 0x3B,
+	0xFE, 0x72, 0x09, 0x8B, 0x48, 0x08, 0x03, 0xCE, 0x3B, 0xF9, 0x72, 0x0A,
+	0x42, 0x83, 0xC0, 0x28, 0x3B, 0xD3, 0x72, 0xE8, 0x33, 0xC0, 0x5F, 0x5E,
+	0x5B, 0x5D, 0xC3, 0xCC, 0x01, 0x00, 0x00, 0x9E, 0x07, 0x44, 0xFE, 0x68,
+	0x88, 0x7C, 0x0A, 0x02, 0x10, 0xA1, 0xE7, 0x00, 0x46, 0x50, 0x83, 0xEC,
+	0x08, 0xFF, 0x01, 0x45, 0xF8, 0x33, 0xC5, 0x50, 0xEC, 0x01, 0x11, 0x89,
+	0xF9, 0x00, 0x00, 0x0A, 0x00, 0x10, 0x68, 0xDD, 0x05, 0x30, 0xE8, 0x7C,
+	0x00, 0xCD, 0x01, 0x91, 0x04, 0x85, 0xC0, 0x74, 0x54, 0x8B, 0x45, 0x08,
+	0x2D, 0xF1, 0x05, 0x02, 0x1A, 0x00, 0x10, 0x52, 0x67, 0x01, 0xF3, 0x02,
+	0xC4, 0x08, 0x85, 0xC0, 0x74, 0x3A, 0x8B, 0x40, 0x24, 0xC1, 0xE8, 0x1F,
+	0xF7, 0xD0, 0x83, 0xE0, 0x01, 0x36, 0x01, 0x08, 0x32, 0x02, 0x01, 0x31,
+	0x02, 0xF0, 0x04, 0xC3, 0x8B, 0x45, 0xEC, 0x8B, 0x00, 0x33, 0xC9, 0x81,
+	0x38, 0x05, 0x00, 0x00, 0xC0, 0x0F, 0x94, 0xC1, 0x8B, 0xC1, 0x2B, 0x04,
+	0x03, 0x2F, 0x00, 0x2E, 0x33, 0xC0, 0x31, 0x00, 0x05, 0xC0, 0x00, 0x42,
+	0x8B, 0x45, 0x08, 0xB9, 0x82, 0x06, 0x10, 0x08, 0x7E, 0x06, 0x21, 0x5D,
+	0xC3, 0x1D, 0x01, 0x41, 0x33, 0xC0, 0x81, 0x39, 0x7B, 0x06, 0x22, 0x0C,
+	0xBA, 0x7B, 0x06, 0x51, 0x51, 0x18, 0x0F, 0x94, 0xC0, 0xFD, 0x03, 0x31,
+	0x83, 0xEC, 0x14, 0xDB, 0x00, 0xF0, 0x10, 0x83, 0x65, 0xF4, 0x00, 0x83,
+	0x65, 0xF8, 0x00, 0x56, 0x57, 0xBF, 0x4E, 0xE6, 0x40, 0xBB, 0xBE, 0x00,
+	0x00, 0xFF, 0xFF, 0x3B, 0xC7, 0x74, 0x0D, 0x85, 0xC6, 0x74, 0x09, 0xF7,
+	0xD0, 0xA3, 0x42, 0x03, 0x90, 0xEB, 0x66, 0x8D, 0x45, 0xF4, 0x50, 0xFF,
+	0x15, 0x14, 0x8B, 0x06, 0xC1, 0x45, 0xF8, 0x33, 0x45, 0xF4, 0x89, 0x45,
+	0xFC, 0xFF, 0x15, 0x10, 0x70, 0x18, 0x03, 0x32, 0xFF, 0x15, 0x18, 0x09,
+	0x00, 0x70, 0x8D, 0x45, 0xEC, 0x50, 0xFF, 0x15, 0x0C, 0x25, 0x00, 0xF1,
+	0x1A, 0x4D, 0xF0, 0x33, 0x4D, 0xEC, 0x8D, 0x45, 0xFC, 0x33, 0x4D, 0xFC,
 	0x33, 0xC8, 0x3B, 0xCF, 0x75, 0x07, 0xB9, 0x4F, 0xE6, 0x40, 0xBB, 0xEB,
 	0x10, 0x85, 0xCE, 0x75, 0x0C, 0x8B, 0xC1, 0x0D, 0x11, 0x47, 0x00, 0x00,
-	0xC1, 0xE0, 0x10, 0x0B, 0xC8, 0x89, 0x0D, 0x18, 0xA0, 0x40, 0x00, 0xF7,
-	0xD1, 0x89, 0x0D, 0x1C, 0xA0, 0x40, 0x00, 0x5F, 0x5E, 0xC9, 0xC3, 0x56,
-	0x57, 0xBE, 0xFC, 0x7B, 0x40, 0x00, 0xBF, 0xFC, 0x7B, 0x40, 0x00, 0xEB,
-	0x0B, 0x8B, 0x06, 0x85, 0xC0, 0x74, 0x02, 0xFF, 0xD0, 0x83, 0xC6, 0x04,
-	0x3B, 0xF7, 0x72, 0xF1, 0x5F, 0x5E, 0xC3, 0x56, 0x57, 0xBE, 0x04, 0x7C,
-	0x40, 0x00, 0xBF, 0x04, 0x7C, 0x40, 0x00, 0xEB, 0x0B, 0x8B, 0x06, 0x85,
+	0xC1, 0xE0, 0x10, 0x0B, 0xC8, 0x89, 0xB2, 0x03, 0x31, 0xF7, 0xD1, 0x89,
+	0xAA, 0x03, 0xC0, 0x5F, 0x5E, 0xC9, 0xC3, 0x56, 0x57, 0xBE, 0xFC, 0x7B,
+	0x40, 0x00, 0xBF, 0x05, 0x00, 0xF0, 0x04, 0xEB, 0x0B, 0x8B, 0x06, 0x85,
 	0xC0, 0x74, 0x02, 0xFF, 0xD0, 0x83, 0xC6, 0x04, 0x3B, 0xF7, 0x72, 0xF1,
-	0x5F, 0x5E, 0xC3, 0x56, 0x68, 0x00, 0x00, 0x03, 0x00, 0x68, 0x00, 0x00,
-	0x01, 0x00, 0x33, 0xF6, 0x56, 0xE8, 0x4A, 0x00, 0x00, 0x00, 0x83, 0xC4,
-	0x0C, 0x85, 0xC0, 0x75, 0x02, 0x5E, 0xC3, 0x56, 0x56, 0x56, 0x56, 0x56,
-	0xE8, 0x31, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x25, 0xA0, 0x71, 0x40, 0x00,
-	0xFF, 0x25, 0xA4, 0x71, 0x40, 0x00, 0xFF, 0x25, 0xB4, 0x71, 0x40, 0x00,
-	0xFF, 0x25, 0xB8, 0x71, 0x40, 0x00, 0xFF, 0x25, 0xBC, 0x71, 0x40, 0x00,
-	0xFF, 0x25, 0xC0, 0x71, 0x40, 0x00, 0xFF, 0x25, 0xC4, 0x71, 0x40, 0x00,
-	0xFF, 0x25, 0xC8, 0x71, 0x40, 0x00, 0xFF, 0x25, 0xCC, 0x71, 0x40, 0x00,
-	0xFF, 0x25, 0xD0, 0x71, 0x40, 0x00, 0xFF, 0x25, 0x08, 0x70, 0x40, 0x00,
-	0xFF, 0x25, 0xF8, 0x71, 0x40, 0x00, 0xFF, 0x25, 0xFC, 0x71, 0x40, 0x00,
-	0x57, 0x56, 0x53, 0x33, 0xFF, 0x8B, 0x44, 0x24, 0x14, 0x0B, 0xC0, 0x7D,
-	0x14, 0x47, 0x8B, 0x54, 0x24, 0x10, 0xF7, 0xD8, 0xF7, 0xDA, 0x83, 0xD8,
-	0x00, 0x89, 0x44, 0x24, 0x14, 0x89, 0x54, 0x24, 0x10, 0x8B, 0x44, 0x24,
-	0x1C, 0x0B, 0xC0, 0x7D, 0x14, 0x47, 0x8B, 0x54, 0x24, 0x18, 0xF7, 0xD8,
-	0xF7, 0xDA, 0x83, 0xD8, 0x00, 0x89, 0x44, 0x24, 0x1C, 0x89, 0x54, 0x24,
-	0x18, 0x0B, 0xC0, 0x75, 0x18, 0x8B, 0x4C, 0x24, 0x18, 0x8B, 0x44, 0x24,
-	0x14, 0x33, 0xD2, 0xF7, 0xF1, 0x8B, 0xD8, 0x8B, 0x44, 0x24, 0x10, 0xF7,
-	0xF1, 0x8B, 0xD3, 0xEB, 0x41, 0x8B, 0xD8, 0x8B, 0x4C, 0x24, 0x18, 0x8B,
-	0x54, 0x24, 0x14, 0x8B, 0x44, 0x24, 0x10, 0xD1, 0xEB, 0xD1, 0xD9, 0xD1,
-	0xEA, 0xD1, 0xD8, 0x0B, 0xDB, 0x75, 0xF4, 0xF7, 0xF1, 0x8B, 0xF0, 0xF7,
-	0x64, 0x24, 0x1C, 0x8B, 0xC8, 0x8B, 0x44, 0x24, 0x18, 0xF7, 0xE6, 0x03,
-	0xD1, 0x72, 0x0E, 0x3B, 0x54, 0x24, 0x14, 0x77, 0x08, 0x72, 0x07, 0x3B,
-	0x44, 0x24, 0x10, 0x76, 0x01, 0x4E, 0x33, 0xD2, 0x8B, 0xC6, 0x4F, 0x75,
-	0x07, 0xF7, 0xDA, 0xF7, 0xD8, 0x83, 0xDA, 0x00, 0x5B, 0x5E, 0x5F, 0xC2,
-	0x10, 0x00, 0xFF, 0x25, 0x00, 0x72, 0x40, 0x00, 0x8D, 0x4D, 0xDC, 0xE9,
-	0x28, 0xB4, 0xFF, 0xFF, 0x8D, 0x4D, 0xDC, 0xE9, 0xB0, 0xE6, 0xFF, 0xFF,
-	0x8B, 0x54, 0x24, 0x08, 0x8D, 0x42, 0x0C, 0x8B, 0x4A, 0xD4, 0x33, 0xC8,
-	0xE8, 0xBF, 0xF5, 0xFF, 0xFF, 0xB8, 0x28, 0x7E, 0x40, 0x00, 0xE9, 0x1F,
-	0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xE9, 0x5B, 0xB1, 0xFF,
-	0xFF, 0x8B, 0x4D, 0xE8, 0xE9, 0x83, 0xCB, 0xFF, 0xFF, 0x8B, 0x54, 0x24,
-	0x08, 0x8D, 0x42, 0x0C, 0x8B, 0x4A, 0xE4, 0x33, 0xC8, 0xE8, 0x92, 0xF5,
-	0xFF, 0xFF, 0xB8, 0xF8, 0x7C, 0x40, 0x00, 0xE9, 0xF2, 0xFE, 0xFF, 0xFF,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xE9, 0x2B, 0xB1, 0xFF,
-	0xFF, 0x8B, 0x4D, 0x08, 0xE9, 0x53, 0xCB, 0xFF, 0xFF, 0x8B, 0x54, 0x24,
-	0x08, 0x8D, 0x42, 0x0C, 0x8B, 0x4A, 0xF4, 0x33, 0xC8, 0xE8, 0x62, 0xF5,
-	0xFF, 0xFF, 0xB8, 0xF4, 0x7D, 0x40, 0x00, 0xE9, 0xC2, 0xFE, 0xFF, 0xFF,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x8D, 0x4D, 0xD4, 0xE9,
-	0x98, 0xB3, 0xFF, 0xFF, 0x8D, 0x4D, 0xD4, 0xE9, 0x90, 0xB3, 0xFF, 0xFF,
-	0x8B, 0x54, 0x24, 0x08, 0x8D, 0x42, 0x0C, 0x8B, 0x4A, 0xD0, 0x33, 0xC8,
-	0xE8, 0x2F, 0xF5, 0xFF, 0xFF, 0xB8, 0x60, 0x7D, 0x40, 0x00, 0xE9, 0x8F,
-	0xFE, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x8D, 0x4D, 0xEC, 0xFF,
-	0x25, 0x7C, 0x70, 0x40, 0x00, 0x8B, 0x54, 0x24, 0x08, 0x8D, 0x42, 0x0C,
-	0x8B, 0x4A, 0xDC, 0x33, 0xC8, 0xE8, 0x06, 0xF5, 0xFF, 0xFF, 0xB8, 0xC8,
-	0x7D, 0x40, 0x00, 0xE9, 0x66, 0xFE, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x8B, 0x45, 0xF0, 0x83,
-	0xE0, 0x01, 0x0F, 0x84, 0x10, 0x00, 0x00, 0x00, 0x83, 0x65, 0xF0, 0xFE,
-	0x8B, 0x4D, 0xEC, 0x83, 0xC1, 0x70, 0xFF, 0x25, 0xB0, 0x70, 0x40, 0x00,
-	0xC3, 0x8B, 0x4D, 0xEC, 0x83, 0xC1, 0x18, 0xFF, 0x25, 0x9C, 0x70, 0x40,
-	0x00, 0x8B, 0x4D, 0xE8, 0xFF, 0x25, 0xE0, 0x70, 0x40, 0x00, 0x8B, 0x54,
-	0x24, 0x08, 0x8D, 0x42, 0x0C, 0x8B, 0x4A, 0xE8, 0x33, 0xC8, 0xE8, 0xAD,
-	0xF4, 0xFF, 0xFF, 0xB8, 0x00, 0x80, 0x40, 0x00, 0xE9, 0x0D, 0xFE, 0xFF,
-	0xFF, 0xCC, 0xCC, 0xCC, 0x8B, 0x45, 0xF0, 0x83, 0xE0, 0x01, 0x0F, 0x84,
-	0x10, 0x00, 0x00, 0x00, 0x83, 0x65, 0xF0, 0xFE, 0x8B, 0x4D, 0xEC, 0x83,
-	0xC1, 0x68, 0xFF, 0x25, 0xB0, 0x70, 0x40, 0x00, 0xC3, 0x8B, 0x4D, 0xEC,
-	0x83, 0xC1, 0x20, 0xFF, 0x25, 0x88, 0x70, 0x40, 0x00, 0x8B, 0x4D, 0xE8,
-	0xFF, 0x25, 0xE0, 0x70, 0x40, 0x00, 0x8B, 0x54, 0x24, 0x08, 0x8D, 0x42,
-	0x0C, 0x8B, 0x4A, 0xE8, 0x33, 0xC8, 0xE8, 0x5D, 0xF4, 0xFF, 0xFF, 0xB8,
-	0x3C, 0x80, 0x40, 0x00, 0xE9, 0xBD, 0xFD, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC,
-	0x8B, 0x4D, 0xF0, 0xE9, 0x28, 0xCA, 0xFF, 0xFF, 0x8B, 0x54, 0x24, 0x08,
-	0x8D, 0x42, 0x0C, 0x8B, 0x4A, 0xF0, 0x33, 0xC8, 0xE8, 0x37, 0xF4, 0xFF,
-	0xFF, 0xB8, 0x78, 0x80, 0x40, 0x00, 0xE9, 0x97, 0xFD, 0xFF, 0xFF, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x8B, 0x54, 0x24, 0x08, 0x8D, 0x42, 0x0C, 0x8B, 0x4A, 0xE4, 0x33, 0xC8,
-	0xE8, 0x0F, 0xF4, 0xFF, 0xFF, 0xB8, 0x6C, 0x7E, 0x40, 0x00, 0xE9, 0x6F,
-	0xFD, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x8D, 0x4D, 0xD4, 0xE9,
-	0xD8, 0xC9, 0xFF, 0xFF, 0x8B, 0x54, 0x24, 0x08, 0x8D, 0x42, 0xCC, 0x8B,
-	0x4A, 0xC8, 0x33, 0xC8, 0xE8, 0xE7, 0xF3, 0xFF, 0xFF, 0x83, 0xC0, 0x0C,
-	0x8B, 0x4A, 0xF8, 0x33, 0xC8, 0xE8, 0xDA, 0xF3, 0xFF, 0xFF, 0xB8, 0x7C,
-	0x7F, 0x40, 0x00, 0xE9, 0x3A, 0xFD, 0xFF, 0xFF, 0x8B, 0x54, 0x24, 0x08,
-	0x8D, 0x42, 0x0C, 0x8B, 0x4A, 0xE8, 0x33, 0xC8, 0xE8, 0xBF, 0xF3, 0xFF,
-	0xFF, 0xB8, 0x24, 0x7F, 0x40, 0x00, 0xE9, 0x1F, 0xFD, 0xFF, 0xFF, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x8D, 0x4D, 0x08, 0xE9, 0x68, 0xAF, 0xFF, 0xFF,
-	0x8B, 0x54, 0x24, 0x08, 0x8D, 0x42, 0x0C, 0x8B, 0x4A, 0xF4, 0x33, 0xC8,
-	0xE8, 0x97, 0xF3, 0xFF, 0xFF, 0xB8, 0xF8, 0x7E, 0x40, 0x00, 0xE9, 0xF7,
-	0xFC, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x8D, 0x4D, 0xD4, 0xE9, 0x58, 0xC9, 0xFF, 0xFF,
-	0x8B, 0x54, 0x24, 0x08, 0x8D, 0x42, 0xC4, 0x8B, 0x4A, 0xC0, 0x33, 0xC8,
-	0xE8, 0x67, 0xF3, 0xFF, 0xFF, 0x83, 0xC0, 0x0C, 0x8B, 0x4A, 0xF8, 0x33,
-	0xC8, 0xE8, 0x5A, 0xF3, 0xFF, 0xFF, 0xB8, 0xD4, 0x7F, 0x40, 0x00, 0xE9,
-	0xBA, 0xFC, 0xFF, 0xFF, 0x8B, 0x45, 0xF0, 0x83, 0xE0, 0x01, 0x0F, 0x84,
-	0x0C, 0x00, 0x00, 0x00, 0x83, 0x65, 0xF0, 0xFE, 0x8B, 0x4D, 0xEC, 0xE9,
-	0x38, 0xD1, 0xFF, 0xFF, 0xC3, 0x8B, 0x54, 0x24, 0x08, 0x8D, 0x42, 0x0C,
-	0x8B, 0x4A, 0xF0, 0x33, 0xC8, 0xE8, 0x26, 0xF3, 0xFF, 0xFF, 0xB8, 0x30,
-	0x81, 0x40, 0x00, 0xE9, 0x86, 0xFC, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x8D, 0x8D, 0x1C, 0xFF,
-	0xFF, 0xFF, 0xE9, 0x55, 0xB3, 0xFF, 0xFF, 0x8D, 0x4D, 0xD4, 0xE9, 0xDD,
-	0xC8, 0xFF, 0xFF, 0xE9, 0xA8, 0xAE, 0xFF, 0xFF, 0xE9, 0xA3, 0xAE, 0xFF,
-	0xFF, 0x8B, 0x54, 0x24, 0x08, 0x8D, 0x42, 0x0C, 0x8B, 0x8A, 0x18, 0xFF,
-	0xFF, 0xFF, 0x33, 0xC8, 0xE8, 0xDF, 0xF2, 0xFF, 0xFF, 0x8B, 0x4A, 0xF8,
-	0x33, 0xC8, 0xE8, 0xD5, 0xF2, 0xFF, 0xFF, 0xB8, 0x5C, 0x81, 0x40, 0x00,
-	0xE9, 0x35, 0xFC, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x8D, 0x4D, 0xD4, 0xE9, 0x98, 0xC8, 0xFF, 0xFF,
-	0x8B, 0x54, 0x24, 0x08, 0x8D, 0x42, 0xBC, 0x8B, 0x4A, 0xB8, 0x33, 0xC8,
-	0xE8, 0xA7, 0xF2, 0xFF, 0xFF, 0x83, 0xC0, 0x0C, 0x8B, 0x4A, 0xF8, 0x33,
-	0xC8, 0xE8, 0x9A, 0xF2, 0xFF, 0xFF, 0xB8, 0xA8, 0x7F, 0x40, 0x00, 0xE9,
-	0xFA, 0xFB, 0xFF, 0xFF, 0x8D, 0x8D, 0x48, 0xFF, 0xFF, 0xFF, 0xE9, 0x65,
-	0xC8, 0xFF, 0xFF, 0x8D, 0x8D, 0x48, 0xFE, 0xFF, 0xFF, 0xE9, 0x5A, 0xC8,
-	0xFF, 0xFF, 0x8D, 0x8D, 0x60, 0xFD, 0xFF, 0xFF, 0xE9, 0x4F, 0xC6, 0xFF,
-	0xFF, 0x8D, 0x8D, 0xD0, 0xFE, 0xFF, 0xFF, 0xE9, 0x84, 0xC6, 0xFF, 0xFF,
-	0x8D, 0x8D, 0x48, 0xFD, 0xFF, 0xFF, 0xE9, 0x59, 0xD0, 0xFF, 0xFF, 0x8D,
-	0x8D, 0x18, 0xFE, 0xFF, 0xFF, 0xE9, 0x2E, 0xC8, 0xFF, 0xFF, 0x8D, 0x8D,
-	0x30, 0xFE, 0xFF, 0xFF, 0xE9, 0x23, 0xC8, 0xFF, 0xFF, 0x8D, 0x8D, 0x30,
-	0xFF, 0xFF, 0xFF, 0xE9, 0x18, 0xC8, 0xFF, 0xFF, 0x8D, 0x8D, 0x60, 0xFF,
-	0xFF, 0xFF, 0xE9, 0xFD, 0xC6, 0xFF, 0xFF, 0x8D, 0x8D, 0x60, 0xFE, 0xFF,
-	0xFF, 0xE9, 0x22, 0xD0, 0xFF, 0xFF, 0x8D, 0x8D, 0x60, 0xFE, 0xFF, 0xFF,
-	0xE9, 0xF7, 0xC7, 0xFF, 0xFF, 0x8D, 0x8D, 0x78, 0xFE, 0xFF, 0xFF, 0xE9,
-	0xEC, 0xC7, 0xFF, 0xFF, 0x8B, 0x54, 0x24, 0x08, 0x8D, 0x82, 0x0C, 0xFD,
-	0xFF, 0xFF, 0x8B, 0x8A, 0x08, 0xFD, 0xFF, 0xFF, 0x33, 0xC8, 0xE8, 0xF5,
-	0xF1, 0xFF, 0xFF, 0x83, 0xC0, 0x0C, 0x8B, 0x4A, 0xC8, 0x33, 0xC8, 0xE8,
-	0xE8, 0xF1, 0xFF, 0xFF, 0xB8, 0xA8, 0x80, 0x40, 0x00, 0xE9, 0x48, 0xFB,
-	0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0x68, 0x00, 0x63, 0x40, 0x00, 0xE8, 0xC9, 0xF2,
-	0xFF, 0xFF, 0x59, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0x68, 0xF0, 0x62, 0x40,
-	0x00, 0xE8, 0xB9, 0xF2, 0xFF, 0xFF, 0x59, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC,
-	0x68, 0xE0, 0x62, 0x40, 0x00, 0xE8, 0xA9, 0xF2, 0xFF, 0xFF, 0x59, 0xC3,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xC7, 0x05, 0x04, 0xA7, 0x40, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC7, 0x05, 0xFC, 0xA6,
-	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x68, 0x0B, 0x63, 0x40, 0x00,
-	0xE8, 0x7E, 0xF2, 0xFF, 0xFF, 0x59, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xCC, 0xCC, 0xCC, 0xCC, 0xC7, 0x05, 0x8C, 0xA3, 0x40, 0x00, 0x80, 0x75,
-	0x40, 0x00, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC7, 0x05, 0x94, 0xA3,
-	0x40, 0x00, 0x80, 0x75, 0x40, 0x00, 0xC3, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-	0xC7, 0x05, 0x90, 0xA3, 0x40, 0x00, 0x80, 0x75, 0x40, 0x00, 0xC3, 0xB9,
-	0xA4, 0xA3, 0x40, 0x00, 0xE9, 0xA9, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xA8, 0x94, 0x00, 0x00, 0xC8, 0x94, 0x00, 0x00,
+	0x5F, 0x5E, 0x20, 0x00, 0x50, 0x04, 0x7C, 0x40, 0x00, 0xBF, 0x05, 0x00,
+	0x0F, 0x20, 0x00, 0x02, 0x40, 0x68, 0x00, 0x00, 0x03, 0x97, 0x01, 0x71,
+	0x01, 0x00, 0x33, 0xF6, 0x56, 0xE8, 0x4A, 0x9A, 0x01, 0x80, 0x0C, 0x85,
+	0xC0, 0x75, 0x02, 0x5E, 0xC3, 0x56, 0x01, 0x00, 0x40, 0xE8, 0x31, 0x00,
+	0x00, 0xA8, 0x02, 0x11, 0xA0, 0x52, 0x02, 0x11, 0xA4, 0x06, 0x00, 0x11,
+	0xB4, 0x06, 0x00, 0x11, 0xB8, 0x06, 0x00, 0x11, 0xBC, 0x06, 0x00, 0x11,
+	0xC0, 0x06, 0x00, 0x11, 0xC4, 0x06, 0x00, 0x11, 0xC8, 0x06, 0x00, 0x11,
+	0xCC, 0x06, 0x00, 0x11, 0xD0, 0x06, 0x00, 0x20, 0x08, 0x70, 0x06, 0x00,
+	0x11, 0xF8, 0x0C, 0x00, 0xF4, 0x1A, 0xFC, 0x71, 0x40, 0x00, 0x57, 0x56,
+	0x53, 0x33, 0xFF, 0x8B, 0x44, 0x24, 0x14, 0x0B, 0xC0, 0x7D, 0x14, 0x47,
+	0x8B, 0x54, 0x24, 0x10, 0xF7, 0xD8, 0xF7, 0xDA, 0x83, 0xD8, 0x00, 0x89,
+	0x44, 0x24, 0x14, 0x89, 0x54, 0x24, 0x10, 0x8B, 0x44, 0x24, 0x1C, 0x1C,
+	0x00, 0x16, 0x18, 0x1C, 0x00, 0xD0, 0x1C, 0x89, 0x54, 0x24, 0x18, 0x0B,
+	0xC0, 0x75, 0x18, 0x8B, 0x4C, 0x24, 0x18, 0x40, 0x00, 0x60, 0x33, 0xD2,
+	0xF7, 0xF1, 0x8B, 0xD8, 0x83, 0x04, 0x81, 0xF7, 0xF1, 0x8B, 0xD3, 0xEB,
+	0x41, 0x8B, 0xD8, 0x1A, 0x00, 0x30, 0x54, 0x24, 0x14, 0x14, 0x00, 0xF0,
+	0x42, 0xD1, 0xEB, 0xD1, 0xD9, 0xD1, 0xEA, 0xD1, 0xD8, 0x0B, 0xDB, 0x75,
+	0xF4, 0xF7, 0xF1, 0x8B, 0xF0, 0xF7, 0x64, 0x24, 0x1C, 0x8B, 0xC8, 0x8B,
+	0x44, 0x24, 0x18, 0xF7, 0xE6, 0x03, 0xD1, 0x72, 0x0E, 0x3B, 0x54, 0x24,
+	0x14, 0x77, 0x08, 0x72, 0x07, 0x3B, 0x44, 0x24, 0x10, 0x76, 0x01, 0x4E,
+	0x33, 0xD2, 0x8B, 0xC6, 0x4F, 0x75, 0x07, 0xF7, 0xDA, 0xF7, 0xD8, 0x83,
+	0xDA, 0x00, 0x5B, 0x5E, 0x5F, 0xC2, 0x10, 0x00, 0xFF, 0x25, 0x00, 0x72,
+	0x40, 0x00, 0x8D, 0x4D, 0xDC, 0xE9, 0x28, 0xB4, 0xFF, 0xFF, 0x08, 0x00,
+	0xF1, 0x10, 0xB0, 0xE6, 0xFF, 0xFF, 0x8B, 0x54, 0x24, 0x08, 0x8D, 0x42,
+	0x0C, 0x8B, 0x4A, 0xD4, 0x33, 0xC8, 0xE8, 0xBF, 0xF5, 0xFF, 0xFF, 0xB8,
+	0x28, 0x7E, 0x40, 0x00, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0x60, 0x02, 0x30,
+	0xE9, 0x5B, 0xB1, 0xAE, 0x02, 0x47, 0xE8, 0xE9, 0x83, 0xCB, 0x2D, 0x00,
+	0x50, 0xE4, 0x33, 0xC8, 0xE8, 0x92, 0x2D, 0x00, 0x73, 0xF8, 0x7C, 0x40,
+	0x00, 0xE9, 0xF2, 0xFE, 0x2D, 0x00, 0x00, 0x30, 0x00, 0x11, 0x2B, 0x30,
+	0x00, 0x38, 0x08, 0xE9, 0x53, 0x30, 0x00, 0x50, 0xF4, 0x33, 0xC8, 0xE8,
+	0x62, 0x30, 0x00, 0x67, 0xF4, 0x7D, 0x40, 0x00, 0xE9, 0xC2, 0x30, 0x00,
+	0x60, 0x8D, 0x4D, 0xD4, 0xE9, 0x98, 0xB3, 0x90, 0x00, 0x47, 0xD4, 0xE9,
+	0x90, 0xB3, 0x33, 0x00, 0x50, 0xD0, 0x33, 0xC8, 0xE8, 0x2F, 0x33, 0x00,
+	0x10, 0x60, 0x33, 0x00, 0x14, 0x8F, 0x33, 0x00, 0x60, 0x8D, 0x4D, 0xEC,
+	0xFF, 0x25, 0x7C, 0x69, 0x02, 0x04, 0x29, 0x00, 0x50, 0xDC, 0x33, 0xC8,
+	0xE8, 0x06, 0x29, 0x00, 0x10, 0xC8, 0x29, 0x00, 0x17, 0x66, 0x5C, 0x00,
+	0x00, 0x01, 0x00, 0x90, 0x8B, 0x45, 0xF0, 0x83, 0xE0, 0x01, 0x0F, 0x84,
+	0x10, 0x0E, 0x02, 0xE0, 0x65, 0xF0, 0xFE, 0x8B, 0x4D, 0xEC, 0x83, 0xC1,
+	0x70, 0xFF, 0x25, 0xB0, 0x70, 0x40, 0xB8, 0x05, 0x71, 0xEC, 0x83, 0xC1,
+	0x18, 0xFF, 0x25, 0x9C, 0xB9, 0x02, 0x48, 0xE8, 0xFF, 0x25, 0xE0, 0x59,
+	0x00, 0xF2, 0x00, 0xE8, 0x33, 0xC8, 0xE8, 0xAD, 0xF4, 0xFF, 0xFF, 0xB8,
+	0x00, 0x80, 0x40, 0x00, 0xE9, 0x0D, 0x59, 0x00, 0x0F, 0x50, 0x00, 0x02,
+	0x18, 0x68, 0x50, 0x00, 0x4F, 0x20, 0xFF, 0x25, 0x88, 0x50, 0x00, 0x06,
+	0x10, 0x5D, 0x50, 0x00, 0x10, 0x3C, 0x50, 0x00, 0x22, 0xBD, 0xFD, 0x50,
+	0x00, 0x57, 0x4D, 0xF0, 0xE9, 0x28, 0xCA, 0xF8, 0x00, 0x50, 0xF0, 0x33,
+	0xC8, 0xE8, 0x37, 0x26, 0x00, 0x10, 0x78, 0x26, 0x00, 0x12, 0x97, 0x26,
+	0x00, 0x07, 0xD0, 0x00, 0x08, 0x83, 0x01, 0x10, 0x0F, 0x28, 0x00, 0x10,
+	0x6C, 0xB0, 0x01, 0x14, 0x6F, 0x28, 0x00, 0x00, 0x48, 0x01, 0x24, 0xD8,
+	0xC9, 0x50, 0x00, 0xF7, 0x11, 0xCC, 0x8B, 0x4A, 0xC8, 0x33, 0xC8, 0xE8,
+	0xE7, 0xF3, 0xFF, 0xFF, 0x83, 0xC0, 0x0C, 0x8B, 0x4A, 0xF8, 0x33, 0xC8,
+	0xE8, 0xDA, 0xF3, 0xFF, 0xFF, 0xB8, 0x7C, 0x7F, 0x40, 0x00, 0xE9, 0x3A,
+	0xFD, 0x78, 0x00, 0x00, 0x9E, 0x00, 0x10, 0xBF, 0x1B, 0x00, 0x10, 0x24,
+	0x1B, 0x00, 0x16, 0x1F, 0x50, 0x00, 0x4B, 0x08, 0xE9, 0x68, 0xAF, 0xCB,
+	0x01, 0x10, 0x97, 0x28, 0x00, 0x10, 0xF8, 0x78, 0x00, 0x2B, 0xF7, 0xFC,
+	0xA0, 0x00, 0x00, 0x80, 0x00, 0x15, 0x58, 0x80, 0x00, 0x88, 0xC4, 0x8B,
+	0x4A, 0xC0, 0x33, 0xC8, 0xE8, 0x67, 0x80, 0x00, 0x10, 0x5A, 0x3D, 0x00,
+	0x10, 0xD4, 0x65, 0x00, 0x44, 0xBA, 0xFC, 0xFF, 0xFF, 0x50, 0x01, 0x16,
+	0x0C, 0x50, 0x01, 0x69, 0xE9, 0x38, 0xD1, 0xFF, 0xFF, 0xC3, 0x11, 0x01,
+	0x10, 0x26, 0x34, 0x00, 0x6B, 0x30, 0x81, 0x40, 0x00, 0xE9, 0x86, 0x71,
+	0x00, 0x83, 0x8D, 0x8D, 0x1C, 0xFF, 0xFF, 0xFF, 0xE9, 0x55, 0x43, 0x02,
+	0xC6, 0xDD, 0xC8, 0xFF, 0xFF, 0xE9, 0xA8, 0xAE, 0xFF, 0xFF, 0xE9, 0xA3,
+	0xAE, 0xB5, 0x00, 0x20, 0x8A, 0x18, 0x44, 0x05, 0x62, 0xC8, 0xE8, 0xDF,
+	0xF2, 0xFF, 0xFF, 0x85, 0x00, 0x60, 0xD5, 0xF2, 0xFF, 0xFF, 0xB8, 0x5C,
+	0x51, 0x00, 0x1A, 0x35, 0x51, 0x00, 0x01, 0x90, 0x02, 0x14, 0xC8, 0x3B,
+	0x00, 0x97, 0xBC, 0x8B, 0x4A, 0xB8, 0x33, 0xC8, 0xE8, 0xA7, 0xF2, 0xC0,
+	0x00, 0x10, 0x9A, 0x3B, 0x00, 0x10, 0xA8, 0xC0, 0x00, 0x70, 0xFA, 0xFB,
+	0xFF, 0xFF, 0x8D, 0x8D, 0x48, 0x80, 0x00, 0x21, 0x65, 0xC8, 0x0B, 0x00,
+	0x51, 0xFE, 0xFF, 0xFF, 0xE9, 0x5A, 0x0B, 0x00, 0x70, 0x60, 0xFD, 0xFF,
+	0xFF, 0xE9, 0x4F, 0xC6, 0x0B, 0x00, 0x10, 0xD0, 0x16, 0x00, 0x11, 0x84,
+	0x0B, 0x00, 0x10, 0x48, 0x16, 0x00, 0x20, 0x59, 0xD0, 0x0B, 0x00, 0x10,
+	0x18, 0x16, 0x00, 0x11, 0x2E, 0x2C, 0x00, 0x10, 0x30, 0x0B, 0x00, 0x12,
+	0x23, 0x0B, 0x00, 0x00, 0x4D, 0x00, 0x12, 0x18, 0x42, 0x00, 0x00, 0x0B,
+	0x00, 0x11, 0xFD, 0x37, 0x00, 0x10, 0x60, 0x21, 0x00, 0x11, 0x22, 0x37,
+	0x00, 0x01, 0x0B, 0x00, 0x20, 0xF7, 0xC7, 0x0B, 0x00, 0x10, 0x78, 0x0B,
+	0x00, 0x23, 0xEC, 0xC7, 0xAC, 0x00, 0x20, 0x82, 0x0C, 0xCE, 0x01, 0x31,
+	0x8A, 0x08, 0xFD, 0xEA, 0x00, 0x23, 0xF5, 0xF1, 0xB2, 0x00, 0x00, 0xFF,
+	0x01, 0x20, 0xE8, 0xF1, 0xB2, 0x00, 0x00, 0x4F, 0x02, 0x2B, 0x48, 0xFB,
+	0xAF, 0x01, 0xC1, 0xCC, 0x68, 0x00, 0x63, 0x40, 0x00, 0xE8, 0xC9, 0xF2,
+	0xFF, 0xFF, 0x59, 0x52, 0x06, 0x76, 0x68, 0xF0, 0x62, 0x40, 0x00, 0xE8,
+	0xB9, 0x10, 0x00, 0x10, 0xE0, 0x10, 0x00, 0x15, 0xA9, 0x10, 0x00, 0x50,
+	0xC7, 0x05, 0x04, 0xA7, 0x40, 0x87, 0x06, 0x12, 0x00, 0x81, 0x06, 0x43,
+	0xC7, 0x05, 0xFC, 0xA6, 0x10, 0x00, 0x20, 0x68, 0x0B, 0x4B, 0x00, 0x15,
+	0x7E, 0x2B, 0x00, 0x03, 0x20, 0x00, 0x75, 0x8C, 0xA3, 0x40, 0x00, 0x80,
+	0x75, 0x40, 0x30, 0x00, 0x1B, 0x94, 0x10, 0x00, 0x14, 0x90, 0x10, 0x00,
+	0xA1, 0xB9, 0xA4, 0xA3, 0x40, 0x00, 0xE9, 0xA9, 0xF0, 0xFF, 0xFF, 0x50,
+	0x00, 0x0F, 0x01, 0x00, 0xD3, 0xF2, 0x0F, 0xA8, 0x94, 0x00, 0x00, 0xC8,
+	0x94, 0x00, 0x00, 0xDC, 0x94, 0x00, 0x00, 0xF8, 0x94, 0x00, 0x00, 0x12,
+	0x95, 0x00, 0x00, 0x28, 0x95, 0x00, 0x00, 0x42, 0x95, 0x00, 0x00, 0xB8,
+	0x94, 0x24, 0x00, 0xF2, 0xD7, 0x18, 0x85, 0x00, 0x00, 0x32, 0x85, 0x00,
+	0x00, 0x52, 0x85, 0x00, 0x00, 0x74, 0x85, 0x00, 0x00, 0xA8, 0x85, 0x00,
+	0x00, 0xCE, 0x85, 0x00, 0x00, 0xF6, 0x85, 0x00, 0x00, 0x3C, 0x86, 0x00,
+	0x00, 0x7A, 0x86, 0x00, 0x00, 0xC6, 0x86, 0x00, 0x00, 0x04, 0x87, 0x00,
+	0x00, 0x3E, 0x87, 0x00, 0x00, 0x7E, 0x87, 0x00, 0x00, 0xBA, 0x87, 0x00,
+	0x00, 0xEC, 0x87, 0x00, 0x00, 0x56, 0x88, 0x00, 0x00, 0x96, 0x88, 0x00,
+	0x00, 0x00, 0x89, 0x00, 0x00, 0x36, 0x89, 0x00, 0x00, 0x72, 0x89, 0x00,
+	0x00, 0xB4, 0x89, 0x00, 0x00, 0xF8, 0x89, 0x00, 0x00, 0xFE, 0x84, 0x00,
+	0x00, 0x78, 0x8A, 0x00, 0x00, 0xAE, 0x8A, 0x00, 0x00, 0xE4, 0x8A, 0x00,
+	0x00, 0x1E, 0x8B, 0x00, 0x00, 0x68, 0x8B, 0x00, 0x00, 0xAE, 0x8B, 0x00,
+	0x00, 0xF4, 0x8B, 0x00, 0x00, 0x3A, 0x8C, 0x00, 0x00, 0x74, 0x8C, 0x00,
+	0x00, 0xB6, 0x8C, 0x00, 0x00, 0xFC, 0x8C, 0x00, 0x00, 0x3C, 0x8D, 0x00,
+	0x00, 0x7E, 0x8D, 0x00, 0x00, 0xB4, 0x8D, 0x00, 0x00, 0x00, 0x8E, 0x00,
+	0x00, 0x3E, 0x8E, 0x00, 0x00, 0x88, 0x8E, 0x00, 0x00, 0xCE, 0x8E, 0x00,
+	0x00, 0x14, 0x8F, 0x00, 0x00, 0x54, 0x8F, 0x00, 0x00, 0x98, 0x8F, 0x00,
+	0x00, 0xDA, 0x8F, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x5A, 0x90, 0x00,
+	0x00, 0x9A, 0x90, 0x00, 0x00, 0xD6, 0x90, 0x00, 0x00, 0x02, 0x91, 0x00,
+	0x00, 0xDE, 0x84, 0x00, 0x00, 0xC4, 0x84, 0x00, 0x00, 0x8A, 0x84, 0x00,
+	0x00, 0x4E, 0x84, 0x00, 0x00, 0x38, 0x84, 0x00, 0x00, 0x18, 0x84, 0x00,
+	0x00, 0xF8, 0x83, 0x00, 0x00, 0x38, 0x8A, 0xEC, 0x00, 0xF0, 0x52, 0xDC,
+	0x91, 0x00, 0x00, 0xE6, 0x91, 0x00, 0x00, 0xF2, 0x91, 0x00, 0x00, 0xFC,
+	0x91, 0x00, 0x00, 0x04, 0x92, 0x00, 0x00, 0x0C, 0x92, 0x00, 0x00, 0x16,
+	0x92, 0x00, 0x00, 0x20, 0x92, 0x00, 0x00, 0x2A, 0x92, 0x00, 0x00, 0x34,
+	0x92, 0x00, 0x00, 0x42, 0x92, 0x00, 0x00, 0x52, 0x92, 0x00, 0x00, 0x5C,
+	0x92, 0x00, 0x00, 0x72, 0x92, 0x00, 0x00, 0x7E, 0x92, 0x00, 0x00, 0x8E,
+	0x92, 0x00, 0x00, 0x9A, 0x92, 0x00, 0x00, 0xA4, 0x92, 0x00, 0x00, 0xAE,
+	0x92, 0x00, 0x00, 0xB6, 0x92, 0x00, 0x00, 0xC0, 0x92, 0x00, 0x00, 0xDE,
+	0x92, 0x00, 0x00, 0xE6, 0x92, 0x00, 0x00, 0xF0, 0x92, 0x00, 0x00, 0xFE,
+	0x50, 0x00, 0xF6, 0x7E, 0x93, 0x00, 0x00, 0x16, 0x93, 0x00, 0x00, 0x2E,
+	0x93, 0x00, 0x00, 0x3C, 0x93, 0x00, 0x00, 0x4A, 0x93, 0x00, 0x00, 0x5A,
+	0x93, 0x00, 0x00, 0x6C, 0x93, 0x00, 0x00, 0x74, 0x93, 0x00, 0x00, 0x7C,
+	0x93, 0x00, 0x00, 0x86, 0x93, 0x00, 0x00, 0x9C, 0x93, 0x00, 0x00, 0xB0,
+	0x93, 0x00, 0x00, 0xBE, 0x93, 0x00, 0x00, 0xCA, 0x93, 0x00, 0x00, 0xD6,
+	0x93, 0x00, 0x00, 0xE0, 0x93, 0x00, 0x00, 0xEC, 0x93, 0x00, 0x00, 0x02,
+	0x94, 0x00, 0x00, 0x1C, 0x94, 0x00, 0x00, 0x34, 0x94, 0x00, 0x00, 0x4E,
+	0x94, 0x00, 0x00, 0x62, 0x94, 0x00, 0x00, 0x86, 0x94, 0x00, 0x00, 0x98,
+	0x94, 0x00, 0x00, 0xD2, 0x91, 0x00, 0x00, 0xC2, 0x91, 0x00, 0x00, 0xB8,
+	0x91, 0x00, 0x00, 0xAE, 0x91, 0x00, 0x00, 0x8C, 0x91, 0x00, 0x00, 0x6C,
+	0x91, 0x00, 0x00, 0x4E, 0x91, 0x00, 0x00, 0x34, 0x91, 0x00, 0x00, 0x2C,
+	0x91, 0x00, 0x00, 0x62, 0x95, 0x00, 0x00, 0x78, 0x95, 0x00, 0x00, 0x8E,
+	0x95, 0x0C, 0x02, 0xF2, 0x0B, 0x7D, 0x56, 0x40, 0x00, 0xCB, 0x62, 0x40,
+	0x00, 0x80, 0x62, 0x40, 0x00, 0x90, 0x62, 0x40, 0x00, 0xA0, 0x62, 0x40,
+	0x00, 0xB0, 0x62, 0x40, 0x00, 0xC0, 0x62, 0x62, 0x03, 0x00, 0x01, 0x00,
+	0xA6, 0xC4, 0x55, 0x40, 0x00, 0x72, 0x54, 0x40, 0x00, 0x11, 0x5B, 0x14,
+	0x00, 0x40, 0xC5, 0x04, 0x5C, 0x55, 0x08, 0x00, 0xEA, 0x02, 0x00, 0x00,
+	0x00, 0x6B, 0x00, 0x00, 0x00, 0x20, 0x76, 0x00, 0x00, 0x20, 0x5E, 0x1C,
+	0x00, 0x00, 0x60, 0x05, 0x00, 0xB4, 0x06, 0xF0, 0x29, 0x8C, 0x76, 0x00,
+	0x00, 0x8C, 0x5E, 0x00, 0x00, 0x9C, 0x76, 0x40, 0x00, 0x74, 0x55, 0x40,
+	0x00, 0xC8, 0xA3, 0x40, 0x00, 0x18, 0xA4, 0x40, 0x00, 0x67, 0x65, 0x6E,
+	0x65, 0x72, 0x69, 0x63, 0x00, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E,
+	0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x00, 0x00, 0x00, 0x69, 0x6F, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6D, 0x44, 0x00, 0x04, 0x0C, 0x00, 0x13, 0x20,
+	0x07, 0x00, 0x04, 0x24, 0x00, 0xF0, 0x2D, 0x73, 0x79, 0x73, 0x74, 0x65,
+	0x6D, 0x00, 0x00, 0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x66,
+	0x69, 0x6C, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x00, 0x65,
+	0x6E, 0x64, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x00, 0x64,
+	0x61, 0x74, 0x61, 0x20, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x52,
+	0x45, 0x41, 0x44, 0x41, 0x42, 0x4C, 0x45, 0x58, 0x00, 0x70, 0x63, 0x6F,
+	0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x00, 0x50, 0x65, 0x20, 0x74, 0x69,
+	0x6D, 0x20, 0x00, 0xB4, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x20, 0x72,
+	0x61, 0x74, 0x65, 0x0C, 0x00, 0x60, 0x70, 0x65, 0x72, 0x69, 0x6F, 0x64,
+	0x30, 0x00, 0xD0, 0x68, 0x00, 0x00, 0x4F, 0x75, 0x74, 0x70, 0x75, 0x74,
+	0x20, 0x46, 0x69, 0x6C, 0x66, 0x00, 0x47, 0x00, 0x00, 0x77, 0x00, 0x60,
+	0x00, 0x24, 0x2C, 0x20, 0x5F, 0x00, 0x17, 0x0A, 0x60, 0x00, 0x41, 0x2C,
+	0x20, 0x25, 0x73, 0x10, 0x00, 0x05, 0x68, 0x00, 0x05, 0x12, 0x00, 0xA0,
+	0x00, 0x00, 0x25, 0x73, 0x2C, 0x20, 0x73, 0x63, 0x61, 0x6C, 0x14, 0x00,
+	0x01, 0x18, 0x00, 0x90, 0x2F, 0x56, 0x2C, 0x20, 0x6F, 0x66, 0x66, 0x73,
+	0x65, 0x38, 0x00, 0x77, 0x65, 0x2C, 0x20, 0x56, 0x2C, 0x20, 0x63, 0x21,
+	0x00, 0x88, 0x56, 0x2F, 0x4C, 0x53, 0x42, 0x2C, 0x20, 0x63, 0x23, 0x00,
+	0x31, 0x4C, 0x53, 0x42, 0x4E, 0x00, 0x07, 0xBC, 0x00, 0x88, 0x2C, 0x20,
+	0x25, 0x64, 0x2C, 0x20, 0x48, 0x7A, 0x18, 0x00, 0x02, 0xC8, 0x00, 0x61,
+	0x2C, 0x20, 0x25, 0x66, 0x2C, 0x20, 0x7F, 0x00, 0x06, 0x24, 0x01, 0x20,
+	0x0A, 0x00, 0x97, 0x00, 0x40, 0x5B, 0x73, 0x5D, 0x2C, 0x30, 0x00, 0x5A,
+	0x20, 0x25, 0x73, 0x5B, 0x25, 0x0C, 0x00, 0x01, 0x48, 0x00, 0x80, 0x25,
+	0x66, 0x2C, 0x00, 0x25, 0x2E, 0x34, 0x65, 0x19, 0x00, 0x00, 0x08, 0x00,
+	0x00, 0x15, 0x00, 0xF5, 0x1C, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64,
+	0x20, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x3C, 0x54, 0x3E, 0x20, 0x73,
+	0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x00, 0x73, 0x74, 0x72,
+	0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6C, 0x6F, 0x6E, 0x67,
+	0x2C, 0x00, 0x03, 0x18, 0x00, 0x96, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69,
+	0x6F, 0x6E, 0x00, 0x3C, 0x00, 0x05, 0x2B, 0x00, 0x90, 0x00, 0x62, 0x61,
+	0x64, 0x20, 0x63, 0x61, 0x73, 0x74, 0x78, 0x00, 0xE3, 0x3C, 0x77, 0x40,
+	0x00, 0x89, 0x53, 0x40, 0x00, 0x7D, 0x53, 0x40, 0x00, 0x14, 0x54, 0x80,
+	0x02, 0xF2, 0x4A, 0x77, 0x40, 0x00, 0x20, 0x3E, 0x40, 0x00, 0x4A, 0x54,
+	0x40, 0x00, 0x44, 0x54, 0x40, 0x00, 0xB0, 0x2C, 0x40, 0x00, 0x90, 0x2E,
+	0x40, 0x00, 0x3E, 0x54, 0x40, 0x00, 0xF0, 0x2E, 0x40, 0x00, 0x38, 0x54,
+	0x40, 0x00, 0x32, 0x54, 0x40, 0x00, 0x2C, 0x54, 0x40, 0x00, 0x50, 0x2F,
+	0x40, 0x00, 0x20, 0x31, 0x40, 0x00, 0x26, 0x54, 0x40, 0x00, 0x20, 0x54,
+	0x40, 0x00, 0x1A, 0x54, 0x40, 0x00, 0x88, 0x78, 0x40, 0x00, 0x30, 0x10,
+	0x40, 0x00, 0xE0, 0x10, 0x40, 0x00, 0xF0, 0x10, 0x40, 0x00, 0x60, 0x10,
+	0x40, 0x00, 0xC0, 0x10, 0x40, 0x00, 0x80, 0x10, 0x60, 0x00, 0xF2, 0x03,
+	0x70, 0x00, 0x00, 0x00, 0xB8, 0x79, 0x40, 0x00, 0x75, 0x53, 0x40, 0x00,
+	0x9D, 0x53, 0x40, 0x00, 0x91, 0x53, 0x18, 0x00, 0x62, 0x68, 0x00, 0x00,
+	0x00, 0xAC, 0x7A, 0x3C, 0x00, 0xA6, 0xD0, 0x11, 0x40, 0x00, 0xE0, 0x11,
+	0x40, 0x00, 0x60, 0x12, 0x3C, 0x00, 0x22, 0x6C, 0x79, 0x1C, 0x00, 0x50,
+	0x70, 0x11, 0x40, 0x00, 0x80, 0x1C, 0x00, 0x0B, 0x58, 0x00, 0x53, 0x58,
+	0x00, 0x00, 0x00, 0x50, 0x24, 0x00, 0x22, 0x68, 0x55, 0x04, 0x00, 0x08,
+	0x24, 0x00, 0xF2, 0x07, 0xAC, 0x78, 0x40, 0x00, 0xB0, 0x3E, 0x40, 0x00,
+	0xA0, 0x34, 0x40, 0x00, 0xB0, 0x34, 0x40, 0x00, 0xC0, 0x34, 0x40, 0x00,
+	0x20, 0x37, 0xD8, 0x00, 0x66, 0xB0, 0x37, 0x40, 0x00, 0xF0, 0x37, 0xD8,
+	0x00, 0xFB, 0x06, 0xC0, 0x3A, 0x40, 0x00, 0xD0, 0x3B, 0x40, 0x00, 0xC0,
+	0x3C, 0x40, 0x00, 0x50, 0x3D, 0x40, 0x00, 0x80, 0x3D, 0x40, 0x00, 0x48,
+	0xE8, 0x05, 0x0F, 0x01, 0x00, 0x19, 0x90, 0x18, 0xA0, 0x40, 0x00, 0xB0,
+	0x7B, 0x40, 0x00, 0x12, 0x28, 0x03, 0xF0, 0x04, 0x53, 0x44, 0x53, 0x99,
+	0xE6, 0x94, 0xE5, 0x41, 0x68, 0xC9, 0x45, 0x94, 0x4A, 0x80, 0x6D, 0x46,
+	0xE7, 0x96, 0x05, 0xE8, 0x03, 0xFD, 0x2E, 0x43, 0x3A, 0x5C, 0x55, 0x73,
+	0x65, 0x72, 0x73, 0x5C, 0x53, 0x76, 0x65, 0x6E, 0x5C, 0x77, 0x6F, 0x72,
+	0x6B, 0x73, 0x70, 0x61, 0x63, 0x65, 0x5C, 0x53, 0x65, 0x6E, 0x69, 0x6F,
+	0x72, 0x44, 0x65, 0x73, 0x69, 0x67, 0x6E, 0x5C, 0x43, 0x6F, 0x6E, 0x73,
+	0x6F, 0x6C, 0x65, 0x43, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x72,
+	0x5C, 0x52, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x19, 0x00, 0x42, 0x2E,
+	0x70, 0x64, 0x62, 0x7C, 0x00, 0x13, 0x1A, 0x04, 0x00, 0x0D, 0x01, 0x00,
+	0x00, 0x94, 0x00, 0x16, 0x76, 0x74, 0x04, 0x94, 0x01, 0x00, 0x00, 0x00,
+	0xC0, 0x76, 0x40, 0x00, 0xC8, 0x14, 0x00, 0x16, 0xA0, 0x1C, 0x00, 0x22,
+	0xFF, 0xFF, 0xC3, 0x07, 0x00, 0x12, 0x00, 0x00, 0x34, 0x00, 0x22, 0xA8,
+	0xA2, 0x1C, 0x00, 0x1B, 0x08, 0x1C, 0x00, 0x26, 0x08, 0x79, 0x34, 0x00,
+	0x00, 0x01, 0x00, 0xFA, 0x0B, 0x58, 0xA2, 0x40, 0x00, 0x24, 0x7B, 0x40,
+	0x00, 0x34, 0x79, 0x40, 0x00, 0xB8, 0x77, 0x40, 0x00, 0x8C, 0x77, 0x40,
+	0x00, 0x5C, 0x78, 0x40, 0x00, 0xC0, 0x7A, 0x28, 0x00, 0x00, 0x7C, 0x00,
+	0x13, 0x64, 0x3C, 0x00, 0x00, 0x20, 0x02, 0x10, 0x04, 0x34, 0x01, 0x56,
+	0xA2, 0x40, 0x00, 0x9C, 0x78, 0x28, 0x00, 0x00, 0x24, 0x01, 0x6F, 0xD4,
+	0x79, 0x40, 0x00, 0x50, 0xA3, 0x98, 0x00, 0x03, 0x2A, 0x2C, 0x77, 0xCC,
+	0x00, 0x71, 0xCC, 0x79, 0x40, 0x00, 0xE0, 0xA1, 0x40, 0x38, 0x00, 0x04,
+	0x01, 0x00, 0x00, 0x58, 0x00, 0x57, 0x50, 0x00, 0x00, 0x00, 0x9C, 0x80,
+	0x00, 0x00, 0x14, 0x00, 0x9F, 0xD4, 0x77, 0x40, 0x00, 0xF4, 0xA0, 0x40,
+	0x00, 0x03, 0x58, 0x00, 0x00, 0x6F, 0x08, 0x7A, 0x40, 0x00, 0x80, 0x79,
+	0xBC, 0x00, 0x07, 0x00, 0x60, 0x00, 0x9F, 0x4C, 0x7A, 0x40, 0x00, 0x88,
+	0xA0, 0x40, 0x00, 0x09, 0x40, 0x00, 0x00, 0x53, 0xDC, 0x78, 0x40, 0x00,
+	0xC4, 0x30, 0x01, 0x0C, 0x1C, 0x00, 0x17, 0x7C, 0xB4, 0x00, 0x00, 0x7C,
+	0x00, 0x71, 0x78, 0x78, 0x40, 0x00, 0xA4, 0xA1, 0x40, 0xC0, 0x00, 0x0C,
+	0x2C, 0x00, 0x57, 0xE8, 0x77, 0x40, 0x00, 0x30, 0x1C, 0x00, 0x04, 0xBC,
+	0x00, 0x00, 0x1C, 0x00, 0xD7, 0x50, 0x77, 0x40, 0x00, 0x18, 0x7A, 0x40,
+	0x00, 0xEC, 0x78, 0x40, 0x00, 0x14, 0x34, 0x01, 0x04, 0x01, 0x00, 0x66,
+	0xE8, 0xA2, 0x40, 0x00, 0x60, 0x7B, 0x18, 0x00, 0x57, 0x05, 0x00, 0x00,
+	0x00, 0x14, 0x7C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x64,
+	0x00, 0x04, 0xDC, 0x01, 0x0C, 0x80, 0x00, 0x04, 0xDC, 0x01, 0x00, 0xA8,
+	0x00, 0x00, 0xA0, 0x04, 0x31, 0xDC, 0x7A, 0x40, 0x58, 0x00, 0x0F, 0xAC,
+	0x00, 0x01, 0x08, 0x6C, 0x00, 0x00, 0x20, 0x00, 0x57, 0x44, 0x7A, 0x40,
+	0x00, 0x4C, 0x8C, 0x01, 0x08, 0x2C, 0x00, 0x31, 0x34, 0x7A, 0x40, 0xEC,
+	0x01, 0x00, 0xCC, 0x00, 0x0C, 0x1C, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01,
+	0x00, 0x00, 0x48, 0x01, 0x00, 0x34, 0x01, 0x1B, 0x60, 0xBC, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x4C, 0x00, 0x2F, 0x14, 0xA3, 0xC8,
+	0x01, 0x03, 0x26, 0xA8, 0x77, 0x1C, 0x00, 0x00, 0x38, 0x07, 0x0C, 0x1C,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x84, 0x04, 0x00, 0x88, 0x00, 0x00, 0xCC,
+	0x01, 0x00, 0xB8, 0x01, 0x04, 0x4C, 0x01, 0x53, 0x34, 0x7B, 0x40, 0x00,
+	0xE4, 0x18, 0x03, 0x08, 0x54, 0x02, 0x09, 0xAC, 0x00, 0x5E, 0x7A, 0x40,
+	0x00, 0x84, 0x7B, 0x9C, 0x00, 0x00, 0x50, 0x00, 0x5F, 0x70, 0x7B, 0x40,
+	0x00, 0x78, 0x38, 0x00, 0x04, 0x17, 0x30, 0xE4, 0x00, 0x00, 0x9C, 0x00,
+	0x53, 0xA0, 0x7B, 0x40, 0x00, 0xC0, 0x14, 0x00, 0x26, 0x40, 0x78, 0x50,
+	0x00, 0x2E, 0x80, 0x7A, 0x44, 0x03, 0x1F, 0x9C, 0x98, 0x02, 0x00, 0x31,
+	0x2C, 0xA0, 0x40, 0x98, 0x03, 0x0C, 0x68, 0x00, 0x17, 0x14, 0x94, 0x01,
+	0x00, 0x68, 0x00, 0x17, 0x50, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0xA0,
+	0x00, 0x00, 0x8C, 0x00, 0x08, 0xDC, 0x03, 0x04, 0xC0, 0x00, 0x04, 0x00,
+	0x02, 0x3F, 0xF8, 0x77, 0x40, 0x88, 0x00, 0x16, 0x0C, 0x8C, 0x02, 0x00,
+	0x74, 0x00, 0x00, 0x20, 0x03, 0x17, 0x58, 0x40, 0x03, 0x00, 0x10, 0x01,
+	0x10, 0xFC, 0xB4, 0x05, 0x0F, 0xF4, 0x02, 0x04, 0x00, 0xD8, 0x02, 0x39,
+	0xE0, 0x79, 0x40, 0x80, 0x01, 0x08, 0x3C, 0x00, 0x2F, 0x08, 0x7B, 0x58,
+	0x04, 0x03, 0x00, 0x78, 0x04, 0x0F, 0x50, 0x00, 0x01, 0x00, 0x8C, 0x04,
+	0x2A, 0x18, 0x79, 0x28, 0x03, 0xF3, 0x36, 0xD9, 0x59, 0x00, 0x00, 0x80,
+	0x5E, 0x00, 0x00, 0xAD, 0x5E, 0x00, 0x00, 0xDD, 0x5E, 0x00, 0x00, 0x10,
+	0x5F, 0x00, 0x00, 0x39, 0x5F, 0x00, 0x00, 0x92, 0x5F, 0x00, 0x00, 0xE2,
+	0x5F, 0x00, 0x00, 0x08, 0x60, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x58,
+	0x60, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0xA8, 0x60, 0x00, 0x00, 0xD8,
+	0x60, 0x00, 0x00, 0x19, 0x61, 0x00, 0x00, 0x5D, 0x61, 0x00, 0x00, 0x98,
+	0x61, 0x00, 0x00, 0x44, 0x6C, 0x05, 0x08, 0x01, 0x00, 0x13, 0xFE, 0x78,
+	0x00, 0x13, 0xCC, 0x08, 0x00, 0x04, 0x10, 0x00, 0x22, 0x47, 0x55, 0x78,
+	0x00, 0x04, 0x10, 0x00, 0x17, 0xD4, 0x20, 0x00, 0x6F, 0xDD, 0x57, 0x40,
+	0x00, 0xF1, 0x57, 0x20, 0x00, 0x07, 0x00, 0x08, 0x00, 0x2A, 0x4F, 0x5A,
+	0x20, 0x00, 0x08, 0x60, 0x00, 0x5B, 0x8E, 0x5A, 0x40, 0x00, 0xB7, 0x20,
+	0x00, 0x17, 0xD8, 0x20, 0x00, 0x62, 0x09, 0x5C, 0x40, 0x00, 0x1C, 0x5C,
+	0x20, 0x00, 0x13, 0x60, 0xF0, 0x07, 0x22, 0xEC, 0x7C, 0x08, 0x00, 0x13,
+	0xD8, 0xF0, 0x05, 0x04, 0x30, 0x01, 0x53, 0x0C, 0x00, 0x00, 0x00, 0x6C,
+	0x24, 0x00, 0x1F, 0x68, 0x1C, 0x00, 0x00, 0x22, 0x66, 0x54, 0xD0, 0x02,
+	0xC0, 0xD0, 0x7C, 0x40, 0x00, 0xB4, 0x7C, 0x40, 0x00, 0x22, 0x05, 0x93,
+	0x19, 0x2C, 0x02, 0x22, 0x1C, 0x7D, 0x7C, 0x01, 0x2E, 0x3C, 0x7D, 0xE4,
+	0x05, 0x04, 0x40, 0x00, 0x00, 0x01, 0x00, 0x22, 0xA0, 0x5E, 0x28, 0x00,
+	0x39, 0xA5, 0x5E, 0x40, 0x18, 0x00, 0x00, 0x54, 0x00, 0x00, 0x2C, 0x02,
+	0x00, 0x1C, 0x00, 0x31, 0x50, 0x7D, 0x40, 0xB8, 0x01, 0x04, 0x01, 0x00,
+	0x26, 0xB9, 0x52, 0x68, 0x00, 0x13, 0x84, 0x68, 0x00, 0x1F, 0xA4, 0x68,
+	0x00, 0x05, 0x12, 0x5F, 0x58, 0x00, 0x26, 0x08, 0x5F, 0x0C, 0x02, 0x04,
+	0x08, 0x00, 0x00, 0x64, 0x00, 0x08, 0x68, 0x00, 0x1B, 0xB8, 0x68, 0x00,
+	0x22, 0xA3, 0x50, 0x68, 0x00, 0x00, 0x1C, 0x00, 0x1B, 0xEC, 0x60, 0x00,
+	0x0C, 0x68, 0x00, 0x22, 0x30, 0x5F, 0x2C, 0x00, 0x00, 0x50, 0x00, 0x2F,
+	0x18, 0x7E, 0x2C, 0x00, 0x0B, 0x22, 0xD0, 0x5E, 0x20, 0x00, 0x26, 0xD5,
+	0x5E, 0xC8, 0x00, 0x1F, 0x4C, 0x34, 0x00, 0x0C, 0x13, 0x70, 0x20, 0x01,
+	0x13, 0x78, 0x30, 0x01, 0x04, 0x1C, 0x00, 0x00, 0x01, 0x00, 0x04, 0x44,
+	0x00, 0x22, 0x90, 0x7E, 0x8C, 0x01, 0x1B, 0xB0, 0x4C, 0x00, 0x08, 0x74,
+	0x01, 0x04, 0x08, 0x00, 0x0F, 0x0C, 0x01, 0x0D, 0x17, 0xD8, 0x44, 0x00,
+	0x04, 0x14, 0x00, 0x2A, 0xE8, 0x7E, 0x20, 0x01, 0x2A, 0x31, 0x4B, 0x10,
+	0x00, 0x26, 0xF7, 0x4A, 0x30, 0x01, 0x2F, 0x1C, 0x7F, 0xD0, 0x00, 0x0B,
+	0x26, 0xA0, 0x60, 0x30, 0x01, 0x22, 0x48, 0x7F, 0xD4, 0x00, 0x1B, 0x58,
+	0x34, 0x00, 0x0F, 0xB8, 0x00, 0x01, 0x08, 0x1C, 0x00, 0x00, 0x04, 0x00,
+	0x2A, 0x6C, 0x7F, 0x84, 0x00, 0x26, 0x99, 0x47, 0x84, 0x00, 0x1F, 0xA0,
+	0x84, 0x00, 0x0C, 0x13, 0x50, 0x84, 0x00, 0x00, 0x10, 0x00, 0x1F, 0xCC,
+	0x2C, 0x00, 0x0C, 0x26, 0x90, 0x61, 0x2C, 0x00, 0x1F, 0xF8, 0x2C, 0x00,
+	0x0C, 0x13, 0xD0, 0x58, 0x00, 0x00, 0x38, 0x01, 0x2F, 0x24, 0x80, 0x2C,
+	0x00, 0x0B, 0x22, 0x60, 0x5F, 0x20, 0x00, 0x13, 0x7D, 0xA0, 0x02, 0x13,
+	0x89, 0x48, 0x02, 0x00, 0x3C, 0x00, 0x1F, 0x60, 0x3C, 0x00, 0x0C, 0x13,
+	0xB0, 0x3C, 0x00, 0x13, 0xCD, 0x3C, 0x00, 0x13, 0xD9, 0x3C, 0x00, 0x00,
+	0x0C, 0x00, 0x1F, 0x9C, 0x3C, 0x00, 0x0C, 0x22, 0x00, 0x60, 0x20, 0x00,
+	0x00, 0x30, 0x00, 0x00, 0xC8, 0x03, 0x1F, 0xD0, 0x30, 0x00, 0x08, 0x00,
+	0x01, 0x00, 0x00, 0x34, 0x00, 0x22, 0xC0, 0x61, 0x24, 0x00, 0x22, 0xCB,
+	0x61, 0x70, 0x00, 0x22, 0xD6, 0x61, 0x70, 0x02, 0x22, 0xE1, 0x61, 0x50,
+	0x07, 0x22, 0xEC, 0x61, 0xC0, 0x07, 0x50, 0xF7, 0x61, 0x40, 0x00, 0x05,
+	0x50, 0x02, 0x83, 0x62, 0x40, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0D, 0x08,
+	0x00, 0x22, 0x18, 0x62, 0x94, 0x06, 0x22, 0x23, 0x62, 0x30, 0x00, 0xA6,
+	0x2E, 0x62, 0x40, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x39, 0x62, 0xB8, 0x00,
+	0x2F, 0x54, 0x81, 0xB8, 0x00, 0x0C, 0x03, 0x88, 0x01, 0x00, 0x68, 0x00,
+	0x1F, 0x80, 0x2C, 0x00, 0x0C, 0x13, 0x40, 0xB0, 0x00, 0x13, 0x4B, 0xB0,
+	0x00, 0x13, 0x53, 0x08, 0x00, 0x66, 0x58, 0x61, 0x40, 0x00, 0x14, 0x82,
+	0x30, 0x00, 0xA6, 0x1E, 0x91, 0x00, 0x00, 0x24, 0x70, 0x00, 0x00, 0x00,
+	0x83, 0x14, 0x00, 0xA6, 0xD0, 0x92, 0x00, 0x00, 0x10, 0x71, 0x00, 0x00,
+	0xF0, 0x81, 0x14, 0x00, 0x20, 0x54, 0x95, 0xC5, 0x07, 0x0F, 0x73, 0x00,
+	0x02, 0xF2, 0x10, 0x00, 0xA8, 0x94, 0x00, 0x00, 0xC8, 0x94, 0x00, 0x00,
 	0xDC, 0x94, 0x00, 0x00, 0xF8, 0x94, 0x00, 0x00, 0x12, 0x95, 0x00, 0x00,
-	0x28, 0x95, 0x00, 0x00, 0x42, 0x95, 0x00, 0x00, 0xB8, 0x94, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x18, 0x85, 0x00, 0x00, 0x32, 0x85, 0x00, 0x00,
-	0x52, 0x85, 0x00, 0x00, 0x74, 0x85, 0x00, 0x00, 0xA8, 0x85, 0x00, 0x00,
-	0xCE, 0x85, 0x00, 0x00, 0xF6, 0x85, 0x00, 0x00, 0x3C, 0x86, 0x00, 0x00,
-	0x7A, 0x86, 0x00, 0x00, 0xC6, 0x86, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00,
-	0x3E, 0x87, 0x00, 0x00, 0x7E, 0x87, 0x00, 0x00, 0xBA, 0x87, 0x00, 0x00,
-	0xEC, 0x87, 0x00, 0x00, 0x56, 0x88, 0x00, 0x00, 0x96, 0x88, 0x00, 0x00,
-	0x00, 0x89, 0x00, 0x00, 0x36, 0x89, 0x00, 0x00, 0x72, 0x89, 0x00, 0x00,
-	0xB4, 0x89, 0x00, 0x00, 0xF8, 0x89, 0x00, 0x00, 0xFE, 0x84, 0x00, 0x00,
-	0x78, 0x8A, 0x00, 0x00, 0xAE, 0x8A, 0x00, 0x00, 0xE4, 0x8A, 0x00, 0x00,
-	0x1E, 0x8B, 0x00, 0x00, 0x68, 0x8B, 0x00, 0x00, 0xAE, 0x8B, 0x00, 0x00,
-	0xF4, 0x8B, 0x00, 0x00, 0x3A, 0x8C, 0x00, 0x00, 0x74, 0x8C, 0x00, 0x00,
-	0xB6, 0x8C, 0x00, 0x00, 0xFC, 0x8C, 0x00, 0x00, 0x3C, 0x8D, 0x00, 0x00,
-	0x7E, 0x8D, 0x00, 0x00, 0xB4, 0x8D, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00,
-	0x3E, 0x8E, 0x00, 0x00, 0x88, 0x8E, 0x00, 0x00, 0xCE, 0x8E, 0x00, 0x00,
-	0x14, 0x8F, 0x00, 0x00, 0x54, 0x8F, 0x00, 0x00, 0x98, 0x8F, 0x00, 0x00,
-	0xDA, 0x8F, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00,
-	0x9A, 0x90, 0x00, 0x00, 0xD6, 0x90, 0x00, 0x00, 0x02, 0x91, 0x00, 0x00,
-	0xDE, 0x84, 0x00, 0x00, 0xC4, 0x84, 0x00, 0x00, 0x8A, 0x84, 0x00, 0x00,
-	0x4E, 0x84, 0x00, 0x00, 0x38, 0x84, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00,
-	0xF8, 0x83, 0x00, 0x00, 0x38, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xDC, 0x91, 0x00, 0x00, 0xE6, 0x91, 0x00, 0x00, 0xF2, 0x91, 0x00, 0x00,
-	0xFC, 0x91, 0x00, 0x00, 0x04, 0x92, 0x00, 0x00, 0x0C, 0x92, 0x00, 0x00,
-	0x16, 0x92, 0x00, 0x00, 0x20, 0x92, 0x00, 0x00, 0x2A, 0x92, 0x00, 0x00,
-	0x34, 0x92, 0x00, 0x00, 0x42, 0x92, 0x00, 0x00, 0x52, 0x92, 0x00, 0x00,
-	0x5C, 0x92, 0x00, 0x00, 0x72, 0x92, 0x00, 0x00, 0x7E, 0x92, 0x00, 0x00,
-	0x8E, 0x92, 0x00, 0x00, 0x9A, 0x92, 0x00, 0x00, 0xA4, 0x92, 0x00, 0x00,
-	0xAE, 0x92, 0x00, 0x00, 0xB6, 0x92, 0x00, 0x00, 0xC0, 0x92, 0x00, 0x00,
-	0xDE, 0x92, 0x00, 0x00, 0xE6, 0x92, 0x00, 0x00, 0xF0, 0x92, 0x00, 0x00,
-	0xFE, 0x92, 0x00, 0x00, 0x0C, 0x93, 0x00, 0x00, 0x16, 0x93, 0x00, 0x00,
-	0x2E, 0x93, 0x00, 0x00, 0x3C, 0x93, 0x00, 0x00, 0x4A, 0x93, 0x00, 0x00,
-	0x5A, 0x93, 0x00, 0x00, 0x6C, 0x93, 0x00, 0x00, 0x74, 0x93, 0x00, 0x00,
-	0x7C, 0x93, 0x00, 0x00, 0x86, 0x93, 0x00, 0x00, 0x9C, 0x93, 0x00, 0x00,
-	0xB0, 0x93, 0x00, 0x00, 0xBE, 0x93, 0x00, 0x00, 0xCA, 0x93, 0x00, 0x00,
-	0xD6, 0x93, 0x00, 0x00, 0xE0, 0x93, 0x00, 0x00, 0xEC, 0x93, 0x00, 0x00,
-	0x02, 0x94, 0x00, 0x00, 0x1C, 0x94, 0x00, 0x00, 0x34, 0x94, 0x00, 0x00,
-	0x4E, 0x94, 0x00, 0x00, 0x62, 0x94, 0x00, 0x00, 0x86, 0x94, 0x00, 0x00,
-	0x98, 0x94, 0x00, 0x00, 0xD2, 0x91, 0x00, 0x00, 0xC2, 0x91, 0x00, 0x00,
-	0xB8, 0x91, 0x00, 0x00, 0xAE, 0x91, 0x00, 0x00, 0x8C, 0x91, 0x00, 0x00,
-	0x6C, 0x91, 0x00, 0x00, 0x4E, 0x91, 0x00, 0x00, 0x34, 0x91, 0x00, 0x00,
-	0x2C, 0x91, 0x00, 0x00, 0x62, 0x95, 0x00, 0x00, 0x78, 0x95, 0x00, 0x00,
-	0x8E, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x7D, 0x56, 0x40, 0x00, 0xCB, 0x62, 0x40, 0x00, 0x80, 0x62, 0x40, 0x00,
-	0x90, 0x62, 0x40, 0x00, 0xA0, 0x62, 0x40, 0x00, 0xB0, 0x62, 0x40, 0x00,
-	0xC0, 0x62, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xC4, 0x55, 0x40, 0x00, 0x72, 0x54, 0x40, 0x00, 0x11, 0x5B, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x04, 0x5C, 0x55,
-	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00,
-	0x20, 0x76, 0x00, 0x00, 0x20, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xC5, 0x04, 0x5C, 0x55, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
-	0x10, 0x00, 0x00, 0x00, 0x8C, 0x76, 0x00, 0x00, 0x8C, 0x5E, 0x00, 0x00,
-	0x9C, 0x76, 0x40, 0x00, 0x74, 0x55, 0x40, 0x00, 0xC8, 0xA3, 0x40, 0x00,
-	0x18, 0xA4, 0x40, 0x00, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x69, 0x63, 0x00,
-	0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F,
-	0x72, 0x00, 0x00, 0x00, 0x69, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D,
-	0x00, 0x00, 0x00, 0x00, 0x69, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D,
-	0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x20, 0x65, 0x72, 0x72, 0x6F,
-	0x72, 0x00, 0x00, 0x00, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x00, 0x00,
-	0x45, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65,
-	0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x00, 0x65, 0x6E, 0x64, 0x20,
-	0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x00, 0x64, 0x61, 0x74, 0x61,
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x52, 0x45, 0x41, 0x44,
-	0x41, 0x42, 0x4C, 0x45, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6F, 0x6D, 0x6D,
-	0x65, 0x6E, 0x74, 0x00, 0x64, 0x61, 0x74, 0x65, 0x20, 0x74, 0x69, 0x6D,
-	0x65, 0x00, 0x00, 0x00, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x20, 0x72,
-	0x61, 0x74, 0x65, 0x00, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x20, 0x70,
-	0x65, 0x72, 0x69, 0x6F, 0x64, 0x00, 0x00, 0x00, 0x63, 0x68, 0x00, 0x00,
-	0x4F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x3A,
-	0x20, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x64, 0x61, 0x74, 0x61,
-	0x20, 0x74, 0x79, 0x70, 0x65, 0x2C, 0x20, 0x52, 0x45, 0x41, 0x44, 0x41,
-	0x42, 0x4C, 0x45, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6F, 0x6D, 0x6D,
-	0x65, 0x6E, 0x74, 0x2C, 0x20, 0x25, 0x73, 0x0A, 0x00, 0x00, 0x00, 0x00,
-	0x64, 0x61, 0x74, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2C, 0x20, 0x25,
-	0x73, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x73, 0x2C, 0x20,
-	0x73, 0x63, 0x61, 0x6C, 0x65, 0x2C, 0x20, 0x25, 0x65, 0x2C, 0x20, 0x25,
-	0x73, 0x2F, 0x56, 0x2C, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2C,
-	0x20, 0x25, 0x65, 0x2C, 0x20, 0x56, 0x2C, 0x20, 0x63, 0x73, 0x63, 0x61,
-	0x6C, 0x65, 0x2C, 0x20, 0x25, 0x65, 0x2C, 0x20, 0x56, 0x2F, 0x4C, 0x53,
-	0x42, 0x2C, 0x20, 0x63, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2C, 0x20,
-	0x25, 0x65, 0x2C, 0x20, 0x4C, 0x53, 0x42, 0x0A, 0x00, 0x00, 0x00, 0x00,
-	0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x20, 0x72, 0x61, 0x74, 0x65, 0x2C,
-	0x20, 0x25, 0x64, 0x2C, 0x20, 0x48, 0x7A, 0x0A, 0x00, 0x00, 0x00, 0x00,
-	0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x20, 0x70, 0x65, 0x72, 0x69, 0x6F,
-	0x64, 0x2C, 0x20, 0x25, 0x66, 0x2C, 0x20, 0x73, 0x0A, 0x00, 0x00, 0x00,
-	0x65, 0x6E, 0x64, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x0A, 0x00,
-	0x74, 0x69, 0x6D, 0x65, 0x5B, 0x73, 0x5D, 0x2C, 0x00, 0x00, 0x00, 0x00,
-	0x20, 0x25, 0x73, 0x5B, 0x25, 0x73, 0x5D, 0x2C, 0x00, 0x00, 0x00, 0x00,
-	0x20, 0x25, 0x73, 0x5B, 0x25, 0x73, 0x5D, 0x0A, 0x00, 0x00, 0x00, 0x00,
-	0x25, 0x66, 0x2C, 0x00, 0x25, 0x2E, 0x34, 0x65, 0x2C, 0x00, 0x00, 0x00,
-	0x25, 0x2E, 0x34, 0x65, 0x0A, 0x00, 0x00, 0x00, 0x69, 0x6E, 0x76, 0x61,
-	0x6C, 0x69, 0x64, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x3C, 0x54,
-	0x3E, 0x20, 0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x00,
-	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6C,
-	0x6F, 0x6E, 0x67, 0x00, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20,
-	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74,
-	0x69, 0x6F, 0x6E, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x3C, 0x54,
-	0x3E, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x00, 0x00,
-	0x62, 0x61, 0x64, 0x20, 0x63, 0x61, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00,
-	0x3C, 0x77, 0x40, 0x00, 0x89, 0x53, 0x40, 0x00, 0x7D, 0x53, 0x40, 0x00,
-	0x14, 0x54, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x40, 0x00,
-	0x20, 0x3E, 0x40, 0x00, 0x4A, 0x54, 0x40, 0x00, 0x44, 0x54, 0x40, 0x00,
-	0xB0, 0x2C, 0x40, 0x00, 0x90, 0x2E, 0x40, 0x00, 0x3E, 0x54, 0x40, 0x00,
-	0xF0, 0x2E, 0x40, 0x00, 0x38, 0x54, 0x40, 0x00, 0x32, 0x54, 0x40, 0x00,
-	0x2C, 0x54, 0x40, 0x00, 0x50, 0x2F, 0x40, 0x00, 0x20, 0x31, 0x40, 0x00,
-	0x26, 0x54, 0x40, 0x00, 0x20, 0x54, 0x40, 0x00, 0x1A, 0x54, 0x40, 0x00,
-	0x88, 0x78, 0x40, 0x00, 0x30, 0x10, 0x40, 0x00, 0xE0, 0x10, 0x40, 0x00,
-	0xF0, 0x10, 0x40, 0x00, 0x60, 0x10, 0x40, 0x00, 0xC0, 0x10, 0x40, 0x00,
-	0x80, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-	0xB8, 0x79, 0x40, 0x00, 0x75, 0x53, 0x40, 0x00, 0x9D, 0x53, 0x40, 0x00,
-	0x91, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-	0xAC, 0x7A, 0x40, 0x00, 0x30, 0x10, 0x40, 0x00, 0xD0, 0x11, 0x40, 0x00,
-	0xE0, 0x11, 0x40, 0x00, 0x60, 0x12, 0x40, 0x00, 0xC0, 0x10, 0x40, 0x00,
-	0x80, 0x10, 0x40, 0x00, 0x6C, 0x79, 0x40, 0x00, 0x30, 0x10, 0x40, 0x00,
-	0x70, 0x11, 0x40, 0x00, 0x80, 0x11, 0x40, 0x00, 0x60, 0x10, 0x40, 0x00,
-	0xC0, 0x10, 0x40, 0x00, 0x80, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x58, 0x00, 0x00, 0x00, 0x50, 0x79, 0x40, 0x00, 0x30, 0x10, 0x40, 0x00,
-	0x68, 0x55, 0x40, 0x00, 0x68, 0x55, 0x40, 0x00, 0x60, 0x10, 0x40, 0x00,
-	0xC0, 0x10, 0x40, 0x00, 0x80, 0x10, 0x40, 0x00, 0xAC, 0x78, 0x40, 0x00,
-	0xB0, 0x3E, 0x40, 0x00, 0xA0, 0x34, 0x40, 0x00, 0xB0, 0x34, 0x40, 0x00,
-	0xC0, 0x34, 0x40, 0x00, 0x20, 0x37, 0x40, 0x00, 0x3E, 0x54, 0x40, 0x00,
-	0xB0, 0x37, 0x40, 0x00, 0xF0, 0x37, 0x40, 0x00, 0x32, 0x54, 0x40, 0x00,
-	0x2C, 0x54, 0x40, 0x00, 0xC0, 0x3A, 0x40, 0x00, 0xD0, 0x3B, 0x40, 0x00,
-	0xC0, 0x3C, 0x40, 0x00, 0x50, 0x3D, 0x40, 0x00, 0x80, 0x3D, 0x40, 0x00,
-	0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0xA0, 0x40, 0x00, 0xB0, 0x7B, 0x40, 0x00, 0x12, 0x00, 0x00, 0x00,
-	0x52, 0x53, 0x44, 0x53, 0x99, 0xE6, 0x94, 0xE5, 0x41, 0x68, 0xC9, 0x45,
-	0x94, 0x4A, 0x80, 0x6D, 0x46, 0xE7, 0x96, 0x05, 0x02, 0x00, 0x00, 0x00,
-	0x43, 0x3A, 0x5C, 0x55, 0x73, 0x65, 0x72, 0x73, 0x5C, 0x53, 0x76, 0x65,
-	0x6E, 0x5C, 0x77, 0x6F, 0x72, 0x6B, 0x73, 0x70, 0x61, 0x63, 0x65, 0x5C,
-	0x53, 0x65, 0x6E, 0x69, 0x6F, 0x72, 0x44, 0x65, 0x73, 0x69, 0x67, 0x6E,
-	0x5C, 0x43, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x43, 0x6F, 0x6E, 0x76,
-	0x65, 0x72, 0x74, 0x65, 0x72, 0x5C, 0x52, 0x65, 0x6C, 0x65, 0x61, 0x73,
-	0x65, 0x5C, 0x43, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x43, 0x6F, 0x6E,
-	0x76, 0x65, 0x72, 0x74, 0x65, 0x72, 0x2E, 0x70, 0x64, 0x62, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x40, 0x00, 0xB0, 0x76, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0xC0, 0x76, 0x40, 0x00, 0xC8, 0x76, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xA0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-	0xB0, 0x76, 0x40, 0x00, 0xA8, 0xA2, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x08, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0x08, 0x79, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xA2, 0x40, 0x00,
-	0x24, 0x7B, 0x40, 0x00, 0x34, 0x79, 0x40, 0x00, 0xB8, 0x77, 0x40, 0x00,
-	0x8C, 0x77, 0x40, 0x00, 0x5C, 0x78, 0x40, 0x00, 0xC0, 0x7A, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x64, 0x79, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x70, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x18, 0xA2, 0x40, 0x00,
-	0x9C, 0x78, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0xD4, 0x79, 0x40, 0x00, 0x50, 0xA3, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2C, 0x77, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0xCC, 0x79, 0x40, 0x00, 0xE0, 0xA1, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-	0x50, 0x00, 0x00, 0x00, 0x9C, 0x7A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xD4, 0x77, 0x40, 0x00,
-	0xF4, 0xA0, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-	0x08, 0x7A, 0x40, 0x00, 0x80, 0x79, 0x40, 0x00, 0x8C, 0x77, 0x40, 0x00,
-	0x5C, 0x78, 0x40, 0x00, 0xC0, 0x7A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x4C, 0x7A, 0x40, 0x00, 0x88, 0xA0, 0x40, 0x00, 0x09, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0xDC, 0x78, 0x40, 0x00, 0xC4, 0xA2, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x77, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0x78, 0x78, 0x40, 0x00, 0xA4, 0xA1, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0xE8, 0x77, 0x40, 0x00, 0x30, 0xA1, 0x40, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x77, 0x40, 0x00,
-	0x18, 0x7A, 0x40, 0x00, 0xEC, 0x78, 0x40, 0x00, 0x14, 0x78, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xE8, 0xA2, 0x40, 0x00, 0x60, 0x7B, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-	0x14, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xA4, 0xA1, 0x40, 0x00, 0xE8, 0x77, 0x40, 0x00,
-	0xA8, 0xA2, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-	0x08, 0x79, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0x0A, 0x00, 0x00, 0x00, 0xDC, 0x7A, 0x40, 0x00, 0xE8, 0xA2, 0x40, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x60, 0x7B, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x44, 0x7A, 0x40, 0x00, 0x4C, 0xA1, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0x34, 0x7A, 0x40, 0x00, 0x18, 0xA2, 0x40, 0x00,
-	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x9C, 0x78, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xC4, 0xA2, 0x40, 0x00, 0x7C, 0x77, 0x40, 0x00, 0x60, 0x77, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x4C, 0xA1, 0x40, 0x00, 0x34, 0x7A, 0x40, 0x00,
-	0x14, 0xA3, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-	0xA8, 0x77, 0x40, 0x00, 0x14, 0xA3, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0x10, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0xA8, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x88, 0xA0, 0x40, 0x00,
-	0xDC, 0x78, 0x40, 0x00, 0x14, 0x78, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x34, 0x7B, 0x40, 0x00, 0xE4, 0x76, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xE0, 0xA1, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-	0x9C, 0x7A, 0x40, 0x00, 0x84, 0x7B, 0x40, 0x00, 0x60, 0x77, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x04, 0x00, 0x00, 0x00, 0x70, 0x7B, 0x40, 0x00, 0x78, 0xA1, 0x40, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x30, 0x78, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0xA0, 0x7B, 0x40, 0x00, 0xC0, 0x78, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x78, 0x40, 0x00, 0x60, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x80, 0x7A, 0x40, 0x00, 0xB8, 0x77, 0x40, 0x00, 0x8C, 0x77, 0x40, 0x00,
-	0x5C, 0x78, 0x40, 0x00, 0xC0, 0x7A, 0x40, 0x00, 0x9C, 0x79, 0x40, 0x00,
-	0x8C, 0x77, 0x40, 0x00, 0x5C, 0x78, 0x40, 0x00, 0xC0, 0x7A, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x2C, 0xA0, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0x14, 0x7B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x50, 0x7B, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x78, 0xA1, 0x40, 0x00, 0x30, 0x78, 0x40, 0x00, 0xA8, 0xA2, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x08, 0x79, 0x40, 0x00,
-	0xF8, 0x77, 0x40, 0x00, 0x80, 0x7A, 0x40, 0x00, 0xB8, 0x77, 0x40, 0x00,
-	0x8C, 0x77, 0x40, 0x00, 0x5C, 0x78, 0x40, 0x00, 0xC0, 0x7A, 0x40, 0x00,
-	0x9C, 0x79, 0x40, 0x00, 0x8C, 0x77, 0x40, 0x00, 0x5C, 0x78, 0x40, 0x00,
-	0xC0, 0x7A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x78, 0x40, 0x00,
-	0x14, 0x78, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x58, 0x7A, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0xFC, 0x79, 0x40, 0x00, 0x30, 0xA1, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0x50, 0x77, 0x40, 0x00, 0xE0, 0x79, 0x40, 0x00,
-	0x34, 0x7B, 0x40, 0x00, 0xE4, 0x76, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x08, 0x7B, 0x40, 0x00, 0xB8, 0x77, 0x40, 0x00, 0x8C, 0x77, 0x40, 0x00,
-	0x5C, 0x78, 0x40, 0x00, 0xC0, 0x7A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x58, 0xA2, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-	0x24, 0x7B, 0x40, 0x00, 0x18, 0x79, 0x40, 0x00, 0xEC, 0x78, 0x40, 0x00,
-	0x14, 0x78, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x59, 0x00, 0x00,
-	0x80, 0x5E, 0x00, 0x00, 0xAD, 0x5E, 0x00, 0x00, 0xDD, 0x5E, 0x00, 0x00,
-	0x10, 0x5F, 0x00, 0x00, 0x39, 0x5F, 0x00, 0x00, 0x92, 0x5F, 0x00, 0x00,
-	0xE2, 0x5F, 0x00, 0x00, 0x08, 0x60, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00,
-	0x58, 0x60, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0xA8, 0x60, 0x00, 0x00,
-	0xD8, 0x60, 0x00, 0x00, 0x19, 0x61, 0x00, 0x00, 0x5D, 0x61, 0x00, 0x00,
-	0x98, 0x61, 0x00, 0x00, 0x44, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x47, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0xFE, 0xFF, 0xFF, 0xFF, 0xDD, 0x57, 0x40, 0x00, 0xF1, 0x57, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0xD4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x4F, 0x5A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x8E, 0x5A, 0x40, 0x00,
-	0xB7, 0x5A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0xFE, 0xFF, 0xFF, 0xFF, 0x09, 0x5C, 0x40, 0x00, 0x1C, 0x5C, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x60, 0x54, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xEC, 0x7C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xA0, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0x0C, 0x00, 0x00, 0x00, 0x6C, 0x54, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x68, 0xA0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x66, 0x54, 0x40, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0xD0, 0x7C, 0x40, 0x00, 0xB4, 0x7C, 0x40, 0x00,
-	0x22, 0x05, 0x93, 0x19, 0x04, 0x00, 0x00, 0x00, 0x1C, 0x7D, 0x40, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x3C, 0x7D, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xA0, 0x5E, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0xA5, 0x5E, 0x40, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x50, 0x7D, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xB9, 0x52, 0x40, 0x00, 0x22, 0x05, 0x93, 0x19,
-	0x04, 0x00, 0x00, 0x00, 0x84, 0x7D, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0xA4, 0x7D, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x5F, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x5F, 0x40, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x7D, 0x40, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xA3, 0x50, 0x40, 0x00, 0x22, 0x05, 0x93, 0x19, 0x01, 0x00, 0x00, 0x00,
-	0xEC, 0x7D, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x5F, 0x40, 0x00,
-	0x22, 0x05, 0x93, 0x19, 0x02, 0x00, 0x00, 0x00, 0x18, 0x7E, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x5E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xD5, 0x5E, 0x40, 0x00, 0x22, 0x05, 0x93, 0x19, 0x04, 0x00, 0x00, 0x00,
-	0x4C, 0x7E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x5E, 0x40, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x5E, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x22, 0x05, 0x93, 0x19, 0x04, 0x00, 0x00, 0x00, 0x90, 0x7E, 0x40, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0xB0, 0x7E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0xD8, 0x7E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x7E, 0x40, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x31, 0x4B, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xF7, 0x4A, 0x40, 0x00, 0x22, 0x05, 0x93, 0x19,
-	0x01, 0x00, 0x00, 0x00, 0x1C, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xA0, 0x60, 0x40, 0x00, 0x22, 0x05, 0x93, 0x19, 0x02, 0x00, 0x00, 0x00,
-	0x48, 0x7F, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x58, 0x7F, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x6C, 0x7F, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x99, 0x47, 0x40, 0x00, 0x22, 0x05, 0x93, 0x19,
-	0x01, 0x00, 0x00, 0x00, 0xA0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x50, 0x60, 0x40, 0x00, 0x22, 0x05, 0x93, 0x19, 0x01, 0x00, 0x00, 0x00,
-	0xCC, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x61, 0x40, 0x00,
-	0x22, 0x05, 0x93, 0x19, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x60, 0x40, 0x00, 0x22, 0x05, 0x93, 0x19,
-	0x03, 0x00, 0x00, 0x00, 0x24, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x60, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x5F, 0x40, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x89, 0x5F, 0x40, 0x00, 0x22, 0x05, 0x93, 0x19,
-	0x03, 0x00, 0x00, 0x00, 0x60, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0xB0, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x5F, 0x40, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0xD9, 0x5F, 0x40, 0x00, 0x22, 0x05, 0x93, 0x19,
-	0x01, 0x00, 0x00, 0x00, 0x9C, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x00, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x05, 0x93, 0x19,
-	0x0C, 0x00, 0x00, 0x00, 0xD0, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x61, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xCB, 0x61, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0xD6, 0x61, 0x40, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0xE1, 0x61, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0xEC, 0x61, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF7, 0x61, 0x40, 0x00,
-	0x05, 0x00, 0x00, 0x00, 0x02, 0x62, 0x40, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0x0D, 0x62, 0x40, 0x00, 0x06, 0x00, 0x00, 0x00, 0x18, 0x62, 0x40, 0x00,
-	0x08, 0x00, 0x00, 0x00, 0x23, 0x62, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0x2E, 0x62, 0x40, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x39, 0x62, 0x40, 0x00,
-	0x22, 0x05, 0x93, 0x19, 0x01, 0x00, 0x00, 0x00, 0x54, 0x81, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0x40, 0x00, 0x22, 0x05, 0x93, 0x19,
-	0x04, 0x00, 0x00, 0x00, 0x80, 0x81, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-	0x40, 0x61, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x61, 0x40, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x53, 0x61, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x58, 0x61, 0x40, 0x00, 0x14, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x1E, 0x91, 0x00, 0x00, 0x24, 0x70, 0x00, 0x00,
-	0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xD0, 0x92, 0x00, 0x00, 0x10, 0x71, 0x00, 0x00, 0xF0, 0x81, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x95, 0x00, 0x00,
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xA8, 0x94, 0x00, 0x00, 0xC8, 0x94, 0x00, 0x00, 0xDC, 0x94, 0x00, 0x00,
-	0xF8, 0x94, 0x00, 0x00, 0x12, 0x95, 0x00, 0x00, 0x28, 0x95, 0x00, 0x00,
-	0x42, 0x95, 0x00, 0x00, 0xB8, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x85, 0x00, 0x00, 0x32, 0x85, 0x00, 0x00, 0x52, 0x85, 0x00, 0x00,
-	0x74, 0x85, 0x00, 0x00, 0xA8, 0x85, 0x00, 0x00, 0xCE, 0x85, 0x00, 0x00,
-	0xF6, 0x85, 0x00, 0x00, 0x3C, 0x86, 0x00, 0x00, 0x7A, 0x86, 0x00, 0x00,
-	0xC6, 0x86, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x3E, 0x87, 0x00, 0x00,
-	0x7E, 0x87, 0x00, 0x00, 0xBA, 0x87, 0x00, 0x00, 0xEC, 0x87, 0x00, 0x00,
-	0x56, 0x88, 0x00, 0x00, 0x96, 0x88, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00,
-	0x36, 0x89, 0x00, 0x00, 0x72, 0x89, 0x00, 0x00, 0xB4, 0x89, 0x00, 0x00,
-	0xF8, 0x89, 0x00, 0x00, 0xFE, 0x84, 0x00, 0x00, 0x78, 0x8A, 0x00, 0x00,
-	0xAE, 0x8A, 0x00, 0x00, 0xE4, 0x8A, 0x00, 0x00, 0x1E, 0x8B, 0x00, 0x00,
-	0x68, 0x8B, 0x00, 0x00, 0xAE, 0x8B, 0x00, 0x00, 0xF4, 0x8B, 0x00, 0x00,
-	0x3A, 0x8C, 0x00, 0x00, 0x74, 0x8C, 0x00, 0x00, 0xB6, 0x8C, 0x00, 0x00,
-	0xFC, 0x8C, 0x00, 0x00, 0x3C, 0x8D, 0x00, 0x00, 0x7E, 0x8D, 0x00, 0x00,
-	0xB4, 0x8D, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x3E, 0x8E, 0x00, 0x00,
-	0x88, 0x8E, 0x00, 0x00, 0xCE, 0x8E, 0x00, 0x00, 0x14, 0x8F, 0x00, 0x00,
-	0x54, 0x8F, 0x00, 0x00, 0x98, 0x8F, 0x00, 0x00, 0xDA, 0x8F, 0x00, 0x00,
-	0x1A, 0x90, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x9A, 0x90, 0x00, 0x00,
-	0xD6, 0x90, 0x00, 0x00, 0x02, 0x91, 0x00, 0x00, 0xDE, 0x84, 0x00, 0x00,
-	0xC4, 0x84, 0x00, 0x00, 0x8A, 0x84, 0x00, 0x00, 0x4E, 0x84, 0x00, 0x00,
-	0x38, 0x84, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0xF8, 0x83, 0x00, 0x00,
-	0x38, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x91, 0x00, 0x00,
+	0x28, 0x95, 0x00, 0x00, 0x42, 0x95, 0x00, 0x00, 0xB8, 0x94, 0x24, 0x00,
+	0xF0, 0x33, 0x18, 0x85, 0x00, 0x00, 0x32, 0x85, 0x00, 0x00, 0x52, 0x85,
+	0x00, 0x00, 0x74, 0x85, 0x00, 0x00, 0xA8, 0x85, 0x00, 0x00, 0xCE, 0x85,
+	0x00, 0x00, 0xF6, 0x85, 0x00, 0x00, 0x3C, 0x86, 0x00, 0x00, 0x7A, 0x86,
+	0x00, 0x00, 0xC6, 0x86, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x3E, 0x87,
+	0x00, 0x00, 0x7E, 0x87, 0x00, 0x00, 0xBA, 0x87, 0x00, 0x00, 0xEC, 0x87,
+	0x00, 0x00, 0x56, 0x88, 0x00, 0x00, 0x96, 0x88, 0x21, 0x02, 0xF2, 0x91,
+	0x00, 0x00, 0x36, 0x89, 0x00, 0x00, 0x72, 0x89, 0x00, 0x00, 0xB4, 0x89,
+	0x00, 0x00, 0xF8, 0x89, 0x00, 0x00, 0xFE, 0x84, 0x00, 0x00, 0x78, 0x8A,
+	0x00, 0x00, 0xAE, 0x8A, 0x00, 0x00, 0xE4, 0x8A, 0x00, 0x00, 0x1E, 0x8B,
+	0x00, 0x00, 0x68, 0x8B, 0x00, 0x00, 0xAE, 0x8B, 0x00, 0x00, 0xF4, 0x8B,
+	0x00, 0x00, 0x3A, 0x8C, 0x00, 0x00, 0x74, 0x8C, 0x00, 0x00, 0xB6, 0x8C,
+	0x00, 0x00, 0xFC, 0x8C, 0x00, 0x00, 0x3C, 0x8D, 0x00, 0x00, 0x7E, 0x8D,
+	0x00, 0x00, 0xB4, 0x8D, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x3E, 0x8E,
+	0x00, 0x00, 0x88, 0x8E, 0x00, 0x00, 0xCE, 0x8E, 0x00, 0x00, 0x14, 0x8F,
+	0x00, 0x00, 0x54, 0x8F, 0x00, 0x00, 0x98, 0x8F, 0x00, 0x00, 0xDA, 0x8F,
+	0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x9A, 0x90,
+	0x00, 0x00, 0xD6, 0x90, 0x00, 0x00, 0x02, 0x91, 0x00, 0x00, 0xDE, 0x84,
+	0x00, 0x00, 0xC4, 0x84, 0x00, 0x00, 0x8A, 0x84, 0x00, 0x00, 0x4E, 0x84,
+	0x00, 0x00, 0x38, 0x84, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0xF8, 0x83,
+	0x00, 0x00, 0x38, 0x8A, 0xEC, 0x00, 0xF0, 0x52, 0xDC, 0x91, 0x00, 0x00,
 	0xE6, 0x91, 0x00, 0x00, 0xF2, 0x91, 0x00, 0x00, 0xFC, 0x91, 0x00, 0x00,
 	0x04, 0x92, 0x00, 0x00, 0x0C, 0x92, 0x00, 0x00, 0x16, 0x92, 0x00, 0x00,
 	0x20, 0x92, 0x00, 0x00, 0x2A, 0x92, 0x00, 0x00, 0x34, 0x92, 0x00, 0x00,
@@ -2385,8 +1743,8 @@ const uint8_t consoleConverterBinary[37376] = {
 	0x72, 0x92, 0x00, 0x00, 0x7E, 0x92, 0x00, 0x00, 0x8E, 0x92, 0x00, 0x00,
 	0x9A, 0x92, 0x00, 0x00, 0xA4, 0x92, 0x00, 0x00, 0xAE, 0x92, 0x00, 0x00,
 	0xB6, 0x92, 0x00, 0x00, 0xC0, 0x92, 0x00, 0x00, 0xDE, 0x92, 0x00, 0x00,
-	0xE6, 0x92, 0x00, 0x00, 0xF0, 0x92, 0x00, 0x00, 0xFE, 0x92, 0x00, 0x00,
-	0x0C, 0x93, 0x00, 0x00, 0x16, 0x93, 0x00, 0x00, 0x2E, 0x93, 0x00, 0x00,
+	0xE6, 0x92, 0x00, 0x00, 0xF0, 0x92, 0x00, 0x00, 0xFE, 0x50, 0x00, 0xF0,
+	0x7D, 0x93, 0x00, 0x00, 0x16, 0x93, 0x00, 0x00, 0x2E, 0x93, 0x00, 0x00,
 	0x3C, 0x93, 0x00, 0x00, 0x4A, 0x93, 0x00, 0x00, 0x5A, 0x93, 0x00, 0x00,
 	0x6C, 0x93, 0x00, 0x00, 0x74, 0x93, 0x00, 0x00, 0x7C, 0x93, 0x00, 0x00,
 	0x86, 0x93, 0x00, 0x00, 0x9C, 0x93, 0x00, 0x00, 0xB0, 0x93, 0x00, 0x00,
@@ -2397,557 +1755,264 @@ const uint8_t consoleConverterBinary[37376] = {
 	0xD2, 0x91, 0x00, 0x00, 0xC2, 0x91, 0x00, 0x00, 0xB8, 0x91, 0x00, 0x00,
 	0xAE, 0x91, 0x00, 0x00, 0x8C, 0x91, 0x00, 0x00, 0x6C, 0x91, 0x00, 0x00,
 	0x4E, 0x91, 0x00, 0x00, 0x34, 0x91, 0x00, 0x00, 0x2C, 0x91, 0x00, 0x00,
-	0x62, 0x95, 0x00, 0x00, 0x78, 0x95, 0x00, 0x00, 0x8E, 0x95, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xD3, 0x02, 0x3F, 0x5F, 0x57, 0x69, 0x6E, 0x65,
+	0x62, 0x95, 0x00, 0x00, 0x78, 0x95, 0x00, 0x00, 0x8E, 0x1C, 0x02, 0xFF,
+	0x1B, 0x00, 0x00, 0x00, 0xD3, 0x02, 0x3F, 0x5F, 0x57, 0x69, 0x6E, 0x65,
 	0x72, 0x72, 0x6F, 0x72, 0x5F, 0x6D, 0x61, 0x70, 0x40, 0x73, 0x74, 0x64,
 	0x40, 0x40, 0x59, 0x41, 0x50, 0x42, 0x44, 0x48, 0x40, 0x5A, 0x00, 0x00,
-	0xBE, 0x02, 0x3F, 0x5F, 0x53, 0x79, 0x73, 0x65, 0x72, 0x72, 0x6F, 0x72,
-	0x5F, 0x6D, 0x61, 0x70, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x59, 0x41,
-	0x50, 0x42, 0x44, 0x48, 0x40, 0x5A, 0x00, 0x00, 0xB2, 0x01, 0x3F, 0x5F,
-	0x42, 0x41, 0x44, 0x4F, 0x46, 0x46, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
+	0xBE, 0x02, 0x3F, 0x5F, 0x53, 0x79, 0x73, 0x20, 0x00, 0x06, 0xA2, 0xB2,
+	0x01, 0x3F, 0x5F, 0x42, 0x41, 0x44, 0x4F, 0x46, 0x46, 0x1A, 0x00, 0xD3,
 	0x33, 0x5F, 0x4A, 0x42, 0x00, 0x00, 0xF7, 0x02, 0x3F, 0x63, 0x6F, 0x75,
-	0x74, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x33, 0x56, 0x3F, 0x24, 0x62,
-	0x61, 0x73, 0x69, 0x63, 0x5F, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D,
-	0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72,
-	0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x40, 0x31, 0x40, 0x41, 0x00, 0x00, 0xE6, 0x02, 0x3F, 0x63, 0x69, 0x6E,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x33, 0x56, 0x3F, 0x24, 0x62, 0x61,
-	0x73, 0x69, 0x63, 0x5F, 0x69, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x40,
-	0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61,
-	0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40,
-	0x31, 0x40, 0x41, 0x00, 0xD7, 0x02, 0x3F, 0x5F, 0x58, 0x62, 0x61, 0x64,
-	0x5F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x59, 0x41, 0x58, 0x58, 0x5A, 0x00, 0xDB, 0x02, 0x3F, 0x5F, 0x58, 0x6F,
-	0x75, 0x74, 0x5F, 0x6F, 0x66, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x59, 0x41, 0x58, 0x50, 0x42, 0x44, 0x40,
-	0x5A, 0x00, 0xA5, 0x00, 0x3F, 0x3F, 0x31, 0x5F, 0x4C, 0x6F, 0x63, 0x6B,
-	0x69, 0x74, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x41, 0x45, 0x40,
-	0x58, 0x5A, 0x00, 0x00, 0x66, 0x00, 0x3F, 0x3F, 0x30, 0x5F, 0x4C, 0x6F,
-	0x63, 0x6B, 0x69, 0x74, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x41,
-	0x45, 0x40, 0x48, 0x40, 0x5A, 0x00, 0xDA, 0x02, 0x3F, 0x5F, 0x58, 0x6C,
-	0x65, 0x6E, 0x67, 0x74, 0x68, 0x5F, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x59, 0x41, 0x58, 0x50, 0x42, 0x44, 0x40,
-	0x5A, 0x00, 0x5C, 0x05, 0x3F, 0x75, 0x6E, 0x63, 0x61, 0x75, 0x67, 0x68,
-	0x74, 0x5F, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x59, 0x41, 0x5F, 0x4E, 0x58, 0x5A, 0x00,
-	0xFB, 0x01, 0x3F, 0x5F, 0x47, 0x65, 0x74, 0x67, 0x6C, 0x6F, 0x62, 0x61,
-	0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x65, 0x40, 0x6C, 0x6F, 0x63, 0x61,
-	0x6C, 0x65, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x43, 0x41, 0x50, 0x41,
-	0x56, 0x5F, 0x4C, 0x6F, 0x63, 0x69, 0x6D, 0x70, 0x40, 0x31, 0x32, 0x40,
-	0x58, 0x5A, 0x00, 0x00, 0xCE, 0x01, 0x3F, 0x5F, 0x46, 0x69, 0x6F, 0x70,
-	0x65, 0x6E, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x59, 0x41, 0x50, 0x41,
-	0x55, 0x5F, 0x69, 0x6F, 0x62, 0x75, 0x66, 0x40, 0x40, 0x50, 0x42, 0x44,
-	0x48, 0x48, 0x40, 0x5A, 0x00, 0x00, 0x07, 0x04, 0x3F, 0x69, 0x64, 0x40,
-	0x3F, 0x24, 0x63, 0x6F, 0x64, 0x65, 0x63, 0x76, 0x74, 0x40, 0x44, 0x44,
-	0x48, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x32, 0x56, 0x30, 0x6C, 0x6F,
-	0x63, 0x61, 0x6C, 0x65, 0x40, 0x32, 0x40, 0x41, 0x00, 0x00, 0x1B, 0x05,
-	0x3F, 0x73, 0x70, 0x75, 0x74, 0x6E, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73,
-	0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66,
-	0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72,
-	0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x41, 0x45, 0x5F, 0x4A, 0x50,
-	0x42, 0x44, 0x5F, 0x4A, 0x40, 0x5A, 0x00, 0x00, 0xD9, 0x01, 0x3F, 0x5F,
-	0x47, 0x65, 0x74, 0x63, 0x61, 0x74, 0x40, 0x3F, 0x24, 0x63, 0x6F, 0x64,
-	0x65, 0x63, 0x76, 0x74, 0x40, 0x44, 0x44, 0x48, 0x40, 0x73, 0x74, 0x64,
-	0x40, 0x40, 0x53, 0x41, 0x49, 0x50, 0x41, 0x50, 0x42, 0x56, 0x66, 0x61,
-	0x63, 0x65, 0x74, 0x40, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x65, 0x40, 0x32,
-	0x40, 0x50, 0x42, 0x56, 0x34, 0x32, 0x40, 0x40, 0x5A, 0x00, 0xFE, 0x03,
-	0x3F, 0x67, 0x65, 0x74, 0x6C, 0x6F, 0x63, 0x40, 0x3F, 0x24, 0x62, 0x61,
-	0x73, 0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75,
-	0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74,
-	0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40,
-	0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x42, 0x45, 0x3F, 0x41,
-	0x56, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x65, 0x40, 0x32, 0x40, 0x58, 0x5A,
-	0x00, 0x00, 0x84, 0x02, 0x3F, 0x5F, 0x4F, 0x73, 0x66, 0x78, 0x40, 0x3F,
-	0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x6F, 0x73, 0x74, 0x72, 0x65,
-	0x61, 0x6D, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F,
-	0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64,
-	0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x41, 0x45, 0x58,
-	0x58, 0x5A, 0x00, 0x00, 0x72, 0x05, 0x3F, 0x77, 0x69, 0x64, 0x65, 0x6E,
-	0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x69, 0x6F, 0x73,
-	0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72,
-	0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x42, 0x45, 0x44, 0x44, 0x40,
-	0x5A, 0x00, 0x1C, 0x02, 0x3F, 0x5F, 0x49, 0x6E, 0x69, 0x74, 0x40, 0x3F,
-	0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61,
-	0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61,
-	0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73,
-	0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x49, 0x41,
-	0x45, 0x58, 0x58, 0x5A, 0x00, 0x00, 0x2A, 0x00, 0x3F, 0x3F, 0x30, 0x3F,
-	0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61,
-	0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61,
-	0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73,
-	0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x49, 0x41,
-	0x45, 0x40, 0x58, 0x5A, 0x00, 0x00, 0x64, 0x05, 0x3F, 0x75, 0x6E, 0x73,
-	0x68, 0x69, 0x66, 0x74, 0x40, 0x3F, 0x24, 0x63, 0x6F, 0x64, 0x65, 0x63,
-	0x76, 0x74, 0x40, 0x44, 0x44, 0x48, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x51, 0x42, 0x45, 0x48, 0x41, 0x41, 0x48, 0x50, 0x41, 0x44, 0x31, 0x41,
-	0x41, 0x50, 0x41, 0x44, 0x40, 0x5A, 0x00, 0x00, 0x0E, 0x00, 0x3F, 0x3F,
-	0x30, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x69, 0x6F, 0x73,
-	0x74, 0x72, 0x65, 0x61, 0x6D, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68,
-	0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51,
-	0x41, 0x45, 0x40, 0x50, 0x41, 0x56, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69,
-	0x63, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x40,
-	0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61,
-	0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40,
-	0x31, 0x40, 0x40, 0x5A, 0x00, 0x00, 0x52, 0x02, 0x3F, 0x5F, 0x49, 0x70,
-	0x66, 0x78, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x69,
-	0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63,
-	0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x51, 0x41, 0x45, 0x5F, 0x4E, 0x5F, 0x4E, 0x40, 0x5A, 0x00, 0x15, 0x00,
-	0x3F, 0x3F, 0x30, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x69,
-	0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63,
-	0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x51, 0x41, 0x45, 0x40, 0x50, 0x41, 0x56, 0x3F, 0x24, 0x62, 0x61, 0x73,
-	0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66,
-	0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72,
-	0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x40, 0x31, 0x40, 0x5F, 0x4E, 0x40, 0x5A, 0x00, 0x07, 0x00, 0x3F, 0x3F,
-	0x30, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x69, 0x6F, 0x73,
-	0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72,
-	0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x49, 0x41, 0x45, 0x40, 0x58, 0x5A,
-	0x00, 0x00, 0xE9, 0x02, 0x3F, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x40, 0x3F,
-	0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x69, 0x6F, 0x73, 0x40, 0x44,
-	0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69,
-	0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73,
-	0x74, 0x64, 0x40, 0x40, 0x51, 0x41, 0x45, 0x58, 0x48, 0x5F, 0x4E, 0x40,
-	0x5A, 0x00, 0x8A, 0x02, 0x3F, 0x5F, 0x50, 0x6E, 0x69, 0x6E, 0x63, 0x40,
-	0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x65,
-	0x61, 0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68,
-	0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x49,
-	0x41, 0x45, 0x50, 0x41, 0x44, 0x58, 0x5A, 0x00, 0xF4, 0x04, 0x3F, 0x73,
-	0x65, 0x74, 0x67, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F,
-	0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55,
-	0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74,
-	0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74,
-	0x64, 0x40, 0x40, 0x49, 0x41, 0x45, 0x58, 0x50, 0x41, 0x44, 0x30, 0x30,
-	0x40, 0x5A, 0x00, 0x00, 0x18, 0x05, 0x3F, 0x73, 0x70, 0x75, 0x74, 0x63,
-	0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73, 0x74, 0x72,
-	0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63,
-	0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x51, 0x41, 0x45, 0x48, 0x44, 0x40, 0x5A, 0x00, 0xCF, 0x04, 0x3F, 0x73,
-	0x62, 0x75, 0x6D, 0x70, 0x63, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69,
-	0x63, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x40,
-	0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61,
-	0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x41, 0x45, 0x48, 0x58, 0x5A, 0x00,
-	0x6F, 0x04, 0x3F, 0x6F, 0x75, 0x74, 0x40, 0x3F, 0x24, 0x63, 0x6F, 0x64,
-	0x65, 0x63, 0x76, 0x74, 0x40, 0x44, 0x44, 0x48, 0x40, 0x73, 0x74, 0x64,
-	0x40, 0x40, 0x51, 0x42, 0x45, 0x48, 0x41, 0x41, 0x48, 0x50, 0x42, 0x44,
-	0x31, 0x41, 0x41, 0x50, 0x42, 0x44, 0x50, 0x41, 0x44, 0x33, 0x41, 0x41,
-	0x50, 0x41, 0x44, 0x40, 0x5A, 0x00, 0x38, 0x04, 0x3F, 0x69, 0x6E, 0x40,
-	0x3F, 0x24, 0x63, 0x6F, 0x64, 0x65, 0x63, 0x76, 0x74, 0x40, 0x44, 0x44,
-	0x48, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x42, 0x45, 0x48, 0x41,
-	0x41, 0x48, 0x50, 0x42, 0x44, 0x31, 0x41, 0x41, 0x50, 0x42, 0x44, 0x50,
-	0x41, 0x44, 0x33, 0x41, 0x41, 0x50, 0x41, 0x44, 0x40, 0x5A, 0x00, 0x00,
-	0x7E, 0x00, 0x3F, 0x3F, 0x31, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63,
-	0x5F, 0x69, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x40, 0x44, 0x55,
-	0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74,
-	0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74,
-	0x64, 0x40, 0x40, 0x55, 0x41, 0x45, 0x40, 0x58, 0x5A, 0x00, 0x40, 0x05,
-	0x3F, 0x74, 0x65, 0x6C, 0x6C, 0x67, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73,
-	0x69, 0x63, 0x5F, 0x69, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x40, 0x44,
-	0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69,
-	0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73,
-	0x74, 0x64, 0x40, 0x40, 0x51, 0x41, 0x45, 0x3F, 0x41, 0x56, 0x3F, 0x24,
-	0x66, 0x70, 0x6F, 0x73, 0x40, 0x48, 0x40, 0x32, 0x40, 0x58, 0x5A, 0x00,
-	0xD9, 0x04, 0x3F, 0x73, 0x65, 0x65, 0x6B, 0x67, 0x40, 0x3F, 0x24, 0x62,
-	0x61, 0x73, 0x69, 0x63, 0x5F, 0x69, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D,
-	0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72,
-	0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x41, 0x45, 0x41, 0x41, 0x56,
-	0x31, 0x32, 0x40, 0x5F, 0x4A, 0x48, 0x40, 0x5A, 0x00, 0x00, 0xC7, 0x04,
-	0x3F, 0x72, 0x65, 0x61, 0x64, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69,
-	0x63, 0x5F, 0x69, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x40, 0x44, 0x55,
-	0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74,
-	0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74,
-	0x64, 0x40, 0x40, 0x51, 0x41, 0x45, 0x41, 0x41, 0x56, 0x31, 0x32, 0x40,
-	0x50, 0x41, 0x44, 0x5F, 0x4A, 0x40, 0x5A, 0x00, 0xA3, 0x01, 0x3F, 0x5F,
-	0x41, 0x64, 0x64, 0x5F, 0x76, 0x74, 0x6F, 0x72, 0x64, 0x69, 0x73, 0x70,
-	0x31, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x69, 0x73,
-	0x74, 0x72, 0x65, 0x61, 0x6D, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68,
-	0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x55,
-	0x41, 0x45, 0x58, 0x58, 0x5A, 0x00, 0x81, 0x00, 0x3F, 0x3F, 0x31, 0x3F,
-	0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x69, 0x73, 0x74, 0x72, 0x65,
-	0x61, 0x6D, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F,
-	0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64,
-	0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x55, 0x41, 0x45, 0x40,
-	0x58, 0x5A, 0x00, 0x00, 0xA3, 0x03, 0x3F, 0x66, 0x6C, 0x75, 0x73, 0x68,
-	0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x6F, 0x73, 0x74,
-	0x72, 0x65, 0x61, 0x6D, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61,
-	0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73,
-	0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x41,
-	0x45, 0x41, 0x41, 0x56, 0x31, 0x32, 0x40, 0x58, 0x5A, 0x00, 0xA9, 0x01,
-	0x3F, 0x5F, 0x41, 0x64, 0x64, 0x5F, 0x76, 0x74, 0x6F, 0x72, 0x64, 0x69,
-	0x73, 0x70, 0x32, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F,
-	0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x40, 0x44, 0x55, 0x3F, 0x24,
-	0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40,
-	0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40,
-	0x40, 0x55, 0x41, 0x45, 0x58, 0x58, 0x5A, 0x00, 0xFF, 0x04, 0x3F, 0x73,
-	0x65, 0x74, 0x73, 0x74, 0x61, 0x74, 0x65, 0x40, 0x3F, 0x24, 0x62, 0x61,
-	0x73, 0x69, 0x63, 0x5F, 0x69, 0x6F, 0x73, 0x40, 0x44, 0x55, 0x3F, 0x24,
-	0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40,
-	0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40,
-	0x40, 0x51, 0x41, 0x45, 0x58, 0x48, 0x5F, 0x4E, 0x40, 0x5A, 0x00, 0x00,
-	0xA6, 0x01, 0x3F, 0x5F, 0x41, 0x64, 0x64, 0x5F, 0x76, 0x74, 0x6F, 0x72,
-	0x64, 0x69, 0x73, 0x70, 0x32, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69,
-	0x63, 0x5F, 0x69, 0x6F, 0x73, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68,
-	0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x55,
-	0x41, 0x45, 0x58, 0x58, 0x5A, 0x00, 0x7B, 0x00, 0x3F, 0x3F, 0x31, 0x3F,
-	0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x69, 0x6F, 0x73, 0x40, 0x44,
-	0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69,
-	0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73,
-	0x74, 0x64, 0x40, 0x40, 0x55, 0x41, 0x45, 0x40, 0x58, 0x5A, 0x00, 0x00,
-	0x34, 0x04, 0x3F, 0x69, 0x6D, 0x62, 0x75, 0x65, 0x40, 0x3F, 0x24, 0x62,
-	0x61, 0x73, 0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62,
-	0x75, 0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F,
-	0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64,
-	0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x4D, 0x41, 0x45, 0x58,
-	0x41, 0x42, 0x56, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x65, 0x40, 0x32, 0x40,
-	0x40, 0x5A, 0x00, 0x00, 0x3A, 0x05, 0x3F, 0x73, 0x79, 0x6E, 0x63, 0x40,
-	0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x65,
-	0x61, 0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68,
-	0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x4D,
-	0x41, 0x45, 0x48, 0x58, 0x5A, 0x00, 0xEF, 0x04, 0x3F, 0x73, 0x65, 0x74,
-	0x62, 0x75, 0x66, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F,
-	0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55,
-	0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74,
-	0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74,
-	0x64, 0x40, 0x40, 0x4D, 0x41, 0x45, 0x50, 0x41, 0x56, 0x31, 0x32, 0x40,
-	0x50, 0x41, 0x44, 0x5F, 0x4A, 0x40, 0x5A, 0x00, 0x87, 0x05, 0x3F, 0x78,
-	0x73, 0x70, 0x75, 0x74, 0x6E, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69,
-	0x63, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x40,
-	0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61,
-	0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x4D, 0x41, 0x45, 0x5F, 0x4A, 0x50, 0x42,
-	0x44, 0x5F, 0x4A, 0x40, 0x5A, 0x00, 0x84, 0x05, 0x3F, 0x78, 0x73, 0x67,
-	0x65, 0x74, 0x6E, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F,
-	0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55,
+	0x74, 0x13, 0x00, 0xF2, 0x13, 0x56, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69,
+	0x63, 0x5F, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x40, 0x44, 0x55,
 	0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74,
-	0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74,
-	0x64, 0x40, 0x40, 0x4D, 0x41, 0x45, 0x5F, 0x4A, 0x50, 0x41, 0x44, 0x5F,
-	0x4A, 0x40, 0x5A, 0x00, 0x59, 0x05, 0x3F, 0x75, 0x66, 0x6C, 0x6F, 0x77,
-	0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73, 0x74, 0x72,
-	0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63,
-	0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x4D, 0x41, 0x45, 0x48, 0x58, 0x5A, 0x00, 0x00, 0x0F, 0x05, 0x3F, 0x73,
-	0x68, 0x6F, 0x77, 0x6D, 0x61, 0x6E, 0x79, 0x63, 0x40, 0x3F, 0x24, 0x62,
-	0x61, 0x73, 0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62,
-	0x75, 0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F,
-	0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64,
-	0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x4D, 0x41, 0x45, 0x5F,
-	0x4A, 0x58, 0x5A, 0x00, 0xCD, 0x02, 0x3F, 0x5F, 0x55, 0x6E, 0x6C, 0x6F,
-	0x63, 0x6B, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73,
-	0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55, 0x3F,
-	0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73,
-	0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64,
-	0x40, 0x40, 0x55, 0x41, 0x45, 0x58, 0x58, 0x5A, 0x00, 0x00, 0x66, 0x02,
-	0x3F, 0x5F, 0x4C, 0x6F, 0x63, 0x6B, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73,
-	0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66,
-	0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72,
-	0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x55, 0x41, 0x45, 0x58, 0x58, 0x5A,
-	0x00, 0x00, 0x12, 0x05, 0x3F, 0x73, 0x6E, 0x65, 0x78, 0x74, 0x63, 0x40,
-	0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x65,
-	0x61, 0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68,
-	0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51,
-	0x41, 0x45, 0x48, 0x58, 0x5A, 0x00, 0x09, 0x05, 0x3F, 0x73, 0x67, 0x65,
-	0x74, 0x63, 0x40, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73,
-	0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55, 0x3F,
-	0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73,
-	0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64,
-	0x40, 0x40, 0x51, 0x41, 0x45, 0x48, 0x58, 0x5A, 0x00, 0x00, 0x87, 0x00,
-	0x3F, 0x3F, 0x31, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73,
-	0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55, 0x3F,
-	0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73,
-	0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64,
-	0x40, 0x40, 0x55, 0x41, 0x45, 0x40, 0x58, 0x5A, 0x00, 0x00, 0xE0, 0x02,
-	0x3F, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x5F, 0x6E, 0x6F, 0x63, 0x6F,
-	0x6E, 0x76, 0x40, 0x63, 0x6F, 0x64, 0x65, 0x63, 0x76, 0x74, 0x5F, 0x62,
-	0x61, 0x73, 0x65, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x42, 0x45,
-	0x5F, 0x4E, 0x58, 0x5A, 0x00, 0x00, 0x30, 0x01, 0x3F, 0x3F, 0x42, 0x69,
-	0x64, 0x40, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x65, 0x40, 0x73, 0x74, 0x64,
-	0x40, 0x40, 0x51, 0x41, 0x45, 0x49, 0x58, 0x5A, 0x00, 0x00, 0x4D, 0x53,
-	0x56, 0x43, 0x50, 0x31, 0x31, 0x30, 0x2E, 0x64, 0x6C, 0x6C, 0x00, 0x00,
-	0xCE, 0x05, 0x66, 0x70, 0x75, 0x74, 0x63, 0x00, 0x67, 0x00, 0x3F, 0x3F,
-	0x31, 0x62, 0x61, 0x64, 0x5F, 0x63, 0x61, 0x73, 0x74, 0x40, 0x73, 0x74,
-	0x64, 0x40, 0x40, 0x55, 0x41, 0x45, 0x40, 0x58, 0x5A, 0x00, 0x1E, 0x00,
-	0x3F, 0x3F, 0x30, 0x62, 0x61, 0x64, 0x5F, 0x63, 0x61, 0x73, 0x74, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x41, 0x45, 0x40, 0x50, 0x42, 0x44,
-	0x40, 0x5A, 0x00, 0x00, 0x1D, 0x00, 0x3F, 0x3F, 0x30, 0x62, 0x61, 0x64,
-	0x5F, 0x63, 0x61, 0x73, 0x74, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51,
-	0x41, 0x45, 0x40, 0x41, 0x42, 0x56, 0x30, 0x31, 0x40, 0x40, 0x5A, 0x00,
-	0x2D, 0x00, 0x3F, 0x3F, 0x30, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69,
-	0x6F, 0x6E, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x51, 0x41, 0x45, 0x40,
-	0x41, 0x42, 0x56, 0x30, 0x31, 0x40, 0x40, 0x5A, 0x00, 0x00, 0x1A, 0x06,
-	0x6D, 0x65, 0x6D, 0x6D, 0x6F, 0x76, 0x65, 0x00, 0xF4, 0x05, 0x69, 0x73,
-	0x73, 0x70, 0x61, 0x63, 0x65, 0x00, 0xD7, 0x04, 0x5F, 0x75, 0x6E, 0x6C,
-	0x6F, 0x63, 0x6B, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x00, 0x00, 0x68, 0x06,
-	0x75, 0x6E, 0x67, 0x65, 0x74, 0x63, 0x00, 0x00, 0xC4, 0x05, 0x66, 0x67,
-	0x65, 0x74, 0x70, 0x6F, 0x73, 0x00, 0x98, 0x02, 0x5F, 0x66, 0x73, 0x65,
-	0x65, 0x6B, 0x69, 0x36, 0x34, 0x00, 0xC2, 0x05, 0x66, 0x66, 0x6C, 0x75,
-	0x73, 0x68, 0x00, 0x00, 0xAF, 0x05, 0x61, 0x74, 0x6F, 0x69, 0x00, 0x00,
-	0xC3, 0x05, 0x66, 0x67, 0x65, 0x74, 0x63, 0x00, 0xCB, 0x05, 0x66, 0x6F,
-	0x70, 0x65, 0x6E, 0x5F, 0x73, 0x00, 0x64, 0x06, 0x74, 0x6F, 0x6C, 0x6F,
-	0x77, 0x65, 0x72, 0x00, 0xDB, 0x05, 0x66, 0x73, 0x65, 0x74, 0x70, 0x6F,
-	0x73, 0x00, 0x34, 0x06, 0x73, 0x65, 0x74, 0x76, 0x62, 0x75, 0x66, 0x00,
-	0x6D, 0x03, 0x5F, 0x6C, 0x6F, 0x63, 0x6B, 0x5F, 0x66, 0x69, 0x6C, 0x65,
-	0x00, 0x00, 0x8A, 0x00, 0x3F, 0x3F, 0x5F, 0x56, 0x40, 0x59, 0x41, 0x58,
-	0x50, 0x41, 0x58, 0x40, 0x5A, 0x00, 0xCC, 0x05, 0x66, 0x70, 0x72, 0x69,
-	0x6E, 0x74, 0x66, 0x00, 0x4E, 0x04, 0x5F, 0x73, 0x65, 0x74, 0x5F, 0x6F,
-	0x75, 0x74, 0x70, 0x75, 0x74, 0x5F, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
-	0x00, 0x00, 0x21, 0x04, 0x5F, 0x70, 0x75, 0x72, 0x65, 0x63, 0x61, 0x6C,
-	0x6C, 0x00, 0x73, 0x00, 0x3F, 0x3F, 0x33, 0x40, 0x59, 0x41, 0x58, 0x50,
-	0x41, 0x58, 0x40, 0x5A, 0x00, 0x00, 0x19, 0x06, 0x6D, 0x65, 0x6D, 0x63,
-	0x70, 0x79, 0x5F, 0x73, 0x00, 0x00, 0xDF, 0x05, 0x66, 0x77, 0x72, 0x69,
-	0x74, 0x65, 0x00, 0x00, 0x65, 0x06, 0x74, 0x6F, 0x75, 0x70, 0x70, 0x65,
-	0x72, 0x00, 0xAE, 0x05, 0x61, 0x74, 0x6F, 0x66, 0x00, 0x00, 0xBF, 0x05,
-	0x66, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x00, 0x00, 0x71, 0x00, 0x3F, 0x3F,
-	0x32, 0x40, 0x59, 0x41, 0x50, 0x41, 0x58, 0x49, 0x40, 0x5A, 0x00, 0x00,
-	0x4D, 0x53, 0x56, 0x43, 0x52, 0x31, 0x31, 0x30, 0x2E, 0x64, 0x6C, 0x6C,
-	0x00, 0x00, 0x6C, 0x03, 0x5F, 0x6C, 0x6F, 0x63, 0x6B, 0x00, 0xD6, 0x04,
-	0x5F, 0x75, 0x6E, 0x6C, 0x6F, 0x63, 0x6B, 0x00, 0x1B, 0x02, 0x5F, 0x63,
-	0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x5F, 0x63, 0x72, 0x74, 0x00, 0x9C, 0x01,
-	0x5F, 0x5F, 0x64, 0x6C, 0x6C, 0x6F, 0x6E, 0x65, 0x78, 0x69, 0x74, 0x00,
-	0x12, 0x04, 0x5F, 0x6F, 0x6E, 0x65, 0x78, 0x69, 0x74, 0x00, 0x70, 0x00,
-	0x3F, 0x3F, 0x31, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x69, 0x6E, 0x66, 0x6F,
-	0x40, 0x40, 0x55, 0x41, 0x45, 0x40, 0x58, 0x5A, 0x00, 0x00, 0x6F, 0x01,
-	0x5F, 0x58, 0x63, 0x70, 0x74, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x00,
-	0x05, 0x02, 0x5F, 0x61, 0x6D, 0x73, 0x67, 0x5F, 0x65, 0x78, 0x69, 0x74,
-	0x00, 0x00, 0xA4, 0x01, 0x5F, 0x5F, 0x67, 0x65, 0x74, 0x6D, 0x61, 0x69,
-	0x6E, 0x61, 0x72, 0x67, 0x73, 0x00, 0xE0, 0x01, 0x5F, 0x5F, 0x73, 0x65,
-	0x74, 0x5F, 0x61, 0x70, 0x70, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00,
-	0xBC, 0x05, 0x65, 0x78, 0x69, 0x74, 0x00, 0x00, 0x69, 0x02, 0x5F, 0x65,
-	0x78, 0x69, 0x74, 0x00, 0x1C, 0x02, 0x5F, 0x63, 0x65, 0x78, 0x69, 0x74,
-	0x00, 0x00, 0x2C, 0x02, 0x5F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x74,
-	0x68, 0x72, 0x65, 0x61, 0x64, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x65, 0x00,
-	0xE2, 0x01, 0x5F, 0x5F, 0x73, 0x65, 0x74, 0x75, 0x73, 0x65, 0x72, 0x6D,
-	0x61, 0x74, 0x68, 0x65, 0x72, 0x72, 0x00, 0x00, 0xEF, 0x02, 0x5F, 0x69,
-	0x6E, 0x69, 0x74, 0x74, 0x65, 0x72, 0x6D, 0x5F, 0x65, 0x00, 0xEE, 0x02,
-	0x5F, 0x69, 0x6E, 0x69, 0x74, 0x74, 0x65, 0x72, 0x6D, 0x00, 0xA5, 0x01,
-	0x5F, 0x5F, 0x69, 0x6E, 0x69, 0x74, 0x65, 0x6E, 0x76, 0x00, 0x84, 0x02,
-	0x5F, 0x66, 0x6D, 0x6F, 0x64, 0x65, 0x00, 0x00, 0x2B, 0x02, 0x5F, 0x63,
-	0x6F, 0x6D, 0x6D, 0x6F, 0x64, 0x65, 0x00, 0x00, 0x3B, 0x02, 0x5F, 0x63,
-	0x72, 0x74, 0x5F, 0x64, 0x65, 0x62, 0x75, 0x67, 0x67, 0x65, 0x72, 0x5F,
-	0x68, 0x6F, 0x6F, 0x6B, 0x00, 0x00, 0x9A, 0x01, 0x5F, 0x5F, 0x63, 0x72,
-	0x74, 0x55, 0x6E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x64, 0x45, 0x78,
-	0x63, 0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x99, 0x01, 0x5F, 0x5F,
-	0x63, 0x72, 0x74, 0x54, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x74, 0x65,
-	0x50, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x00, 0x60, 0x02, 0x5F, 0x65,
-	0x78, 0x63, 0x65, 0x70, 0x74, 0x5F, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
-	0x72, 0x34, 0x5F, 0x63, 0x6F, 0x6D, 0x6D, 0x6F, 0x6E, 0x00, 0x3B, 0x01,
-	0x3F, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x40, 0x40,
-	0x59, 0x41, 0x58, 0x58, 0x5A, 0x00, 0x98, 0x01, 0x5F, 0x5F, 0x63, 0x72,
-	0x74, 0x53, 0x65, 0x74, 0x55, 0x6E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
-	0x64, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x46, 0x69,
-	0x6C, 0x74, 0x65, 0x72, 0x00, 0x00, 0xF6, 0x02, 0x5F, 0x69, 0x6E, 0x76,
-	0x6F, 0x6B, 0x65, 0x5F, 0x77, 0x61, 0x74, 0x73, 0x6F, 0x6E, 0x00, 0x00,
-	0x2F, 0x02, 0x5F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x66, 0x70,
-	0x5F, 0x73, 0x00, 0x00, 0x3C, 0x01, 0x45, 0x6E, 0x63, 0x6F, 0x64, 0x65,
-	0x50, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x00, 0x17, 0x01, 0x44, 0x65,
-	0x63, 0x6F, 0x64, 0x65, 0x50, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x00,
-	0x83, 0x03, 0x49, 0x73, 0x44, 0x65, 0x62, 0x75, 0x67, 0x67, 0x65, 0x72,
-	0x50, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x00, 0x88, 0x03, 0x49, 0x73,
-	0x50, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x65, 0x61,
-	0x74, 0x75, 0x72, 0x65, 0x50, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x00,
-	0x3C, 0x04, 0x51, 0x75, 0x65, 0x72, 0x79, 0x50, 0x65, 0x72, 0x66, 0x6F,
-	0x72, 0x6D, 0x61, 0x6E, 0x63, 0x65, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x65,
-	0x72, 0x00, 0x28, 0x02, 0x47, 0x65, 0x74, 0x43, 0x75, 0x72, 0x72, 0x65,
-	0x6E, 0x74, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x49, 0x64, 0x00, 0x00,
-	0xF4, 0x02, 0x47, 0x65, 0x74, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x54,
-	0x69, 0x6D, 0x65, 0x41, 0x73, 0x46, 0x69, 0x6C, 0x65, 0x54, 0x69, 0x6D,
-	0x65, 0x00, 0x11, 0x03, 0x47, 0x65, 0x74, 0x54, 0x69, 0x63, 0x6B, 0x43,
-	0x6F, 0x75, 0x6E, 0x74, 0x36, 0x34, 0x00, 0x00, 0x4B, 0x45, 0x52, 0x4E,
-	0x45, 0x4C, 0x33, 0x32, 0x2E, 0x64, 0x6C, 0x6C, 0x00, 0x00, 0x5D, 0x01,
-	0x5F, 0x43, 0x78, 0x78, 0x54, 0x68, 0x72, 0x6F, 0x77, 0x45, 0x78, 0x63,
-	0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x00, 0x78, 0x01, 0x5F, 0x5F,
-	0x43, 0x78, 0x78, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x48, 0x61, 0x6E, 0x64,
-	0x6C, 0x65, 0x72, 0x33, 0x00, 0x00, 0x18, 0x06, 0x6D, 0x65, 0x6D, 0x63,
-	0x70, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x7C, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56,
-	0x74, 0x79, 0x70, 0x65, 0x5F, 0x69, 0x6E, 0x66, 0x6F, 0x40, 0x40, 0x00,
-	0x4E, 0xE6, 0x40, 0xBB, 0xB1, 0x19, 0xBF, 0x44, 0x01, 0x00, 0x00, 0x00,
-	0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x72, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56, 0x3F, 0x24, 0x62, 0x61,
-	0x73, 0x69, 0x63, 0x5F, 0x69, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D,
-	0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72,
-	0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x00, 0x00, 0x7C, 0x72, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56, 0x62, 0x61, 0x64, 0x5F,
-	0x63, 0x61, 0x73, 0x74, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x7C, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x2E, 0x3F, 0x41, 0x56, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F,
-	0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D,
-	0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72,
-	0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x56, 0x3F, 0x24, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x6F, 0x72,
-	0x40, 0x44, 0x40, 0x32, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x00,
-	0x7C, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56,
-	0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x40, 0x73, 0x74,
-	0x64, 0x40, 0x40, 0x00, 0x7C, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x2E, 0x3F, 0x41, 0x56, 0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F,
-	0x69, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x40, 0x44, 0x55, 0x3F, 0x24,
-	0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40,
-	0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40,
-	0x40, 0x00, 0x00, 0x00, 0x7C, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x2E, 0x3F, 0x41, 0x56, 0x69, 0x6F, 0x73, 0x5F, 0x62, 0x61, 0x73, 0x65,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x00, 0x00, 0x7C, 0x72, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56, 0x5F, 0x49, 0x6F, 0x73,
-	0x74, 0x72, 0x65, 0x61, 0x6D, 0x5F, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x5F,
-	0x63, 0x61, 0x74, 0x65, 0x67, 0x6F, 0x72, 0x79, 0x40, 0x73, 0x74, 0x64,
-	0x40, 0x40, 0x00, 0x00, 0x7C, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x2E, 0x3F, 0x41, 0x56, 0x5F, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x5F,
-	0x65, 0x72, 0x72, 0x6F, 0x72, 0x5F, 0x63, 0x61, 0x74, 0x65, 0x67, 0x6F,
-	0x72, 0x79, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
-	0x7C, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56,
-	0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x66, 0x69, 0x6C, 0x65,
-	0x62, 0x75, 0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72,
-	0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74,
-	0x64, 0x40, 0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x00, 0x00, 0x00,
-	0x7C, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56,
-	0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x69, 0x6F, 0x73, 0x40,
-	0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61,
-	0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x72, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56, 0x3F, 0x24, 0x62, 0x61,
-	0x73, 0x69, 0x63, 0x5F, 0x69, 0x66, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D,
-	0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72,
-	0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40,
-	0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x7C, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56,
-	0x3F, 0x24, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x69,
-	0x6E, 0x67, 0x62, 0x75, 0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68,
-	0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x56, 0x3F, 0x24, 0x61, 0x6C, 0x6C, 0x6F,
-	0x63, 0x61, 0x74, 0x6F, 0x72, 0x40, 0x44, 0x40, 0x32, 0x40, 0x40, 0x73,
-	0x74, 0x64, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x72, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56, 0x3F, 0x24, 0x5F, 0x49,
-	0x6F, 0x73, 0x62, 0x40, 0x48, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x00,
-	0x7C, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56,
-	0x65, 0x72, 0x72, 0x6F, 0x72, 0x5F, 0x63, 0x61, 0x74, 0x65, 0x67, 0x6F,
-	0x72, 0x79, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
-	0x7C, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56,
-	0x5F, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x69, 0x63, 0x5F, 0x65, 0x72, 0x72,
-	0x6F, 0x72, 0x5F, 0x63, 0x61, 0x74, 0x65, 0x67, 0x6F, 0x72, 0x79, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x72, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56, 0x3F, 0x24, 0x62, 0x61,
-	0x73, 0x69, 0x63, 0x5F, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x40,
-	0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61,
-	0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x40,
-	0x73, 0x74, 0x64, 0x40, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x72, 0x40, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x2E, 0x3F, 0x41, 0x56, 0x3F, 0x24, 0x62, 0x61,
-	0x73, 0x69, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75,
-	0x66, 0x40, 0x44, 0x55, 0x3F, 0x24, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x74,
-	0x72, 0x61, 0x69, 0x74, 0x73, 0x40, 0x44, 0x40, 0x73, 0x74, 0x64, 0x40,
-	0x40, 0x40, 0x73, 0x74, 0x64, 0x40, 0x40, 0x00, 0x40, 0x75, 0x40, 0x00,
-	0x04, 0x75, 0x40, 0x00, 0x5C, 0x75, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00,
-	0x18, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x30, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x04, 0x00, 0x00,
-	0x48, 0x00, 0x00, 0x00, 0x60, 0xB0, 0x00, 0x00, 0x7D, 0x01, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3C, 0x3F, 0x78, 0x6D, 0x6C, 0x20, 0x76, 0x65,
+	0x73, 0x40, 0x44, 0x29, 0x00, 0xCC, 0x40, 0x31, 0x40, 0x41, 0x00, 0x00,
+	0xE6, 0x02, 0x3F, 0x63, 0x69, 0x6E, 0x3B, 0x00, 0x1F, 0x69, 0x3B, 0x00,
+	0x10, 0xE4, 0xD7, 0x02, 0x3F, 0x5F, 0x58, 0x62, 0x61, 0x64, 0x5F, 0x61,
+	0x6C, 0x6C, 0x6F, 0x63, 0xAA, 0x00, 0x50, 0x58, 0x58, 0x5A, 0x00, 0xDB,
+	0x1A, 0x00, 0xC5, 0x6F, 0x75, 0x74, 0x5F, 0x6F, 0x66, 0x5F, 0x72, 0x61,
+	0x6E, 0x67, 0x65, 0x1D, 0x00, 0xF3, 0x02, 0x50, 0x42, 0x44, 0x40, 0x5A,
+	0x00, 0xA5, 0x00, 0x3F, 0x3F, 0x31, 0x5F, 0x4C, 0x6F, 0x63, 0x6B, 0x69,
+	0xB5, 0x00, 0xDD, 0x51, 0x41, 0x45, 0x40, 0x58, 0x5A, 0x00, 0x00, 0x66,
+	0x00, 0x3F, 0x3F, 0x30, 0x1A, 0x00, 0x00, 0xFB, 0x00, 0x10, 0xDA, 0x54,
+	0x00, 0x71, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x5F, 0x1F, 0x01, 0x0B,
+	0x54, 0x00, 0xF3, 0x05, 0x5C, 0x05, 0x3F, 0x75, 0x6E, 0x63, 0x61, 0x75,
+	0x67, 0x68, 0x74, 0x5F, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6F,
+	0xD7, 0x00, 0xF1, 0x03, 0x59, 0x41, 0x5F, 0x4E, 0x58, 0x5A, 0x00, 0xFB,
+	0x01, 0x3F, 0x5F, 0x47, 0x65, 0x74, 0x67, 0x6C, 0x6F, 0x62, 0xB2, 0x00,
+	0x43, 0x61, 0x6C, 0x65, 0x40, 0x07, 0x00, 0x01, 0x27, 0x00, 0x50, 0x43,
+	0x41, 0x50, 0x41, 0x56, 0x7C, 0x00, 0x61, 0x69, 0x6D, 0x70, 0x40, 0x31,
+	0x32, 0x90, 0x00, 0x95, 0xCE, 0x01, 0x3F, 0x5F, 0x46, 0x69, 0x6F, 0x70,
+	0x65, 0x4B, 0x00, 0xB0, 0x50, 0x41, 0x55, 0x5F, 0x69, 0x6F, 0x62, 0x75,
+	0x66, 0x40, 0x40, 0x95, 0x01, 0x01, 0x96, 0x01, 0xF2, 0x04, 0x07, 0x04,
+	0x3F, 0x69, 0x64, 0x40, 0x3F, 0x24, 0x63, 0x6F, 0x64, 0x65, 0x63, 0x76,
+	0x74, 0x40, 0x44, 0x44, 0x48, 0x2F, 0x00, 0x33, 0x32, 0x56, 0x30, 0x62,
+	0x00, 0x10, 0x32, 0x6C, 0x01, 0x94, 0x1B, 0x05, 0x3F, 0x73, 0x70, 0x75,
+	0x74, 0x6E, 0x40, 0x67, 0x01, 0x02, 0x66, 0x01, 0x00, 0x4D, 0x00, 0x0F,
+	0x69, 0x01, 0x05, 0x04, 0x04, 0x01, 0x70, 0x5F, 0x4A, 0x50, 0x42, 0x44,
+	0x5F, 0x4A, 0x6E, 0x00, 0x12, 0xD9, 0xC8, 0x00, 0x3F, 0x63, 0x61, 0x74,
+	0x73, 0x00, 0x01, 0xD4, 0x53, 0x41, 0x49, 0x50, 0x41, 0x50, 0x42, 0x56,
+	0x66, 0x61, 0x63, 0x65, 0x74, 0xE0, 0x00, 0xF0, 0x02, 0x32, 0x40, 0x50,
+	0x42, 0x56, 0x34, 0x32, 0x40, 0x40, 0x5A, 0x00, 0xFE, 0x03, 0x3F, 0x67,
+	0x65, 0x74, 0xB1, 0x01, 0x0F, 0x85, 0x00, 0x1D, 0x55, 0x42, 0x45, 0x3F,
+	0x41, 0x56, 0x51, 0x00, 0x00, 0x1E, 0x01, 0x85, 0x84, 0x02, 0x3F, 0x5F,
+	0x4F, 0x73, 0x66, 0x78, 0x4B, 0x00, 0x0F, 0x72, 0x02, 0x0D, 0x04, 0xCE,
+	0x00, 0x00, 0x25, 0x02, 0x86, 0x00, 0x72, 0x05, 0x3F, 0x77, 0x69, 0x64,
+	0x65, 0x0E, 0x01, 0x3F, 0x69, 0x6F, 0x73, 0x83, 0x00, 0x0E, 0x10, 0x44,
+	0xEC, 0x01, 0x70, 0x1C, 0x02, 0x3F, 0x5F, 0x49, 0x6E, 0x69, 0x00, 0x01,
+	0x0F, 0xC3, 0x00, 0x1A, 0x13, 0x49, 0x7A, 0x00, 0x10, 0x2A, 0x66, 0x02,
+	0x0F, 0x3C, 0x00, 0x1F, 0x01, 0xF4, 0x00, 0x10, 0x64, 0x68, 0x02, 0x4F,
+	0x73, 0x68, 0x69, 0x66, 0x7E, 0x01, 0x02, 0xF0, 0x00, 0x51, 0x42, 0x45,
+	0x48, 0x41, 0x41, 0x48, 0x50, 0x41, 0x44, 0x31, 0x41, 0x41, 0x50, 0x41,
+	0xAD, 0x00, 0x28, 0x00, 0x0E, 0x6E, 0x00, 0x1F, 0x69, 0x23, 0x01, 0x15,
+	0x35, 0x40, 0x50, 0x41, 0x8E, 0x03, 0x0F, 0xA3, 0x00, 0x0F, 0x10, 0x31,
+	0xDB, 0x01, 0x20, 0x00, 0x52, 0x18, 0x01, 0x17, 0x70, 0x90, 0x01, 0x0F,
+	0xC7, 0x03, 0x0D, 0x05, 0x5E, 0x02, 0x79, 0x4E, 0x5F, 0x4E, 0x40, 0x5A,
+	0x00, 0x15, 0xAA, 0x00, 0x0F, 0xA9, 0x00, 0x44, 0x01, 0x6A, 0x00, 0x1B,
+	0x07, 0x14, 0x01, 0x0F, 0x7C, 0x01, 0x13, 0x8F, 0xE9, 0x02, 0x3F, 0x63,
+	0x6C, 0x65, 0x61, 0x72, 0x32, 0x02, 0x18, 0x41, 0x41, 0x45, 0x58, 0x48,
+	0x72, 0x00, 0x8F, 0x8A, 0x02, 0x3F, 0x5F, 0x50, 0x6E, 0x69, 0x6E, 0xF8,
+	0x02, 0x1E, 0xFF, 0x01, 0x49, 0x41, 0x45, 0x50, 0x41, 0x44, 0x58, 0x5A,
+	0x00, 0xF4, 0x04, 0x3F, 0x73, 0x65, 0x74, 0x67, 0x75, 0x02, 0x21, 0x50,
+	0x50, 0x41, 0x44, 0x30, 0x30, 0xA2, 0x01, 0x12, 0x18, 0x02, 0x04, 0x0F,
+	0x7D, 0x03, 0x1F, 0x30, 0x41, 0x45, 0x48, 0x4D, 0x02, 0x8F, 0xCF, 0x04,
+	0x3F, 0x73, 0x62, 0x75, 0x6D, 0x70, 0x41, 0x00, 0x22, 0x60, 0x58, 0x5A,
+	0x00, 0x6F, 0x04, 0x3F, 0x29, 0x06, 0x0F, 0xBA, 0x02, 0x08, 0x11, 0x42,
+	0xBA, 0x02, 0x64, 0x42, 0x44, 0x50, 0x41, 0x44, 0x33, 0xC3, 0x02, 0x40,
+	0x38, 0x04, 0x3F, 0x69, 0xA7, 0x03, 0x0F, 0x35, 0x00, 0x1A, 0x20, 0x00,
+	0x7E, 0xE6, 0x05, 0x0F, 0xF8, 0x02, 0x1B, 0x12, 0x55, 0xE9, 0x01, 0x76,
+	0x40, 0x05, 0x3F, 0x74, 0x65, 0x6C, 0x6C, 0x6B, 0x01, 0x0F, 0x8C, 0x02,
+	0x15, 0x10, 0x3F, 0x8B, 0x02, 0x62, 0x66, 0x70, 0x6F, 0x73, 0x40, 0x48,
+	0xA3, 0x04, 0x10, 0xD9, 0xB4, 0x01, 0x2F, 0x65, 0x6B, 0x4A, 0x00, 0x1F,
+	0x81, 0x41, 0x41, 0x56, 0x31, 0x32, 0x40, 0x5F, 0x4A, 0xE0, 0x05, 0x60,
+	0xC7, 0x04, 0x3F, 0x72, 0x65, 0x61, 0xE2, 0x05, 0x0F, 0x45, 0x00, 0x21,
+	0x22, 0x50, 0x41, 0xB9, 0x05, 0xFF, 0x02, 0xA3, 0x01, 0x3F, 0x5F, 0x41,
+	0x64, 0x64, 0x5F, 0x76, 0x74, 0x6F, 0x72, 0x64, 0x69, 0x73, 0x70, 0x31,
+	0x50, 0x00, 0x1B, 0x12, 0x55, 0xBD, 0x04, 0x19, 0x81, 0x56, 0x01, 0x0F,
+	0x55, 0x01, 0x18, 0x9F, 0x00, 0xA3, 0x03, 0x3F, 0x66, 0x6C, 0x75, 0x73,
+	0x68, 0xAE, 0x05, 0x1E, 0x02, 0xC7, 0x00, 0x4B, 0x58, 0x5A, 0x00, 0xA9,
+	0xC2, 0x00, 0x1F, 0x32, 0x4B, 0x00, 0x1B, 0x03, 0xC2, 0x00, 0x11, 0xFF,
+	0x48, 0x03, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0xC9, 0x03, 0x21, 0x2F,
+	0x00, 0xA6, 0x86, 0x00, 0x06, 0x0F, 0x46, 0x00, 0x0E, 0x03, 0x82, 0x00,
+	0x1B, 0x7B, 0x9A, 0x02, 0x0F, 0x40, 0x01, 0x13, 0x76, 0x34, 0x04, 0x3F,
+	0x69, 0x6D, 0x62, 0x75, 0xB5, 0x00, 0x0F, 0x7B, 0x03, 0x14, 0x66, 0x4D,
+	0x41, 0x45, 0x58, 0x41, 0x42, 0x3A, 0x07, 0x00, 0xC4, 0x00, 0x5F, 0x3A,
+	0x05, 0x3F, 0x73, 0x79, 0x8C, 0x04, 0x1F, 0x12, 0x4D, 0xC6, 0x03, 0x11,
+	0xEF, 0x42, 0x01, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x19, 0x50,
+	0x94, 0x02, 0x40, 0x87, 0x05, 0x3F, 0x78, 0x91, 0x04, 0x06, 0x85, 0x07,
+	0x0F, 0x4A, 0x00, 0x17, 0x42, 0x5F, 0x4A, 0x50, 0x42, 0x46, 0x00, 0x10,
+	0x84, 0x46, 0x00, 0x2F, 0x67, 0x65, 0x46, 0x00, 0x25, 0x03, 0x8C, 0x00,
+	0x8F, 0x59, 0x05, 0x3F, 0x75, 0x66, 0x6C, 0x6F, 0x77, 0x15, 0x01, 0x24,
+	0xCF, 0x00, 0x0F, 0x05, 0x3F, 0x73, 0x68, 0x6F, 0x77, 0x6D, 0x61, 0x6E,
+	0x79, 0x59, 0x01, 0x21, 0xFF, 0x00, 0x5F, 0x4A, 0x58, 0x5A, 0x00, 0xCD,
+	0x02, 0x3F, 0x5F, 0x55, 0x6E, 0x6C, 0x6F, 0x63, 0x6B, 0x42, 0x00, 0x1D,
+	0x03, 0x5B, 0x02, 0x6F, 0x00, 0x66, 0x02, 0x3F, 0x5F, 0x4C, 0x40, 0x00,
+	0x28, 0x7F, 0x12, 0x05, 0x3F, 0x73, 0x6E, 0x65, 0x78, 0x23, 0x06, 0x23,
+	0x60, 0x58, 0x5A, 0x00, 0x09, 0x05, 0x3F, 0x8B, 0x01, 0x0F, 0x3F, 0x00,
+	0x25, 0x28, 0x00, 0x87, 0x1C, 0x03, 0x0F, 0xBC, 0x00, 0x17, 0x01, 0x22,
+	0x03, 0xF3, 0x02, 0xE0, 0x02, 0x3F, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73,
+	0x5F, 0x6E, 0x6F, 0x63, 0x6F, 0x6E, 0x76, 0x40, 0x31, 0x06, 0x55, 0x5F,
+	0x62, 0x61, 0x73, 0x65, 0x32, 0x06, 0x20, 0x5F, 0x4E, 0x2C, 0x00, 0x83,
+	0x30, 0x01, 0x3F, 0x3F, 0x42, 0x69, 0x64, 0x40, 0x17, 0x03, 0x04, 0x84,
+	0x00, 0x10, 0x49, 0x1C, 0x00, 0xF0, 0x02, 0x4D, 0x53, 0x56, 0x43, 0x50,
+	0x31, 0x31, 0x30, 0x2E, 0x64, 0x6C, 0x6C, 0x00, 0x00, 0xCE, 0x05, 0x66,
+	0x33, 0x07, 0x20, 0x00, 0x67, 0x9A, 0x00, 0x89, 0x62, 0x61, 0x64, 0x5F,
+	0x63, 0x61, 0x73, 0x74, 0x79, 0x00, 0x5A, 0x1E, 0x00, 0x3F, 0x3F, 0x30,
+	0x1A, 0x00, 0x61, 0x51, 0x41, 0x45, 0x40, 0x50, 0x42, 0x88, 0x06, 0x1F,
+	0x1D, 0x1E, 0x00, 0x03, 0x50, 0x41, 0x42, 0x56, 0x30, 0x31, 0x8D, 0x03,
+	0x10, 0x2D, 0x20, 0x00, 0x9F, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69,
+	0x6F, 0x6E, 0x21, 0x00, 0x00, 0xF1, 0x0A, 0x00, 0x1A, 0x06, 0x6D, 0x65,
+	0x6D, 0x6D, 0x6F, 0x76, 0x65, 0x00, 0xF4, 0x05, 0x69, 0x73, 0x73, 0x70,
+	0x61, 0x63, 0x65, 0x00, 0xD7, 0x04, 0x5F, 0x75, 0x29, 0x02, 0xB0, 0x5F,
+	0x66, 0x69, 0x6C, 0x65, 0x00, 0x00, 0x68, 0x06, 0x75, 0x6E, 0x78, 0x01,
+	0xF0, 0x01, 0x00, 0x00, 0xC4, 0x05, 0x66, 0x67, 0x65, 0x74, 0x70, 0x6F,
+	0x73, 0x00, 0x98, 0x02, 0x5F, 0x66, 0x7F, 0x06, 0x71, 0x69, 0x36, 0x34,
+	0x00, 0xC2, 0x05, 0x66, 0x7E, 0x05, 0xB1, 0x00, 0x00, 0xAF, 0x05, 0x61,
+	0x74, 0x6F, 0x69, 0x00, 0x00, 0xC3, 0x28, 0x00, 0xF2, 0x0B, 0x63, 0x00,
+	0xCB, 0x05, 0x66, 0x6F, 0x70, 0x65, 0x6E, 0x5F, 0x73, 0x00, 0x64, 0x06,
+	0x74, 0x6F, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x00, 0xDB, 0x05, 0x66, 0x73,
+	0x44, 0x00, 0xD7, 0x34, 0x06, 0x73, 0x65, 0x74, 0x76, 0x62, 0x75, 0x66,
+	0x00, 0x6D, 0x03, 0x5F, 0x70, 0x00, 0xF6, 0x32, 0x8A, 0x00, 0x3F, 0x3F,
+	0x5F, 0x56, 0x40, 0x59, 0x41, 0x58, 0x50, 0x41, 0x58, 0x40, 0x5A, 0x00,
+	0xCC, 0x05, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x00, 0x4E, 0x04,
+	0x5F, 0x73, 0x65, 0x74, 0x5F, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5F,
+	0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x00, 0x00, 0x21, 0x04, 0x5F, 0x70,
+	0x75, 0x72, 0x65, 0x63, 0x61, 0x6C, 0x6C, 0x00, 0x73, 0x00, 0x3F, 0x3F,
+	0x33, 0x3B, 0x00, 0x20, 0x00, 0x19, 0xE0, 0x00, 0xF0, 0x0D, 0x63, 0x70,
+	0x79, 0x5F, 0x73, 0x00, 0x00, 0xDF, 0x05, 0x66, 0x77, 0x72, 0x69, 0x74,
+	0x65, 0x00, 0x00, 0x65, 0x06, 0x74, 0x6F, 0x75, 0x70, 0x70, 0x65, 0x72,
+	0x00, 0xAE, 0xB2, 0x00, 0xF0, 0x0A, 0x66, 0x00, 0x00, 0xBF, 0x05, 0x66,
+	0x63, 0x6C, 0x6F, 0x73, 0x65, 0x00, 0x00, 0x71, 0x00, 0x3F, 0x3F, 0x32,
+	0x40, 0x59, 0x41, 0x50, 0x41, 0x58, 0x49, 0x42, 0x00, 0x00, 0xB2, 0x01,
+	0x15, 0x52, 0xB2, 0x01, 0x12, 0x6C, 0xAA, 0x00, 0x24, 0x00, 0xD6, 0x24,
+	0x01, 0x40, 0x00, 0x1B, 0x02, 0x5F, 0x7A, 0x00, 0xF3, 0x09, 0x6F, 0x63,
+	0x5F, 0x63, 0x72, 0x74, 0x00, 0x9C, 0x01, 0x5F, 0x5F, 0x64, 0x6C, 0x6C,
+	0x6F, 0x6E, 0x65, 0x78, 0x69, 0x74, 0x00, 0x12, 0x04, 0x5F, 0x0A, 0x00,
+	0x10, 0x70, 0xE2, 0x01, 0x96, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x69, 0x6E,
+	0x66, 0x6F, 0x58, 0x02, 0xF1, 0x07, 0x6F, 0x01, 0x5F, 0x58, 0x63, 0x70,
+	0x74, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x00, 0x05, 0x02, 0x5F, 0x61,
+	0x6D, 0x73, 0x67, 0x5F, 0x33, 0x00, 0xF1, 0x05, 0x00, 0xA4, 0x01, 0x5F,
+	0x5F, 0x67, 0x65, 0x74, 0x6D, 0x61, 0x69, 0x6E, 0x61, 0x72, 0x67, 0x73,
+	0x00, 0xE0, 0x01, 0x5F, 0xFF, 0x00, 0x40, 0x61, 0x70, 0x70, 0x5F, 0x4B,
+	0x00, 0x42, 0x00, 0x00, 0xBC, 0x05, 0x2A, 0x00, 0x22, 0x69, 0x02, 0x33,
+	0x00, 0x42, 0x1C, 0x02, 0x5F, 0x63, 0x12, 0x00, 0xB0, 0x2C, 0x02, 0x5F,
+	0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x74, 0x68, 0xE0, 0x07, 0x02, 0x8B,
+	0x02, 0x22, 0x00, 0xE2, 0x42, 0x00, 0x30, 0x75, 0x73, 0x65, 0x3A, 0x01,
+	0xF6, 0x06, 0x68, 0x65, 0x72, 0x72, 0x00, 0x00, 0xEF, 0x02, 0x5F, 0x69,
+	0x6E, 0x69, 0x74, 0x74, 0x65, 0x72, 0x6D, 0x5F, 0x65, 0x00, 0xEE, 0x0E,
+	0x00, 0x41, 0x00, 0xA5, 0x01, 0x5F, 0x0D, 0x00, 0xF0, 0x00, 0x65, 0x6E,
+	0x76, 0x00, 0x84, 0x02, 0x5F, 0x66, 0x6D, 0x6F, 0x64, 0x65, 0x00, 0x00,
+	0x2B, 0x5A, 0x00, 0x12, 0x6D, 0x0C, 0x00, 0x20, 0x3B, 0x02, 0xF5, 0x00,
+	0xF0, 0x04, 0x5F, 0x64, 0x65, 0x62, 0x75, 0x67, 0x67, 0x65, 0x72, 0x5F,
+	0x68, 0x6F, 0x6F, 0x6B, 0x00, 0x00, 0x9A, 0x01, 0x5F, 0x17, 0x00, 0xA4,
+	0x55, 0x6E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x64, 0x45, 0x81, 0x02,
+	0x22, 0x00, 0x99, 0x1A, 0x00, 0xF0, 0x03, 0x54, 0x65, 0x72, 0x6D, 0x69,
+	0x6E, 0x61, 0x74, 0x65, 0x50, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x00,
+	0x60, 0xC0, 0x00, 0x00, 0x25, 0x00, 0x12, 0x5F, 0x33, 0x00, 0x22, 0x72,
+	0x34, 0x64, 0x00, 0x50, 0x6E, 0x00, 0x3B, 0x01, 0x3F, 0x8C, 0x00, 0x01,
+	0x2E, 0x00, 0x10, 0x40, 0xD8, 0x01, 0x42, 0x58, 0x5A, 0x00, 0x98, 0x46,
+	0x00, 0x2F, 0x53, 0x65, 0x63, 0x00, 0x00, 0x03, 0x49, 0x01, 0x20, 0x00,
+	0xF6, 0xC8, 0x00, 0xE1, 0x76, 0x6F, 0x6B, 0x65, 0x5F, 0x77, 0x61, 0x74,
+	0x73, 0x6F, 0x6E, 0x00, 0x00, 0x2F, 0x12, 0x01, 0x60, 0x74, 0x72, 0x6F,
+	0x6C, 0x66, 0x70, 0x0E, 0x02, 0x40, 0x3C, 0x01, 0x45, 0x6E, 0xC5, 0x03,
+	0x40, 0x50, 0x6F, 0x69, 0x6E, 0x33, 0x00, 0x48, 0x17, 0x01, 0x44, 0x65,
+	0x10, 0x00, 0x53, 0x83, 0x03, 0x49, 0x73, 0x44, 0xD9, 0x00, 0xC3, 0x50,
+	0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x00, 0x88, 0x03, 0x49, 0x73, 0xB4,
+	0x00, 0x94, 0x6F, 0x72, 0x46, 0x65, 0x61, 0x74, 0x75, 0x72, 0x65, 0x1C,
+	0x00, 0xA1, 0x3C, 0x04, 0x51, 0x75, 0x65, 0x72, 0x79, 0x50, 0x65, 0x72,
+	0x98, 0x02, 0x61, 0x6E, 0x63, 0x65, 0x43, 0x6F, 0x75, 0x4A, 0x00, 0xD1,
+	0x28, 0x02, 0x47, 0x65, 0x74, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
+	0x54, 0x8F, 0x01, 0x50, 0x49, 0x64, 0x00, 0x00, 0xF4, 0x16, 0x00, 0xF0,
+	0x01, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x54, 0x69, 0x6D, 0x65, 0x41,
+	0x73, 0x46, 0x69, 0x6C, 0x65, 0x0A, 0x00, 0xA1, 0x00, 0x11, 0x03, 0x47,
+	0x65, 0x74, 0x54, 0x69, 0x63, 0x6B, 0x41, 0x00, 0xC2, 0x36, 0x34, 0x00,
+	0x00, 0x4B, 0x45, 0x52, 0x4E, 0x45, 0x4C, 0x33, 0x32, 0x84, 0x02, 0xB6,
+	0x5D, 0x01, 0x5F, 0x43, 0x78, 0x78, 0x54, 0x68, 0x72, 0x6F, 0x77, 0x5B,
+	0x01, 0x40, 0x00, 0x78, 0x01, 0x5F, 0x17, 0x00, 0x62, 0x46, 0x72, 0x61,
+	0x6D, 0x65, 0x48, 0x46, 0x01, 0x43, 0x33, 0x00, 0x00, 0x18, 0x00, 0x03,
+	0x1F, 0x00, 0x01, 0x00, 0x56, 0x31, 0x7C, 0x72, 0x40, 0x08, 0x00, 0x47,
+	0x2E, 0x3F, 0x41, 0x56, 0xF1, 0x02, 0xF2, 0x00, 0x00, 0x4E, 0xE6, 0x40,
+	0xBB, 0xB1, 0x19, 0xBF, 0x44, 0x01, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01,
+	0x00, 0x08, 0x2C, 0x00, 0x04, 0x99, 0x05, 0x22, 0x69, 0x6F, 0x9B, 0x05,
+	0x0F, 0x98, 0x05, 0x0B, 0x0A, 0x68, 0x00, 0x0A, 0x03, 0x05, 0x0E, 0x88,
+	0x00, 0x07, 0xF5, 0x05, 0x3F, 0x69, 0x6E, 0x67, 0x60, 0x00, 0x0B, 0x31,
+	0x56, 0x3F, 0x24, 0xCF, 0x03, 0x84, 0x61, 0x74, 0x6F, 0x72, 0x40, 0x44,
+	0x40, 0x32, 0x71, 0x00, 0x08, 0x50, 0x00, 0x0B, 0x53, 0x05, 0x0F, 0x6C,
+	0x00, 0x02, 0x1F, 0x69, 0xC7, 0x00, 0x13, 0x09, 0x3C, 0x00, 0x37, 0x69,
+	0x6F, 0x73, 0x51, 0x06, 0x0A, 0x1C, 0x00, 0x23, 0x5F, 0x49, 0x19, 0x01,
+	0xFF, 0x00, 0x5F, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x5F, 0x63, 0x61, 0x74,
+	0x65, 0x67, 0x6F, 0x72, 0x79, 0x2C, 0x00, 0x02, 0x02, 0x58, 0x02, 0x0F,
+	0x2A, 0x00, 0x04, 0x0F, 0x1C, 0x01, 0x03, 0x00, 0x7C, 0x05, 0x0F, 0x0F,
+	0x07, 0x0E, 0x0F, 0x3C, 0x00, 0x04, 0x3F, 0x69, 0x6F, 0x73, 0x38, 0x00,
+	0x23, 0x1F, 0x66, 0x25, 0x01, 0x14, 0x0F, 0xD0, 0x01, 0x0A, 0x0F, 0xB6,
+	0x00, 0x08, 0x0F, 0xCD, 0x01, 0x05, 0x0D, 0x50, 0x00, 0x00, 0x5E, 0x01,
+	0x3F, 0x62, 0x40, 0x48, 0xEC, 0x01, 0x01, 0x0F, 0x44, 0x01, 0x10, 0x8F,
+	0x5F, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x69, 0x63, 0x71, 0x01, 0x05, 0x0F,
+	0xBC, 0x00, 0x01, 0x0F, 0xE7, 0x02, 0x14, 0x0F, 0xF8, 0x00, 0x05, 0x3F,
+	0x65, 0x61, 0x6D, 0xAE, 0x01, 0x0F, 0xA3, 0x40, 0x75, 0x40, 0x00, 0x04,
+	0x75, 0x40, 0x00, 0x5C, 0x75, 0x45, 0x01, 0x0F, 0x01, 0x00, 0x5E, 0x50,
+	0x01, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x1C, 0x80, 0x18, 0x00, 0x00,
+	0x08, 0x04, 0x1F, 0x30, 0x18, 0x00, 0x00, 0xD0, 0x09, 0x04, 0x00, 0x00,
+	0x48, 0x00, 0x00, 0x00, 0x60, 0xB0, 0x00, 0x00, 0x7D, 0x25, 0x00, 0x0B,
+	0x01, 0x00, 0xF0, 0x06, 0x3C, 0x3F, 0x78, 0x6D, 0x6C, 0x20, 0x76, 0x65,
 	0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x27, 0x31, 0x2E, 0x30, 0x27, 0x20,
-	0x65, 0x6E, 0x63, 0x6F, 0x64, 0x69, 0x6E, 0x67, 0x3D, 0x27, 0x55, 0x54,
-	0x46, 0x2D, 0x38, 0x27, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x6C,
-	0x6F, 0x6E, 0x65, 0x3D, 0x27, 0x79, 0x65, 0x73, 0x27, 0x3F, 0x3E, 0x0D,
+	0x65, 0xCA, 0x05, 0xF0, 0x03, 0x69, 0x6E, 0x67, 0x3D, 0x27, 0x55, 0x54,
+	0x46, 0x2D, 0x38, 0x27, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x87,
+	0x07, 0xF8, 0x37, 0x3D, 0x27, 0x79, 0x65, 0x73, 0x27, 0x3F, 0x3E, 0x0D,
 	0x0A, 0x3C, 0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x20, 0x78,
 	0x6D, 0x6C, 0x6E, 0x73, 0x3D, 0x27, 0x75, 0x72, 0x6E, 0x3A, 0x73, 0x63,
 	0x68, 0x65, 0x6D, 0x61, 0x73, 0x2D, 0x6D, 0x69, 0x63, 0x72, 0x6F, 0x73,
 	0x6F, 0x66, 0x74, 0x2D, 0x63, 0x6F, 0x6D, 0x3A, 0x61, 0x73, 0x6D, 0x2E,
 	0x76, 0x31, 0x27, 0x20, 0x6D, 0x61, 0x6E, 0x69, 0x66, 0x65, 0x73, 0x74,
-	0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x27, 0x31, 0x2E, 0x30,
-	0x27, 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x3C, 0x74, 0x72, 0x75, 0x73, 0x74,
-	0x49, 0x6E, 0x66, 0x6F, 0x20, 0x78, 0x6D, 0x6C, 0x6E, 0x73, 0x3D, 0x22,
-	0x75, 0x72, 0x6E, 0x3A, 0x73, 0x63, 0x68, 0x65, 0x6D, 0x61, 0x73, 0x2D,
-	0x6D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x2D, 0x63, 0x6F,
-	0x6D, 0x3A, 0x61, 0x73, 0x6D, 0x2E, 0x76, 0x33, 0x22, 0x3E, 0x0D, 0x0A,
-	0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74,
-	0x79, 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x72,
-	0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x50, 0x72, 0x69, 0x76,
-	0x69, 0x6C, 0x65, 0x67, 0x65, 0x73, 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73,
-	0x74, 0x65, 0x64, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6F, 0x6E,
-	0x4C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x3D,
-	0x27, 0x61, 0x73, 0x49, 0x6E, 0x76, 0x6F, 0x6B, 0x65, 0x72, 0x27, 0x20,
-	0x75, 0x69, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3D, 0x27, 0x66, 0x61,
-	0x6C, 0x73, 0x65, 0x27, 0x20, 0x2F, 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x3C, 0x2F, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
-	0x65, 0x64, 0x50, 0x72, 0x69, 0x76, 0x69, 0x6C, 0x65, 0x67, 0x65, 0x73,
-	0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x65, 0x63,
-	0x75, 0x72, 0x69, 0x74, 0x79, 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x3C, 0x2F,
-	0x74, 0x72, 0x75, 0x73, 0x74, 0x49, 0x6E, 0x66, 0x6F, 0x3E, 0x0D, 0x0A,
-	0x3C, 0x2F, 0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x3E, 0x0D,
-	0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x30, 0x45, 0x30,
-	0xE1, 0x30, 0x01, 0x31, 0x0E, 0x31, 0x71, 0x31, 0xA8, 0x31, 0xD1, 0x31,
-	0xF1, 0x31, 0xFE, 0x31, 0x6A, 0x32, 0x7D, 0x32, 0x89, 0x32, 0xC6, 0x32,
-	0xD8, 0x32, 0x2F, 0x34, 0x46, 0x34, 0x70, 0x34, 0x79, 0x34, 0xAD, 0x34,
-	0xCB, 0x34, 0xD4, 0x34, 0xE6, 0x34, 0xF6, 0x34, 0x96, 0x35, 0xF9, 0x35,
-	0x0B, 0x36, 0x1C, 0x36, 0x83, 0x36, 0x89, 0x36, 0x91, 0x36, 0x9C, 0x36,
-	0xAB, 0x36, 0xB7, 0x37, 0xC3, 0x37, 0xD1, 0x37, 0xE7, 0x37, 0xF9, 0x37,
-	0x1C, 0x38, 0xB4, 0x38, 0xB6, 0x39, 0xF6, 0x39, 0xFF, 0x3A, 0xC6, 0x3B,
-	0xD8, 0x3B, 0x18, 0x3C, 0x4D, 0x3C, 0x88, 0x3C, 0xBE, 0x3C, 0xD4, 0x3C,
-	0x0A, 0x3D, 0x37, 0x3D, 0x66, 0x3D, 0xE9, 0x3D, 0x0D, 0x3E, 0x31, 0x3E,
-	0x55, 0x3E, 0xE9, 0x3E, 0x9F, 0x3F, 0xE4, 0x3F, 0x00, 0x20, 0x00, 0x00,
-	0x88, 0x00, 0x00, 0x00, 0x65, 0x30, 0x80, 0x30, 0xA1, 0x30, 0xAE, 0x30,
-	0x23, 0x31, 0x29, 0x31, 0x2F, 0x31, 0x9B, 0x31, 0xF9, 0x31, 0xFE, 0x31,
-	0x09, 0x32, 0x18, 0x32, 0xCA, 0x32, 0xD6, 0x32, 0xEB, 0x32, 0xF0, 0x32,
-	0x10, 0x33, 0x36, 0x33, 0xFB, 0x33, 0x47, 0x34, 0x63, 0x34, 0x6E, 0x34,
-	0x79, 0x34, 0xB3, 0x34, 0xC2, 0x35, 0xEB, 0x35, 0x99, 0x36, 0xEC, 0x36,
-	0xFA, 0x36, 0x5D, 0x37, 0x64, 0x37, 0x6E, 0x37, 0x7B, 0x37, 0xEC, 0x37,
-	0xFB, 0x37, 0x22, 0x38, 0x3D, 0x38, 0x5B, 0x38, 0x64, 0x38, 0x7D, 0x38,
-	0x2E, 0x39, 0x51, 0x39, 0x76, 0x39, 0x85, 0x39, 0x3D, 0x3A, 0x66, 0x3B,
-	0x77, 0x3B, 0x98, 0x3B, 0x9F, 0x3B, 0xA5, 0x3B, 0xC1, 0x3B, 0xD7, 0x3B,
-	0xEB, 0x3B, 0xF8, 0x3B, 0x49, 0x3C, 0x56, 0x3C, 0xA3, 0x3C, 0x1D, 0x3D,
-	0x89, 0x3D, 0x98, 0x3D, 0x6B, 0x3E, 0x7A, 0x3E, 0xC7, 0x3F, 0x00, 0x00,
-	0x00, 0x30, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x94, 0x30, 0xE2, 0x30,
-	0x4C, 0x31, 0x66, 0x32, 0xB4, 0x32, 0xBA, 0x32, 0xD6, 0x32, 0xE7, 0x32,
-	0x08, 0x33, 0x0E, 0x33, 0x2C, 0x33, 0x42, 0x33, 0x56, 0x33, 0x62, 0x33,
-	0x70, 0x33, 0x75, 0x33, 0xC6, 0x33, 0xE1, 0x33, 0xE6, 0x33, 0x0B, 0x34,
-	0x29, 0x34, 0x65, 0x34, 0x78, 0x34, 0x7D, 0x34, 0x97, 0x34, 0xAA, 0x34,
-	0xBA, 0x34, 0xC9, 0x34, 0xD8, 0x34, 0xE6, 0x34, 0x59, 0x35, 0x6C, 0x35,
-	0xDC, 0x35, 0x1E, 0x36, 0xA6, 0x36, 0xAC, 0x36, 0xC5, 0x36, 0xEA, 0x36,
-	0x78, 0x37, 0xF9, 0x37, 0x08, 0x38, 0x16, 0x38, 0x7F, 0x38, 0x8E, 0x38,
-	0xC4, 0x38, 0x8D, 0x39, 0xC8, 0x39, 0x25, 0x3A, 0x4B, 0x3A, 0x90, 0x3A,
-	0xB2, 0x3A, 0xB8, 0x3A, 0x27, 0x3B, 0x3C, 0x3B, 0x97, 0x3B, 0x0F, 0x3C,
-	0x29, 0x3C, 0x3E, 0x3C, 0x88, 0x3C, 0xEE, 0x3C, 0x07, 0x3D, 0x28, 0x3D,
-	0x6A, 0x3D, 0x95, 0x3D, 0xB1, 0x3D, 0xD1, 0x3D, 0xEE, 0x3D, 0xF7, 0x3D,
-	0x04, 0x3E, 0x34, 0x3E, 0x61, 0x3E, 0x7E, 0x3E, 0x87, 0x3E, 0x94, 0x3E,
-	0xC4, 0x3E, 0x55, 0x3F, 0x5B, 0x3F, 0xC6, 0x3F, 0xCC, 0x3F, 0xE6, 0x3F,
-	0xEC, 0x3F, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
+	0x56, 0x6E, 0x00, 0xF3, 0x00, 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x3C, 0x74,
+	0x72, 0x75, 0x73, 0x74, 0x49, 0x6E, 0x66, 0x6F, 0x4E, 0x00, 0x1F, 0x22,
+	0x4E, 0x00, 0x0C, 0x21, 0x33, 0x22, 0x38, 0x00, 0xB3, 0x20, 0x20, 0x3C,
+	0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 0x10, 0x00, 0xF5, 0x07,
+	0x20, 0x20, 0x3C, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64,
+	0x50, 0x72, 0x69, 0x76, 0x69, 0x6C, 0x65, 0x67, 0x65, 0x73, 0x1D, 0x00,
+	0x08, 0x1F, 0x00, 0x50, 0x45, 0x78, 0x65, 0x63, 0x75, 0x77, 0x04, 0x70,
+	0x4C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x6C, 0x06, 0x00, 0x51, 0x3D, 0x27,
+	0x61, 0x73, 0x49, 0xEA, 0x06, 0x70, 0x72, 0x27, 0x20, 0x75, 0x69, 0x41,
+	0x63, 0x9D, 0x06, 0xA6, 0x3D, 0x27, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x27,
+	0x20, 0x2F, 0x65, 0x00, 0x1F, 0x2F, 0x66, 0x00, 0x07, 0x29, 0x3C, 0x2F,
+	0x94, 0x00, 0x25, 0x3C, 0x2F, 0xDD, 0x00, 0x00, 0x37, 0x01, 0x14, 0x2F,
+	0x38, 0x01, 0x3F, 0x3E, 0x0D, 0x0A, 0xED, 0x01, 0x0B, 0x02, 0x01, 0x00,
+	0x12, 0x10, 0xD5, 0x01, 0xF2, 0xEF, 0x3C, 0x30, 0x45, 0x30, 0xE1, 0x30,
+	0x01, 0x31, 0x0E, 0x31, 0x71, 0x31, 0xA8, 0x31, 0xD1, 0x31, 0xF1, 0x31,
+	0xFE, 0x31, 0x6A, 0x32, 0x7D, 0x32, 0x89, 0x32, 0xC6, 0x32, 0xD8, 0x32,
+	0x2F, 0x34, 0x46, 0x34, 0x70, 0x34, 0x79, 0x34, 0xAD, 0x34, 0xCB, 0x34,
+	0xD4, 0x34, 0xE6, 0x34, 0xF6, 0x34, 0x96, 0x35, 0xF9, 0x35, 0x0B, 0x36,
+	0x1C, 0x36, 0x83, 0x36, 0x89, 0x36, 0x91, 0x36, 0x9C, 0x36, 0xAB, 0x36,
+	0xB7, 0x37, 0xC3, 0x37, 0xD1, 0x37, 0xE7, 0x37, 0xF9, 0x37, 0x1C, 0x38,
+	0xB4, 0x38, 0xB6, 0x39, 0xF6, 0x39, 0xFF, 0x3A, 0xC6, 0x3B, 0xD8, 0x3B,
+	0x18, 0x3C, 0x4D, 0x3C, 0x88, 0x3C, 0xBE, 0x3C, 0xD4, 0x3C, 0x0A, 0x3D,
+	0x37, 0x3D, 0x66, 0x3D, 0xE9, 0x3D, 0x0D, 0x3E, 0x31, 0x3E, 0x55, 0x3E,
+	0xE9, 0x3E, 0x9F, 0x3F, 0xE4, 0x3F, 0x00, 0x20, 0x00, 0x00, 0x88, 0x00,
+	0x00, 0x00, 0x65, 0x30, 0x80, 0x30, 0xA1, 0x30, 0xAE, 0x30, 0x23, 0x31,
+	0x29, 0x31, 0x2F, 0x31, 0x9B, 0x31, 0xF9, 0x31, 0xFE, 0x31, 0x09, 0x32,
+	0x18, 0x32, 0xCA, 0x32, 0xD6, 0x32, 0xEB, 0x32, 0xF0, 0x32, 0x10, 0x33,
+	0x36, 0x33, 0xFB, 0x33, 0x47, 0x34, 0x63, 0x34, 0x6E, 0x34, 0x79, 0x34,
+	0xB3, 0x34, 0xC2, 0x35, 0xEB, 0x35, 0x99, 0x36, 0xEC, 0x36, 0xFA, 0x36,
+	0x5D, 0x37, 0x64, 0x37, 0x6E, 0x37, 0x7B, 0x37, 0xEC, 0x37, 0xFB, 0x37,
+	0x22, 0x38, 0x3D, 0x38, 0x5B, 0x38, 0x64, 0x38, 0x7D, 0x38, 0x2E, 0x39,
+	0x51, 0x39, 0x76, 0x39, 0x85, 0x39, 0x3D, 0x3A, 0x66, 0x3B, 0x77, 0x3B,
+	0x98, 0x3B, 0x9F, 0x3B, 0xA5, 0x3B, 0xC1, 0x3B, 0xD7, 0x3B, 0xEB, 0x3B,
+	0xF8, 0x3B, 0x49, 0x3C, 0x56, 0x3C, 0xA3, 0x3C, 0x1D, 0x3D, 0x89, 0x3D,
+	0x98, 0x3D, 0x6B, 0x3E, 0x7A, 0x3E, 0xC7, 0x3F, 0xDD, 0x02, 0xF0, 0x96,
+	0xAC, 0x00, 0x00, 0x00, 0x94, 0x30, 0xE2, 0x30, 0x4C, 0x31, 0x66, 0x32,
+	0xB4, 0x32, 0xBA, 0x32, 0xD6, 0x32, 0xE7, 0x32, 0x08, 0x33, 0x0E, 0x33,
+	0x2C, 0x33, 0x42, 0x33, 0x56, 0x33, 0x62, 0x33, 0x70, 0x33, 0x75, 0x33,
+	0xC6, 0x33, 0xE1, 0x33, 0xE6, 0x33, 0x0B, 0x34, 0x29, 0x34, 0x65, 0x34,
+	0x78, 0x34, 0x7D, 0x34, 0x97, 0x34, 0xAA, 0x34, 0xBA, 0x34, 0xC9, 0x34,
+	0xD8, 0x34, 0xE6, 0x34, 0x59, 0x35, 0x6C, 0x35, 0xDC, 0x35, 0x1E, 0x36,
+	0xA6, 0x36, 0xAC, 0x36, 0xC5, 0x36, 0xEA, 0x36, 0x78, 0x37, 0xF9, 0x37,
+	0x08, 0x38, 0x16, 0x38, 0x7F, 0x38, 0x8E, 0x38, 0xC4, 0x38, 0x8D, 0x39,
+	0xC8, 0x39, 0x25, 0x3A, 0x4B, 0x3A, 0x90, 0x3A, 0xB2, 0x3A, 0xB8, 0x3A,
+	0x27, 0x3B, 0x3C, 0x3B, 0x97, 0x3B, 0x0F, 0x3C, 0x29, 0x3C, 0x3E, 0x3C,
+	0x88, 0x3C, 0xEE, 0x3C, 0x07, 0x3D, 0x28, 0x3D, 0x6A, 0x3D, 0x95, 0x3D,
+	0xB1, 0x3D, 0xD1, 0x3D, 0xEE, 0x3D, 0xF7, 0x3D, 0x04, 0x3E, 0x34, 0x3E,
+	0x61, 0x3E, 0x7E, 0x3E, 0x87, 0x3E, 0x94, 0x3E, 0xC4, 0x3E, 0x55, 0x3F,
+	0x5B, 0x3F, 0xC6, 0x3F, 0xCC, 0x3F, 0xE6, 0x3F, 0xEC, 0xAC, 0x00, 0xF0,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x40, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
 	0xA2, 0x30, 0xA8, 0x30, 0xFE, 0x30, 0x15, 0x32, 0x1B, 0x32, 0xB5, 0x32,
 	0xBB, 0x32, 0x19, 0x33, 0x28, 0x33, 0x36, 0x33, 0xB3, 0x33, 0x00, 0x34,
 	0x73, 0x34, 0x79, 0x34, 0x8C, 0x34, 0x35, 0x35, 0x41, 0x35, 0xCF, 0x35,
@@ -3044,172 +2109,18 @@ const uint8_t consoleConverterBinary[37376] = {
 	0x30, 0x3E, 0x50, 0x3E, 0x58, 0x3E, 0x74, 0x3E, 0x7C, 0x3E, 0xC0, 0x3E,
 	0xD4, 0x3E, 0xE4, 0x3E, 0xF4, 0x3E, 0x00, 0x3F, 0x20, 0x3F, 0x2C, 0x3F,
 	0x34, 0x3F, 0x68, 0x3F, 0x78, 0x3F, 0x84, 0x3F, 0xA4, 0x3F, 0xB0, 0x3F,
-	0xD0, 0x3F, 0xDC, 0x3F, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+	0xD0, 0x3F, 0xDC, 0x3F, 0xFC, 0x90, 0x04, 0xF0, 0x34, 0x80, 0x00, 0x00,
 	0x44, 0x00, 0x00, 0x00, 0x08, 0x30, 0x28, 0x30, 0x30, 0x30, 0x38, 0x30,
 	0x44, 0x30, 0x64, 0x30, 0x6C, 0x30, 0x74, 0x30, 0x80, 0x30, 0xA0, 0x30,
 	0xB0, 0x30, 0xD4, 0x30, 0xDC, 0x30, 0xE4, 0x30, 0xEC, 0x30, 0xF4, 0x30,
 	0xFC, 0x30, 0x04, 0x31, 0x0C, 0x31, 0x14, 0x31, 0x1C, 0x31, 0x24, 0x31,
 	0x2C, 0x31, 0x38, 0x31, 0x58, 0x31, 0x64, 0x31, 0x84, 0x31, 0x8C, 0x31,
-	0x94, 0x31, 0x9C, 0x31, 0x00, 0xA0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-	0x00, 0x30, 0x2C, 0x30, 0x68, 0x30, 0x88, 0x30, 0xD8, 0x30, 0xF4, 0x30,
-	0x30, 0x31, 0x4C, 0x31, 0x78, 0x31, 0xA4, 0x31, 0xE0, 0x31, 0x18, 0x32,
-	0x58, 0x32, 0xA8, 0x32, 0xC4, 0x32, 0xE8, 0x32, 0x14, 0x33, 0x50, 0x33,
-	0x8C, 0x33, 0x90, 0x33, 0x94, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	0x94, 0x31, 0x9C, 0x31, 0xD1, 0x04, 0x10, 0x34, 0x90, 0x06, 0xF0, 0x19,
+	0x30, 0x2C, 0x30, 0x68, 0x30, 0x88, 0x30, 0xD8, 0x30, 0xF4, 0x30, 0x30,
+	0x31, 0x4C, 0x31, 0x78, 0x31, 0xA4, 0x31, 0xE0, 0x31, 0x18, 0x32, 0x58,
+	0x32, 0xA8, 0x32, 0xC4, 0x32, 0xE8, 0x32, 0x14, 0x33, 0x50, 0x33, 0x8C,
+	0x33, 0x90, 0x33, 0x94, 0x98, 0x02, 0x0F, 0x01, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
 #endif
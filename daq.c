@@ -1,4 +1,6 @@
 #include "daq.h"
+#include "system.h"
+#include "diskio.h"
 
 // Data type strings
 static const char* const dataType[] = {
@@ -6,12 +8,26 @@ static const char* const dataType[] = {
 	"BINARY"
 };
 
+// Signal source strings
+static const char* const signalType[] = {
+	"ADC",
+	"RAMP",
+	"SINE",
+	"WORST"
+};
+
 // Buffer used for string formatted data
 RingBuffer *strBuff;
 
 // FatFS file object
 FIL dataFile;
 
+// Data file segments, long recordings are split across files of at most DAQ_SEGMENT_SIZE bytes
+static char dataFnBase[40]; // File name of the recording without extension, shared by all segments
+static uint32_t segment; // Index of the current file segment
+static uint64_t segmentFirstSample; // Index of the first sample in the current file segment
+static uint32_t segmentHeaderSize; // Size of the header in the current file segment
+
 // DAQ configuration data
 DAQ daq;
 
@@ -19,33 +35,87 @@ DAQ daq;
 void (*daq_loop)(void);
 
 // Time tracking
-static volatile uint32_t sampleCount; // Count of samples taken in the current recording, used for timing verification
-static uint32_t sampleStrfCount; // Count of samples string formatted in the current recording
+static volatile uint64_t sampleCount; // Count of samples taken in the current recording, used for timing verification
+static uint64_t sampleStrfCount; // Count of samples string formatted in the current recording
 static volatile uint32_t dwt_lastTime; // Time of the last sample according to the DWT timer, used to measure sampling integral error and jitter
 static volatile uint64_t dwt_elapsedTime; // Total sampling elapsed time according to the DWT timer
 static uint32_t buttonTime; // Time that the record button was pressed, used for trigger delay
 
 // Sampling
 static uint32_t rawValSum[MAX_CHAN]; // Raw sample values, summed over the number of over-samples
+static uint32_t rawVoutSum; // Raw vout values, summed over the number of over-samples
 static uint32_t MRTCount; // Count of runs of the MRT1 timer interrupt
 static uint32_t subSampleCount; // Count of over samples
 
 // Vout raw value read from ADC
 static volatile uint16_t rawVout;
 
+// Index of the sample being summed, counts saved and dropped samples
+static uint64_t sampleIndex;
+
+// Overload handling, samples that do not fit in the raw buffer are dropped and recorded as gaps
+typedef struct Gap {
+	uint64_t index;	// Index of the first dropped sample
+	uint32_t count;	// Number of dropped samples
+} Gap;
+static Gap gapQueue[GAP_QUEUE_SIZE]; // Gaps closed by the RIT interrupt, waiting for the writer
+static volatile uint8_t gapHead; // Count of gaps queued by the RIT interrupt
+static volatile uint8_t gapTail; // Count of gaps taken by the writer
+static Gap gapOpen; // Gap being counted by the RIT interrupt, closed by the next saved sample
+static volatile uint64_t droppedTotal; // Count of samples dropped in the current recording
+static uint32_t gapTotal; // Count of gaps written in the current recording
+static uint64_t gapSamples; // Count of dropped samples the binary writer has reached
+static uint64_t gapFillBytes; // Bytes of GAP_FILL_VALUE still to write in binary data for the last gap reached
+static uint64_t rawBytesRead; // Bytes of binary data read from the raw buffer
+static Gap gapRecords[GAP_RECORD_POINTS]; // Gaps reached by the binary writer, waiting to be written to the gap file
+static uint32_t gapRecordCount; // Gaps waiting in gapRecords
+
+// Battery trace, the battery voltage and the data written over the recording, to relate runtime to load
+typedef struct Vbat_Point {
+	uint32_t seconds;	// Time since the recording started
+	uint32_t mV;		// Average battery voltage
+	uint32_t kB;		// Data written to the card since the recording started
+} Vbat_Point;
+static Vbat_Point vbatTrace[VBAT_TRACE_POINTS];
+static uint32_t vbatTraceCount; // Points waiting to be written
+static uint32_t vbatTraceNext; // Recording time of the next point in seconds
+static uint32_t recordStart; // RTC time the recording started
+
+// Synthetic signal
+static uint16_t synthVal[MAX_CHAN]; // Synthetic values of the sample being summed, replace the ADC conversions
+static uint16_t synthSine[SYNTH_SINE_SIZE]; // One period of the synthetic sine
+
 // Flag set when data recording starts
 static volatile bool recordData;
 
+// Conversion timing of the config, low power mode converts at a lower rate
+static uint32_t conversionCycles; // Clock cycles per conversion
+static uint32_t voutDivider; // Conversions per vout update
+static int32_t voutIntGain; // Vout integral gain, keeps the integral time constant at any update rate
+
+// Low power mode collects blocks in the burst buffer and writes them together
+static char *burstBuff; // LOWPOWER_BURST_BLOCKS blocks from the arena, NULL outside low power mode
+static uint32_t burstCount; // Blocks collected in the burst buffer
+static uint32_t writeThreshold; // Raw buffer fill in bytes that wakes the writer task
+
+// Sample paths of the recording config, selected once in daq_init
+static void (*daq_collectSample)(uint16_t *rawVal); // Averaged values of the recorded channels, from the RIT interrupt
+static void (*daq_formatSample)(uint16_t *rawData, char *sampleStr); // Readable string of a sample
+static bool (*daq_makeBlock)(void); // Block of file data for the data mode, false if a block cannot be made
+static bool daq_readableBlock(void);
+static bool daq_binaryBlock(void);
+
 // Vout PWM
-// Takes 195cc (2.7us). At 10000Hz, takes 2.7% of cpu time
-void daq_updateVout(void){
+// Cycle counts are reported in profile.txt when PROFILE is defined
+RAMFUNC void daq_updateVout(void){
     static int32_t intError;
     int32_t propError, pwmOut;
+    uint32_t profStart = prof_start();
 
     // Theoretical mv / LSB = 1000 * ((100+20)/20) * 4.096 / (1 << 16) = 0.375
     propError =  daq.mv_out - (3 * rawVout) / 8; // Units are mv
 
-    intError += propError; // Units are mv * ms * 10, or giving a rate of 10e6/(v*s)
+    intError += propError * voutIntGain; // Units are mv * ms * 10, or giving a rate of 10e6/(v*s)
 
     // Integral Error Saturation
     intError = clamp(intError, -100000, 100000); // 10E5 means saturation at 10[mv*s]
@@ -60,12 +130,196 @@ void daq_updateVout(void){
 
     // Set PWM output
     Chip_SCTPWM_SetDutyCycle(LPC_SCT0, 1, pwmOut);
+
+    prof_end(PROF_UPDATE_VOUT, profStart);
+}
+
+#ifndef DAQ_SPECIALIZED
+// Copy the averaged values of the enabled channels, and vout if recorded, to rawVal
+// Generic path, checks the config of each channel for each sample
+static RAMFUNC void daq_collectGeneric(uint16_t *rawVal){
+	uint8_t i = 0;
+	uint8_t ch = 0;
+	for(i=0;i<MAX_CHAN;i++){
+		if(daq.channel[i].enable){
+			rawVal[ch++] = (uint16_t) (rawValSum[i] / daq.subsamples);
+		}
+	}
+	if(daq.vout_record){
+		rawVal[ch++] = (uint16_t) (rawVoutSum / daq.subsamples);
+	}
+}
+#else
+/* Specialized sample paths
+ * Each variant is the always inlined body below with the config as constants, the compiler
+ * drops the steps of the disabled channels and the config branches, leaving straight line code.
+ * The variants give the same values and strings as the generic path.
+ */
+_Static_assert(MAX_CHAN == 3, "Specialized sample paths are generated for 3 channels");
+
+// Scaling of a recorded channel from its config and range, fixed for the recording
+typedef struct Value_Scale {
+	fix64_t *zero_offset;		// Raw value of 0 V in the channel range
+	fix64_t *uV_per_LSB;		// Sensitivity of the channel range
+	fix64_t *offset_uV;			// Zero offset of the sensor
+	fix64_t *units_per_volt;	// Sensitivity of the sensor, mantissa
+	int32_t exp;				// Decimal exponent of the scaled value
+} Value_Scale;
+static Value_Scale valueScale[MAX_CHAN]; // Scaling of each recorded channel, in recorded order
+static int64_t samplePeriodUs; // Microseconds between samples, exact for the sample rates in [1,2,5]*10^k
+
+// Copy the averaged values of the channels in mask, and vout if recorded, to rawVal
+static inline __attribute__((always_inline)) void daq_collect(uint16_t *rawVal, const uint32_t mask, const bool vout){
+	uint32_t subsamples = daq.subsamples;
+	if(mask & 1) *rawVal++ = (uint16_t) (rawValSum[0] / subsamples);
+	if(mask & 2) *rawVal++ = (uint16_t) (rawValSum[1] / subsamples);
+	if(mask & 4) *rawVal++ = (uint16_t) (rawValSum[2] / subsamples);
+	if(vout) *rawVal++ = (uint16_t) (rawVoutSum / subsamples);
+}
+
+#define DAQ_COLLECT(mask, vout) \
+	static RAMFUNC void daq_collect##mask##vout(uint16_t *rawVal){ daq_collect(rawVal, mask, vout); }
+DAQ_COLLECT(0,0) DAQ_COLLECT(1,0) DAQ_COLLECT(2,0) DAQ_COLLECT(3,0)
+DAQ_COLLECT(4,0) DAQ_COLLECT(5,0) DAQ_COLLECT(6,0) DAQ_COLLECT(7,0)
+DAQ_COLLECT(0,1) DAQ_COLLECT(1,1) DAQ_COLLECT(2,1) DAQ_COLLECT(3,1)
+DAQ_COLLECT(4,1) DAQ_COLLECT(5,1) DAQ_COLLECT(6,1) DAQ_COLLECT(7,1)
+
+// Collect variants by enabled channel mask and vout_record
+static void (*const collectVariant[1 << MAX_CHAN][2])(uint16_t *rawVal) = {
+	{daq_collect00, daq_collect01}, {daq_collect10, daq_collect11},
+	{daq_collect20, daq_collect21}, {daq_collect30, daq_collect31},
+	{daq_collect40, daq_collect41}, {daq_collect50, daq_collect51},
+	{daq_collect60, daq_collect61}, {daq_collect70, daq_collect71}
+};
+
+// Scale a raw channel value to [units] * 10^exp, with the ratiometric correction if ratio is not NULL
+static inline __attribute__((always_inline)) void daq_scale(dec_float_t *scaledVal, uint16_t raw, Value_Scale *s, fix64_t *ratio){
+	fix64_t *val = (fix64_t*)scaledVal;
+	intToFix(val, raw);
+	fix_sub(val, s->zero_offset);
+	fix_mult(val, s->uV_per_LSB);
+	if(ratio){
+		fix_mult(val, ratio);
+	}
+	fix_sub(val, s->offset_uV);
+	fix_mult(val, s->units_per_volt);
+	scaledVal->exp = s->exp;
+}
+
+// Append a value to a sample string, return length appended
+static inline __attribute__((always_inline)) int32_t daq_formatValue(char *str, dec_float_t *val){
+	str[0] = ',';
+	return 1 + decFloatToStr(str + 1, val, 4); // Precision = 4
+}
+
+// Convert rawData of ch channels, vout if recorded, into a readable scaled and formatted output string
+// Cycle counts are reported in profile.txt when PROFILE is defined
+static inline __attribute__((always_inline)) void daq_format(uint16_t *rawData, char *sampleStr,
+		const uint32_t ch, const bool vout, const bool ratiometric){
+	uint32_t profStart = prof_start();
+	dec_float_t scaledVal[MAX_VALUES];
+	fix64_t ratio;
+	int32_t size;
+
+	int64_t us = (int64_t)sampleStrfCount++ * samplePeriodUs;
+
+	// Vout is recorded after the channels
+	if(ratiometric){
+		ratio = daq_ratiometricScale(rawData[ch]);
+	}
+	if(ch > 0) daq_scale(scaledVal + 0, rawData[0], valueScale + 0, ratiometric ? &ratio : NULL);
+	if(ch > 1) daq_scale(scaledVal + 1, rawData[1], valueScale + 1, ratiometric ? &ratio : NULL);
+	if(ch > 2) daq_scale(scaledVal + 2, rawData[2], valueScale + 2, ratiometric ? &ratio : NULL);
+	if(vout){
+		scaledVal[ch]._int = rawData[ch] * VOUT_UV_PER_LSB;
+		scaledVal[ch].frac = 0;
+		scaledVal[ch].exp = -6;
+	}
+
+	size = usToStr(sampleStr, us, daq.time_res);
+	if(ch + vout > 0) size += daq_formatValue(sampleStr + size, scaledVal + 0);
+	if(ch + vout > 1) size += daq_formatValue(sampleStr + size, scaledVal + 1);
+	if(ch + vout > 2) size += daq_formatValue(sampleStr + size, scaledVal + 2);
+	if(ch + vout > 3) size += daq_formatValue(sampleStr + size, scaledVal + 3);
+	sampleStr[size++] = '\n';
+	sampleStr[size++] = '\0';
+
+	prof_end(PROF_READABLE_FORMAT, profStart);
+}
+
+#define DAQ_FORMAT(ch, vout, ratiometric) \
+	static void daq_readableFormat##ch##vout##ratiometric(uint16_t *rawData, char *sampleStr){ \
+		daq_format(rawData, sampleStr, ch, vout, ratiometric); \
+	}
+DAQ_FORMAT(0,0,0) DAQ_FORMAT(1,0,0) DAQ_FORMAT(2,0,0) DAQ_FORMAT(3,0,0)
+DAQ_FORMAT(0,1,0) DAQ_FORMAT(1,1,0) DAQ_FORMAT(2,1,0) DAQ_FORMAT(3,1,0)
+DAQ_FORMAT(0,1,1) DAQ_FORMAT(1,1,1) DAQ_FORMAT(2,1,1) DAQ_FORMAT(3,1,1)
+
+// Format variants by channel_count and vout_record + ratiometric, ratiometric requires vout_record
+static void (*const formatVariant[MAX_CHAN + 1][3])(uint16_t *rawData, char *sampleStr) = {
+	{daq_readableFormat000, daq_readableFormat010, daq_readableFormat011},
+	{daq_readableFormat100, daq_readableFormat110, daq_readableFormat111},
+	{daq_readableFormat200, daq_readableFormat210, daq_readableFormat211},
+	{daq_readableFormat300, daq_readableFormat310, daq_readableFormat311}
+};
+#endif
+
+// Copy the averaged values of the enabled channels to rawVal, corrected to the nominal vout about the zero offset of
+// their range, rounded and clamped to the raw range. Binary ratiometric path, the data holds the channels only
+static RAMFUNC void daq_collectRatiometric(uint16_t *rawVal){
+	fix64_t ratio = daq_ratiometricScale((uint16_t) (rawVoutSum / daq.subsamples));
+	fix64_t val;
+	uint8_t i = 0;
+	uint8_t ch = 0;
+	for(i=0;i<MAX_CHAN;i++){
+		Channel_Config *c = &daq.channel[i];
+		if(c->enable){
+			fix64_t *zero = c->range == V5 ? &c->v5_zero_offset : &c->v24_zero_offset;
+			intToFix(&val, (int32_t) (rawValSum[i] / daq.subsamples));
+			fix_sub(&val, zero);
+			fix_mult(&val, &ratio);
+			fix_add(&val, zero);
+			rawVal[ch++] = (uint16_t) clamp(val._int + (int32_t) (val.frac >> 31), 0, 0xFFFF);
+		}
+	}
+}
+
+// Select the sample paths of the config, fixed for the recording
+static void daq_selectPaths(void){
+	daq_makeBlock = daq.data_type == READABLE ? daq_readableBlock : daq_binaryBlock;
+#ifdef DAQ_SPECIALIZED
+	uint32_t mask = 0;
+	uint8_t ch = 0;
+	int i;
+	for(i=0;i<MAX_CHAN;i++){
+		Channel_Config *c = &daq.channel[i];
+		if(c->enable){
+			mask |= 1 << i;
+			valueScale[ch].zero_offset = c->range == V5 ? &c->v5_zero_offset : &c->v24_zero_offset;
+			valueScale[ch].uV_per_LSB = c->range == V5 ? &c->v5_uV_per_LSB : &c->v24_uV_per_LSB;
+			valueScale[ch].offset_uV = &c->offset_uV;
+			valueScale[ch].units_per_volt = (fix64_t*)&c->units_per_volt;
+			valueScale[ch].exp = c->units_per_volt.exp - 6; // account for uV to V conversion
+			ch++;
+		}
+	}
+	samplePeriodUs = 1000000 / daq.sample_rate;
+	daq_collectSample = collectVariant[mask][daq.vout_record];
+	daq_formatSample = formatVariant[daq.channel_count][daq.vout_record + daq.ratiometric];
+#else
+	daq_collectSample = daq_collectGeneric;
+	daq_formatSample = daq_readableFormat;
+#endif
+	if(daq.data_type == BINARY && daq.ratiometric){
+		daq_collectSample = daq_collectRatiometric;
+	}
 }
 
 // Sample timer
-// 268cc no save, 701cc when saving to buffer
-// 484cc total cpu time per 3-channel sample not writing to ring buffer, 917cc when writing to buffer
-void RIT_IRQHandler(void){
+// Cycle counts are reported in profile.txt when PROFILE is defined
+RAMFUNC void RIT_IRQHandler(void){
+	uint32_t profStart = prof_start();
+	trace_isr(TRACE_RIT_ENTER);
 	Chip_RIT_ClearIntStatus(LPC_RITIMER);
 
 	/* Check sample time against DWT timer, 97cc */
@@ -74,28 +328,43 @@ void RIT_IRQHandler(void){
 	dwt_lastTime = dwt_currentTime;
 
 	// Read current target sample time in clock cycles, increment sample counter
-	uint64_t cc = (uint64_t)++sampleCount * (SYS_CLOCK_RATE / CONVERSION_RATE);
+	uint64_t cc = ++sampleCount * conversionCycles;
 
 	// Compare to DWT time
 	int32_t dT = cc - dwt_elapsedTime;
 
 	// Error if sample timing is off by more than one conversion period
-	if(dT > (SYS_CLOCK_RATE/CONVERSION_RATE) || dT < -(SYS_CLOCK_RATE/CONVERSION_RATE)){
+	if(dT > (int32_t)conversionCycles || dT < -(int32_t)conversionCycles){
 		error(ERROR_SAMPLE_TIME);
 	}
 
 	/* Save data to the ring buffer for enabled channels after all sub-samples have been collected */
 	if (subSampleCount == daq.subsamples){
 		if(recordData){ // Only record data after recordData has been set true
-			uint8_t i = 0;
-			uint8_t ch = 0;
-			uint16_t rawVal[MAX_CHAN];
-			for(i=0;i<MAX_CHAN;i++){
-				if(daq.channel[i].enable){
-					rawVal[ch++] = (uint16_t) (rawValSum[i] / daq.subsamples);
+			uint16_t rawVal[MAX_VALUES];
+			daq_collectSample(rawVal);
+			// Save the sample, or drop it if the buffer is full or the gap cannot be queued
+			if(RingBuffer_getFree(rawBuff) >= 2*daq.value_count &&
+					(gapOpen.count == 0 || (uint8_t)(gapHead - gapTail) < GAP_QUEUE_SIZE)){
+				// Close the gap before the sample so the writer places it in the stream
+				if(gapOpen.count){
+					gapQueue[gapHead % GAP_QUEUE_SIZE] = gapOpen;
+					__DMB(); // Gap is stored before the writer can see it
+					gapHead++;
+					gapOpen.count = 0;
 				}
+				RingBuffer_writeData(rawBuff, &rawVal, 2*daq.value_count); // 16 bit samples = 2bytes/sample
+				if(RingBuffer_getSize(rawBuff) >= writeThreshold){
+					sched_post(TASK_WRITER);
+				}
+			} else {
+				if(gapOpen.count == 0){
+					gapOpen.index = sampleIndex;
+				}
+				gapOpen.count++;
+				droppedTotal++;
 			}
-			RingBuffer_writeData(rawBuff, &rawVal, 2*daq.channel_count); // 16 bit samples = 2bytes/sample
+			sampleIndex++;
 		}
 		subSampleCount = 0;
 	}
@@ -106,27 +375,46 @@ void RIT_IRQHandler(void){
 		for(i=0;i<MAX_CHAN;i++){
 			rawValSum[i] = 0;
 		}
+		rawVoutSum = 0;
+
+		// Synthetic values for the next sample
+		if(daq.signal != SIGNAL_ADC){
+			for(i=0;i<MAX_CHAN;i++){
+				synthVal[i] = daq_synthValue(sampleIndex, i);
+			}
+		}
 	}
 
 	// Reset MRT count and set MRT1 timer for ADC_US us repeating
 	MRTCount = 0;
 	Chip_MRT_SetInterval(LPC_MRT_CH(1), (ADC_US * (SYS_CLOCK_RATE / 1000000)) | MRT_INTVAL_LOAD);
 
-	// Read vout from the last conversion
+	// Read vout from the last conversion, sum for recording at no extra conversion cost
 	rawVout = LPC_SPI1->RXDAT;
+	rawVoutSum += rawVout;
 
 	// Start conversion of ch1
 	LPC_SPI1->TXDATCTL = SPI_TXDATCTL_LEN(16-1) | SPI_TXDATCTL_EOT | SPI_TXCTL_ASSERT_SSEL0;
 
 	// Increment sub sample counter
 	subSampleCount++;
+
+	trace_isr(TRACE_RIT_EXIT);
+	prof_end(PROF_RIT, profStart);
 }
 
 // ADC sample timing interrupt, called from main MRT interrupt in system
-// 51cc, 49cc, 116cc no update /333cc vout update
-void MRT1_IRQHandler(void){
-	// Read result of last conversion
-	rawValSum[MRTCount++] += LPC_SPI1->RXDAT & 0xFFFF;
+// Cycle counts are reported in profile.txt when PROFILE is defined
+RAMFUNC void MRT1_IRQHandler(void){
+	uint32_t profStart = prof_start();
+	trace_isr(TRACE_MRT1_ENTER);
+
+	// Read result of last conversion, replaced by the synthetic signal if enabled so the SPI timing is unchanged
+	uint16_t val = LPC_SPI1->RXDAT & 0xFFFF;
+	if(daq.signal != SIGNAL_ADC){
+		val = synthVal[MRTCount];
+	}
+	rawValSum[MRTCount++] += val;
 
 	// Start the next conversion
 	LPC_SPI1->TXDATCTL = SPI_TXDATCTL_LEN(16-1) | SPI_TXDATCTL_EOT | SPI_TXCTL_ASSERT_SSEL0;
@@ -137,10 +425,13 @@ void MRT1_IRQHandler(void){
 		Chip_MRT_IntClear(LPC_MRT_CH(1));
 
 		// Update output value at the PWM frequency
-		if(subSampleCount % (CONVERSION_RATE/VOUT_PWM_RATE) == 0){
+		if(subSampleCount % voutDivider == 0){
 			daq_updateVout();
 		}
 	}
+
+	trace_isr(TRACE_MRT1_EXIT);
+	prof_end(PROF_MRT1, profStart);
 }
 
 // Set up daq
@@ -150,25 +441,76 @@ void daq_init(void){
 
 	// Limit config values to valid values
 	daq_configCheck();
+	daq_selectPaths();
+
+	// Log the predicted overflow risk of the config on this card, benchmarking a new card first
+	bench_card();
+	bench_logPlan();
+
+	// Clear stage cycle statistics and disk write telemetry for the new recording
+	prof_reset();
+	disk_telemetryReset();
+
+	// Vout is updated at VOUT_PWM_RATE, or at each conversion when converting slower in low power mode
+	conversionCycles = SYS_CLOCK_RATE / daq.conversion_rate;
+	voutDivider = daq.conversion_rate > VOUT_PWM_RATE ? daq.conversion_rate / VOUT_PWM_RATE : 1;
+	voutIntGain = VOUT_PWM_RATE / (daq.conversion_rate / voutDivider);
 
 	// Set up ADC
 	adc_spi_setup();
 
 	// Set up channel ranges in hardware mux
-#ifndef DEBUG
 	int i;
+#ifndef DEBUG
 	for(i=0;i<3;i++){ // This Kills the UART
 		Chip_GPIO_SetPinDIROutput(LPC_GPIO, 0, rsel_pins[i]);
 		Chip_GPIO_SetPinState(LPC_GPIO, 0, rsel_pins[i], daq.channel[i].range);
 	}
 #endif
 
-	// Clear the raw data buffer
-	RingBuffer_clear(rawBuff);
-
-	// Initialize the string formatted buffer if in readable mode
+	// Lay out the buffers for the data mode, binary mode has no string buffer and gives its memory to the raw buffer
 	if(daq.data_type == READABLE){
-		strBuff = RingBuffer_init(BLOCK_SIZE + SAMPLE_STR_SIZE);
+		mem_plan(MEM_PLAN_READABLE);
+		strBuff = RingBuffer_init(STR_BUFF_SIZE);
+	}else{
+		mem_plan(MEM_PLAN_BINARY);
+		strBuff = NULL;
+	}
+	// Low power mode takes the burst buffer from the raw buffer
+	burstBuff = daq.low_power ? mem_alloc(BURST_BUFF_SIZE) : NULL;
+	burstCount = 0;
+	rawBuff = RingBuffer_init(daq_rawBuffSize());
+
+	// The plans are checked at build time in mem.c, a buffer missing here is a plan out of step with daq_init
+	// The error is handled when the control task returns, before the sampling interrupts are started
+	if(!rawBuff || (daq.data_type == READABLE && !strBuff) || (daq.low_power && !burstBuff)){
+		error(ERROR_BUF_OVF);
+		return;
+	}
+
+	// Wake the writer for each block, or in low power mode once the samples make about a burst of file data
+	writeThreshold = WRITE_THRESHOLD;
+	if(daq.low_power){
+		writeThreshold = daq.data_type == BINARY ? BURST_BUFF_SIZE :
+				BURST_BUFF_SIZE * 2 * daq.value_count / (8 + daq.time_res + 12 * daq.value_count);
+	}
+
+	// Start at sample 0 with no gaps
+	sampleIndex = 0;
+	gapHead = gapTail = 0;
+	gapOpen.count = 0;
+	droppedTotal = 0;
+	gapTotal = 0;
+	gapSamples = 0;
+	gapFillBytes = 0;
+	gapRecordCount = 0;
+	rawBytesRead = 0;
+
+	// Start the synthetic signal at sample 0
+	if(daq.signal == SIGNAL_SINE){
+		for(i=0;i<SYNTH_SINE_SIZE;i++){
+			synthSine[i] = (uint16_t)lround(32768 + SYNTH_SINE_AMPL * sin(2 * M_PI * i / SYNTH_SINE_SIZE));
+		}
 	}
 
 	// 0 the sample counts
@@ -203,16 +545,19 @@ void daq_init(void){
 	while(~LPC_SPI1->STAT & SPI_STAT_TXRDY){};
 	LPC_SPI1->TXDATCTL = SPI_TXDATCTL_LEN(16-1) | SPI_TXDATCTL_EOT | SPI_TXCTL_ASSERT_SSEL0;
 
-	// Start time according to DWT timer
+	// Start time according to DWT timer, and the sleep time of the core and card over the same period
 	dwt_lastTime = DWT_Get();
 	dwt_elapsedTime = 0;
+	sched_sleepCycles = 0;
+	sd_sleepCycles = 0;
+	sd_wakes = 0;
 
 	// Set up sampling interrupt using RITimer
 	Chip_RIT_Init(LPC_RITIMER);
 
 	/* Set timer compare value and periodic mode */
 	// Do not use Chip_RIT_SetTimerIntervalHz, for timing critical operations, it has an off by 1 error on the period in clock cycles
-	uint64_t cmp_value = SystemCoreClock / CONVERSION_RATE - 1;
+	uint64_t cmp_value = SystemCoreClock / daq.conversion_rate - 1;
 	Chip_RIT_SetCompareValue(LPC_RITIMER, cmp_value);
 	Chip_RIT_EnableCompClear(LPC_RITIMER);
 
@@ -239,12 +584,19 @@ void daq_record(){
 	// Make the data file
 	daq_makeDataFile();
 
-	// Write data file header
-	daq_header();
+	// Start the battery trace with the recording
+	recordStart = Chip_RTC_GetCount(LPC_RTC);
+	vbatTraceCount = 0;
+	vbatTraceNext = 0;
 
 	// Set loop to write data from buffer to file
 	daq_loop = daq_writeData;
 
+	// Tick slower in low power mode, the writer is woken by the sample buffer
+	if(daq.low_power){
+		system_setTickRate(TICKRATE_HZ_LOWPOWER);
+	}
+
 	// Begin recording data in RIT interrupt
 	recordData = true;
 }
@@ -254,15 +606,304 @@ void daq_makeDataFile(void){
 	time_t t = Chip_RTC_GetCount(LPC_RTC);
 	struct tm * tm;
 	tm = localtime(&t);
-	char fn[40];
-	uint8_t fn_size = 0;
-	fn_size += strftime(fn,40,"%Y-%m-%d_%H-%M-%S_data",tm);
+	strftime(dataFnBase,40,"%Y-%m-%d_%H-%M-%S_data",tm);
+
+	// Start the first segment
+	segment = 0;
+	segmentFirstSample = 0;
+	daq_openSegment();
+}
+
+// Open the file for the current segment and write its header
+// Segment 0 is named after the recording, later segments append the segment index
+void daq_openSegment(void){
+	char fn[48];
+	uint8_t fn_size = strlen(strcpy(fn, dataFnBase));
+	if(segment > 0){
+		fn_size += sprintf(fn+fn_size, "_%03u", (unsigned int)segment);
+	}
 	if(daq.data_type == READABLE){
-		strcat(fn+fn_size,".txt");
+		strcpy(fn+fn_size,".txt");
 	}else{
-		strcat(fn+fn_size,".dat");
+		strcpy(fn+fn_size,".dat");
 	}
 	f_open(&dataFile,fn,FA_CREATE_ALWAYS | FA_WRITE);
+
+	// Write data file header
+	daq_header();
+	segmentHeaderSize = f_size(&dataFile);
+}
+
+// Return the count of samples written to the current segment
+static uint64_t daq_segmentSamples(void){
+	if(daq.data_type == READABLE){
+		return sampleStrfCount - segmentFirstSample;
+	}else{
+		return (f_size(&dataFile) - segmentHeaderSize) / (2 * daq.value_count);
+	}
+}
+
+// Returns true if the current segment has reached the size or time boundary
+static bool daq_segmentFull(void){
+	if(f_size(&dataFile) >= DAQ_SEGMENT_SIZE){
+		return true;
+	}
+#if DAQ_SEGMENT_SECONDS > 0
+	if(daq_segmentSamples() >= (uint64_t)daq.sample_rate * DAQ_SEGMENT_SECONDS){
+		return true;
+	}
+#endif
+	return false;
+}
+
+// Size of the raw sample buffer of the current config
+uint32_t daq_rawBuffSize(void){
+	if(daq.data_type == READABLE){
+		return daq.low_power ? RAW_BUFF_SIZE_READABLE_LOWPOWER : RAW_BUFF_SIZE_READABLE;
+	}else{
+		return daq.low_power ? RAW_BUFF_SIZE_BINARY_LOWPOWER : RAW_BUFF_SIZE_BINARY;
+	}
+}
+
+// Write the blocks collected in low power mode, committing the file so FatFs holds nothing unwritten
+static void daq_burstFlush(void){
+	if(burstCount == 0){
+		return;
+	}
+	daq_writeBlock(burstBuff, burstCount * BLOCK_SIZE);
+	burstCount = 0;
+	if(f_sync(&dataFile) != FR_OK){
+		error(ERROR_F_WRITE);
+	}
+}
+
+// Write a block made by daq_makeBlock, in low power mode the block is in the burst buffer
+// A full burst is written in one multiple block write, then the card is powered off until the next one
+static void daq_putBlock(char *data){
+	if(!burstBuff){
+		daq_writeBlock(data, BLOCK_SIZE);
+	}else if(++burstCount == LOWPOWER_BURST_BLOCKS){
+		daq_burstFlush();
+		sd_sleep();
+	}
+}
+
+// Return where daq_makeBlock makes the next block, block on the stack or the next block of the burst buffer
+static char *daq_nextBlock(char *block){
+	return burstBuff ? burstBuff + burstCount * BLOCK_SIZE : block;
+}
+
+// Return the oldest gap queued by the RIT interrupt, NULL if there is none
+static Gap *daq_nextGap(void){
+	if(gapTail == gapHead){
+		return NULL;
+	}
+	return &gapQueue[gapTail % GAP_QUEUE_SIZE];
+}
+
+// Release the oldest gap back to the RIT interrupt
+static void daq_popGap(void){
+	gapTotal++;
+	gapTail++;
+}
+
+// Format a gap record
+// gapStr Ex. gap, 123456, 250
+static void daq_gapFormat(Gap *gap, char *gapStr){
+	int32_t size = sprintf(gapStr, "gap, ");
+	size += uint64ToStr(gapStr + size, gap->index);
+	sprintf(gapStr + size, ", %u\n", (unsigned int)gap->count);
+}
+
+// Append the gaps waiting in RAM to the gap file
+static void daq_gapFlush(void){
+	FIL gapFile;
+	char fn[56];
+	char gapStr[SAMPLE_STR_SIZE];
+	uint32_t i;
+
+	if(gapRecordCount == 0){
+		return;
+	}
+	sprintf(fn, "%s_gaps.txt", dataFnBase);
+	if(f_open(&gapFile, fn, FA_OPEN_ALWAYS | FA_WRITE) == FR_OK){
+		if(f_size(&gapFile) == 0){
+			f_puts("gap, first sample, sample count\n", &gapFile);
+		}
+		f_lseek(&gapFile, f_size(&gapFile));
+		for(i=0;i<gapRecordCount;i++){
+			daq_gapFormat(&gapRecords[i], gapStr);
+			f_puts(gapStr, &gapFile);
+		}
+		f_close(&gapFile);
+	}
+	gapRecordCount = 0;
+}
+
+// Bytes of binary data the raw buffer makes, with the fill of the gaps queued in it and of the last gap reached
+// The gaps are read before the raw buffer, the samples after a gap queued in between are not counted
+static uint64_t daq_binaryAvailable(void){
+	uint8_t head = gapHead;
+	uint64_t bytes = gapFillBytes;
+	uint8_t i;
+	for(i=gapTail;i!=head;i++){
+		bytes += (uint64_t)gapQueue[i % GAP_QUEUE_SIZE].count * 2 * daq.value_count;
+	}
+	return bytes + RingBuffer_getSize(rawBuff);
+}
+
+// Read up to size bytes of binary data, returns the bytes read
+// Each dropped sample is written in place as GAP_FILL_VALUE values, so the data keeps one sample per sample period
+// Each gap reached is listed in the gap file by the index of its first dropped sample, the gaps are kept in RAM
+// and written GAP_RECORD_POINTS at a time, an overload does not add a file open per gap
+static int32_t daq_binaryRead(char *data, int32_t size){
+	_Static_assert((GAP_FILL_VALUE >> 8) == (GAP_FILL_VALUE & 0xFF), "gap fill is written bytewise");
+	int32_t n = 0;
+	while(n < size){
+		Gap *gap = daq_nextGap();
+		// Raw bytes up to the next gap
+		uint64_t rawBytes = gap ? (gap->index - gapSamples) * 2 * daq.value_count - rawBytesRead : UINT64_MAX;
+		if(gapFillBytes){
+			int32_t fill = (int32_t) clamp(gapFillBytes, 0, (uint64_t)(size - n));
+			memset(data + n, GAP_FILL_VALUE & 0xFF, fill);
+			gapFillBytes -= fill;
+			n += fill;
+		}else if(rawBytes == 0){
+			gapRecords[gapRecordCount] = *gap;
+			gapSamples += gap->count;
+			gapFillBytes = (uint64_t)gap->count * 2 * daq.value_count;
+			daq_popGap();
+			if(++gapRecordCount == GAP_RECORD_POINTS){
+				daq_gapFlush();
+			}
+		}else{
+			int32_t want = (int32_t) clamp(rawBytes, 0, (uint64_t)(size - n));
+			int32_t br = RingBuffer_read(rawBuff, data + n, want);
+			rawBytesRead += br;
+			n += br;
+			if(br < want){
+				break; // No more raw data
+			}
+		}
+	}
+	return n;
+}
+
+// Close the current segment on a whole sample and continue the recording in the next segment
+// Samples keep being buffered by the RIT interrupt while the files are switched, none are dropped
+void daq_nextSegment(void){
+	char data[BLOCK_SIZE];
+	int32_t br;
+
+	// The blocks collected for a burst come before the rest of the segment
+	daq_burstFlush();
+
+	switch (daq.data_type){
+	case READABLE:
+		// The string buffer always ends on a whole sample line, write all of it
+		br = RingBuffer_read(strBuff, data, BLOCK_SIZE);
+		daq_writeBlock(data, br);
+		break;
+	case BINARY:
+		// Write the rest of the last partially written sample, the fill of a gap continues in the next segment
+		br = (f_size(&dataFile) - segmentHeaderSize) % (2 * daq.value_count);
+		if(br > 0){
+			br = daq_binaryRead(data, 2 * daq.value_count - br);
+			daq_writeBlock(data, br);
+		}
+		daq_gapFlush();
+		break;
+	}
+
+	// Close the segment and link it in the manifest
+	uint64_t samples = daq_segmentSamples();
+	f_close(&dataFile);
+	daq_manifestEntry(samples);
+
+	// Open the next segment
+	segment++;
+	segmentFirstSample += samples;
+	daq_openSegment();
+	log_string("Acquisition Next Segment");
+}
+
+// Append the current segment to the recording manifest, which lists the segments of a multi-segment recording
+void daq_manifestEntry(uint64_t samples){
+	FIL manifest;
+	char fn[56];
+	char line[100];
+	uint32_t lSize;
+
+	sprintf(fn, "%s_manifest.txt", dataFnBase);
+	if(f_open(&manifest, fn, FA_OPEN_ALWAYS | FA_WRITE) != FR_OK){
+		error(ERROR_F_WRITE);
+		return;
+	}
+	if(f_size(&manifest) == 0){
+		f_puts("segment, file, first sample, sample count\n", &manifest);
+	}
+	f_lseek(&manifest, f_size(&manifest));
+
+	/**** Segment ****
+	 * Ex.
+	 * 1, 2015-03-02_20-02-43_data_001.dat, 2684354, 2684354
+	 */
+	lSize = sprintf(line, "%u, %s", (unsigned int)segment, dataFnBase);
+	if(segment > 0){
+		lSize += sprintf(line+lSize, "_%03u", (unsigned int)segment);
+	}
+	lSize += sprintf(line+lSize, "%s, ", daq.data_type == READABLE ? ".txt" : ".dat");
+	lSize += uint64ToStr(line+lSize, segmentFirstSample);
+	lSize += sprintf(line+lSize, ", ");
+	lSize += uint64ToStr(line+lSize, samples);
+	sprintf(line+lSize, "\n");
+	f_puts(line, &manifest);
+	f_close(&manifest);
+}
+
+// Append the points of the battery trace to the battery file
+static void daq_batteryFlush(void){
+	FIL vbatFile;
+	char fn[56];
+	char line[40];
+	uint32_t i;
+
+	if(vbatTraceCount == 0){
+		return;
+	}
+	sprintf(fn, "%s_battery.txt", dataFnBase);
+	if(f_open(&vbatFile, fn, FA_OPEN_ALWAYS | FA_WRITE) == FR_OK){
+		if(f_size(&vbatFile) == 0){
+			sprintf(line, "sample rate, %d, Hz\n", daq.sample_rate);
+			f_puts(line, &vbatFile);
+			f_puts("time[s], vbat[V], written[kB]\n", &vbatFile);
+		}
+		f_lseek(&vbatFile, f_size(&vbatFile));
+		for(i=0;i<vbatTraceCount;i++){
+			sprintf(line, "%u, %u.%03u, %u\n", (unsigned int)vbatTrace[i].seconds,
+					(unsigned int)(vbatTrace[i].mV / 1000), (unsigned int)(vbatTrace[i].mV % 1000), (unsigned int)vbatTrace[i].kB);
+			f_puts(line, &vbatFile);
+		}
+		f_close(&vbatFile);
+	}
+	vbatTraceCount = 0;
+}
+
+// Add the battery voltage in mV to the battery trace of the recording, called once per second
+// Points are kept in RAM and written VBAT_TRACE_POINTS at a time, so the trace rarely wakes the card in low power mode
+void daq_batteryTrace(uint32_t mV){
+	uint32_t seconds = Chip_RTC_GetCount(LPC_RTC) - recordStart;
+
+	if(daq_loop != daq_writeData || seconds < vbatTraceNext){
+		return;
+	}
+	vbatTrace[vbatTraceCount].seconds = seconds;
+	vbatTrace[vbatTraceCount].mV = mV;
+	vbatTrace[vbatTraceCount].kB = disk_telemetry.sectors / 2;
+	vbatTraceNext = seconds + VBAT_TRACE_SECONDS;
+	if(++vbatTraceCount == VBAT_TRACE_POINTS){
+		daq_batteryFlush();
+	}
 }
 
 // Wait for the trigger time to start
@@ -350,6 +991,32 @@ void daq_header(void){
 		}
 	}
 
+	/**** Vout ****
+	 * Ex.
+	 * vout, scale, 1.000000e+00, V/V, offset, 0.000000e+00, V, cscale, 3.750000e-04, V/LSB, coffset, 0.000000e+00, LSB
+	 * ratiometric, Y
+	 */
+	if(daq.vout_record){
+		hSize += sprintf(hStr+hSize, "vout, scale, 1.000000e+00, V/V, offset, 0.000000e+00, V, cscale, %.6e, V/LSB, coffset, 0.000000e+00, LSB\n", VOUT_UV_PER_LSB / 1000000.0);
+	}
+	hSize += sprintf(hStr+hSize, "ratiometric, %c\n", daq.ratiometric ? 'Y' : 'N');
+
+	/**** Signal source ****
+	 * Ex.
+	 * signal, RAMP
+	 */
+	hSize += sprintf(hStr+hSize, "signal, %s\n", signalType[daq.signal]);
+
+	/**** Gaps ****
+	 * Ex.
+	 * gaps, 2015-03-02_20-02-43_data_gaps.txt
+	 * Samples dropped on overload are marked by "gap, first sample, sample count" lines in readable data.
+	 * Binary data holds GAP_FILL_VALUE in each value of a dropped sample, and the gaps are listed in the gap file
+	 */
+	if(daq.data_type == BINARY){
+		hSize += sprintf(hStr+hSize, "gaps, %s_gaps.txt\n", dataFnBase);
+	}
+
 	/**** Sample Rate ****
 	 * Ex.
 	 * sample rate, 1000, Hz
@@ -358,6 +1025,16 @@ void daq_header(void){
 	hSize += sprintf(hStr+hSize, "sample rate, %d, Hz\n", daq.sample_rate);
 	hSize += sprintf(hStr+hSize, "sample period, %.6f, s\n", 1.0 / daq.sample_rate);
 
+	/**** Segment ****
+	 * Ex.
+	 * segment, 1
+	 * segment start, 3600.000, s
+	 */
+	hSize += sprintf(hStr+hSize, "segment, %u\n", (unsigned int)segment);
+	hSize += sprintf(hStr+hSize, "segment start, ");
+	hSize += usToStr(hStr+hSize, (int64_t)((segmentFirstSample * 1000000) / daq.sample_rate), daq.time_res);
+	hSize += sprintf(hStr+hSize, ", s\n");
+
 	/**** End header ****
 	 * Ex.
 	 * end header
@@ -375,6 +1052,9 @@ void daq_header(void){
 				hSize += sprintf(hStr+hSize, ", ch%d[%s]", i+1, daq.channel[i].unit_name);
 			}
 		}
+		if(daq.vout_record){
+			hSize += sprintf(hStr+hSize, ", vout[V]");
+		}
 		hSize += sprintf(hStr+hSize, "\n");
 	}
 
@@ -386,6 +1066,28 @@ void daq_header(void){
 #endif
 }
 
+// Log the time the core and the card were awake during the recording, and the supply current they suggest
+static void daq_powerLog(void){
+	char str[70];
+	uint64_t elapsed = dwt_elapsedTime;
+	uint32_t core, card, uA;
+
+	if(elapsed == 0 || sched_sleepCycles > elapsed || sd_sleepCycles > elapsed){
+		return;
+	}
+
+	// Permille of the recording time awake and powered
+	core = (uint32_t)((elapsed - sched_sleepCycles) * 1000 / elapsed);
+	card = (uint32_t)((elapsed - sd_sleepCycles) * 1000 / elapsed);
+	uA = (LOWPOWER_UA_CORE_RUN * core + LOWPOWER_UA_CORE_SLEEP * (1000 - core) + LOWPOWER_UA_CARD_ACTIVE * card) / 1000 +
+			LOWPOWER_UA_ADC;
+
+	sprintf(str, "Duty core %u.%u%%, card %u.%u%%, %u wakes, est %u.%u mA", (unsigned int)(core / 10), (unsigned int)(core % 10),
+			(unsigned int)(card / 10), (unsigned int)(card % 10), (unsigned int)sd_wakes,
+			(unsigned int)(uA / 1000), (unsigned int)(uA % 1000 / 100));
+	log_string(str);
+}
+
 // Stop acquiring data
 void daq_stop(void){
 	// Stop RIT interrupt
@@ -407,60 +1109,124 @@ void daq_stop(void){
 		daq_flushData();
 
 		// Write all buffered data to disk
+		uint64_t samples = daq_segmentSamples();
 		f_close(&dataFile);
+
+		// Link the final segment of a multi-segment recording
+		if(segment > 0){
+			daq_manifestEntry(samples);
+		}
+
+		// End the battery trace with the voltage at the stop
+		vbatTraceNext = 0;
+		daq_batteryTrace(vbat_mV());
+		daq_batteryFlush();
 	}
 
-	// Destroy the string formatted buffer if it exists
-	RingBuffer_destroy(strBuff);
+	// Leave the card powered for MSC and the next recording, and tick at the normal rate
+	if(sd_wake() != SD_OK){
+		error(ERROR_SD_INIT);
+	}
+	system_setTickRate(TICKRATE_HZ1);
+	daq_powerLog();
+
+	// Report the samples dropped by overloads, including gaps not reached by the writer
+	char dropStr[60];
+	strcpy(dropStr, "Dropped samples ");
+	uint64ToStr(dropStr + strlen(dropStr), droppedTotal);
+	sprintf(dropStr + strlen(dropStr), " in %u gaps",
+			(unsigned int)(gapTotal + (uint8_t)(gapHead - gapTail) + (gapOpen.count ? 1 : 0)));
+	log_string(dropStr);
+
+	// Summarize the disk write latency of the recording into the log
+	disk_telemetryLog();
+
+	// Write stage cycle statistics for the recording
+	prof_report("profile.txt");
+
+	// Release the buffers, the arena is free for MSC read-ahead until the next recording
+	rawBuff = NULL;
+	strBuff = NULL;
+	mem_plan(MEM_PLAN_IDLE);
+}
+
+// Write blocks of file data until less than a block is buffered or maxBlocks are written, true if the data ran out
+static bool daq_writeBlocks(uint32_t maxBlocks){
+	while(maxBlocks--){
+
+		// Continue in a new file segment at the size or time boundary
+		if(daq_segmentFull()){
+			daq_nextSegment();
+		}
+
+		// Generate a block of file data, or return if a block cannot be made
+		if(!daq_makeBlock()){
+			return true;
+		}
+	}
+	return false;
 }
 
 // Write data from raw buffer to file, formatting to string  buffer as an intermediate step if needed
+// The writer has the highest task priority, after a budget of blocks it lets the control and housekeeping tasks run
 void daq_writeData(void){
-	while(true){
+	if(!daq_writeBlocks(WRITER_BUDGET_BLOCKS)){
+		sched_yield(TASK_WRITER);
+	}
+}
 
-		// Generate a block of file data, or return if a block cannot be made
-		switch (daq.data_type){
-		case READABLE:
-
-			while(RingBuffer_getSize(strBuff) < BLOCK_SIZE){
-				uint16_t rawData[MAX_CHAN];
-				if(RingBuffer_read(rawBuff, rawData, daq.channel_count*2) == daq.channel_count*2){
-					// Format data into string
-					char sampleStr[SAMPLE_STR_SIZE];
-					daq_readableFormat(rawData, sampleStr);
-					RingBuffer_writeStr(strBuff, sampleStr);
+// Format samples to the string buffer and write a block of it, false if the raw data runs out first
+static bool daq_readableBlock(void){
+	int32_t sampleBytes = daq.value_count*2;
+
+	while(RingBuffer_getSize(strBuff) < BLOCK_SIZE){
+		uint16_t rawData[MAX_VALUES];
+		Gap *gap = daq_nextGap();
+		if(gap && gap->index == sampleStrfCount){
+			// Mark the dropped samples in place, later sample times stay correct
+			char gapStr[SAMPLE_STR_SIZE];
+			daq_gapFormat(gap, gapStr);
+			RingBuffer_writeStr(strBuff, gapStr);
+			sampleStrfCount += gap->count;
+			daq_popGap();
+		} else if(RingBuffer_read(rawBuff, rawData, sampleBytes) == sampleBytes){
+			// Format data into string
+			char sampleStr[SAMPLE_STR_SIZE];
+			daq_formatSample(rawData, sampleStr);
+			RingBuffer_writeStr(strBuff, sampleStr);
 #if defined(DEBUG) && defined(PRINT_DATA_UART)
-					putLineUART(sampleStr);
+			putLineUART(sampleStr);
 #endif
-				} else {
-					return; // No more raw data, finished processing
-				}
-			}
-			char data[BLOCK_SIZE];
-			RingBuffer_read(strBuff, data, BLOCK_SIZE);
-			daq_writeBlock(data, BLOCK_SIZE);
-
-			break;
-		case BINARY:
-
-			if(RingBuffer_getSize(rawBuff) >= BLOCK_SIZE){
-				char data[BLOCK_SIZE];
-				RingBuffer_read(rawBuff, data, BLOCK_SIZE);
-				daq_writeBlock(data, BLOCK_SIZE);
-			} else {
-				return;
-			}
-
-			break;
+		} else {
+			return false; // No more raw data, finished processing
 		}
+	}
+	char block[BLOCK_SIZE];
+	char *data = daq_nextBlock(block);
+	RingBuffer_read(strBuff, data, BLOCK_SIZE);
+	trace_event(TRACE_BLOCK, RingBuffer_getSize(rawBuff));
+	daq_putBlock(data);
+	return true;
+}
 
+// Write a block of raw data and gap fill, false if less than a block is buffered
+static bool daq_binaryBlock(void){
+	if(daq_binaryAvailable() < BLOCK_SIZE){
+		return false;
 	}
+	char block[BLOCK_SIZE];
+	char *data = daq_nextBlock(block);
+	daq_binaryRead(data, BLOCK_SIZE);
+	trace_event(TRACE_BLOCK, RingBuffer_getSize(rawBuff));
+	daq_putBlock(data);
+	return true;
 }
 
 // Flush data from raw buffer to file, formatting to string  buffer as an intermediate step if needed
 void daq_flushData(void){
-	// Write full blocks of data to the file
-	daq_writeData();
+	// Write full blocks of data to the file, and the blocks collected for a burst
+	daq_writeBlocks(UINT32_MAX);
+	daq_burstFlush();
 
 	// Flush remaining partial block
 	char data[BLOCK_SIZE];
@@ -470,7 +1236,8 @@ void daq_flushData(void){
 		br = RingBuffer_read(strBuff, data, BLOCK_SIZE);
 		break;
 	case BINARY:
-		br = RingBuffer_read(rawBuff, data, BLOCK_SIZE);
+		br = daq_binaryRead(data, BLOCK_SIZE);
+		daq_gapFlush();
 		break;
 	}
 	daq_writeBlock(data, br);
@@ -480,25 +1247,41 @@ void daq_flushData(void){
 void daq_writeBlock(void *data, int32_t data_size){
 	UINT bw;
 	FRESULT errorCode;
+	uint32_t profStart = prof_start();
 	Board_LED_Color(LED_YELLOW);
-	if((errorCode = f_write(&dataFile, data, data_size, &bw)) != FR_OK){
+	trace_event(TRACE_WRITE_START, data_size);
+	errorCode = f_write(&dataFile, data, data_size, &bw);
+	trace_event(TRACE_WRITE_END, bw);
+	if(errorCode != FR_OK){
 		error(ERROR_F_WRITE);
+	}else if(bw != data_size){ // No free clusters left on the volume
+		error(ERROR_DISK_FULL);
 	}
 	Board_LED_Color(LED_RED);
+	prof_end(PROF_WRITE_BLOCK, profStart);
 }
 
+#ifndef DAQ_SPECIALIZED
 // Convert rawData into a readable scaled and formatted output string
-// Total calculation time for 3 channels with time and sample precision 4:
-// 4650cc (65us)
+// Generic path, checks the config of each channel for each sample, see daq_format for the specialized paths
+// Cycle counts are reported in profile.txt when PROFILE is defined
 void daq_readableFormat(uint16_t *rawData, char *sampleStr){
+	uint32_t profStart = prof_start();
 	// sampleStr Ex. 9999.1234,1.2345e+01,1.2345e+01,1.2345e+01
 	int8_t sampleStr_size = 0;
 
-	dec_float_t scaledVal[MAX_CHAN];
+	dec_float_t scaledVal[MAX_VALUES];
 
 	// Calculate sample time with microsecond precision
 	int64_t us = ((int64_t)sampleStrfCount++ * 1000000 ) / daq.sample_rate;
 
+	// Vout is recorded after the enabled channels
+	uint16_t rawVoutVal = daq.vout_record ? rawData[daq.channel_count] : 0;
+	fix64_t ratio;
+	if(daq.ratiometric){
+		ratio = daq_ratiometricScale(rawVoutVal);
+	}
+
 	/* Scale samples , takes 566cc/sample (7.9us) */
 	uint8_t ch = 0;
 	int8_t i;
@@ -514,6 +1297,10 @@ void daq_readableFormat(uint16_t *rawData, char *sampleStr){
 				fix_sub((fix64_t*)(scaledVal+ch), &daq.channel[i].v24_zero_offset);
 				fix_mult((fix64_t*)(scaledVal+ch), &daq.channel[i].v24_uV_per_LSB);
 			}
+			// Correct the reading to the nominal excitation voltage
+			if(daq.ratiometric){
+				fix_mult((fix64_t*)(scaledVal+ch), &ratio);
+			}
 			// Scale uV to [units] * 1000000, ignoring user scale exponent
 			fix_sub((fix64_t*)(scaledVal+ch), &daq.channel[i].offset_uV);
 			fix_mult((fix64_t*)(scaledVal+ch), (fix64_t*)&daq.channel[i].units_per_volt);
@@ -522,12 +1309,19 @@ void daq_readableFormat(uint16_t *rawData, char *sampleStr){
 		}
 	}
 
+	// Scale vout to uV, the fractional part is not significant
+	if(daq.vout_record){
+		scaledVal[ch]._int = rawVoutVal * VOUT_UV_PER_LSB;
+		scaledVal[ch].frac = 0;
+		scaledVal[ch].exp = -6;
+	}
+
 	// Format time
 	// 424cc + 77cc / seconds digit (5.9us + 1us / digit) for precision 4
 	sampleStr_size += usToStr(sampleStr+sampleStr_size, us, daq.time_res);
 
 	// Fast formatting from fixed-point samples
-	for(i=0;i<daq.channel_count;i++){
+	for(i=0;i<daq.value_count;i++){
 		/* Format and append sample string */
 		sampleStr[sampleStr_size++] = ',';
 		// Takes 600cc (8.3us) for precision 4
@@ -536,6 +1330,40 @@ void daq_readableFormat(uint16_t *rawData, char *sampleStr){
 	// 14cc each
 	sampleStr[sampleStr_size++] = '\n';
 	sampleStr[sampleStr_size++] = '\0';
+
+	prof_end(PROF_READABLE_FORMAT, profStart);
+}
+#endif
+
+// Raw value of the synthetic signal for sample n of channel ch
+RAMFUNC uint16_t daq_synthValue(uint64_t n, uint8_t ch){
+	switch(daq.signal){
+	case SIGNAL_RAMP:
+		return (uint16_t)(n + ch * 0x5555);
+	case SIGNAL_SINE:
+		return synthSine[(n + ch * SYNTH_SINE_SIZE / 3) % SYNTH_SINE_SIZE];
+	case SIGNAL_WORST:
+		return ((n + ch) & 1) ? 0xFFFF : 0x0000;
+	default:
+		return 0;
+	}
+}
+
+// Calculate the ratiometric correction scaling a reading to the nominal vout, given the measured raw vout
+fix64_t daq_ratiometricScale(uint16_t rawVoutVal){
+	fix64_t ratio;
+	int64_t *res = (int64_t*)&ratio;
+	int32_t uV = rawVoutVal * VOUT_UV_PER_LSB;
+
+	// No correction without a valid vout reading
+	if(uV <= 0){
+		intToFix(&ratio, 1);
+		return ratio;
+	}
+
+	// ratio = nominal vout / measured vout, 32 fractional bits
+	*res = ((int64_t)daq.mv_out * 1000 << 32) / uV;
+	return ratio;
 }
 
 // Limit configuration values to valid ranges
@@ -563,8 +1391,12 @@ void daq_configCheck(void){
 		mag *= 10;
 	}
 
+	// Low power mode for slow rates only, faster rates need the conversions and the writer every block
+	daq.low_power = daq.low_power == 1 && daq.sample_rate <= LOWPOWER_MAX_SAMPLE_RATE;
+	daq.conversion_rate = daq.low_power ? LOWPOWER_CONVERSION_RATE : CONVERSION_RATE;
+
 	// Set the number of subsamples
-	daq.subsamples = CONVERSION_RATE / daq.sample_rate;
+	daq.subsamples = daq.conversion_rate / daq.sample_rate;
 
 	// Determine time resolution required
 	daq.time_res = 0;
@@ -576,4 +1408,20 @@ void daq_configCheck(void){
 
 	// Limit output voltage to the range 5-24v
 	daq.mv_out = clamp(daq.mv_out, 5000, 24000);
+
+	// Synthetic signals are recorded as generated, without ratiometric correction
+	if(daq.signal > SIGNAL_WORST){
+		daq.signal = SIGNAL_ADC;
+	}
+
+	// Ratiometric correction of readable data needs vout recorded with each sample
+	daq.ratiometric = daq.ratiometric == 1 && daq.signal == SIGNAL_ADC;
+	daq.vout_record = daq.vout_record == 1 || daq.ratiometric;
+
+	// Binary data holds a value per enabled channel, converter.exe cannot read vout in the sample stride
+	// Ratiometric correction is applied to the raw values as they are collected instead
+	if(daq.data_type == BINARY){
+		daq.vout_record = 0;
+	}
+	daq.value_count = daq.channel_count + daq.vout_record;
 }
@@ -14,6 +14,11 @@
 #include "log.h"
 #include "fixed.h"
 #include "config.h"
+#include "profile.h"
+#include "trace.h"
+#include "bench.h"
+#include "sched.h"
+#include "mem.h"
 
 #define SYS_CLOCK_RATE 72000000 // System clock rate in Hz
 
@@ -21,15 +26,59 @@
 
 #define CONVERSION_RATE 40000 // Rate of conversion from ADC, limits sub sampling
 
+#define LOWPOWER_MAX_SAMPLE_RATE 100 // Highest sample rate recorded in low power mode, faster configs record normally
+
+#define LOWPOWER_CONVERSION_RATE 1000 // Rate of conversion in low power mode, a multiple of every sample rate up to LOWPOWER_MAX_SAMPLE_RATE
+
+#define LOWPOWER_BURST_BLOCKS 16 // Blocks collected in RAM in low power mode and written in one multiple block write
+
+// Rough supply current figures in uA for the low power estimate, calibrate against a measured board
+#define LOWPOWER_UA_CORE_RUN 20000	// Core running at 72 MHz
+#define LOWPOWER_UA_CORE_SLEEP 8000	// Core in sleep, peripherals clocked
+#define LOWPOWER_UA_CARD_ACTIVE 40000	// Card powered and initializing or writing
+#define LOWPOWER_UA_ADC 3000	// External ADC, analog front end and vout supply at idle load
+
 #define VOUT_PWM_RATE 10000 // Vout pwm rate in Hz, also rate of updates to output value
 
 #define MAX_SAMPLE_RATE 10000 // Maximum rate samples can be recorded to the sd card
 
 #define MAX_CHAN 3 // Total count of available channels
 
+#define MAX_VALUES (MAX_CHAN + 1) // Maximum count of values per sample, all channels plus vout
+
+#define VOUT_UV_PER_LSB 375 // Theoretical vout sensitivity in uV / LSB = 1000000 * ((100+20)/20) * 4.096 / (1 << 16)
+
+#define SYNTH_SINE_SIZE 64 // Period of the synthetic sine signal in samples
+#define SYNTH_SINE_AMPL 30000 // Amplitude of the synthetic sine signal in LSB, centred on 32768
+
 #define BLOCK_SIZE 512 // Size of blocks to write to the file system
 
-#define SAMPLE_STR_SIZE 60 // Maximum size of a single sample string
+#define STR_BUFF_SIZE (BLOCK_SIZE + SAMPLE_STR_SIZE) // Size of the readable string buffer, a block and the sample that overflows it
+
+#define RAW_BUFF_SIZE_READABLE RINGBUFFER_MAX_LENGTH(MEM_ARENA_SIZE - RINGBUFFER_ALLOC_SIZE(STR_BUFF_SIZE)) // Raw sample buffer in readable mode, the arena after the string buffer
+#define RAW_BUFF_SIZE_BINARY RINGBUFFER_MAX_LENGTH(MEM_ARENA_SIZE) // Raw sample buffer in binary mode, the whole arena
+
+#define BURST_BUFF_SIZE (LOWPOWER_BURST_BLOCKS * BLOCK_SIZE) // Blocks collected for one write in low power mode, allocated before the raw buffer
+#define RAW_BUFF_SIZE_READABLE_LOWPOWER (RAW_BUFF_SIZE_READABLE - MEM_ALIGN(BURST_BUFF_SIZE)) // Raw sample buffer in readable low power mode
+#define RAW_BUFF_SIZE_BINARY_LOWPOWER (RAW_BUFF_SIZE_BINARY - MEM_ALIGN(BURST_BUFF_SIZE)) // Raw sample buffer in binary low power mode
+
+#define WRITE_THRESHOLD BLOCK_SIZE // Raw buffer fill in bytes that wakes the writer task
+
+#define WRITER_BUDGET_BLOCKS 8 // Blocks written per run of the writer task before it yields to the control and housekeeping tasks
+
+#define SAMPLE_STR_SIZE 72 // Maximum size of a single sample string
+
+#define DAQ_SEGMENT_SIZE 0x40000000 // Data files are split into segments at this size in bytes, below the FAT32 4GB file limit
+
+#define GAP_QUEUE_SIZE 4 // Gaps of dropped samples waiting for the writer, samples are dropped while the queue is full
+
+#define GAP_RECORD_POINTS 16 // Gaps reached by the binary writer kept in RAM, written to the gap file when full, at a segment switch and at the end
+#define GAP_FILL_VALUE 0xFFFF // Raw value written in binary data for each value of a dropped sample, the gap file tells fills from samples
+
+#define DAQ_SEGMENT_SECONDS 86400 // Data files are split into segments after this many seconds of samples, 0 to disable
+
+#define VBAT_TRACE_SECONDS 60 // Seconds between points of the battery trace of a recording
+#define VBAT_TRACE_POINTS 16 // Points of the battery trace kept in RAM, written to the battery file when full and at the end
 
 #define clamp(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
 
@@ -45,6 +94,14 @@ typedef enum {
 	BINARY
 } DATA_T;
 
+// Source of channel samples, synthetic signals replace the ADC conversions to test the recording pipeline
+typedef enum {
+	SIGNAL_ADC,		// ADC conversions
+	SIGNAL_RAMP,	// (n + ch * 0x5555) & 0xFFFF for sample n, every sample distinct
+	SIGNAL_SINE,	// Sine of SYNTH_SINE_SIZE samples period, channels 1/3 period apart
+	SIGNAL_WORST	// Alternating 0x0000 and 0xFFFF, the longest readable strings
+} SIGNAL_T;
+
 // Configuration data for each channel
 typedef struct Channel_Config {
 
@@ -72,10 +129,16 @@ typedef struct DAQ {
 	int32_t mv_out;			// Output voltage in mv, valid_range = <5000..24000>
 	int32_t sample_rate;	// Sample rate in Hz, valid range = <1..10000>
 	int8_t time_res;		// Sample time resolution in n digits where time is s.n
-	uint32_t subsamples;	// Number of sub samples per data sample, normally 40k/sample_rate
+	uint32_t subsamples;	// Number of sub samples per data sample, conversion_rate/sample_rate
 	int32_t trigger_delay;	// Delay in seconds before starting the data collection
 	DATA_T data_type;		// data mode, can be READABLE or COMPACT
 	char user_comment[101];	// User comment to appear at the top of each data file
+	uint8_t vout_record;	// 1 to record vout as an extra value after the enabled channels, uint8_t so invalid EEPROM values can be checked
+	uint8_t ratiometric;	// 1 to scale channels to the nominal vout using the measured vout, requires vout_record in readable mode
+	uint8_t value_count;	// Number of 16-bit values recorded per sample, calculated from channel_count and vout_record
+	uint8_t signal;			// SIGNAL_T source of channel samples, uint8_t so invalid EEPROM values can be checked
+	uint8_t low_power;		// 1 to convert at LOWPOWER_CONVERSION_RATE, write in bursts and power the card off between them, uint8_t so invalid EEPROM values can be checked
+	uint32_t conversion_rate;	// Rate of conversion from ADC in Hz, CONVERSION_RATE or LOWPOWER_CONVERSION_RATE
 } DAQ;
 
 extern uint8_t rsel_pins[3];
@@ -107,6 +170,18 @@ void daq_record(void);
 // Make the data file
 void daq_makeDataFile(void);
 
+// Open the file for the current segment and write its header
+void daq_openSegment(void);
+
+// Close the current segment on a whole sample and continue the recording in the next segment
+void daq_nextSegment(void);
+
+// Append the current segment to the recording manifest
+void daq_manifestEntry(uint64_t samples);
+
+// Add the battery voltage in mV to the battery trace of the recording, called once per second
+void daq_batteryTrace(uint32_t mV);
+
 // Wait for the trigger time to start
 void daq_triggerDelay(void);
 
@@ -123,6 +198,7 @@ void daq_header(void);
 void daq_stop(void);
 
 // Write data from raw buffer to file, formatting to string  buffer as an intermediate step if needed
+// Writes at most WRITER_BUDGET_BLOCKS blocks, then yields the writer task and continues on its next run
 void daq_writeData(void);
 
 // Flush data from raw buffer to file, formatting to string  buffer as an intermediate step if needed
@@ -131,8 +207,19 @@ void daq_flushData(void);
 // Write a single block to the data file from the string buffer
 void daq_writeBlock(void *data, int32_t data_size);
 
-// Convert rawData into a readable formatted output string
+// Size of the raw sample buffer of the current config
+uint32_t daq_rawBuffSize(void);
+
+#ifndef DAQ_SPECIALIZED
+// Convert rawData into a readable formatted output string, the generic path
 void daq_readableFormat(uint16_t *rawData, char *sampleStr);
+#endif
+
+// Calculate the ratiometric correction scaling a reading to the nominal vout, given the measured raw vout
+fix64_t daq_ratiometricScale(uint16_t rawVoutVal);
+
+// Raw value of the synthetic signal for sample n of channel ch
+uint16_t daq_synthValue(uint64_t n, uint8_t ch);
 
 // Limit configuration values to valid ranges
 void daq_configCheck(void);
@@ -1,5 +1,5 @@
 #include "delay.h"
-#include "chip.h"
+#include "board.h"
 
 extern uint32_t SystemCoreClock;
 
@@ -12,7 +12,8 @@ void DWT_Init(void) {
   }
 }
 
-uint32_t DWT_Get(void)
+// Called from the sampling ISRs
+RAMFUNC uint32_t DWT_Get(void)
 {
   return DWT->CYCCNT;
 }
@@ -12,15 +12,103 @@
 #include "board.h"
 #include "delay.h"
 #include "ffconf.h"
+#include "profile.h"
+#include "log.h"
+#include "daq.h"
+#include "trace.h"
 
-/* Define this to enable SD block write timing debug prints */
-//#define SD_WRITE_DEBUG
+/* Define this to inject periodic card stalls into disk_write, to test the buffering
+   on the device against the garbage collection pauses modelled in tools/host/buffer_sim.c */
+//#define DISK_STALL_INJECT
+#define DISK_STALL_PERIOD_MS	10000	/* Time between injected stalls, below the 59s DWT wrap */
+#define DISK_STALL_MS			250		/* Length of each injected stall */
 
 /* Definitions of physical drive number for each drive */
 //#define SD		0	/* Example: Map SD card to drive number 0 */
 
 SD_CardInfo cardinfo;
 
+/* Write latency telemetry, cleared at the start of each recording */
+DISK_TELEMETRY disk_telemetry;
+
+#define CC_PER_US (SYS_CLOCK_RATE / 1000000)
+
+/*-----------------------------------------------------------------------*/
+/* Write Telemetry                                                       */
+/*-----------------------------------------------------------------------*/
+
+/* Record a write of count sectors taking cc cycles, ~40cc */
+static void disk_telemetryRecord (
+	uint32_t cc,
+	UINT count
+)
+{
+	DWORD us = cc / CC_PER_US;
+	DWORD bin = 31 - __CLZ(us | 1);
+	BYTE fill;
+
+	if (bin >= DISK_LAT_BINS) bin = DISK_LAT_BINS - 1;
+
+	disk_telemetry.writes++;
+	disk_telemetry.sectors += count;
+	if (count > disk_telemetry.maxSectors) disk_telemetry.maxSectors = count;
+	if (us > disk_telemetry.maxLatency) disk_telemetry.maxLatency = us;
+	if (us > DISK_STALL_US) {
+		disk_telemetry.stalls++;
+		disk_telemetry.stallTime += us / 1000;
+	}
+	disk_telemetry.hist[bin]++;
+
+	/* Sample buffer fill level after the write, what the write allowed to accumulate */
+	if (rawBuff) {
+		fill = (BYTE)((RingBuffer_getSize(rawBuff) * 100) / (rawBuff->length - 1));
+		if (fill > disk_telemetry.histFill[bin]) disk_telemetry.histFill[bin] = fill;
+	}
+}
+
+/* Clear the write telemetry */
+void disk_telemetryReset (void)
+{
+	memset(&disk_telemetry, 0, sizeof(disk_telemetry));
+	sd_crc_errors = 0;
+}
+
+/* Summarize the write telemetry into the log */
+void disk_telemetryLog (void)
+{
+	char str[80];
+	int len = 0;
+	BYTE peak = 0;
+	int i;
+
+	for (i = 0; i < DISK_LAT_BINS; i++) {
+		if (disk_telemetry.histFill[i] > peak) peak = disk_telemetry.histFill[i];
+	}
+
+	sprintf(str, "Disk writes %u, sectors %u, max %u/write, busy %u us",
+			(unsigned int)disk_telemetry.writes, (unsigned int)disk_telemetry.sectors,
+			(unsigned int)disk_telemetry.maxSectors, (unsigned int)(disk_telemetry.maxBusy / CC_PER_US));
+	log_string(str);
+
+	sprintf(str, "Disk max %u us, stalls %u, %u ms, buffer peak %u%%, crc %u",
+			(unsigned int)disk_telemetry.maxLatency, (unsigned int)disk_telemetry.stalls,
+			(unsigned int)disk_telemetry.stallTime, (unsigned int)peak, (unsigned int)sd_crc_errors);
+	log_string(str);
+
+	/* Histogram as log2(us):writes[peak buffer %], a few bins per line to fit the log line */
+	for (i = 0; i < DISK_LAT_BINS; i++) {
+		if (disk_telemetry.hist[i] == 0) continue;
+		if (len == 0) len = sprintf(str, "Disk latency");
+		len += sprintf(str + len, " %d:%u[%u%%]", i,
+				(unsigned int)disk_telemetry.hist[i], (unsigned int)disk_telemetry.histFill[i]);
+		if (len > 40) {
+			log_string(str);
+			len = 0;
+		}
+	}
+	if (len) log_string(str);
+}
+
 /*-----------------------------------------------------------------------*/
 /* Get Drive Status                                                      */
 /*-----------------------------------------------------------------------*/
@@ -60,31 +148,61 @@ DRESULT disk_read (
 	UINT count		/* Number of sectors to read */
 )
 {
-	if (count == 1) {
-		if (sd_read_block(sector,buff) == SD_OK) {
-			return RES_OK;
-		} else {
-			return RES_ERROR;
-		}
-	} else if (count > 1) {
-		if (sd_read_multiple_blocks(sector,count,buff) == SD_OK) {
-			return RES_OK;
-		} else {
-			return RES_ERROR;
-		}
-	} else {
+	uint8_t res;
+
+	if (count == 0) {
 		return RES_PARERR;
 	}
+	/* Power the card up again after a low power burst */
+	if (sd_wake() != SD_OK) {
+		return RES_ERROR;
+	}
+	res = count == 1 ? sd_read_block(sector,buff) : sd_read_multiple_blocks(sector,count,buff);
+
+	/* Retry once a rung down the SPI clock ladder */
+	if (res != SD_OK && sd_speed_down() == 0) {
+		res = count == 1 ? sd_read_block(sector,buff) : sd_read_multiple_blocks(sector,count,buff);
+	}
+	return res == SD_OK ? RES_OK : RES_ERROR;
 }
 
 /*-----------------------------------------------------------------------*/
 /* Write Sector(s)                                                       */
 /*-----------------------------------------------------------------------*/
-#ifdef SD_WRITE_DEBUG
-uint32_t writeTimeMax; // Used for profiling
-#endif
 
 #if _USE_WRITE
+static DRESULT disk_write_sectors (
+	const BYTE *buff,	/* Data to be written */
+	DWORD sector,		/* Sector address in LBA */
+	UINT count			/* Number of sectors to write */
+)
+{
+	uint8_t res;
+
+	if (count == 0) {
+		return RES_PARERR;
+	}
+	/* Runs of sectors, the low power bursts, go in one multiple block write */
+	res = count == 1 ? sd_write_block(sector,buff) : sd_write_multiple_blocks(sector,count,buff);
+
+	/* Retry once a rung down the SPI clock ladder */
+	if (res != SD_OK && sd_speed_down() == 0) {
+		res = count == 1 ? sd_write_block(sector,buff) : sd_write_multiple_blocks(sector,count,buff);
+	}
+	if (res != SD_OK) {
+		return RES_ERROR;
+	}
+
+	/* The busy time is timed for single block writes */
+	if (count == 1) {
+		if (sd_write_busy > disk_telemetry.maxBusy) {
+			disk_telemetry.maxBusy = sd_write_busy;
+		}
+		trace_event(TRACE_SD_BUSY, (WORD)(sd_write_busy / CC_PER_US > 0xFFFF ? 0xFFFF : sd_write_busy / CC_PER_US));
+	}
+	return RES_OK;
+}
+
 DRESULT disk_write (
 	BYTE pdrv,			/* Physical drive number to identify the drive */
 	const BYTE *buff,	/* Data to be written */
@@ -92,59 +210,35 @@ DRESULT disk_write (
 	UINT count			/* Number of sectors to write */
 )
 {
-	// Error if writing to a block above 4gb, minus room to grow the log file
-	if( sector + count >= 0x007FFFF0 ){
+	DRESULT res;
+	uint32_t start;
+
+	// Error if writing past the end of the card
+	// The checks that return early come before start, every write that starts closes the PROF_DISK_WRITE probe
+	if( sector + count > (DWORD)(cardinfo.CardCapacity >> SD_BLOCKSIZE_NBITS) ){
 		error(ERROR_DISK_FULL);
 		return RES_ERROR;
 	}
 
-#ifdef SD_WRITE_DEBUG
-	uint32_t start_time = DWT_Get();
-	uint32_t bc = 0;
-#endif
-	if (count == 1) {
-		if (sd_write_block(sector,buff) == SD_OK) {
-#ifdef SD_WRITE_DEBUG
-			bc++;
-			uint32_t elapsed_time = DWT_Get() - start_time;
-			char b[20];
-			sprintf(b, "%d\n", elapsed_time);
-			putLineUART(b);
-#endif
-			return RES_OK;
-		} else {
-			return RES_ERROR;
-		}
-	} else if (count > 1) {
-		UINT i;
-		for(i=0;i<count;i++){
-			if(sd_write_block(sector,buff) == SD_OK) {
-#ifdef SD_WRITE_DEBUG
-				bc++;
-#endif
-				sector++;
-				buff += _MAX_SS;
-			} else {
-				return RES_ERROR;
-			}
-		}
-#ifdef SD_WRITE_DEBUG
-		bc++;
-		uint32_t elapsed_time = DWT_Get() - start_time;
-		char b[20];
-		sprintf(b, "%d, %d\n", bc, elapsed_time);
-		putLineUART(b);
-#endif
-		return RES_OK;
-		/* Write Multiple Block Function */
-		/* if (sd_write_multiple_blocks(sector,count,buff) == SD_OK) {
-			return RES_OK;
-		} else {
-			return RES_ERROR;
-		} */
-	} else {
-		return RES_PARERR;
+	/* Power the card up again after a low power burst, the power up is not counted as write latency */
+	if (sd_wake() != SD_OK) {
+		return RES_ERROR;
+	}
+	start = DWT_Get();
+
+#ifdef DISK_STALL_INJECT
+	static uint32_t lastStall;
+	if (start - lastStall > DISK_STALL_PERIOD_MS * (SYS_CLOCK_RATE / 1000)) {
+		DWT_Delay(DISK_STALL_MS * 1000);
+		lastStall = DWT_Get();
 	}
+#endif
+
+	res = disk_write_sectors(buff, sector, count);
+
+	disk_telemetryRecord(DWT_Get() - start, count);
+	prof_end(PROF_DISK_WRITE, start);
+	return res;
 }
 #endif
 
@@ -160,7 +254,23 @@ DRESULT disk_ioctl (
 	void *buff		/* Buffer to send/receive control data */
 )
 {
-	/* Currently not needed */
-	return 0;
+	switch (cmd) {
+	case CTRL_SYNC:
+		/* Writes complete before disk_write returns */
+		return RES_OK;
+	case GET_SECTOR_COUNT:
+		/* Sector count as a DWORD, SDXC cards up to 2TB fit */
+		*(DWORD*)buff = (DWORD)(cardinfo.CardCapacity >> SD_BLOCKSIZE_NBITS);
+		return RES_OK;
+	case GET_SECTOR_SIZE:
+		*(WORD*)buff = SD_BLOCKSIZE;
+		return RES_OK;
+	case GET_BLOCK_SIZE:
+		/* Erase block size in sectors, unknown */
+		*(DWORD*)buff = 1;
+		return RES_OK;
+	default:
+		return RES_PARERR;
+	}
 }
 #endif
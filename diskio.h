@@ -39,6 +39,30 @@ DRESULT disk_write (BYTE pdrv, const BYTE* buff, DWORD sector, UINT count);
 DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff);
 
 
+/*---------------------------------------*/
+/* Write latency telemetry               */
+
+#define DISK_LAT_BINS	20		/* Histogram bins, bin n counts writes taking [2^n, 2^(n+1)) us */
+#define DISK_STALL_US	50000	/* Writes taking longer than this are counted as stalls */
+
+typedef struct {
+	DWORD writes;				/* disk_write calls */
+	DWORD sectors;				/* Sectors written */
+	DWORD maxSectors;			/* Most sectors written in one call */
+	DWORD maxLatency;			/* Longest disk_write call in us */
+	DWORD maxBusy;				/* Longest card busy-wait after a block in us */
+	DWORD stalls;				/* Writes longer than DISK_STALL_US */
+	DWORD stallTime;			/* Total time of stalled writes in ms */
+	DWORD hist[DISK_LAT_BINS];	/* log2 histogram of write latency */
+	BYTE histFill[DISK_LAT_BINS];	/* Peak sample buffer fill in % after writes in each bin */
+} DISK_TELEMETRY;
+
+extern DISK_TELEMETRY disk_telemetry;
+
+void disk_telemetryReset (void);
+void disk_telemetryLog (void);
+
+
 /* Disk Status Bits (DSTATUS) */
 
 #define STA_NOINIT		0x01	/* Drive not initialized */
@@ -121,6 +121,7 @@
 
 #include "ff.h"			/* Declarations of FatFs API */
 #include "diskio.h"		/* Declarations of disk I/O functions */
+#include "trace.h"		/* Event trace of cluster allocation */
 
 
 
@@ -570,6 +571,23 @@ void mem_cpy (void* dst, const void* src, UINT cnt) {
 		d += sizeof (int); s += sizeof (int);
 		cnt -= sizeof (int);
 	}
+#elif _WORD_ACCESS == 2
+	if (cnt >= 16) {
+		while ((uintptr_t)d & 3) {	/* Align the destination */
+			*d++ = *s++; cnt--;
+		}
+		while (cnt >= 16) {			/* Four words a pass, the source may be unaligned */
+			((UA_DWORD*)d)[0].v = ((const UA_DWORD*)s)[0].v;
+			((UA_DWORD*)d)[1].v = ((const UA_DWORD*)s)[1].v;
+			((UA_DWORD*)d)[2].v = ((const UA_DWORD*)s)[2].v;
+			((UA_DWORD*)d)[3].v = ((const UA_DWORD*)s)[3].v;
+			d += 16; s += 16; cnt -= 16;
+		}
+		while (cnt >= 4) {
+			((UA_DWORD*)d)->v = ((const UA_DWORD*)s)->v;
+			d += 4; s += 4; cnt -= 4;
+		}
+	}
 #endif
 	while (cnt--)
 		*d++ = *s++;
@@ -580,6 +598,24 @@ static
 void mem_set (void* dst, int val, UINT cnt) {
 	BYTE *d = (BYTE*)dst;
 
+#if _WORD_ACCESS == 2
+	if (cnt >= 16) {
+		uint32_t w = (BYTE)val * 0x01010101UL;
+
+		while ((uintptr_t)d & 3) {	/* Align the destination */
+			*d++ = (BYTE)val; cnt--;
+		}
+		while (cnt >= 16) {
+			((UA_DWORD*)d)[0].v = w; ((UA_DWORD*)d)[1].v = w;
+			((UA_DWORD*)d)[2].v = w; ((UA_DWORD*)d)[3].v = w;
+			d += 16; cnt -= 16;
+		}
+		while (cnt >= 4) {
+			((UA_DWORD*)d)->v = w;
+			d += 4; cnt -= 4;
+		}
+	}
+#endif
 	while (cnt--)
 		*d++ = (BYTE)val;
 }
@@ -774,28 +810,124 @@ void clear_lock (	/* Clear lock entries of the volume */
 /* Move/Flush disk access window in the file system object               */
 /*-----------------------------------------------------------------------*/
 #if !_FS_READONLY
+static
+FRESULT write_sect (
+	FATFS* fs,			/* File system object */
+	const BYTE* buff,	/* Sector data */
+	DWORD sect			/* Sector number */
+)
+{
+	UINT nf;
+
+
+	if (disk_write(fs->drv, buff, sect, 1) != RES_OK)
+		return FR_DISK_ERR;
+	if (sect - fs->fatbase < fs->fsize) {		/* Is it in the FAT area? */
+		for (nf = fs->n_fats; nf >= 2; nf--) {	/* Reflect the change to all FAT copies */
+			sect += fs->fsize;
+			disk_write(fs->drv, buff, sect, 1);
+		}
+	}
+	return FR_OK;
+}
+
+
+#if _FS_CACHE
+static
+void cache_drop (
+	FATFS* fs,		/* File system object */
+	DWORD sect		/* Sector written around the cache, or 0xFFFFFFFF to empty the cache */
+)
+{
+	UINT i;
+
+
+	for (i = 0; i < _FS_CACHE; i++) {
+		if (sect == 0xFFFFFFFF || fs->csect[i] == sect) {
+			fs->csect[i] = 0xFFFFFFFF;
+			fs->cflag[i] = 0;
+		}
+	}
+}
+
+
+static
+FRESULT cache_flush (	/* Write back the dirty sectors in the cache */
+	FATFS* fs		/* File system object */
+)
+{
+	UINT i;
+
+
+	for (i = 0; i < _FS_CACHE; i++) {
+		if (fs->cflag[i]) {
+			if (write_sect(fs, fs->cbuf[i], fs->csect[i]) != FR_OK)
+				return FR_DISK_ERR;
+			fs->cflag[i] = 0;
+		}
+	}
+	return FR_OK;
+}
+
+
+static
+FRESULT cache_swap (	/* Keep the window in the cache and bring a sector into it */
+	FATFS* fs,		/* File system object */
+	DWORD sector	/* Sector number to make appearance in the fs->win[] */
+)
+{
+	UINT i, n = 0;
+
+
+	if (fs->winsect != 0xFFFFFFFF) {	/* Put the window into an empty or the least recently used line */
+		for (i = 0; i < _FS_CACHE; i++) {
+			if (fs->csect[i] == 0xFFFFFFFF) { n = i; break; }
+			if (fs->cuse[i] < fs->cuse[n]) n = i;
+		}
+		if (fs->cflag[n] && write_sect(fs, fs->cbuf[n], fs->csect[n]) != FR_OK)
+			return FR_DISK_ERR;
+		mem_cpy(fs->cbuf[n], fs->win, SS(fs));
+		fs->csect[n] = fs->winsect;
+		fs->cflag[n] = fs->wflag;
+		fs->cuse[n] = ++fs->cclock;
+		fs->wflag = 0;
+	}
+
+	for (i = 0; i < _FS_CACHE; i++) {	/* Take the sector out of the cache if it is there */
+		if (fs->csect[i] == sector) {
+			mem_cpy(fs->win, fs->cbuf[i], SS(fs));
+			fs->wflag = fs->cflag[i];
+			fs->csect[i] = 0xFFFFFFFF;
+			fs->cflag[i] = 0;
+			fs->winsect = sector;
+			return FR_OK;
+		}
+	}
+	if (disk_read(fs->drv, fs->win, sector, 1) != RES_OK) {
+		fs->winsect = 0xFFFFFFFF;	/* Invalidate window if data is not reliable */
+		return FR_DISK_ERR;
+	}
+	fs->winsect = sector;
+	return FR_OK;
+}
+#endif
+
+
 static
 FRESULT sync_window (
 	FATFS* fs		/* File system object */
 )
 {
-	DWORD wsect;
-	UINT nf;
 	FRESULT res = FR_OK;
 
 
 	if (fs->wflag) {	/* Write back the sector if it is dirty */
-		wsect = fs->winsect;	/* Current sector number */
-		if (disk_write(fs->drv, fs->win, wsect, 1) != RES_OK) {
-			res = FR_DISK_ERR;
-		} else {
+		res = write_sect(fs, fs->win, fs->winsect);
+		if (res == FR_OK) {
 			fs->wflag = 0;
-			if (wsect - fs->fatbase < fs->fsize) {		/* Is it in the FAT area? */
-				for (nf = fs->n_fats; nf >= 2; nf--) {	/* Reflect the change to all FAT copies */
-					wsect += fs->fsize;
-					disk_write(fs->drv, fs->win, wsect, 1);
-				}
-			}
+#if _FS_CACHE
+			cache_drop(fs, fs->winsect);	/* The window may have been moved without the cache */
+#endif
 		}
 	}
 	return res;
@@ -813,6 +945,9 @@ FRESULT move_window (
 
 
 	if (sector != fs->winsect) {	/* Window offset changed? */
+#if _FS_CACHE && !_FS_READONLY
+		res = cache_swap(fs, sector);	/* Keep changes in the cache */
+#else
 #if !_FS_READONLY
 		res = sync_window(fs);		/* Write-back changes */
 #endif
@@ -823,6 +958,7 @@ FRESULT move_window (
 			}
 			fs->winsect = sector;
 		}
+#endif
 	}
 	return res;
 }
@@ -843,6 +979,9 @@ FRESULT sync_fs (	/* FR_OK: successful, FR_DISK_ERR: failed */
 
 
 	res = sync_window(fs);
+#if _FS_CACHE
+	if (res == FR_OK) res = cache_flush(fs);	/* Write-back the cached sectors */
+#endif
 	if (res == FR_OK) {
 		/* Update FSINFO sector if needed */
 		if (fs->fs_type == FS_FAT32 && fs->fsi_flag == 1) {
@@ -856,6 +995,9 @@ FRESULT sync_fs (	/* FR_OK: successful, FR_DISK_ERR: failed */
 			/* Write it into the FSINFO sector */
 			fs->winsect = fs->volbase + 1;
 			disk_write(fs->drv, fs->win, fs->winsect, 1);
+#if _FS_CACHE
+			cache_drop(fs, fs->winsect);
+#endif
 			fs->fsi_flag = 0;
 		}
 		/* Make sure that no pending write process in the physical drive */
@@ -1060,6 +1202,76 @@ FRESULT remove_chain (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Free extent map                                        */
+/*-----------------------------------------------------------------------*/
+#if _USE_EXTMAP && !_FS_READONLY
+static
+void ext_add (
+	FATFS* fs,		/* File system object */
+	DWORD start,	/* First free cluster */
+	DWORD len		/* Number of free clusters */
+)
+{
+	UINT i, m = 0;
+
+
+	for (i = 1; i < _EXTMAP_SIZE; i++) {	/* Find the shortest extent */
+		if (fs->ext_len[i] < fs->ext_len[m]) m = i;
+	}
+	if (len > fs->ext_len[m]) {		/* Replace it if the new one is longer */
+		fs->ext_start[m] = start;
+		fs->ext_len[m] = len;
+	}
+}
+
+
+static
+void ext_take (
+	FATFS* fs,		/* File system object */
+	DWORD clst		/* Cluster# allocated */
+)
+{
+	UINT i;
+	DWORD end;
+
+
+	for (i = 0; i < _EXTMAP_SIZE; i++) {	/* Split the extent holding the cluster */
+		end = fs->ext_start[i] + fs->ext_len[i];
+		if (fs->ext_len[i] && clst >= fs->ext_start[i] && clst < end) {
+			fs->ext_len[i] = clst - fs->ext_start[i];
+			if (clst + 1 < end) ext_add(fs, clst + 1, end - clst - 1);
+			break;
+		}
+	}
+	if (fs->ext_run && clst >= fs->ext_run && clst < fs->ext_scan) {	/* Split the run being scanned */
+		if (clst > fs->ext_run) ext_add(fs, fs->ext_run, clst - fs->ext_run);
+		fs->ext_run = clst + 1;
+	}
+}
+
+
+static
+DWORD ext_find (	/* 0:Map is empty, >=2:Free cluster# */
+	FATFS* fs,		/* File system object */
+	DWORD scl		/* Cluster# to continue from */
+)
+{
+	UINT i, m = 0;
+
+
+	for (i = 0; i < _EXTMAP_SIZE; i++) {
+		if (fs->ext_len[i] && scl + 1 >= fs->ext_start[i] && scl + 1 < fs->ext_start[i] + fs->ext_len[i])
+			return scl + 1;			/* The next cluster is free, keep the chain contiguous */
+		if (fs->ext_len[i] > fs->ext_len[m]) m = i;
+	}
+	return fs->ext_len[m] ? fs->ext_start[m] : 0;	/* Start of the longest extent */
+}
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* FAT handling - Stretch or Create a cluster chain                      */
 /*-----------------------------------------------------------------------*/
@@ -1086,18 +1298,35 @@ DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk err
 		scl = clst;
 	}
 
-	ncl = scl;				/* Start cluster */
-	for (;;) {
-		ncl++;							/* Next cluster */
-		if (ncl >= fs->n_fatent) {		/* Check wrap around */
-			ncl = 2;
-			if (ncl > scl) return 0;	/* No free cluster */
-		}
-		cs = get_fat(fs, ncl);			/* Get the cluster status */
-		if (cs == 0) break;				/* Found a free cluster */
+#if _USE_EXTMAP
+	ncl = ext_find(fs, scl);	/* Take a free cluster from the extent map */
+	if (ncl) {
+		cs = get_fat(fs, ncl);			/* Check the cluster is still free */
 		if (cs == 0xFFFFFFFF || cs == 1)/* An error occurred */
 			return cs;
-		if (ncl == scl) return 0;		/* No free cluster */
+		if (cs != 0) {					/* The map is stale, drop it, search the FAT and scan again */
+			fs->ext_scan = 2;
+			fs->ext_run = 0;
+			mem_set(fs->ext_len, 0, sizeof fs->ext_len);
+			ncl = 0;
+		}
+	}
+	if (!ncl)
+#endif
+	{
+		ncl = scl;				/* Start cluster */
+		for (;;) {
+			ncl++;							/* Next cluster */
+			if (ncl >= fs->n_fatent) {		/* Check wrap around */
+				ncl = 2;
+				if (ncl > scl) return 0;	/* No free cluster */
+			}
+			cs = get_fat(fs, ncl);			/* Get the cluster status */
+			if (cs == 0) break;				/* Found a free cluster */
+			if (cs == 0xFFFFFFFF || cs == 1)/* An error occurred */
+				return cs;
+			if (ncl == scl) return 0;		/* No free cluster */
+		}
 	}
 
 	res = put_fat(fs, ncl, 0x0FFFFFFF);	/* Mark the new cluster "last link" */
@@ -1106,6 +1335,10 @@ DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk err
 	}
 	if (res == FR_OK) {
 		fs->last_clust = ncl;			/* Update FSINFO */
+#if _USE_EXTMAP
+		ext_take(fs, ncl);				/* Remove it from the extent map */
+#endif
+		trace_event(TRACE_FAT_ALLOC, (WORD)ncl);
 		if (fs->free_clust != 0xFFFFFFFF) {
 			fs->free_clust--;
 			fs->fsi_flag |= 1;
@@ -2180,6 +2413,9 @@ BYTE check_fs (	/* 0:FAT boor sector, 1:Valid boor sector but not FAT, 2:Not a b
 )
 {
 	fs->wflag = 0; fs->winsect = 0xFFFFFFFF;	/* Invaidate window */
+#if _FS_CACHE && !_FS_READONLY
+	cache_drop(fs, 0xFFFFFFFF);					/* Empty the cache */
+#endif
 	if (move_window(fs, sect) != FR_OK)			/* Load boot record */
 		return 3;
 
@@ -2355,6 +2591,11 @@ FRESULT find_volume (	/* FR_OK(0): successful, !=0: any error occurred */
 #endif
 	fs->fs_type = fmt;	/* FAT sub-type */
 	fs->id = ++Fsid;	/* File system mount ID */
+#if _USE_EXTMAP && !_FS_READONLY
+	fs->ext_scan = 2;	/* Empty the extent map, filled by f_scanfree() */
+	fs->ext_run = 0;
+	mem_set(fs->ext_len, 0, sizeof fs->ext_len);
+#endif
 #if _FS_RPATH
 	fs->cdir = 0;		/* Set current directory to root */
 #endif
@@ -3418,6 +3659,50 @@ FRESULT f_getfree (
 
 
 
+#if _USE_EXTMAP && !_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Scan Free Clusters into the Extent Map                                */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_scanfree (
+	const TCHAR* path,	/* Path name of the logical drive number */
+	DWORD nclst,		/* Number of clusters to scan */
+	DWORD* left			/* Pointer to return number of clusters left to scan (can be NULL) */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	DWORD clst, stat;
+
+
+	/* Get logical drive number */
+	res = find_volume(&fs, &path, 0);
+	if (res == FR_OK) {
+		for (clst = fs->ext_scan; nclst && clst < fs->n_fatent; clst++, nclst--) {
+			stat = get_fat(fs, clst);
+			if (stat == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
+			if (stat == 1) { res = FR_INT_ERR; break; }
+			if (stat == 0) {
+				if (!fs->ext_run) fs->ext_run = clst;		/* Start of a free run */
+			} else if (fs->ext_run) {
+				ext_add(fs, fs->ext_run, clst - fs->ext_run);	/* End of a free run */
+				fs->ext_run = 0;
+			}
+		}
+		if (clst >= fs->n_fatent && fs->ext_run) {	/* Free run up to the end of the volume */
+			ext_add(fs, fs->ext_run, clst - fs->ext_run);
+			fs->ext_run = 0;
+		}
+		fs->ext_scan = clst;
+		if (left) *left = fs->n_fatent - clst;
+	}
+	LEAVE_FF(fs, res);
+}
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Truncate File                                                         */
 /*-----------------------------------------------------------------------*/
@@ -3507,8 +3792,8 @@ FRESULT f_unlink (
 				if (dir[DIR_Attr] & AM_RDO)
 					res = FR_DENIED;		/* Cannot remove R/O object */
 			}
+			if (res == FR_OK) dclst = ld_clust(dj.fs, dir);	/* Cluster chain of the file or sub-dir */
 			if (res == FR_OK && (dir[DIR_Attr] & AM_DIR)) {	/* Is it a sub-dir? */
-				dclst = ld_clust(dj.fs, dir);
 				if (!dclst) {
 					res = FR_INT_ERR;
 				} else {					/* Make sure the sub-directory is empty */
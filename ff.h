@@ -93,6 +93,12 @@ typedef struct {
 #if !_FS_READONLY
 	DWORD	last_clust;		/* Last allocated cluster */
 	DWORD	free_clust;		/* Number of free clusters */
+#if _USE_EXTMAP
+	DWORD	ext_scan;		/* Next cluster f_scanfree() scans (n_fatent:Scan done) */
+	DWORD	ext_run;		/* Start of the free run being scanned (0:None) */
+	DWORD	ext_start[_EXTMAP_SIZE];	/* Free extent start clusters */
+	DWORD	ext_len[_EXTMAP_SIZE];		/* Free extent lengths (0:Unused) */
+#endif
 #endif
 #if _FS_RPATH
 	DWORD	cdir;			/* Current directory start cluster (0:root) */
@@ -105,6 +111,13 @@ typedef struct {
 	DWORD	database;		/* Data start sector */
 	DWORD	winsect;		/* Current sector appearing in the win[] */
 	BYTE	win[_MAX_SS];	/* Disk access window for Directory, FAT (and file data at tiny cfg) */
+#if _FS_CACHE && !_FS_READONLY
+	DWORD	cclock;			/* Cache use counter */
+	DWORD	csect[_FS_CACHE];	/* Sector in each cache line (0xFFFFFFFF:Empty) */
+	DWORD	cuse[_FS_CACHE];	/* Last use of each cache line */
+	BYTE	cflag[_FS_CACHE];	/* Cache line flags (b0:dirty) */
+	BYTE	cbuf[_FS_CACHE][_MAX_SS];	/* Directory and FAT sectors out of win[] */
+#endif
 } FATFS;
 
 
@@ -227,6 +240,7 @@ FRESULT f_chdir (const TCHAR* path);								/* Change current directory */
 FRESULT f_chdrive (const TCHAR* path);								/* Change current drive */
 FRESULT f_getcwd (TCHAR* buff, UINT len);							/* Get current directory */
 FRESULT f_getfree (const TCHAR* path, DWORD* nclst, FATFS** fatfs);	/* Get number of free clusters on the drive */
+FRESULT f_scanfree (const TCHAR* path, DWORD nclst, DWORD* left);	/* Scan free clusters into the extent map */
 FRESULT f_getlabel (const TCHAR* path, TCHAR* label, DWORD* vsn);	/* Get volume label */
 FRESULT f_setlabel (const TCHAR* label);							/* Set volume label */
 FRESULT f_mount (FATFS* fs, const TCHAR* path, BYTE opt);			/* Mount/Unmount a logical drive */
@@ -329,6 +343,13 @@ int ff_del_syncobj (_SYNC_t sobj);				/* Delete a sync object */
 #define	LD_DWORD(ptr)		(DWORD)(*(DWORD*)(BYTE*)(ptr))
 #define	ST_WORD(ptr,val)	*(WORD*)(BYTE*)(ptr)=(WORD)(val)
 #define	ST_DWORD(ptr,val)	*(DWORD*)(BYTE*)(ptr)=(DWORD)(val)
+#elif _WORD_ACCESS == 2	/* Use unaligned LDR/STR through packed types, never merged into LDRD/STRD/LDM */
+typedef struct __attribute__((packed, may_alias)) { uint16_t v; } UA_WORD;
+typedef struct __attribute__((packed, may_alias)) { uint32_t v; } UA_DWORD;
+#define	LD_WORD(ptr)		(WORD)(((const UA_WORD*)(ptr))->v)
+#define	LD_DWORD(ptr)		(DWORD)(((const UA_DWORD*)(ptr))->v)
+#define	ST_WORD(ptr,val)	((UA_WORD*)(ptr))->v=(uint16_t)(val)
+#define	ST_DWORD(ptr,val)	((UA_DWORD*)(ptr))->v=(uint32_t)(val)
 #else					/* Use byte-by-byte access to the FAT structure */
 #define	LD_WORD(ptr)		(WORD)(((WORD)*((BYTE*)(ptr)+1)<<8)|(WORD)*(BYTE*)(ptr))
 #define	LD_DWORD(ptr)		(DWORD)(((DWORD)*((BYTE*)(ptr)+3)<<24)|((DWORD)*((BYTE*)(ptr)+2)<<16)|((WORD)*((BYTE*)(ptr)+1)<<8)|*(BYTE*)(ptr))
@@ -199,6 +199,25 @@
 / System Configurations
 /---------------------------------------------------------------------------*/
 
+#define	_FS_CACHE		2
+/* Number of FAT and directory sectors kept in a write-back cache behind win[]
+/  of each volume, 0 disables the cache. Each sector takes _MAX_SS bytes of RAM.
+/  A sector leaving win[] is kept in the cache with its dirty flag and comes back
+/  without a disk access. The least recently used sector is written back when the
+/  cache is full, and all dirty sectors by f_sync() and f_close(). */
+
+
+
+#define	_USE_EXTMAP		1
+#define	_EXTMAP_SIZE	16
+/* To enable the free extent map of the cluster allocator, set _USE_EXTMAP to 1.
+/  f_scanfree() scans the FAT a number of clusters per call and keeps the
+/  _EXTMAP_SIZE longest runs of free clusters. create_chain() then takes new
+/  clusters from the map instead of searching the FAT, continuing a chain into the
+/  next cluster while it is free and starting on the longest run otherwise. */
+
+
+
 #define _FS_NORTC	0
 #define _NORTC_MON	11
 #define _NORTC_MDAY	9
@@ -245,7 +264,7 @@
 /  SemaphoreHandle_t and etc.. */
 
 
-#define _WORD_ACCESS	0
+#define _WORD_ACCESS	2
 /* The _WORD_ACCESS option is an only platform dependent option. It defines
 /  which access method is used to the word data on the FAT volume.
 /
@@ -255,12 +274,16 @@
 /  * Address misaligned memory access is always allowed to ALL instructions.
 /  * Byte order on the memory is little-endian.
 /
+/   2: Unaligned word access through packed types, for cores that allow it
+/      to LDR/LDRH/STR/STRH but not to LDRD/STRD/LDM/STM, such as Cortex-M3/M4.
+/      mem_cpy() and mem_set() also move a word at a time.
+/
 /  If it is the case, _WORD_ACCESS can also be set to 1 to reduce code size.
 /  Following table shows allowable settings of some processor types.
 /
 /   ARM7TDMI    0           ColdFire    0           V850E       0
-/   Cortex-M3   0           Z80         0/1         V850ES      0/1
-/   Cortex-M0   0           x86         0/1         TLCS-870    0/1
+/   Cortex-M3   0/2         Z80         0/1         V850ES      0/1
+/   Cortex-M0   0           x86         0/1/2         TLCS-870    0/1
 /   AVR         0/1         RX600(LE)   0/1         TLCS-900    0/1
 /   AVR32       0           RL78        0           R32C        0
 /   PIC18       0/1         SH-2        0           M16C        0/1
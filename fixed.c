@@ -52,6 +52,24 @@ int32_t usToStr(char *str, int64_t us, int8_t precision){
 	return strSize;
 }
 
+// Convert unsigned 64-bit integer to string, return length
+int32_t uint64ToStr(char *str, uint64_t val){
+	char b[20];
+	int32_t d = 0;
+	// Generate digits in reverse
+	do{
+		b[d++] = '0' + (char)(val % 10);
+		val /= 10;
+	}while(val > 0);
+	// Print digits
+	int32_t i;
+	for(i=0;i<d;i++){
+		str[i] = b[d-1-i];
+	}
+	str[d] = '\0';
+	return d;
+}
+
 // Convert floating point value to decimal exponent floating point
 dec_float_t floatToDecFloat(float fp){
 	dec_float_t df;
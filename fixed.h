@@ -31,6 +31,9 @@ typedef struct dec_float_t {
 // Convert time in microseconds to string, return length
 int32_t usToStr(char *str, int64_t us, int8_t precision);
 
+// Convert unsigned 64-bit integer to string, return length
+int32_t uint64ToStr(char *str, uint64_t val);
+
 // Convert floating point value to decimal exponent floating point
 dec_float_t floatToDecFloat(float fp);
 
@@ -0,0 +1,104 @@
+/*
+ * lz_decomp.c
+ *
+ *  Streaming decompressor for the LZ4 block compressed assets in
+ *  console_converter.h, generated by tools/pack_assets.py
+ */
+
+#include "lz_decomp.h"
+
+// Decompression state, data is decompressed into a ring window that is flushed to the file in whole sectors
+typedef struct LZ_State {
+	FIL *fp;
+	uint8_t window[LZ_WINDOW_SIZE];
+	uint32_t pos;	// count of bytes decompressed
+	UINT bw;		// count of bytes written to the file
+	FRESULT fr;		// result of the last file write
+} LZ_State;
+
+// The flush size must divide the window so that each flushed chunk is contiguous
+typedef char lz_flush_fits[(LZ_WINDOW_SIZE % LZ_FLUSH_SIZE == 0 && LZ_FLUSH_SIZE % 512 == 0) ? 1 : -1];
+
+// Write decompressed data not yet written to the file
+static void lz_flush(LZ_State *s){
+	UINT size = s->pos - s->bw;
+	UINT w;
+	if(s->fr != FR_OK || size == 0){
+		return;
+	}
+	s->fr = f_write(s->fp, s->window + s->bw % LZ_WINDOW_SIZE, size, &w);
+	s->bw += w;
+	if(s->fr == FR_OK && w != size){
+		s->fr = FR_DENIED; // Disk full
+	}
+}
+
+// Append a decompressed byte, flush every LZ_FLUSH_SIZE bytes
+static inline void lz_put(LZ_State *s, uint8_t c){
+	s->window[s->pos++ % LZ_WINDOW_SIZE] = c;
+	if(s->pos % LZ_FLUSH_SIZE == 0){
+		lz_flush(s);
+	}
+}
+
+// Read an extended length, a run of 255 bytes terminated by a byte < 255
+static uint32_t lz_readLength(const uint8_t **src, const uint8_t *end){
+	uint32_t len = 0;
+	uint8_t b;
+	do{
+		b = *(*src)++;
+		len += b;
+	}while(b == 255 && *src < end);
+	return len;
+}
+
+// Decompress an LZ4 block straight into an open file, bw is set to the number of bytes written on every return, FR_INT_ERR for a corrupt block
+FRESULT lz_decompressToFile(FIL *fp, const uint8_t *src, uint32_t srcSize, UINT *bw){
+	LZ_State s;
+	const uint8_t *end = src + srcSize;
+
+	s.fp = fp;
+	s.pos = 0;
+	s.bw = 0;
+	s.fr = FR_OK;
+
+	while(src < end && s.fr == FR_OK){
+		uint8_t token = *src++;
+
+		/* Copy literals */
+		uint32_t len = token >> 4;
+		if(len == 15){
+			len += lz_readLength(&src, end);
+		}
+		while(len-- && src < end){
+			lz_put(&s, *src++);
+		}
+
+		// The last sequence has literals only
+		if(src + 2 > end){
+			break;
+		}
+
+		/* Copy match from the window */
+		uint32_t offset = src[0] | (src[1] << 8);
+		src += 2;
+		len = token & 0x0F;
+		if(len == 15){
+			len += lz_readLength(&src, end);
+		}
+		len += LZ_MIN_MATCH;
+		if(offset == 0 || offset > LZ_WINDOW_SIZE || offset > s.pos){
+			s.fr = FR_INT_ERR; // Corrupt asset, stop after the data written so far
+			break;
+		}
+		while(len--){
+			lz_put(&s, s.window[(s.pos - offset) % LZ_WINDOW_SIZE]);
+		}
+	}
+
+	// Write the final partial chunk, lz_flush does nothing after an error
+	lz_flush(&s);
+
+	*bw = s.bw;
+	return s.fr;
+}
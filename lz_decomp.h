@@ -0,0 +1,22 @@
+/*
+ * lz_decomp.h
+ *
+ *  Streaming decompressor for the LZ4 block compressed assets in
+ *  console_converter.h, generated by tools/pack_assets.py
+ */
+
+#ifndef LZ_DECOMP_H_
+#define LZ_DECOMP_H_
+
+#include "board.h"
+#include "ff.h"
+
+#define LZ_WINDOW_SIZE 2048 // Maximum match offset, must match WINDOW_SIZE in tools/pack_assets.py
+#define LZ_FLUSH_SIZE (LZ_WINDOW_SIZE/2) // Decompressed data is written to the file in chunks of this many bytes
+
+#define LZ_MIN_MATCH 4 // Shortest match, match lengths are stored minus this value
+
+// Decompress an LZ4 block straight into an open file, bw is set to the number of bytes written on every return, FR_INT_ERR for a corrupt block
+FRESULT lz_decompressToFile(FIL *fp, const uint8_t *src, uint32_t srcSize, UINT *bw);
+
+#endif /* LZ_DECOMP_H_ */
@@ -31,15 +31,13 @@ BLUE = error
 #include "system.h"
 #include "config.h"
 #include "log.h"
+#include "trace.h"
+#include "sched.h"
+#include "mem.h"
 
-/* Size of the output file write buffer */
-#define RAW_BUFF_SIZE 0x4FFF // 0x5000 = 20kB, set 1 smaller for the extra byte required by the ring buffer
-
-#define VBAT_LOW 3.25 // Low battery indicator voltage
-#define VBAT_SHUTDOWN 3.0 // Low battery shut down voltage
-
-#define TICKRATE_HZ1 (100)	// 100 ticks per second
 #define TIMEOUT_SECS (300)	// Shut down after X seconds in Idle
+#define CARD_SETTLE_TICKS (5)	// Ticks from card insertion to initialization, lets connections and power stabilize
+#define FREE_SCAN_CLUSTERS (16384)	// FAT entries scanned into the free extent map each second in Idle, 128 sectors on FAT32
 
 RingBuffer *rawBuff;
 
@@ -49,12 +47,74 @@ SD_CardInfo cardinfo;
 
 uint32_t enterIdleTime; // Time that the idle state was entered
 
+static volatile uint32_t sysTickCounter; // Used to schedule less frequent tasks
+static volatile uint32_t cardInTicks; // Ticks the card has been detected, the card is initialized once it settles
+static bool lowBat; // Set when battery voltage drops below VBAT_LOW
+
+// Timebase, posts the tasks due this tick and leaves the work to them
 void SysTick_Handler(void){
-	static bool lowBat; // Set when battery voltage drops below VBAT_LOW
-	static uint32_t sysTickCounter;
+	sysTickCounter++;
+
+	sched_post(TASK_CONTROL);
+
+	// The trigger delay is polled, a recording wakes the writer from the sample buffer threshold
+	if(system_state == STATE_DAQ && daq_loop != daq_writeData){
+		sched_post(TASK_WRITER);
+	}
+
+	// Card removal is handled at once, insertion after the connections and power settle
+	if(Chip_GPIO_GetPinState(LPC_GPIO, 0, CARD_DETECT)){
+		cardInTicks = 0;
+		if(sd_state != SD_OUT){
+			sched_post(TASK_CARD);
+		}
+	}else if(sd_state == SD_OUT && ++cardInTicks >= CARD_SETTLE_TICKS){
+		sched_post(TASK_CARD);
+	}
+
+	if(sysTickCounter % tickRate == 0){
+		sched_post(TASK_HOUSEKEEPING);
+	}
+
+	// Battery conversion in the background, averaged by the ADC0 interrupt
+	vbat_start();
+}
+
+// Perform the current asynchronous daq action
+static void task_writer(void){
+	if(system_state == STATE_DAQ){
+		daq_loop();
+	}
+}
 
-	sysTickCounter++; // Used to schedule less frequent tasks
+// Initialize SD card after every insertion
+static void task_card(void){
+	if(Chip_GPIO_GetPinState(LPC_GPIO, 0, CARD_DETECT)){
+		// Card out
+		Board_LED_Color(LED_CYAN);
+		sd_state = SD_OUT;
+	}else if (sd_state == SD_OUT){
+		// Card in, power cycled as the card may have been taken out while powered off between low power bursts
+		if(sd_reset(&cardinfo) != SD_OK) {
+			error(ERROR_SD_INIT);
+		}
+		switch(system_state){
+		case STATE_IDLE:
+			Board_LED_Color(LED_GREEN);
+			break;
+		case STATE_MSC:
+			Board_LED_Color(LED_YELLOW);
+			break;
+		case STATE_DAQ:
+			Board_LED_Color(LED_RED);
+			break;
+		}
+		sd_state = SD_READY;
+	}
+}
 
+// System state machine, push button and error handling
+static void task_control(void){
 	switch(system_state){
 	case STATE_IDLE:
 		// Enable USB if VBUS is disconnected
@@ -68,6 +128,7 @@ void SysTick_Handler(void){
 			if (msc_init() == MSC_OK){
 				Board_LED_Color(LED_YELLOW);
 				system_state = STATE_MSC;
+				trace_event(TRACE_STATE, STATE_MSC);
 				break;
 			}else{ // Error on MSC initialization
 				error(ERROR_MSC_INIT);
@@ -77,17 +138,23 @@ void SysTick_Handler(void){
 		if (pb_shortPress() && sd_state == SD_READY){
 			daq_init();
 			system_state = STATE_DAQ;
+			trace_event(TRACE_STATE, STATE_DAQ);
 			break;
 		}
 
-		// Blink LED if in low battery state, otherwise solid green
-		if (lowBat && sysTickCounter % TICKRATE_HZ1 < TICKRATE_HZ1/2){
+		// Cyan without a card, blink LED if in low battery state, otherwise solid green
+		if (sd_state == SD_OUT){
+			Board_LED_Color(LED_CYAN);
+		} else if (lowBat && sysTickCounter % tickRate < tickRate/2){
 			Board_LED_Color(LED_OFF);
 		} else {
 			Board_LED_Color(LED_GREEN);
 		}
 		break;
 	case STATE_MSC:
+		// Write back the sectors of a finished host write
+		MSC_WriteFlushIdle();
+
 		// If VBUS is disconnected or button is short pressed
 		;bool pb;
 		if (Chip_GPIO_GetPinState(LPC_GPIO, 0, VBUS) == 0 || (pb = pb_shortPress())){
@@ -96,79 +163,65 @@ void SysTick_Handler(void){
 			}
 			msc_stop();
 			f_mount(fatfs,"",0); // mount file system
+			MSC_ReadAheadLog();
 			Board_LED_Color(LED_GREEN);
 			system_state = STATE_IDLE;
+			trace_event(TRACE_STATE, STATE_IDLE);
 			enterIdleTime = Chip_RTC_GetCount(LPC_RTC);
 		}
 		break;
 	case STATE_DAQ:
-		// Perform the current asynchronous daq action
-		daq_loop();
-
 		// If user has short pressed PB to stop acquisition
 		if (pb_shortPress()){
 			Board_LED_Color(LED_PURPLE);
 			daq_stop();
 			Board_LED_Color(LED_GREEN);
 			system_state = STATE_IDLE;
+			trace_event(TRACE_STATE, STATE_IDLE);
 			enterIdleTime = Chip_RTC_GetCount(LPC_RTC);
 			msc_state = MSC_DISABLED;
 		}
 		break;
 	}
 
-	// Initialize SD card after every insertion
-	if (Chip_GPIO_GetPinState(LPC_GPIO, 0, CARD_DETECT)){
-		// Card out
-		Board_LED_Color(LED_CYAN);
-		sd_state = SD_OUT;
-	}else{
-		// Card in
-		if (sd_state == SD_OUT){
-			// Delay 100ms to let connections and power stabilize
-			DWT_Delay(100000);
-			if(init_sd_spi(&cardinfo) != SD_OK) {
-				error(ERROR_SD_INIT);
-			}
-			switch(system_state){
-			case STATE_IDLE:
-				Board_LED_Color(LED_GREEN);
-				break;
-			case STATE_MSC:
-				Board_LED_Color(LED_YELLOW);
-				break;
-			case STATE_DAQ:
-				Board_LED_Color(LED_RED);
-				break;
-			}
-			sd_state = SD_READY;
-		}
+	/* Shut down conditions */
+	if (pb_longPress()){
+		shutdown_message("Power Button Pressed");
 	}
 
-	/* Run once per second */
-	if(sysTickCounter % TICKRATE_HZ1 == 0){
-		float vBat = read_vBat(10);
-		lowBat = vBat < VBAT_LOW ? true : false; // Set low battery state
-		if (vBat < VBAT_SHUTDOWN){
+	/* Handle errors */
+	error_handler();
+}
+
+// Battery and idle time out, run once per second and when a battery conversion crossed the armed level
+static void task_housekeeping(void){
+	uint32_t vBat = vbat_mV();
+	if (vBat){ // No reading yet in the first ticks
+		lowBat = vBat < VBAT_LOW_MV; // Set low battery state
+		if (vBat < VBAT_SHUTDOWN_MV){
 			shutdown_message("Low Battery");
 		}
+	}
 
-		if ((Chip_RTC_GetCount(LPC_RTC) - enterIdleTime > TIMEOUT_SECS && system_state == STATE_IDLE) ){
-			shutdown_message("Idle Time Out");
-		}
+	// Battery trace of a recording
+	if (system_state == STATE_DAQ){
+		daq_batteryTrace(vBat);
 	}
 
-	/* Shut down conditions */
-	if (pb_longPress()){
-		shutdown_message("Power Button Pressed");
+	if ((Chip_RTC_GetCount(LPC_RTC) - enterIdleTime > TIMEOUT_SECS && system_state == STATE_IDLE) ){
+		shutdown_message("Idle Time Out");
 	}
 
-	/* Handle errors */
-	error_handler();
+#if _USE_EXTMAP && !_FS_READONLY
+	// Fill the free extent map of the cluster allocator while the card is not in use
+	if (system_state == STATE_IDLE && sd_state == SD_READY){
+		f_scanfree("", FREE_SCAN_CLUSTERS, NULL);
+	}
+#endif
 }
 
 int main(void) {
-	uint32_t sysTickRate;
+	uint32_t bootTime; // DWT time at the start of boot, used to measure time to ready
 
 	Board_Init();
 
@@ -185,6 +238,7 @@ int main(void) {
 	// Set up clocking for SD lib
 	SystemCoreClockUpdate();
 	DWT_Init();
+	bootTime = DWT_Get();
 
 	// Set up the FatFS Object
 	f_mount(fatfs,"",0);
@@ -204,14 +258,19 @@ int main(void) {
 	// Allow MSC mode on startup
 	msc_state = MSC_ENABLED;
 
-	// Log startup
-	log_string("Startup");
+	// Log startup with the time from boot to ready
+	char startStr[70];
+	sprintf(startStr, "Startup, ready in %u ms, SD at %u.%u MHz%s", (unsigned int)((DWT_Get() - bootTime) / (SystemCoreClock / 1000)),
+			(unsigned int)(cardinfo.SpiClock / 1000000), (unsigned int)(cardinfo.SpiClock / 100000 % 10),
+			cardinfo.HighSpeed ? " high speed" : "");
+	log_string(startStr);
 
-	// Set up ADC for reading battery voltage
-	read_vBat_setup();
+	// Set up ADC for reading battery voltage in the background
+	vbat_init();
 
-	// Initialize ring buffer used to buffer raw data samples
-	rawBuff = RingBuffer_initWithBuffer(RAW_BUFF_SIZE, RAM1_BASE);
+	// Buffers are laid out for each recording, until then the arena is free for MSC read-ahead
+	mem_plan(MEM_PLAN_IDLE);
+	mem_logMap();
 
 	// Set up MRT used by pb and daq
 	Chip_MRT_Init();
@@ -222,19 +281,22 @@ int main(void) {
 	// Initialize push button
 	pb_init();
 
+	// Set up the tasks run from the main loop
+	sched_init();
+	sched_register(TASK_WRITER, task_writer);
+	sched_register(TASK_CARD, task_card);
+	sched_register(TASK_CONTROL, task_control);
+	sched_register(TASK_HOUSEKEEPING, task_housekeeping);
+
 	// Enable and setup SysTick Timer at a periodic rate
-	Chip_Clock_SetSysTickClockDiv(1);
-	sysTickRate = Chip_Clock_GetSysTickClockRate();
-	SysTick_Config(sysTickRate / TICKRATE_HZ1);
+	system_setTickRate(TICKRATE_HZ1);
 
-	// Idle and run systick loop until triggered or plugged in as a USB device
+	// Idle and run tasks until triggered or plugged in as a USB device
 	system_state = STATE_IDLE;
 	enterIdleTime = Chip_RTC_GetCount(LPC_RTC);
 
-    // Wait for interrupts
-    while (1) {
-    	__WFI();
-    }
+	// Run tasks as they are posted, sleeping in between
+	sched_run();
 
     return 0 ;
 }
@@ -0,0 +1,73 @@
+/*
+ * mem.c
+ *
+ *  Static arena for the large buffers, laid out by a plan for each mode.
+ *  Buffers are allocated in order and all released together by the next plan.
+ */
+
+#include <stdio.h>
+
+#include "mem.h"
+#include "daq.h"
+#include "log.h"
+
+// Each plan must fit the banks, checked at build time
+_Static_assert(RAM1_BASE_ADDR + RAM1_SIZE == RAM2_BASE_ADDR, "arena needs RAM1 and RAM2 contiguous");
+_Static_assert(RINGBUFFER_ALLOC_SIZE(STR_BUFF_SIZE) + RINGBUFFER_ALLOC_SIZE(RAW_BUFF_SIZE_READABLE) <= MEM_ARENA_SIZE,
+		"readable plan exceeds RAM1 and RAM2");
+_Static_assert(RINGBUFFER_ALLOC_SIZE(RAW_BUFF_SIZE_BINARY) <= MEM_ARENA_SIZE, "binary plan exceeds RAM1 and RAM2");
+_Static_assert(RINGBUFFER_ALLOC_SIZE(STR_BUFF_SIZE) + MEM_ALIGN(BURST_BUFF_SIZE) +
+		RINGBUFFER_ALLOC_SIZE(RAW_BUFF_SIZE_READABLE_LOWPOWER) <= MEM_ARENA_SIZE, "readable low power plan exceeds RAM1 and RAM2");
+_Static_assert(MEM_ALIGN(BURST_BUFF_SIZE) + RINGBUFFER_ALLOC_SIZE(RAW_BUFF_SIZE_BINARY_LOWPOWER) <= MEM_ARENA_SIZE,
+		"binary low power plan exceeds RAM1 and RAM2");
+_Static_assert(RAW_BUFF_SIZE_READABLE >= 16 * BLOCK_SIZE, "readable plan leaves too little raw buffer");
+_Static_assert(RAW_BUFF_SIZE_BINARY_LOWPOWER >= BURST_BUFF_SIZE + 4 * BLOCK_SIZE, "burst buffer leaves too little binary raw buffer");
+_Static_assert(RAW_BUFF_SIZE_READABLE_LOWPOWER >= BURST_BUFF_SIZE / 2 + 4 * BLOCK_SIZE, "burst buffer leaves too little readable raw buffer");
+
+// RAM0 layout from the linker, static data from the start of RAM0 up to the heap, the stack grows down from the top
+extern unsigned int _pvHeapStart;
+extern void _vStackTop(void);
+
+static MEM_PLAN memPlan;
+static uint32_t memUsed; // Bytes allocated from the start of the arena
+
+// Release all buffers and start allocating for a plan
+void mem_plan(MEM_PLAN plan){
+	memPlan = plan;
+	memUsed = 0;
+}
+
+// Return the current plan
+MEM_PLAN mem_currentPlan(void){
+	return memPlan;
+}
+
+// Allocate word aligned memory from the arena, returns NULL if the arena is exhausted
+void *mem_alloc(uint32_t size){
+	void *p;
+	size = MEM_ALIGN(size);
+	if(size > MEM_ARENA_SIZE - memUsed){
+		return NULL;
+	}
+	p = (char *)MEM_ARENA_BASE + memUsed;
+	memUsed += size;
+	return p;
+}
+
+// Return the bytes left in the arena
+uint32_t mem_available(void){
+	return MEM_ARENA_SIZE - memUsed;
+}
+
+// Write the memory map to the log
+void mem_logMap(void){
+	char str[70];
+	uint32_t ram0Static = (uint32_t)&_pvHeapStart - RAM0_BASE_ADDR;
+
+	sprintf(str, "RAM0 static %u B, heap and stack %u B", (unsigned int)ram0Static,
+			(unsigned int)((uint32_t)&_vStackTop - (uint32_t)&_pvHeapStart));
+	log_string(str);
+	sprintf(str, "Arena %u B, raw readable %u B, raw binary %u B", (unsigned int)MEM_ARENA_SIZE,
+			(unsigned int)RAW_BUFF_SIZE_READABLE, (unsigned int)RAW_BUFF_SIZE_BINARY);
+	log_string(str);
+}
@@ -0,0 +1,41 @@
+/*
+ * mem.h
+ *
+ *  Static arena for the large buffers, laid out by a plan for each mode.
+ *  Buffers are allocated in order and all released together by the next plan.
+ */
+
+#ifndef MEM_H_
+#define MEM_H_
+
+#include "board.h"
+
+#define MEM_ARENA_BASE RAM1_BASE // Arena starts at RAM1 and continues into RAM2, the banks are contiguous
+#define MEM_ARENA_BASE_ADDR RAM1_BASE_ADDR // Address of the arena for build time checks
+#define MEM_ARENA_SIZE (RAM1_SIZE + RAM2_SIZE) // Size of the arena in bytes
+
+#define MEM_ALIGN(size) (((size) + 3) & ~3) // Bytes of arena used by an allocation of size bytes
+
+// Arena plans, a plan is set before allocating its buffers
+typedef enum {
+	MEM_PLAN_IDLE,		// Not recording, the arena is free for MSC read-ahead
+	MEM_PLAN_READABLE,	// String buffer, raw sample buffer takes the rest
+	MEM_PLAN_BINARY,	// Raw sample buffer takes the whole arena
+} MEM_PLAN;
+
+// Release all buffers and start allocating for a plan
+void mem_plan(MEM_PLAN plan);
+
+// Return the current plan
+MEM_PLAN mem_currentPlan(void);
+
+// Allocate word aligned memory from the arena, returns NULL if the arena is exhausted
+void *mem_alloc(uint32_t size);
+
+// Return the bytes left in the arena
+uint32_t mem_available(void);
+
+// Write the memory map to the log
+void mem_logMap(void);
+
+#endif /* MEM_H_ */
@@ -18,6 +18,12 @@ void USB_IRQHandler(void) {
 // Make USB device invisible on the USB bus
 void msc_stop(void){
   USBD_API->hw->Connect(g_hUsb, 0);
+
+  // Write the sectors the host was told are written, the battery keeps the card powered when VBUS drops
+  MSC_WriteFlush();
+
+  // Close the read stream so the card can be used by the file system
+  MSC_ReadAheadStop();
 }
 
 // Start up MSC without test outputs
@@ -29,6 +35,10 @@ MSC_ERR msc_init(void){
   ErrorCode_t ret = LPC_OK;
   USB_INTERFACE_DESCRIPTOR* pIntfDesc;
 
+  /* read-ahead windows and the write-back buffer use the memory arena while not recording */
+  MSC_ReadAheadInit();
+  MSC_WriteBackInit();
+
   /* enable clocks */
   Chip_USB_Init();
 
@@ -73,7 +83,7 @@ MSC_ERR msc_init(void){
 	msc_param.BlockCount = cardinfo.CardCapacity/SD_BLOCKSIZE;
 	msc_param.BlockSize = SD_BLOCKSIZE;
 
-	// Attempting to accept cards >4gb, doesn't allow read/write beyond 4gb, may not be necessary for reading up to the full 4gb mark
+	// MemorySize is limited to 32 bits, cards >4gb are addressed through BlockCount and the high_offset of the callbacks
 	if(cardinfo.CardCapacity > 0xFFFFFFFF){
 		msc_param.MemorySize = 0xFFFFFFFF;
 	}else{
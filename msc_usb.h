@@ -11,8 +11,44 @@
 #include <stdint.h>
 #include "error.h"
 
+#define RA_MIN_SECTORS 8		// Read-ahead window after a random access
+#define RA_MAX_SECTORS 12		// Read-ahead window grown to by sequential access, two windows and the write-back buffer fill RAM1
+#define RA_PUMP_BYTES 128		// Bytes read ahead per 64 byte packet sent, twice the host rate so a window grown to double size is ready in time
+
+#define WB_SECTORS 8			// Consecutive sectors coalesced into one multiple block write
+#define WB_TIMEOUT_MS 20		// Pending sectors are written once the host stops writing for this long
+
+// Read statistics of an MSC session
+typedef struct MSC_Read_Stats {
+  uint64_t bytes;			// Bytes sent to the host
+  uint64_t activeCycles;	// Cycles between reads less than 100ms apart, the time spent in transfers
+  uint32_t windows;			// Read-ahead windows reached sequentially by the host
+  uint32_t ready;			// Windows completely read ahead when the host reached them
+  uint32_t restarts;		// Random accesses that restarted the read stream
+} MSC_Read_Stats;
+
+extern MSC_Read_Stats msc_readStats;
+
 void MSC_Read(uint32_t offset, uint8_t** buff_adr, uint32_t length, uint32_t high_offset);
 void MSC_Write(uint32_t offset, uint8_t** buff_adr, uint32_t length, uint32_t high_offset);
 ErrorCode_t MSC_Verify(uint32_t offset, uint8_t* src, uint32_t length, uint32_t high_offset);
 
+// Take the read-ahead windows from the memory arena and clear the statistics, at the start of an MSC session
+void MSC_ReadAheadInit(void);
+
+// Close the read stream and drop the read-ahead windows, before any other access to the card
+void MSC_ReadAheadStop(void);
+
+// Write the read statistics of the session to the log
+void MSC_ReadAheadLog(void);
+
+// Take the write-back buffer from the memory arena, after MSC_ReadAheadInit
+void MSC_WriteBackInit(void);
+
+// Write the pending sectors to the card, from the USB interrupt or with it disabled
+void MSC_WriteFlush(void);
+
+// Write the pending sectors once the host has stopped writing for WB_TIMEOUT_MS, called from the main loop
+void MSC_WriteFlushIdle(void);
+
 #endif
@@ -5,6 +5,7 @@
  *      Author: Kestutis Bivainis
  *
  *  Modified by Kyle Smith to allow multiple block read
+ *  Reads are streamed with CMD18 and read ahead into two windows from the memory arena
  */
 
 #include <cr_section_macros.h>
@@ -17,63 +18,241 @@
 #include "error.h"
 #include "sd_spi.h"
 #include "sys_error.h"
+#include "mem.h"
+#include "log.h"
 
-#define BLOCK_COUNT 8
+// Read-ahead window, filled from the read stream in order
+typedef struct Read_Window {
+  uint8_t *data;	// RA_MAX_SECTORS sectors from the memory arena
+  uint32_t start;	// SD block address of the first sector
+  uint32_t count;	// Sectors in the window
+  uint32_t filled;	// Bytes read into the window
+} Read_Window;
 
-// read buffer
-uint8_t bufr[SD_BLOCKSIZE*BLOCK_COUNT];
+_Static_assert((2 * RA_MAX_SECTORS + WB_SECTORS) * SD_BLOCKSIZE <= MEM_ARENA_SIZE, "MSC buffers exceed the memory arena");
+// The ROM stack uses its memory while MSC runs, the recording plans are free to take it between sessions
+_Static_assert(MEM_ARENA_BASE_ADDR + (2 * RA_MAX_SECTORS + WB_SECTORS) * SD_BLOCKSIZE <= USB_STACK_MEM_BASE ||
+    USB_STACK_MEM_BASE + USB_STACK_MEM_SIZE <= MEM_ARENA_BASE_ADDR, "MSC buffers overlap the USB stack memory");
 
-// write buffer
-uint8_t bufw[SD_BLOCKSIZE];
+// Two windows, the host reads the front window while the back window is read ahead
+// The read stream is positioned at the end of the filled part of the back window
+// Sequential reads grow the windows from RA_MIN_SECTORS to RA_MAX_SECTORS, 12 sectors (6 kB) each and 24 buffered,
+// not 16 as first planned: the USB ROM stack owns RAM2 during MSC, so both windows and the write-back buffer fit RAM1
+// and the logged MB/s is measured at this depth
+static Read_Window window[2];
+static uint8_t front;
+static bool windowsValid;
+static uint32_t raSectors; // Size of the next back window, doubled by each sequential window
+static uint32_t lastRead; // DWT time of the last read, for the transfer time
+
+MSC_Read_Stats msc_readStats;
+
+// Write-back buffer, WB_SECTORS consecutive sectors from the memory arena
+static uint8_t *wbData;
+static uint32_t wbStart; // SD block address of the first pending sector
+static volatile uint32_t wbCount; // Complete sectors pending
+static volatile uint32_t wbTime; // DWT time of the last write packet
 
 // verify buffer
 uint8_t bufv[SD_BLOCKSIZE];
 
+// Convert the 64-bit byte offset from the USB stack into an SD block address
+// high_offset holds bits 63:32 of the offset on cards >4gb
+static inline uint32_t msc_blockAddr(uint32_t offset, uint32_t high_offset) {
+  return (high_offset << (32 - SD_BLOCKSIZE_NBITS)) | (offset >> SD_BLOCKSIZE_NBITS);
+}
+
+// Take the read-ahead windows from the memory arena and clear the statistics, at the start of an MSC session
+void MSC_ReadAheadInit(void) {
+  mem_plan(MEM_PLAN_IDLE);
+  window[0].data = mem_alloc(RA_MAX_SECTORS * SD_BLOCKSIZE);
+  window[1].data = mem_alloc(RA_MAX_SECTORS * SD_BLOCKSIZE);
+  windowsValid = false;
+  memset(&msc_readStats, 0, sizeof(msc_readStats));
+}
+
+// Close the read stream and drop the read-ahead windows, before any other access to the card
+void MSC_ReadAheadStop(void) {
+  windowsValid = false;
+  sd_stream_stop();
+}
+
+// Write the read statistics of the session to the log
+void MSC_ReadAheadLog(void) {
+  char str[70];
+  uint32_t kBps = 0;
+
+  if(msc_readStats.bytes == 0) {
+    return;
+  }
+  if(msc_readStats.activeCycles) {
+    kBps = (uint32_t)(msc_readStats.bytes * (SystemCoreClock / 1000) / msc_readStats.activeCycles);
+  }
+  sprintf(str, "MSC read %u MB at %u.%02u MB/s, %u/%u windows ready",
+      (unsigned int)(msc_readStats.bytes >> 20), (unsigned int)(kBps / 1000), (unsigned int)(kBps % 1000 / 10),
+      (unsigned int)msc_readStats.ready, (unsigned int)msc_readStats.windows);
+  log_string(str);
+}
+
+// Take the write-back buffer from the memory arena, after MSC_ReadAheadInit
+void MSC_WriteBackInit(void) {
+  wbData = mem_alloc(WB_SECTORS * SD_BLOCKSIZE);
+  wbCount = 0;
+}
+
+// Write the pending sectors to the card, from the USB interrupt or with it disabled
+void MSC_WriteFlush(void) {
+  uint32_t count = wbCount;
+  uint8_t res;
+
+  if(count == 0) {
+    return;
+  }
+  wbCount = 0;
+
+  if(count == 1) {
+    res = sd_write_block(wbStart, wbData);
+  } else {
+    res = sd_write_multiple_blocks(wbStart, count, wbData);
+  }
+  // Retry once a rung down the SPI clock ladder
+  if(res != SD_OK && sd_speed_down() == 0) {
+    res = count == 1 ? sd_write_block(wbStart, wbData) : sd_write_multiple_blocks(wbStart, count, wbData);
+  }
+  if(res != SD_OK) {
+    error(ERROR_MSC_SD_WRITE);
+  }
+}
+
+// Write the pending sectors once the host has stopped writing for WB_TIMEOUT_MS, called from the main loop
+void MSC_WriteFlushIdle(void) {
+  NVIC_DisableIRQ(USB0_IRQn);
+  if(wbCount && DWT_Get() - wbTime > WB_TIMEOUT_MS * (SystemCoreClock / 1000)) {
+    MSC_WriteFlush();
+  }
+  NVIC_EnableIRQ(USB0_IRQn);
+}
+
+// Read the window from the stream until bytes are filled
+static void ra_fill(Read_Window *w, uint32_t bytes) {
+  if(windowsValid && w->filled < bytes) {
+    // On a CRC mismatch read the window again from its start, which leaves the stream where it was
+    if(sd_stream_read(w->data + w->filled, bytes - w->filled) != 0 &&
+       (sd_stream_start(w->start) != 0 || sd_stream_read(w->data, bytes) != 0)) {
+      windowsValid = false;
+      error(ERROR_MSC_SD_READ);
+    }
+    w->filled = bytes;
+  }
+}
+
+// Sectors of a window of count sectors from start that are on the card, CMD18 must not run past its end
+static uint32_t ra_clamp(uint32_t start, uint32_t count) {
+  uint32_t sectors = (uint32_t)(cardinfo.CardCapacity >> SD_BLOCKSIZE_NBITS);
+  if(start >= sectors) {
+    return 0;
+  }
+  return count < sectors - start ? count : sectors - start;
+}
+
+// Start the back window where the front window ends, the stream is already there
+// The back window is empty when the front window ends at the end of the card
+static void ra_next(void) {
+  Read_Window *f = &window[front];
+  Read_Window *b = &window[front ^ 1];
+  b->start = f->start + f->count;
+  b->count = ra_clamp(b->start, raSectors);
+  b->filled = 0;
+}
+
 // Zero-Copy Data Transfer model
-void MSC_Read(uint32_t offset, uint8_t** buff_adr, uint32_t length, uint32_t high_offset) { // high offset is always 0 and cannot be used to increase capacity >4gb
-  static bool bufferValid = false; // Set to indicate that the buffer data can be read
+void MSC_Read(uint32_t offset, uint8_t** buff_adr, uint32_t length, uint32_t high_offset) {
+  uint32_t block = msc_blockAddr(offset, high_offset);
+  uint32_t now = DWT_Get();
+  Read_Window *w = &window[front];
+  Read_Window *b = &window[front ^ 1];
 
   // Host requests data in chunks of 512 bytes, USB bulk endpoint size is 64 bytes.
   // For each sector of 512 bytes, this function gets called 8 times with length=64 bytes
   Board_LED_Color(LED_PURPLE); // Purple MSC r/w
 
-  // SD block address of the buffer data
-  static uint32_t address;
+  // Count the time of transfers, not the time between them
+  if(now - lastRead < SystemCoreClock / 10) {
+    msc_readStats.activeCycles += now - lastRead;
+  }
+  lastRead = now;
+  msc_readStats.bytes += length;
 
-  // Block address is a multiple of BLOCK_COUNT
-  uint32_t new_address = ((offset/SD_BLOCKSIZE)/BLOCK_COUNT)*BLOCK_COUNT;
+  // The host may read back what it has written
+  if(wbCount) {
+    MSC_WriteFlush();
+  }
 
-  // If the requested data is not in the current buffered blocks, or is in the very first buffer
-  // address is initialized to 0, therefore valid data is not guaranteed for blocks near 0, even when address is 0
-  if(new_address < address || new_address >= address + BLOCK_COUNT || bufferValid == false){
-	address = new_address;
-	if(sd_read_multiple_blocks(address, BLOCK_COUNT, bufr)!=SD_OK){
-	  error(ERROR_MSC_SD_READ);
-	}
-	bufferValid = true;
+  if(!windowsValid || block < w->start || block >= w->start + w->count) {
+    if(windowsValid && block >= b->start && block < b->start + b->count) {
+      // Sequential, the host reached the window read ahead, complete it if the host caught up
+      msc_readStats.windows++;
+      if(b->filled == b->count * SD_BLOCKSIZE) {
+        msc_readStats.ready++;
+      }
+      ra_fill(b, b->count * SD_BLOCKSIZE);
+      front ^= 1;
+      raSectors = raSectors * 2 > RA_MAX_SECTORS ? RA_MAX_SECTORS : raSectors * 2;
+    } else {
+      // Random access, restart the stream at the window holding the block
+      msc_readStats.restarts++;
+      raSectors = RA_MIN_SECTORS;
+      w->start = (block / RA_MIN_SECTORS) * RA_MIN_SECTORS;
+      w->count = ra_clamp(w->start, RA_MIN_SECTORS);
+      w->filled = 0;
+      windowsValid = w->count && sd_stream_start(w->start) == 0;
+      if(!windowsValid) {
+        error(ERROR_MSC_SD_READ);
+      }
+      ra_fill(w, w->count * SD_BLOCKSIZE);
+    }
+    ra_next();
+    w = &window[front];
+    b = &window[front ^ 1];
   }
 
   // Set pointer in buffer
-  uint32_t j = offset%(SD_BLOCKSIZE*BLOCK_COUNT);
-  *buff_adr = &bufr[j];
+  *buff_adr = w->data + (block - w->start) * SD_BLOCKSIZE + offset % SD_BLOCKSIZE;
+
+  // Read ahead into the back window while the USB hardware sends this packet
+  if(b->count) {
+    ra_fill(b, b->filled + RA_PUMP_BYTES < b->count * SD_BLOCKSIZE ? b->filled + RA_PUMP_BYTES : b->count * SD_BLOCKSIZE);
+  }
 
   Board_LED_Color(LED_YELLOW); // Yellow MSC idle
 }
 
-// TODO: Rewrite to use multiple block write
 void MSC_Write(uint32_t offset, uint8_t** buff_adr, uint32_t length, uint32_t high_offset) {
   Board_LED_Color(LED_PURPLE); // Purple MSC r/w
   uint32_t j = offset%SD_BLOCKSIZE;
+  uint32_t block = msc_blockAddr(offset, high_offset);
+
+  // The card cannot be written with a read stream open, and the windows may hold the old data
+  if(windowsValid) {
+    MSC_ReadAheadStop();
+  }
 
   // Host requests data in chunks of 512 bytes, USB bulk endpoint size is 64 bytes.
   // For each sector of 512 bytes, this function gets called 8 times with length=64 bytes
-  // Accumulate all requests in the buffer, and on the last request write 512 bytes to the card.
-  memcpy(&bufw[j],*buff_adr,length);
+  // Accumulate consecutive sectors in the write-back buffer, written together when the run ends or the buffer is full
+  if(j==0) {
+    if(wbCount && (block != wbStart + wbCount || wbCount == WB_SECTORS)) {
+      MSC_WriteFlush();
+    }
+    if(wbCount == 0) {
+      wbStart = block;
+    }
+  }
+  memcpy(&wbData[wbCount*SD_BLOCKSIZE + j],*buff_adr,length);
+  wbTime = DWT_Get();
 
   if((offset+USB_FS_MAX_BULK_PACKET)%SD_BLOCKSIZE==0) {
-    if(sd_write_block(offset/SD_BLOCKSIZE, bufw)!=SD_OK){
-    	error(ERROR_MSC_SD_WRITE);
-    }
+    wbCount++;
   }
   Board_LED_Color(LED_YELLOW); // Yellow MSC idle
 }
@@ -83,8 +262,15 @@ ErrorCode_t MSC_Verify(uint32_t offset, uint8_t* src, uint32_t length, uint32_t
   
   uint32_t j = offset%SD_BLOCKSIZE;
   
+  if(windowsValid) {
+    MSC_ReadAheadStop();
+  }
+  if(wbCount) {
+    MSC_WriteFlush();
+  }
+
   if(j==0) {
-    sd_read_block(offset/SD_BLOCKSIZE,bufv);
+    sd_read_block(msc_blockAddr(offset, high_offset),bufv);
   }  
   
   if(!memcmp(src,&bufv[j],length)) {
@@ -0,0 +1,106 @@
+/*
+ * profile.c
+ *
+ *  Cycle profiling of the acquisition stages using the DWT cycle counter.
+ *  Each probe records min/max/mean and a log2 histogram of cycles per call.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "profile.h"
+#include "config.h"
+
+#ifdef PROFILE
+
+Prof_Stats prof_stats[PROF_COUNT];
+
+// Probe names, in PROF_PROBE order
+static const char* const probeName[] = {
+	"RIT_IRQHandler",
+	"MRT1_IRQHandler",
+	"daq_updateVout",
+	"daq_readableFormat",
+	"daq_writeBlock",
+	"disk_write",
+	"task_writer_latency",
+	"task_card_latency",
+	"task_control_latency",
+	"task_housekeeping_latency",
+	"task_writer",
+	"task_card",
+	"task_control",
+	"task_housekeeping"
+};
+
+// Clear the statistics of all probes
+void prof_reset(void){
+	int32_t i;
+	memset(prof_stats, 0, sizeof(prof_stats));
+	for(i=0;i<PROF_COUNT;i++){
+		prof_stats[i].min = UINT32_MAX;
+	}
+}
+
+// Write the statistics of all probes to the named file
+void prof_report(const char *fn){
+	FIL profFile;
+	char line[LINE_SIZE+1];
+	int32_t i, b;
+
+	if(f_open(&profFile, fn, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK){
+		return;
+	}
+
+	/**** Report ****
+	 * Ex.
+	 * date time, Mon Mar 02 20:02:43 2015
+	 * clock, 72000000, Hz
+	 * isr code, SRAM
+	 * sample path, SPECIALIZED
+	 * probe, count, min[cc], mean[cc], max[cc], histogram[log2(cc):count]
+	 * RIT_IRQHandler, 400000, 262, 301, 934, 8:380211, 9:19789
+	 */
+	sprintf(line, "date time, %s", getTimeStr()); // asctime string ends in a newline
+	f_puts(line, &profFile);
+	sprintf(line, "clock, %u, Hz\n", (unsigned int)SystemCoreClock);
+	f_puts(line, &profFile);
+#ifdef RAMFUNC_ISR
+	f_puts("isr code, SRAM\n", &profFile);
+#else
+	f_puts("isr code, FLASH\n", &profFile);
+#endif
+#ifdef DAQ_SPECIALIZED
+	f_puts("sample path, SPECIALIZED\n", &profFile);
+#else
+	f_puts("sample path, GENERIC\n", &profFile);
+#endif
+	f_puts("probe, count, min[cc], mean[cc], max[cc], histogram[log2(cc):count]\n", &profFile);
+
+	for(i=0;i<PROF_COUNT;i++){
+		Prof_Stats *p = &prof_stats[i];
+		uint32_t mean = p->count ? (uint32_t)(p->sum / p->count) : 0;
+		int32_t size = sprintf(line, "%s, ", probeName[i]);
+		size += uint64ToStr(line+size, p->count);
+		sprintf(line+size, ", %u, %u, %u", (unsigned int)(p->count ? p->min : 0), (unsigned int)mean, (unsigned int)p->max);
+		f_puts(line, &profFile);
+		for(b=0;b<PROF_BINS;b++){
+			if(p->hist[b]){
+				size = sprintf(line, ", %d:", (int)b);
+				size += uint64ToStr(line+size, p->hist[b]);
+				f_puts(line, &profFile);
+			}
+		}
+		f_puts("\n", &profFile);
+	}
+
+	f_close(&profFile);
+}
+
+#else
+
+void prof_reset(void){}
+
+void prof_report(const char *fn){}
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * profile.h
+ *
+ *  Cycle profiling of the acquisition stages using the DWT cycle counter.
+ *  Each probe records min/max/mean and a log2 histogram of cycles per call.
+ */
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include "board.h"
+#include "delay.h"
+#include "ff.h"
+#include "sched.h"
+
+#define PROF_BINS 24 // Histogram bins, bin n counts calls taking [2^n, 2^(n+1)) cycles, the last bin counts all longer calls
+
+// Profiled stages
+typedef enum {
+	PROF_RIT,				// RIT_IRQHandler
+	PROF_MRT1,				// MRT1_IRQHandler
+	PROF_UPDATE_VOUT,		// daq_updateVout
+	PROF_READABLE_FORMAT,	// daq_readableFormat
+	PROF_WRITE_BLOCK,		// daq_writeBlock
+	PROF_DISK_WRITE,		// disk_write
+	PROF_TASK_LATENCY,		// Post to start of each task, in SCHED_TASK order
+	PROF_TASK_RUN = PROF_TASK_LATENCY + TASK_COUNT, // Run time of each task, in SCHED_TASK order
+	PROF_COUNT = PROF_TASK_RUN + TASK_COUNT
+} PROF_PROBE;
+
+// Statistics for a single probe
+typedef struct Prof_Stats {
+	uint64_t count;	// Number of calls, 64-bit as MRT1 would wrap 32 bits in 10 hours
+	uint32_t min;	// Minimum cycles per call
+	uint32_t max;	// Maximum cycles per call
+	uint64_t sum;	// Total cycles, used for the mean
+	uint64_t hist[PROF_BINS]; // log2 histogram of cycles per call
+} Prof_Stats;
+
+#ifdef PROFILE
+
+extern Prof_Stats prof_stats[PROF_COUNT];
+
+// Start timing a probe, returns the start time to pass to prof_end
+#define prof_start() DWT_Get()
+
+// Finish timing a probe, ~20cc
+static inline void prof_end(PROF_PROBE probe, uint32_t start){
+	uint32_t cc = DWT_Get() - start;
+	Prof_Stats *p = &prof_stats[probe];
+	uint32_t bin = 31 - __CLZ(cc | 1);
+
+	p->count++;
+	p->sum += cc;
+	if(cc < p->min){
+		p->min = cc;
+	}
+	if(cc > p->max){
+		p->max = cc;
+	}
+	p->hist[bin < PROF_BINS ? bin : PROF_BINS - 1]++;
+}
+
+#else
+
+#define prof_start() 0
+#define prof_end(probe, start) ((void)(start))
+
+#endif
+
+// Clear the statistics of all probes
+void prof_reset(void);
+
+// Write the statistics of all probes to the named file
+void prof_report(const char *fn);
+
+#endif /* PROFILE_H_ */
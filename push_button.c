@@ -1,4 +1,6 @@
 #include "push_button.h"
+#include "trace.h"
+#include "sched.h"
 
 PB_STATE pbState;
 uint32_t pbTenths;
@@ -19,6 +21,8 @@ void PIN_INT0_IRQHandler(void){
 		break;
 	case TRIGGERED:
 		pbShortPress = true;
+		trace_event(TRACE_BUTTON, 0);
+		sched_post(TASK_CONTROL);
 		Chip_MRT_SetInterval(LPC_MRT_CH(0), MRT_INTVAL_LOAD);
 	case LONGPRESS:
 		PININT_EnableLevelInt(LPC_GPIO_PIN_INT, 1 << 0);
@@ -47,6 +51,8 @@ void MRT0_IRQHandler(void){
 		if(pbTenths >= 10){
 			pbState = LONGPRESS;
 			pbLongPress = true;
+			trace_event(TRACE_BUTTON, 1);
+			sched_post(TASK_CONTROL);
 			Chip_MRT_SetInterval(LPC_MRT_CH(0), MRT_INTVAL_LOAD);
 		}
 	}
@@ -1,34 +1,20 @@
 #include "ring_buff.h"
 
-// Allocate memory for the buffer and return a ring buffer struct
+// Allocate the buffer from the arena of the current memory plan and return a ring buffer struct, NULL if the plan is exhausted
+// Released with the other buffers of the plan by the next mem_plan()
 RingBuffer *RingBuffer_init(int32_t length){
-    RingBuffer *buffer = malloc(sizeof(RingBuffer));
-    buffer->length  = length + 1;
-    buffer->start = 0;
-    buffer->end = 0;
-    buffer->buffer = malloc(buffer->length);
-    return buffer;
-}
-
-// Return a ring buffer struct, using a user set buffer
-RingBuffer *RingBuffer_initWithBuffer(int32_t length, char *pBuffer){
-    RingBuffer *buffer = malloc(sizeof(RingBuffer));
+    RingBuffer *buffer = mem_alloc(sizeof(RingBuffer));
+    char *data = mem_alloc(length + 1);
+    if(!buffer || !data) {
+        return NULL;
+    }
     buffer->length  = length + 1;
     buffer->start = 0;
     buffer->end = 0;
-    buffer->buffer = pBuffer;
+    buffer->buffer = data;
     return buffer;
 }
 
-// Free memory used by the buffer
-void RingBuffer_destroy(RingBuffer *buffer){
-    if(buffer) {
-        free(buffer->buffer);
-        free(buffer);
-        buffer = NULL;
-    }
-}
-
 // Write string into the ring buffer
 void RingBuffer_writeStr(RingBuffer *b, char *string){
 	// Get the length of the string
@@ -53,23 +39,26 @@ void RingBuffer_writeStr(RingBuffer *b, char *string){
 }
 
 // Write data into the ring buffer
-void RingBuffer_writeData(RingBuffer *b, void *data, int32_t count){
+// Called from the sampling ISR
+RAMFUNC void RingBuffer_writeData(RingBuffer *b, void *data, int32_t count){
+	char *src = data;
+	int32_t end = b->end;
+
 	// Error if data would be overwritten before being read
 	if(count + ((b->end - b->start + b->length) % b->length)  >= b->length ){
 		error(ERROR_BUF_OVF);
 	}
 
-	// Copy the data into the ring buffer
-	if(b->end + count > b->length){
-		int32_t partLen = b->length - b->end;
-		memcpy(b->buffer + b->end, data, partLen);
-		memcpy(b->buffer, data + partLen, count-partLen);
-	}else{
-		memcpy(b->buffer + b->end, data, count);
+	// Copy the data into the ring buffer a byte at a time, samples are a few bytes and the library memcpy runs from flash
+	while(count--){
+		b->buffer[end++] = *src++;
+		if(end == b->length){
+			end = 0;
+		}
 	}
 
 	// Move the end
-	b->end = (b->end + count) % b->length;
+	b->end = end;
 }
 
 // Read count bytes into data, return count of byte read
@@ -104,10 +93,15 @@ int32_t RingBuffer_read(RingBuffer *b, void *data, int32_t count){
 }
 
 // Return the size of the current data in the buffer
-int32_t RingBuffer_getSize(RingBuffer *b){
+RAMFUNC int32_t RingBuffer_getSize(RingBuffer *b){
 	return (b->end - b->start + b->length) % b->length;
 }
 
+// Return the number of bytes that can be written without overflowing
+RAMFUNC int32_t RingBuffer_getFree(RingBuffer *b){
+	return b->length - 1 - RingBuffer_getSize(b);
+}
+
 // Clear the buffer
 void RingBuffer_clear(RingBuffer *b){
 	b->end = b->start = 0;
@@ -5,6 +5,7 @@
 #include <stdlib.h>
 #include "board.h"
 #include "sys_error.h"
+#include "mem.h"
 
 typedef struct RingBuffer{
     char *buffer;	// ring buffer data
@@ -13,14 +14,11 @@ typedef struct RingBuffer{
     int32_t end;	// index of the end
 } RingBuffer;
 
-// Allocate memory for the buffer and return a ring buffer struct
-RingBuffer *RingBuffer_init(int32_t length);
-
-// Return a ring buffer struct, using a user set buffer
-RingBuffer *RingBuffer_initWithBuffer(int32_t length, char *pBuffer);
+#define RINGBUFFER_ALLOC_SIZE(length) (MEM_ALIGN(sizeof(RingBuffer)) + MEM_ALIGN((length) + 1)) // Arena bytes used by RingBuffer_init(length)
+#define RINGBUFFER_MAX_LENGTH(bytes) ((bytes) - MEM_ALIGN(sizeof(RingBuffer)) - 1) // Longest ring buffer that fits in bytes of arena
 
-// Free memory used by the buffer
-void RingBuffer_destroy(RingBuffer *buffer);
+// Allocate the buffer from the arena of the current memory plan and return a ring buffer struct, NULL if the plan is exhausted
+RingBuffer *RingBuffer_init(int32_t length);
 
 // Write string into the ring buffer
 void RingBuffer_writeStr(RingBuffer *buffer, char *data);
@@ -34,6 +32,9 @@ int32_t RingBuffer_read(RingBuffer *b, void *data, int32_t count);
 // Return the size of the current data in the buffer
 int32_t RingBuffer_getSize(RingBuffer *b);
 
+// Return the number of bytes that can be written without overflowing
+int32_t RingBuffer_getFree(RingBuffer *b);
+
 // Clear the buffer
 void RingBuffer_clear(RingBuffer *b);
 
@@ -0,0 +1,105 @@
+/*
+ * sched.c
+ *
+ *  Run to completion task scheduler. Interrupts post tasks, main() runs the
+ *  posted tasks in priority order from its sleep loop. Task latency from post
+ *  to start and task run time are reported in profile.txt when PROFILE is defined.
+ */
+
+#include "sched.h"
+#include "delay.h"
+#include "profile.h"
+
+static void (*taskFn[TASK_COUNT])(void);
+static volatile uint32_t pending;				// Bit n set when task n is posted
+static uint32_t yielded;						// Bit n set when task n yielded, it runs once no other task is posted
+static volatile uint32_t postTime[TASK_COUNT];	// DWT time of the first post since the task last ran
+
+uint64_t sched_sleepCycles;
+
+// Pended by sched_post, wakes the scheduler from __WFI even when the post was made with interrupts masked
+void PendSV_Handler(void){
+}
+
+// Set up the scheduler, PendSV at the lowest priority
+void sched_init(void){
+	pending = 0;
+	NVIC_SetPriority(PendSV_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+}
+
+// Set the function run for a task
+void sched_register(SCHED_TASK task, void (*fn)(void)){
+	taskFn[task] = fn;
+}
+
+// Post a task to run, safe from any interrupt, a posted task runs once however often it is posted
+RAMFUNC void sched_post(SCHED_TASK task){
+	uint32_t primask;
+
+	if(pending & (1 << task)){
+		return; // Already posted, keep the time of the first post
+	}
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	postTime[task] = DWT_Get();
+	pending |= 1 << task;
+	__set_PRIMASK(primask);
+
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+// Post the running task again to run after the other posted tasks, a long task gives way to lower priority tasks
+void sched_yield(SCHED_TASK task){
+	yielded |= 1 << task;
+	sched_post(task);
+}
+
+// Run the highest priority posted task, returns false if no task is posted
+static bool sched_dispatch(void){
+	uint32_t posted;
+	uint32_t ready;
+	int32_t task;
+
+	__disable_irq();
+	if(!pending){
+		__enable_irq();
+		return false;
+	}
+	// Yielded tasks run when they are the only tasks posted
+	ready = pending & ~yielded;
+	if(!ready){
+		ready = pending;
+		yielded = 0;
+	}
+	task = __CLZ(__RBIT(ready)); // Lowest set bit
+	pending &= ~(1 << task);
+	posted = postTime[task];
+	__enable_irq();
+
+	prof_end(PROF_TASK_LATENCY + task, posted);
+	uint32_t profStart = prof_start();
+	if(taskFn[task]){
+		taskFn[task]();
+	}
+	prof_end(PROF_TASK_RUN + task, profStart);
+	return true;
+}
+
+// Run posted tasks and sleep when none are posted, does not return
+void sched_run(void){
+	while(1){
+		// Higher priority tasks posted during a task run before the next lower one
+		while(sched_dispatch());
+
+		// Sleep with interrupts masked so a post between the check and __WFI still wakes the core
+		// The wake interrupt runs after __enable_irq, so the sleep time excludes it
+		__disable_irq();
+		if(!pending){
+			uint32_t sleepStart = DWT_Get();
+			__WFI();
+			sched_sleepCycles += DWT_Get() - sleepStart;
+		}
+		__enable_irq();
+	}
+}
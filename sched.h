@@ -0,0 +1,41 @@
+/*
+ * sched.h
+ *
+ *  Run to completion task scheduler. Interrupts post tasks, main() runs the
+ *  posted tasks in priority order from its sleep loop. Task latency from post
+ *  to start and task run time are reported in profile.txt when PROFILE is defined.
+ */
+
+#ifndef SCHED_H_
+#define SCHED_H_
+
+#include "board.h"
+
+// Tasks in priority order, the lowest posted task runs first
+typedef enum {
+	TASK_WRITER,		// Current daq_loop action, posted by the sample buffer threshold
+	TASK_CARD,			// SD card insertion and removal, posted by card detect
+	TASK_CONTROL,		// System state, push button and error handling, posted every tick
+	TASK_HOUSEKEEPING,	// Battery and idle time out, posted once per second
+	TASK_COUNT
+} SCHED_TASK;
+
+// Set up the scheduler, PendSV at the lowest priority
+void sched_init(void);
+
+// Set the function run for a task
+void sched_register(SCHED_TASK task, void (*fn)(void));
+
+// Post a task to run, safe from any interrupt, a posted task runs once however often it is posted
+void sched_post(SCHED_TASK task);
+
+// Post the running task again to run after the other posted tasks, a long task gives way to lower priority tasks
+void sched_yield(SCHED_TASK task);
+
+// Run posted tasks and sleep when none are posted, does not return
+void sched_run(void);
+
+// Cycles the core has slept in sched_run, cleared by the user to measure the duty cycle of a period
+extern uint64_t sched_sleepCycles;
+
+#endif /* SCHED_H_ */
@@ -14,8 +14,32 @@ static uint8_t CRCTable[256];
 
 extern SD_CardInfo cardinfo;
 
+// cycles the card held busy after the last single block write
+uint32_t sd_write_busy;
+
+// data blocks transferred again after a CRC mismatch
+uint32_t sd_crc_errors;
+
+// CMD59 CRC mode, data blocks carry a checked CRC16
+static uint8_t crcOn;
+
+// card powered off by sd_sleep, powered up and initialized again by sd_wake
+static bool asleep;
+static uint32_t sleepStart;
+
+// cycles the card has been powered off by sd_sleep, and the count of sd_wake power ups
+uint64_t sd_sleepCycles;
+uint32_t sd_wakes;
+
 uint8_t response[5];
 
+// Byte position in the block of an open read stream, SD_BLOCKSIZE between blocks
+static uint32_t streamPos;
+static bool streamOpen;
+
+// SPI clock divider in use
+static uint8_t spiDiv;
+
 static void setupSpiMaster(uint8_t clkdiv) {
   SPI_CFG_T spiCfg;
   SPI_DELAY_CONFIG_T spiDelayCfg;
@@ -59,12 +83,12 @@ static uint8_t CRCAdd(uint8_t crc, uint8_t message_byte) {
   return CRCTable[(crc << 1) ^ message_byte];
 }
 
-static uint8_t getCRC(uint8_t* message) {
+static uint8_t getCRC(uint8_t* message, uint32_t len) {
   
   uint32_t i;
   uint8_t crc=0;
 
-  for (i=0; i<5; i++)
+  for (i=0; i<len; i++)
     crc = CRCAdd(crc, message[i]);
 
   return crc;
@@ -96,6 +120,61 @@ static uint8_t SPI_ReadByte(void) {
   return LPC_SPI0->RXDAT;
 }
 
+// Read a data block after its start token, returns 1 if CRC mode is on and the CRC16 does not match
+// The CRC engine is fed in the read loop, one store per byte between transfers, with no second pass
+// over the data, bench_crc (bench.c) logs the read throughput with CRC mode off and on
+static uint8_t SPI_ReadBlock(uint8_t *data) {
+  uint32_t i;
+  uint8_t tmp;
+  uint16_t crc;
+
+  if(!crcOn) {
+    for(i=0; i<SD_BLOCKSIZE; i++) {
+      *data++ = SPI_ReadByte();
+    }
+    //crc
+    SPI_WriteDummyByte();
+    SPI_WriteDummyByte();
+    return 0;
+  }
+
+  Chip_CRC_SetSeed(0);
+  for(i=0; i<SD_BLOCKSIZE; i++) {
+    tmp = SPI_ReadByte();
+    Chip_CRC_Write8(tmp);
+    *data++ = tmp;
+  }
+  crc = SPI_ReadByte()<<8;
+  crc |= SPI_ReadByte();
+
+  return crc != (uint16_t)Chip_CRC_Sum();
+}
+
+// Write a data block after its start token, followed by its CRC16 in CRC mode or dummy bytes otherwise
+static void SPI_WriteBlock(const uint8_t *data) {
+  uint32_t i;
+  uint16_t crc;
+
+  if(!crcOn) {
+    for(i=0; i<SD_BLOCKSIZE; i++) {
+      SPI_WriteByte(*data++);
+    }
+    //crc
+    SPI_WriteDummyByte();
+    SPI_WriteDummyByte();
+    return;
+  }
+
+  Chip_CRC_SetSeed(0);
+  for(i=0; i<SD_BLOCKSIZE; i++) {
+    Chip_CRC_Write8(*data);
+    SPI_WriteByte(*data++);
+  }
+  crc = Chip_CRC_Sum();
+  SPI_WriteByte(crc>>8);
+  SPI_WriteByte(crc);
+}
+
 static SD_ERROR sd_send_command(uint16_t cmd,uint32_t data) {
 
   uint8_t send[6];
@@ -108,7 +187,7 @@ static SD_ERROR sd_send_command(uint16_t cmd,uint32_t data) {
   send[2] = data>>16; 
   send[3] = data>>8; 
   send[4] = data; 
-  send[5] = (getCRC(send)<<1)|0x01; 
+  send[5] = (getCRC(send,5)<<1)|0x01; 
   
   for(i=0;i<6;i++) {
     SPI_WriteByte(send[i]);
@@ -151,14 +230,158 @@ static SD_ERROR sd_send_command(uint16_t cmd,uint32_t data) {
   return SD_OK;
 }
 
+// Set the SPI clock divider, the clock is SystemCoreClock/(clkdiv+1)
+static void sd_set_clock(SD_CardInfo *cardinfo, uint8_t clkdiv) {
+  spiDiv = clkdiv;
+  setupSpiMaster(clkdiv);
+  cardinfo->SpiClock = SystemCoreClock/(clkdiv+1);
+}
+
+// Divider for the fastest SPI clock not above hz
+static uint8_t sd_clkdiv(uint32_t hz) {
+  uint32_t div = (SystemCoreClock+hz-1)/hz;
+  
+  return div > 256 ? 255 : div-1;
+}
+
+// Decode the CSD TRAN_SPEED in Hz, a rate unit of 100k/1M/10M/100M times a value of 1.0-8.0
+static uint32_t sd_tran_speed(uint8_t tran_speed) {
+  static const uint8_t value[16] = {0,10,12,13,15,20,25,30,35,40,45,50,55,60,70,80};
+  static const uint32_t unit[4] = {10000,100000,1000000,10000000};
+  
+  if((tran_speed&0x07) > 3 || value[(tran_speed>>3)&0x0F] == 0) {
+    return SD_DEFAULT_HZ;
+  }
+  return unit[tran_speed&0x07]*value[(tran_speed>>3)&0x0F];
+}
+
+#ifdef SD_HIGH_SPEED
+// SWITCH_FUNC, mode 0 checks and mode 1 switches, reads the 512 bit switch status
+static SD_ERROR sd_switch_func(uint32_t arg, uint8_t *status) {
+  uint32_t i;
+  uint8_t tmp;
+  uint32_t time1,time2;
+
+  if(sd_send_command(CMD6,arg)!=SD_OK) {
+    return ERROR_SWITCH_FUNC_TIMEOUT;
+  }
+
+  // SD 1.0 cards do not have CMD6
+  if(response[0]) {
+    return ERROR_SWITCH_FUNC_RESPONSE;
+  }
+
+  // Wait for the token
+  time1=DWT_Get();
+  do
+  {
+    tmp = SPI_ReadByte();
+    time2=DWT_Get();
+  }
+  while ((tmp == 0xFF) && (time2-time1 < SD_CMD_TIMEOUT));
+
+  if (time2-time1 >= SD_CMD_TIMEOUT) {
+    return ERROR_SWITCH_FUNC_TIMEOUT;
+  }
+
+  if (tmp != SD_TOK_READ_STARTBLOCK) {
+    SPI_WriteDummyByte();
+    return ERROR_SWITCH_FUNC_RESPONSE;
+  }
+
+  for(i=0;i<64;i++) {
+    status[i]=SPI_ReadByte();
+  }
+
+  // crc
+  SPI_WriteDummyByte();
+  SPI_WriteDummyByte();
+
+  SPI_WriteDummyByte();
+
+  return SD_OK;
+}
+
+// Switch function group 1 (access mode) to high speed
+static SD_ERROR sd_switch_high_speed(void) {
+  uint8_t status[64];
+  SD_ERROR tmp;
+
+  // Check, bit 401 set if the card supports high speed
+  tmp=sd_switch_func(0x00FFFFF1,status);
+  if(tmp!=SD_OK) {
+    return tmp;
+  }
+  if((status[13]&0x02)==0) {
+    return ERROR_SWITCH_FUNC_RESPONSE;
+  }
+
+  // Switch, bits 379:376 hold the function selected in group 1
+  tmp=sd_switch_func(0x80FFFFF1,status);
+  if(tmp!=SD_OK) {
+    return tmp;
+  }
+  if((status[16]&0x0F)!=0x01) {
+    return ERROR_SWITCH_FUNC_RESPONSE;
+  }
+
+  // The card runs in high speed mode 8 clocks after the status
+  SPI_WriteDummyByte();
+
+  return SD_OK;
+}
+#endif
+
+// Turn CMD59 CRC mode on or off, off after every card reset
+uint8_t sd_set_crc(uint8_t on) {
+  if(sd_send_command(CMD59,on?1:0)!=SD_OK || response[0]) {
+    return 1;
+  }
+  crcOn = on;
+  return 0;
+}
+
+// Step the SPI clock down one rung of the fallback ladder after a transfer error, before a retry
+// Returns 1 at the lowest rung
+uint8_t sd_speed_down(void) {
+  if(SystemCoreClock/(spiDiv+2) < SD_SPI_MIN_HZ) {
+    return 1;
+  }
+  sd_set_clock(&cardinfo,spiDiv+1);
+  return 0;
+}
+
+// Read and decode the CSD at the current clock, stepping down the ladder while it fails
+static SD_ERROR sd_read_csd_ladder(SD_CardInfo *cardinfo) {
+  SD_ERROR tmp;
+
+  while((tmp=sd_read_csd(&cardinfo->SD_csd,cardinfo->CardType))!=SD_OK) {
+    if(SystemCoreClock/(spiDiv+2) < SD_SPI_MIN_HZ) {
+      return tmp;
+    }
+    sd_set_clock(cardinfo,spiDiv+1);
+  }
+  return SD_OK;
+}
+
 SD_ERROR init_sd_spi(SD_CardInfo *cardinfo) {
   uint32_t i,time1,time2;
   SD_ERROR tmp;
+  uint8_t div;
   
+  // The card is reset, any open read stream is lost
+  streamOpen = false;
+  crcOn = 0;
+
   GenerateCRCTable();
+
+  // CRC engine in CRC-CCITT mode for the data CRC16, x^16 + x^12 + x^5 + 1 seeded with 0
+  Chip_CRC_Init();
+  Chip_CRC_SetPoly(CRC_POLY_CCITT, 0);
   
   // Initialization at slow speed
-  setupSpiMaster(SystemCoreClock/400000-1);// 400Khz
+  cardinfo->HighSpeed = 0;
+  sd_set_clock(cardinfo,sd_clkdiv(SD_INIT_HZ));
 
   for(i=0;i<10;i++) {
     SPI_WriteDummyByteCSHigh();
@@ -288,8 +511,8 @@ SD_ERROR init_sd_spi(SD_CardInfo *cardinfo) {
     }    
   }  
   
-  // After initialization go full speed  
-  setupSpiMaster(SystemCoreClock/24000000-1);//24Mhz
+  // After initialization go to the default speed every card supports
+  sd_set_clock(cardinfo,sd_clkdiv(SD_DEFAULT_HZ));
   
   // Read and decode CID register
   tmp=sd_read_cid(&cardinfo->SD_cid,cardinfo->CardType);
@@ -298,10 +521,42 @@ SD_ERROR init_sd_spi(SD_CardInfo *cardinfo) {
   }
   
   // Read and decode CSD register
-  tmp=sd_read_csd(&cardinfo->SD_csd,cardinfo->CardType);
+  tmp=sd_read_csd_ladder(cardinfo);
   if(tmp!=SD_OK) {
     return tmp;
   }
+
+#ifdef SD_HIGH_SPEED
+  // Cards with the switch command class 10 may support high speed, the CSD read again after the switch shows the new TRAN_SPEED
+  if(cardinfo->CardType!=MULTIMEDIA_CARD && (cardinfo->SD_csd.CardComdClasses&(1<<10))) {
+    cardinfo->HighSpeed = sd_switch_high_speed()==SD_OK;
+    if(cardinfo->HighSpeed) {
+      tmp=sd_read_csd_ladder(cardinfo);
+      if(tmp!=SD_OK) {
+        return tmp;
+      }
+    }
+  }
+#endif
+
+  // Go to the fastest clock the card and LPC_SPI0 support, no faster than a rung the CSD already failed at
+  // Read the CSD again at that clock, step down the ladder while its CRC fails
+  div=sd_clkdiv(sd_tran_speed(cardinfo->SD_csd.MaxBusClkFrec) < SD_SPI_MAX_HZ ?
+                sd_tran_speed(cardinfo->SD_csd.MaxBusClkFrec) : SD_SPI_MAX_HZ);
+  if(spiDiv > sd_clkdiv(SD_DEFAULT_HZ) && spiDiv > div) {
+    div=spiDiv;
+  }
+  sd_set_clock(cardinfo,div);
+  tmp=sd_read_csd_ladder(cardinfo);
+  if(tmp!=SD_OK) {
+    return tmp;
+  }
+
+#ifdef SD_DATA_CRC
+  if(sd_set_crc(1)) {
+    return ERROR_CRC_ON_OFF_TIMEOUT;
+  }
+#endif
   
   // Calculate card capacity
   if ((cardinfo->CardType == SD_CARD_STD_CAPACITY_V1_1) || 
@@ -321,10 +576,8 @@ SD_ERROR init_sd_spi(SD_CardInfo *cardinfo) {
   return SD_OK;
 }
 
-// Hard reset power and re-initialize
-SD_ERROR sd_reset(SD_CardInfo *cardinfo){
-	// Hard reset
-
+// Power off the card and release its IO
+static void sd_power_off(void){
 	// Power off card
 	Chip_GPIO_SetPinDIROutput(LPC_GPIO, 0, SD_POWER);
 	Chip_GPIO_SetPinState(LPC_GPIO, 0, SD_POWER, 1);
@@ -333,20 +586,50 @@ SD_ERROR sd_reset(SD_CardInfo *cardinfo){
 	Chip_SPI_Disable(LPC_SPI0);
 	Chip_SWM_MovablePortPinAssign(SWM_SPI0_SSELSN_0_IO, 0, 0xFF);
 	Chip_SWM_MovablePortPinAssign(SWM_SPI0_MOSI_IO, 0, 0xFF);
+}
+
+// Hard reset power and re-initialize
+SD_ERROR sd_reset(SD_CardInfo *cardinfo){
+	// Hard reset
+	sd_power_off();
+	asleep = false;
 
-	DWT_Delay(100000); // 100ms delay
+	DWT_Delay(SD_POWER_OFF_US);
 
 	// Re-enable IO
 	Chip_SWM_MovablePortPinAssign(SWM_SPI0_SSELSN_0_IO, 0, SD_SPI_CS);
 	Chip_SWM_MovablePortPinAssign(SWM_SPI0_MOSI_IO, 0, SD_SPI_MOSI);
 
 	Chip_GPIO_SetPinState(LPC_GPIO, 0, SD_POWER, 0);
+	DWT_Delay(SD_POWER_UP_US);
+
 	// Initialize SD card
 	return init_sd_spi(cardinfo);
 }
 
+// Power the card off between writes, its writes have completed when the write functions return
+// SPI mode has no sleep command, and an idle card still draws its standby current
+void sd_sleep(void){
+	if(asleep) {
+		return;
+	}
+	sd_power_off();
+	asleep = true;
+	sleepStart = DWT_Get();
+}
+
+// Power the card up and initialize it again if sd_sleep powered it off, before any access
+SD_ERROR sd_wake(void){
+	if(!asleep) {
+		return SD_OK;
+	}
+	sd_sleepCycles += DWT_Get() - sleepStart;
+	sd_wakes++;
+	return sd_reset(&cardinfo);
+}
+
 uint8_t sd_read_block (uint32_t blockaddr,uint8_t *data) {
-  uint32_t i;
+  uint32_t retries=0;
   uint8_t tmp;
   uint32_t time1,time2;
 
@@ -355,6 +638,7 @@ uint8_t sd_read_block (uint32_t blockaddr,uint8_t *data) {
     blockaddr<<=SD_BLOCKSIZE_NBITS;
   }
 
+retry:
   if(sd_send_command(CMD17, blockaddr)!=SD_OK) {
     return 1;
   }
@@ -385,31 +669,31 @@ uint8_t sd_read_block (uint32_t blockaddr,uint8_t *data) {
     return 1;
   }
   
-  for(i=0; i<SD_BLOCKSIZE; i++) {
-    *data++ = SPI_ReadByte();
-  }
-
-  //crc
-  SPI_WriteDummyByte(); 
-  SPI_WriteDummyByte(); 
+  tmp = SPI_ReadBlock(data);
   
   SPI_WriteDummyByte();
  
+  // Read the block again on a CRC mismatch
+  if(tmp) {
+    sd_crc_errors++;
+    if(retries++ < SD_CRC_RETRIES) {
+      goto retry;
+    }
+    return SD_DATA_CRC_ERROR;
+  }
+
   return 0;
 }
 
 uint8_t sd_read_multiple_blocks (uint32_t blockaddr, uint32_t blockcount, uint8_t *data) {
-  uint32_t i,bn;
+  uint32_t bn=0,retries=0;
   uint8_t tmp;
   uint32_t time1,time2;
 
-  // Convert to block address
-  if(cardinfo.CardType!=SD_CARD_HIGH_CAPACITY) {
-    blockaddr<<=SD_BLOCKSIZE_NBITS;
-  }
-
-  // Send read multiple blocks command
-  if(sd_send_command(CMD18, blockaddr)!=SD_OK) {
+retry:
+  // Send read multiple blocks command, from the first block not yet read
+  if(sd_send_command(CMD18, cardinfo.CardType!=SD_CARD_HIGH_CAPACITY ?
+                     (blockaddr+bn)<<SD_BLOCKSIZE_NBITS : blockaddr+bn)!=SD_OK) {
     return 1;
   }
 
@@ -418,7 +702,7 @@ uint8_t sd_read_multiple_blocks (uint32_t blockaddr, uint32_t blockcount, uint8_
     return 1;
   }
 
-  for(bn=0; bn<blockcount; bn++) {
+  for(; bn<blockcount; bn++) {
 
 	  // Wait for the token
 	  time1=DWT_Get();
@@ -440,15 +724,115 @@ uint8_t sd_read_multiple_blocks (uint32_t blockaddr, uint32_t blockcount, uint8_
 		return 1;
 	  }
 
-	  for(i=0; i<SD_BLOCKSIZE; i++) {
-		*data++ = SPI_ReadByte();
+	  // Stop and read again from this block on a CRC mismatch
+	  if(SPI_ReadBlock(data)) {
+		sd_crc_errors++;
+		sd_send_command(CMD12, 0);
+		SPI_WriteDummyByte();
+		if(retries++ < SD_CRC_RETRIES) {
+		  goto retry;
+		}
+		return SD_DATA_CRC_ERROR;
 	  }
+	  data += SD_BLOCKSIZE;
+  }
 
-	  //crc
-	  SPI_WriteDummyByte();
-	  SPI_WriteDummyByte();
+  // Send stop transmission command
+  if(sd_send_command(CMD12, 0)!=SD_OK) {
+    return 1;
   }
 
+  SPI_WriteDummyByte();
+
+  return 0;
+}
+
+// Open a read stream at blockaddr with CMD18, blocks are read on demand with sd_stream_read
+// The card waits with the clock stopped between reads, so a stream can be paused at any byte
+uint8_t sd_stream_start(uint32_t blockaddr) {
+
+  if(streamOpen) {
+    sd_stream_stop();
+  }
+
+  // Convert to block address
+  if(cardinfo.CardType!=SD_CARD_HIGH_CAPACITY) {
+    blockaddr<<=SD_BLOCKSIZE_NBITS;
+  }
+
+  // Send read multiple blocks command
+  if(sd_send_command(CMD18, blockaddr)!=SD_OK || response[0]) {
+    return 1;
+  }
+
+  streamPos = SD_BLOCKSIZE;
+  streamOpen = true;
+  return 0;
+}
+
+// Read the next count bytes of an open stream, across block boundaries
+uint8_t sd_stream_read(uint8_t *data, uint32_t count) {
+  uint8_t tmp;
+  uint16_t crc;
+  uint32_t time1,time2;
+
+  if(!streamOpen) {
+    return 1;
+  }
+
+  while(count--) {
+    if(streamPos == SD_BLOCKSIZE) {
+      // Wait for the token of the next block
+      time1=DWT_Get();
+      do{
+        tmp = SPI_ReadByte();
+        time2=DWT_Get();
+      }
+      while ((tmp == 0xFF) && (time2-time1 < SD_CMD_TIMEOUT));
+
+      if (tmp != SD_TOK_READ_STARTBLOCK) {
+        sd_stream_stop();
+        return 1;
+      }
+      streamPos = 0;
+      Chip_CRC_SetSeed(0);
+    }
+
+    tmp = SPI_ReadByte();
+    *data++ = tmp;
+    if(crcOn) {
+      Chip_CRC_Write8(tmp);
+    }
+
+    if(++streamPos == SD_BLOCKSIZE) {
+      //crc
+      if(crcOn) {
+        crc = SPI_ReadByte()<<8;
+        crc |= SPI_ReadByte();
+        // The caller reads the block again from a new stream
+        if(crc != (uint16_t)Chip_CRC_Sum()) {
+          sd_crc_errors++;
+          sd_stream_stop();
+          return SD_DATA_CRC_ERROR;
+        }
+      } else {
+        SPI_WriteDummyByte();
+        SPI_WriteDummyByte();
+      }
+    }
+  }
+
+  return 0;
+}
+
+// Close an open read stream with CMD12, the card must not be accessed otherwise while a stream is open
+uint8_t sd_stream_stop(void) {
+
+  if(!streamOpen) {
+    return 0;
+  }
+  streamOpen = false;
+
   // Send stop transmission command
   if(sd_send_command(CMD12, 0)!=SD_OK) {
     return 1;
@@ -460,7 +844,7 @@ uint8_t sd_read_multiple_blocks (uint32_t blockaddr, uint32_t blockcount, uint8_
 }
 
 uint8_t sd_write_block (uint32_t blockaddr, const uint8_t *data) {
-  uint32_t i;
+  uint32_t retries=0;
   uint8_t tmp;
 
   // convert to block address
@@ -468,6 +852,7 @@ uint8_t sd_write_block (uint32_t blockaddr, const uint8_t *data) {
     blockaddr<<=SD_BLOCKSIZE_NBITS;
   }
   
+retry:
   if(sd_send_command(CMD24,blockaddr)!=SD_OK) {
     return 1;
   }    
@@ -480,23 +865,28 @@ uint8_t sd_write_block (uint32_t blockaddr, const uint8_t *data) {
   // indicate start of block
   SPI_WriteByte(SD_TOK_WRITE_STARTBLOCK);
   
-  for(i=0; i<SD_BLOCKSIZE; i++) {
-    SPI_WriteByte(data[i]);
-  }
-  
-  //crc
-  SPI_WriteDummyByte(); 
-  SPI_WriteDummyByte();
+  SPI_WriteBlock(data);
 
   // check the response token
   tmp=SPI_ReadByte();
+  if((tmp & 0x1F) == DATA_RESPONSE_TOKEN_CRC_ERROR) {
+    // The card dropped the block, send it again once it is ready
+    while(SPI_ReadByte()!=0xFF){};
+    sd_crc_errors++;
+    if(retries++ < SD_CRC_RETRIES) {
+      goto retry;
+    }
+    return SD_DATA_CRC_ERROR;
+  }
   if((tmp & 0x1F) != DATA_RESPONSE_TOKEN_DATA_ACCEPTED) {
     SPI_WriteDummyByte();
     return 1;
   }
 
-  // wait for write finish
+  // wait for write finish, timing the card busy period
+  uint32_t busy_start=DWT_Get();
   while(SPI_ReadByte()==0){};
+  sd_write_busy=DWT_Get()-busy_start;
   
   SPI_WriteDummyByte();
   
@@ -504,10 +894,27 @@ uint8_t sd_write_block (uint32_t blockaddr, const uint8_t *data) {
   
 }
 
-//TODO: Fix this function
-// 		Currently error in data response token after writing the first block
+// Wait for the card to read 0xFF (ready), returns 1 if it is still busy after SD_CMD_TIMEOUT
+// so a stuck card fails the write and disk_write_sectors retries it a rung down the clock ladder
+static uint8_t sd_wait_ready(void) {
+  uint8_t tmp;
+  uint32_t time1,time2;
+
+  time1=DWT_Get();
+  do
+  {
+    tmp = SPI_ReadByte();
+    time2=DWT_Get();
+  }
+  while ((tmp != 0xFF) && (time2-time1 < SD_CMD_TIMEOUT));
+
+  return tmp != 0xFF;
+}
+
+// The card must read 0xFF (ready) before each start token, stopping the busy wait on the first non-zero byte
+// sent the next token while the card was still releasing busy, failing the data response of the second block
 uint8_t sd_write_multiple_blocks (uint32_t blockaddr, uint32_t blockcount, const uint8_t *data) {
-  uint32_t i,bn;
+  uint32_t bn;
   uint8_t tmp;
 
   // convert to block address
@@ -542,13 +949,8 @@ uint8_t sd_write_multiple_blocks (uint32_t blockaddr, uint32_t blockcount, const
 	  // Indicate start of block
 	  SPI_WriteByte(SD_TOK_WRITE_STARTBLOCK);
 
-	  for(i=0; i<SD_BLOCKSIZE; i++) {
-		SPI_WriteByte(*data++);
-	  }
-
-	  //crc
-	  SPI_WriteDummyByte();
-	  SPI_WriteDummyByte();
+	  SPI_WriteBlock(data);
+	  data += SD_BLOCKSIZE;
 
 	  // check the response token
 	  tmp=SPI_ReadByte();
@@ -559,17 +961,37 @@ uint8_t sd_write_multiple_blocks (uint32_t blockaddr, uint32_t blockcount, const
 		  sprintf(buf, "\nERROR:, tmp = 0x%02X\n",tmp);
 		  putLineUART(buf);
 #endif
+		  // End the transmission so the card accepts commands again
+		  if(sd_wait_ready()) {
+			  return 1;
+		  }
+		  SPI_WriteByte(SD_STOPTRAN_WRITE);
+		  SPI_WriteDummyByte();
+		  if(sd_wait_ready()) {
+			  return 1;
+		  }
+		  // The caller writes the blocks again
+		  if((tmp & 0x1F) == DATA_RESPONSE_TOKEN_CRC_ERROR) {
+			  sd_crc_errors++;
+			  return SD_DATA_CRC_ERROR;
+		  }
 		  return 1;
 	  }
 
-	  // wait for write finish
-	  while(SPI_ReadByte()==0){};
+	  // wait for write finish, until the card is ready for the next token
+	  if(sd_wait_ready()) {
+		  return 1;
+	  }
   }
 
   // Send stop transmission token
   SPI_WriteByte(SD_STOPTRAN_WRITE);
 
+  // The card is busy programming after the stop token, wait so the next command is not read as busy
   SPI_WriteDummyByte();
+  if(sd_wait_ready()) {
+	return 1;
+  }
 
   return 0;
 }
@@ -746,5 +1168,10 @@ SD_ERROR sd_read_csd(SD_CSD *sd_csd,CARD_TYPE ct) {
   
   SPI_WriteDummyByte();
   
+  // The CSD carries its own CRC-7, a bad one means the bus is too fast
+  if(((getCRC(buf,15)<<1)|0x01)!=buf[15]) {
+    return ERROR_SEND_CSD_CRC;
+  }
+  
   return SD_OK;
 }
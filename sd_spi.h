@@ -35,7 +35,11 @@ typedef enum {
   ERROR_SEND_CSD_TIMEOUT,
   ERROR_SEND_CSD_TOKEN_TIMEOUT,
   ERROR_SEND_OP_COND_TIMEOUT,
-  ERROR_SEND_OP_COND_RESPONSE
+  ERROR_SEND_OP_COND_RESPONSE,
+  ERROR_SEND_CSD_CRC,
+  ERROR_SWITCH_FUNC_TIMEOUT,
+  ERROR_SWITCH_FUNC_RESPONSE,
+  ERROR_CRC_ON_OFF_TIMEOUT
 } SD_ERROR;
 
 typedef enum {
@@ -50,6 +54,7 @@ typedef enum {
 #define R1_ILLEGAL_COMMAND 0x04
 
 #define DATA_RESPONSE_TOKEN_DATA_ACCEPTED 0x05
+#define DATA_RESPONSE_TOKEN_CRC_ERROR 0x0B
 
 #define SD_TOK_READ_STARTBLOCK  0xFE
 #define SD_TOK_WRITE_STARTBLOCK 0xFE
@@ -61,6 +66,28 @@ typedef enum {
 // timeout 0.5 sec
 #define SD_CMD_TIMEOUT (SystemCoreClock/2)
 
+// SPI clock, identification mode runs at 100-400 kHz, then every card supports 25 MHz
+#define SD_INIT_HZ     400000
+#define SD_DEFAULT_HZ  25000000
+// Fastest LPC_SPI0 master clock, SystemCoreClock/2
+#define SD_SPI_MAX_HZ  36000000
+// Lowest rung of the fallback ladder, stepped down one divider at a time on errors
+#define SD_SPI_MIN_HZ  4000000
+
+// Switch SD cards to high speed mode with CMD6, TRAN_SPEED goes from 25 to 50 MHz
+#define SD_HIGH_SPEED
+
+// Protect data blocks with CRC16 in CMD59 CRC mode, the CRC engine computes it alongside the SPI transfer
+#define SD_DATA_CRC
+// Transfers of a block again after a CRC mismatch
+#define SD_CRC_RETRIES 2
+// Returned by the block functions when the data CRC still fails after the retries
+#define SD_DATA_CRC_ERROR 2
+
+// Power cycle in sd_reset, supply below 0.5V for at least 1ms then a ramp up before the first clocks
+#define SD_POWER_OFF_US 20000
+#define SD_POWER_UP_US  1000
+
 // Responses
 #define R1  0x0100
 #define R1b 0x1100
@@ -197,12 +224,26 @@ typedef struct
   uint64_t CardCapacity;  /*!< Card Capacity */
   uint32_t CardBlockSize; /*!< Card Block Size */
   CARD_TYPE CardType;
+  uint32_t SpiClock;      /*!< SPI clock in Hz */
+  uint8_t HighSpeed;      /*!< Switched to high speed mode */
 } SD_CardInfo;
 
+extern uint32_t sd_write_busy;
+extern uint32_t sd_crc_errors;
+extern uint64_t sd_sleepCycles;
+extern uint32_t sd_wakes;
+
 SD_ERROR init_sd_spi(SD_CardInfo *cardinfo);
 SD_ERROR sd_reset(SD_CardInfo *cardinfo);
+void sd_sleep(void);
+SD_ERROR sd_wake(void);
+uint8_t sd_speed_down(void);
+uint8_t sd_set_crc(uint8_t on);
 uint8_t sd_read_block(uint32_t blockaddr,uint8_t *data);
 uint8_t sd_read_multiple_blocks(uint32_t blockaddr, uint32_t blockcount, uint8_t *data);
+uint8_t sd_stream_start(uint32_t blockaddr);
+uint8_t sd_stream_read(uint8_t *data, uint32_t count);
+uint8_t sd_stream_stop(void);
 uint8_t sd_write_block(uint32_t blockaddr, const uint8_t *data);
 uint8_t sd_write_multiple_blocks(uint32_t blockaddr, uint32_t blockcount, const uint8_t *data);
 SD_ERROR sd_read_cid(SD_CID *sd_cid,CARD_TYPE ct);
@@ -1,4 +1,6 @@
 #include "sys_error.h"
+#include "trace.h"
+#include "sched.h"
 
 static volatile bool inError; // Set when handling an error to prevent recursion
 static volatile ERROR_CODE globalError;
@@ -26,6 +28,13 @@ void error(ERROR_CODE errorCode){
 
 	// Set error code
 	globalError = errorCode;
+
+	// Keep the events leading up to the error
+	trace_event(TRACE_ERROR, errorCode);
+	trace_freeze();
+
+	// Handle the error as soon as the running task returns
+	sched_post(TASK_CONTROL);
 }
 
 void error_handler(void){
@@ -46,6 +55,9 @@ void error_handler(void){
 		// Write error code to log file
 		log_string(errorString[globalError]);
 
+		// Write the event trace for the timeline of the error
+		trace_dump("trace.bin");
+
 		// Delay 5 seconds
 		DWT_Delay(5000000);
 
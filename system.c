@@ -3,6 +3,13 @@
 SYSTEM_STATE system_state;
 SD_STATE sd_state;
 MSC_STATE msc_state;
+volatile uint32_t tickRate; // SysTick rate in ticks per second
+
+// Battery monitor, filled by the ADC0 interrupts
+static uint32_t vbatSum; // Sum of the conversions of the decimated reading in progress
+static uint32_t vbatCount; // Conversions in vbatSum
+static volatile uint32_t vbatAvg; // Running average of the decimated readings, in units of VBAT_DECIMATION LSB, 0 until the first reading
+static bool vbatFast; // Set when a conversion crossed the armed threshold, the next decimated reading replaces the average
 
 // Halt and power off
 void shutdown(void){
@@ -51,8 +58,16 @@ void system_power_off(void){
 	}
 }
 
-// Prepare ADC for reading battery voltage
-void read_vBat_setup(void){
+// Set the SysTick rate in ticks per second
+void system_setTickRate(uint32_t hz){
+	Chip_Clock_SetSysTickClockDiv(1);
+	tickRate = hz;
+	SysTick_Config(Chip_Clock_GetSysTickClockRate() / hz);
+}
+
+// Set up ADC0 to convert the battery voltage in the background, started each tick by vbat_start
+// The end of sequence interrupt averages the conversions, the threshold compare interrupt reacts to a crossing of the armed level
+void vbat_init(void){
 	// Connect pin in switch matrix adn set IOCON
 	Chip_IOCON_PinMuxSet(LPC_IOCON, 0, VBAT_D, IOCON_ADMODE_EN);
 	Chip_SWM_EnableFixedPin(SWM_FIXED_ADC0_3);
@@ -64,24 +79,82 @@ void read_vBat_setup(void){
 	while(!Chip_ADC_IsCalibrationDone(LPC_ADC0));
 	Chip_ADC_SetTrim(LPC_ADC0, ADC_TRIM_VRANGE_HIGHV); // Select appropriate voltage range
 
-	// Select ADC channel and Set TRIGPOL to 1 and SEQA_ENA to 1
+	// Select ADC channel and Set TRIGPOL to 1 and SEQA_ENA to 1, interrupt at the end of each sequence
 	Chip_ADC_SetupSequencer(LPC_ADC0, ADC_SEQA_IDX,
-			ADC_SEQ_CTRL_CHANSEL(3) | ADC_SEQ_CTRL_HWTRIG_POLPOS |
-			ADC_SEQ_CTRL_SEQ_ENA);
+			ADC_SEQ_CTRL_CHANSEL(VBAT_A) | ADC_SEQ_CTRL_HWTRIG_POLPOS |
+			ADC_SEQ_CTRL_MODE_EOS | ADC_SEQ_CTRL_SEQ_ENA);
+
+	// Compare the battery channel to threshold pair 0, armed at the low battery level
+	Chip_ADC_SelectTH0Channels(LPC_ADC0, 1 << VBAT_A);
+	Chip_ADC_SetThrLowValue(LPC_ADC0, 0, VBAT_RAW(VBAT_LOW_MV));
+	Chip_ADC_SetThrHighValue(LPC_ADC0, 0, 0xFFF);
+
+	vbatSum = 0;
+	vbatCount = 0;
+	vbatAvg = 0;
+	vbatFast = false;
+	Chip_ADC_ClearFlags(LPC_ADC0, Chip_ADC_GetFlags(LPC_ADC0));
+	Chip_ADC_EnableInt(LPC_ADC0, ADC_INTEN_SEQA_ENABLE | ADC_INTEN_CMP_ENABLE(ADC_INTEN_CMP_CROSSTH, VBAT_A));
+	NVIC_SetPriority(ADC0_SEQA_IRQn, 0x03); // Below the MRT, a conversion result waits until the next tick
+	NVIC_SetPriority(ADC0_THCMP_IRQn, 0x03);
+	NVIC_EnableIRQ(ADC0_SEQA_IRQn);
+	NVIC_EnableIRQ(ADC0_THCMP_IRQn);
+}
+
+// Start a background battery conversion, a single register write
+RAMFUNC void vbat_start(void){
+	Chip_ADC_StartSequencer(LPC_ADC0, ADC_SEQA_IDX);
+}
+
+// Running average battery voltage in mV, 0 until the first decimated reading
+uint32_t vbat_mV(void){
+	return vbatAvg * 3300 / (4096 * VBAT_DECIMATION);
 }
 
-// Returns the battery voltage reading in volts after averaging n samples
-float read_vBat(int32_t n){
-	uint32_t sum = 0;
-	int32_t i;
-	for(i=0;i<n;i++){
-		Chip_ADC_StartSequencer(LPC_ADC0, ADC_SEQA_IDX); // Set START bit to 1
-		while(!(Chip_ADC_GetDataReg(LPC_ADC0, 3)&ADC_DR_DATAVALID)); // Wait for conversion to complete
-		sum += ADC_DR_RESULT(Chip_ADC_GetDataReg(LPC_ADC0, 3)); // Read result from the DAT1 register
+// Battery conversion complete, sum VBAT_DECIMATION conversions into a decimated reading and average the readings
+void ADC0_SEQA_IRQHandler(void){
+	uint32_t dr = Chip_ADC_GetDataReg(LPC_ADC0, VBAT_A);
+	int32_t avg = vbatAvg;
+
+	Chip_ADC_ClearFlags(LPC_ADC0, ADC_FLAGS_SEQA_INT_MASK);
+	if(!(dr & ADC_DR_DATAVALID)){
+		return;
+	}
+	vbatSum += ADC_DR_RESULT(dr);
+	if(++vbatCount < VBAT_DECIMATION){
+		return;
 	}
 
-	// Convert raw value to volts
-	return (3.3*sum) / (4096 * n);
+	// The first reading, and the first after a threshold crossing, replace the average
+	if(avg == 0 || vbatFast){
+		avg = vbatSum;
+	}else{
+		avg += ((int32_t)vbatSum - avg) / VBAT_AVG_WEIGHT;
+	}
+	vbatAvg = avg;
+	vbatSum = 0;
+	vbatCount = 0;
+
+	// Arm the threshold compare at the next level below the average
+	Chip_ADC_SetThrLowValue(LPC_ADC0, 0,
+			avg < VBAT_RAW(VBAT_LOW_MV) * VBAT_DECIMATION ? VBAT_RAW(VBAT_SHUTDOWN_MV) : VBAT_RAW(VBAT_LOW_MV));
+
+	// A crossing is confirmed or dismissed by the whole reading, check it at once
+	if(vbatFast){
+		vbatFast = false;
+		sched_post(TASK_HOUSEKEEPING);
+	}
+}
+
+// A battery conversion crossed the armed level downward, replace the average with the next decimated reading
+// A single conversion is too noisy to act on, the SD card draws current in bursts
+void ADC0_THCMP_IRQHandler(void){
+	uint32_t dr = Chip_ADC_GetDataReg(LPC_ADC0, VBAT_A);
+
+	Chip_ADC_ClearFlags(LPC_ADC0, ADC_FLAGS_THCMP_MASK(VBAT_A) | ADC_FLAGS_THCMP_INT_MASK);
+	if(ADC_DR_THCMPCROSS(dr) == VBAT_CROSS_DOWN){
+		vbatFast = true;
+	}
 }
 
 /* Interrupt handlers with multiple functions */
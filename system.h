@@ -10,6 +10,16 @@
 
 #define VERSION "1.0"
 
+#define TICKRATE_HZ1 (100)	// 100 ticks per second
+#define TICKRATE_HZ_LOWPOWER (10)	// Ticks per second while recording in low power mode, SysTick reaches down to 5Hz at 72MHz
+
+#define VBAT_LOW_MV 3250 // Low battery indicator voltage in mV
+#define VBAT_SHUTDOWN_MV 3000 // Low battery shut down voltage in mV
+#define VBAT_DECIMATION 16 // Battery conversions, one per tick, summed into each decimated reading
+#define VBAT_AVG_WEIGHT 8 // Running average of the decimated readings, each new reading counts 1/VBAT_AVG_WEIGHT
+#define VBAT_RAW(mv) ((mv) * 4096 / 3300) // 12-bit ADC reading of a battery voltage in mV
+#define VBAT_CROSS_DOWN 2 // ADC_DR_THCMPCROSS of a conversion that crossed the low threshold downward
+
 typedef enum {
 	STATE_IDLE,
 	STATE_MSC,
@@ -29,6 +39,7 @@ typedef enum {
 extern SYSTEM_STATE system_state;
 extern SD_STATE sd_state;
 extern MSC_STATE msc_state;
+extern volatile uint32_t tickRate;
 
 // Halt and power off
 void shutdown(void);
@@ -42,10 +53,16 @@ void system_halt(void);
 // Turn off system power
 void system_power_off(void);
 
-// Prepare ADC for reading battery voltage
-void read_vBat_setup(void);
+// Set the SysTick rate in ticks per second
+void system_setTickRate(uint32_t hz);
+
+// Set up ADC0 to convert the battery voltage in the background, started each tick by vbat_start
+void vbat_init(void);
+
+// Start a background battery conversion
+void vbat_start(void);
 
-// Read battery voltage
-float read_vBat(int32_t n);
+// Running average battery voltage in mV, 0 until the first decimated reading
+uint32_t vbat_mV(void);
 
 #endif
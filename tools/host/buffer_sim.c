@@ -0,0 +1,224 @@
+/*
+ * buffer_sim.c
+ *
+ *  Runs the acquisition and writer code of daq.c on the host in virtual time,
+ *  against a RAM disk with a model of card write latency (host_card.c), and
+ *  reports for each sample rate, data mode and channel count whether and when
+ *  the raw buffer overflows and samples start being dropped as a gap.
+ *
+ *  The sampling interrupts run on their timers and take their cycle cost from
+ *  the writer, daq_readableFormat takes its cost per sample. The costs default
+ *  to measured means and are taken from the profile.txt of a recording with
+ *  --profile.
+ *
+ *  Usage:
+ *    ./buffer_sim --model gc:800,10,100,500
+ *    ./buffer_sim --model replay:trace.bin --mode BINARY --channels 3
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <setjmp.h>
+
+#include "daq.c"
+#include "host.h"
+
+static void (*formatSample)(uint16_t *rawData, char *sampleStr); // Format path selected by daq_init
+static uint32_t peakFill; // Highest raw buffer fill of the run in bytes
+static uint64_t startCycles; // Virtual time the recording started
+static uint64_t overflowCycles; // Virtual time of the first dropped sample, 0 if none
+static uint64_t endCycles; // Virtual time the run ends
+static jmp_buf runEnd; // Leaves a writer that cannot keep up, it never returns
+
+// Format path of the run, charged its cost in cycles per sample
+static void host_formatSample(uint16_t *rawData, char *sampleStr){
+	formatSample(rawData, sampleStr);
+	host_work(host_costs.format ? host_costs.format : host_costs.formatBase + host_costs.formatValue * daq.value_count);
+}
+
+// Track the fill and the first overflow after each step of the run
+static void host_watch(void){
+	uint32_t fill = RingBuffer_getSize(rawBuff);
+	if(fill > peakFill){
+		peakFill = fill;
+	}
+	if(droppedTotal && !overflowCycles){
+		overflowCycles = host_cycles;
+	}
+}
+
+// End the run at the first overflow or at its duration, from within the writer if need be
+static void host_runCheck(void){
+	host_watch();
+	if(overflowCycles || host_cycles >= endCycles){
+		longjmp(runEnd, 1);
+	}
+}
+
+// Record for duration seconds of virtual time, returns the raw buffer size
+static uint32_t host_run(uint32_t rate, DATA_T mode, uint8_t channels, bool vout, bool lowPower, uint8_t signal, double duration){
+	int i;
+
+	memset(&daq, 0, sizeof(daq));
+	for(i=0;i<MAX_CHAN;i++){
+		daq.channel[i].enable = i < channels;
+		daq.channel[i].units_per_volt = floatToDecFloat(1.0f);
+		intToFix(&daq.channel[i].v5_zero_offset, 32768);
+		intToFix(&daq.channel[i].v24_zero_offset, 32768);
+		daq.channel[i].v5_uV_per_LSB.frac = 0x3F6F7C3F;
+		daq.channel[i].v5_uV_per_LSB._int = 152;
+		daq.channel[i].v24_uV_per_LSB.frac = 0xD8E12DAC;
+		daq.channel[i].v24_uV_per_LSB._int = 732;
+		strcpy(daq.channel[i].unit_name, "Volts");
+	}
+	daq.sample_rate = rate;
+	daq.data_type = mode;
+	daq.vout_record = vout;
+	daq.low_power = lowPower;
+	daq.signal = signal;
+	daq.mv_out = 12000;
+	strcpy(daq.user_comment, "buffer_sim");
+
+	host_reset();
+	host_cardInit();
+	peakFill = 0;
+	overflowCycles = 0;
+
+	daq_init();
+	formatSample = daq_formatSample;
+	daq_formatSample = host_formatSample;
+
+	// Start at once, the writer runs when the buffer wakes it
+	while(daq_loop != daq_writeData && host_error < 0){
+		daq_loop();
+	}
+	startCycles = host_cycles;
+	endCycles = host_cycles + (uint64_t)(duration * SYS_CLOCK_RATE);
+	uint32_t size = RingBuffer_getFree(rawBuff) + RingBuffer_getSize(rawBuff);
+	if(setjmp(runEnd)){
+		// Stop sampling, the data file is left as it was and the card is formatted again for the next run
+		host_check = NULL;
+		Chip_RIT_DeInit(LPC_RITIMER);
+		Chip_MRT_SetDisabled(LPC_MRT_CH(1));
+		return size;
+	}
+	host_check = host_runCheck;
+	while(host_error < 0){
+		if(host_writerPosted){
+			host_writerPosted = false;
+			daq_loop();
+		}else{
+			host_idle();
+		}
+	}
+	host_check = NULL;
+	daq_stop();
+	return size;
+}
+
+static void usage(void){
+	fprintf(stderr,
+		"usage: buffer_sim [options]\n"
+		"  --model SPEC      card write latency, const:US tail:US,P,MAX_US gc:US,PERIOD_S,MIN_MS,MAX_MS replay:FILE\n"
+		"  --profile FILE    profile.txt with measured cycle counts\n"
+		"  --rates LIST      sample rates in Hz, default 1000,2000,5000,10000\n"
+		"  --mode MODE       READABLE or BINARY, repeatable, default both\n"
+		"  --channels N      enabled channels, repeatable, default 1-3\n"
+		"  --vout            record vout in readable mode\n"
+		"  --low-power       record in low power mode, rates up to %d Hz\n"
+		"  --signal NAME     RAMP, SINE or WORST, default WORST\n"
+		"  --duration S      virtual seconds per run, default 120\n"
+		"  --seed N          latency model seed, default 1\n"
+		"  --verbose         print the firmware log\n", LOWPOWER_MAX_SAMPLE_RATE);
+	exit(2);
+}
+
+int main(int argc, char **argv){
+	const char *model = "gc:800,10,100,500";
+	const char *rates = "1000,2000,5000,10000";
+	DATA_T modes[2];
+	int modeCount = 0;
+	uint8_t channels[MAX_CHAN];
+	int channelCount = 0;
+	bool vout = false, lowPower = false;
+	uint8_t signal = SIGNAL_WORST;
+	double duration = 120;
+	uint32_t seed = 1;
+	int i, m, c;
+
+	for(i=1;i<argc;i++){
+		const char *arg = argv[i];
+		const char *val = i + 1 < argc ? argv[i + 1] : NULL;
+		if(strcmp(arg, "--vout") == 0){
+			vout = true;
+		}else if(strcmp(arg, "--low-power") == 0){
+			lowPower = true;
+		}else if(strcmp(arg, "--verbose") == 0){
+			host_verbose = true;
+		}else if(!val){
+			usage();
+		}else{
+			i++;
+			if(strcmp(arg, "--model") == 0){
+				model = val;
+			}else if(strcmp(arg, "--profile") == 0){
+				if(!host_loadProfile(val)){
+					fprintf(stderr, "cannot read %s\n", val);
+					return 1;
+				}
+			}else if(strcmp(arg, "--rates") == 0){
+				rates = val;
+			}else if(strcmp(arg, "--mode") == 0 && modeCount < 2){
+				modes[modeCount++] = strcmp(val, "BINARY") == 0 ? BINARY : READABLE;
+			}else if(strcmp(arg, "--channels") == 0 && channelCount < MAX_CHAN){
+				channels[channelCount++] = clamp(atoi(val), 1, MAX_CHAN);
+			}else if(strcmp(arg, "--signal") == 0){
+				for(signal=SIGNAL_RAMP;signal<=SIGNAL_WORST && strcmp(val, signalType[signal]);signal++);
+				if(signal > SIGNAL_WORST){
+					usage();
+				}
+			}else if(strcmp(arg, "--duration") == 0){
+				duration = atof(val);
+			}else if(strcmp(arg, "--seed") == 0){
+				seed = atoi(val);
+			}else{
+				usage();
+			}
+		}
+	}
+	if(!modeCount){
+		modes[modeCount++] = READABLE;
+		modes[modeCount++] = BINARY;
+	}
+	if(!channelCount){
+		for(c=1;c<=MAX_CHAN;c++){
+			channels[channelCount++] = c;
+		}
+	}
+
+	printf("model %s, %s, %g s per run\n", model, signalType[signal], duration);
+	printf("%8s %9s %8s  %-24s %s\n", "rate", "mode", "channels", "result", "peak fill");
+	for(const char *r = rates; *r; r = strchr(r, ',') ? strchr(r, ',') + 1 : ""){
+		uint32_t rate = atoi(r);
+		for(m=0;m<modeCount;m++){
+			for(c=0;c<channelCount;c++){
+				char result[40];
+				if(!host_cardModel(model, seed)){
+					fprintf(stderr, "bad model %s\n", model);
+					return 1;
+				}
+				uint32_t size = host_run(rate, modes[m], channels[c], vout, lowPower, signal, duration);
+				if(host_error >= 0){
+					sprintf(result, "error %d", host_error);
+				}else if(overflowCycles){
+					sprintf(result, "overflow at %.2f s", (double)(overflowCycles - startCycles) / SYS_CLOCK_RATE);
+				}else{
+					strcpy(result, "ok");
+				}
+				printf("%8u %9s %8u  %-24s %u%%\n", (unsigned int)rate, dataType[modes[m]],
+						channels[c], result, (unsigned int)(100ull * peakFill / size));
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * daq_variants.c
+ *
+ *  Prints the collected values and the readable string of random samples for
+ *  every enabled channel mask, channel range and vout / ratiometric config, at
+ *  each sample time resolution. Built once with the specialized sample paths
+ *  and once with DAQ_GENERIC for the generic paths, make check compares the
+ *  two outputs, they must be identical.
+ */
+
+#include <stdio.h>
+
+#include "board.h"
+#ifdef DAQ_GENERIC
+#undef DAQ_SPECIALIZED
+#endif
+#include "daq.c"
+
+#define VARIANT_SAMPLES 50 // Random samples per config
+
+static const int32_t sampleRates[] = {1, 20, 500, 5000, 10000};
+
+static uint32_t randState = 1;
+
+static uint32_t variant_rand(void){
+	randState = randState * 1103515245 + 12345;
+	return randState >> 8;
+}
+
+// Calibration and sensor scaling that differ by channel and range
+static void variant_config(uint32_t mask, uint32_t ranges, uint32_t voutMode, int32_t rate){
+	int i;
+
+	memset(&daq, 0, sizeof(daq));
+	for(i=0;i<MAX_CHAN;i++){
+		daq.channel[i].enable = (mask >> i) & 1;
+		daq.channel[i].range = (ranges >> i) & 1 ? V24 : V5;
+		daq.channel[i].units_per_volt = floatToDecFloat(1.5f + i);
+		intToFix(&daq.channel[i].offset_uV, 100 * i - 50);
+		intToFix(&daq.channel[i].v5_zero_offset, 32768 + i);
+		intToFix(&daq.channel[i].v24_zero_offset, 32700 - i);
+		daq.channel[i].v5_uV_per_LSB.frac = 0x12345678;
+		daq.channel[i].v5_uV_per_LSB._int = 152;
+		daq.channel[i].v24_uV_per_LSB.frac = 0x87654321;
+		daq.channel[i].v24_uV_per_LSB._int = 732;
+	}
+	daq.vout_record = voutMode > 0;
+	daq.ratiometric = voutMode == 2;
+	daq.signal = SIGNAL_ADC;
+	daq.sample_rate = rate;
+	daq.mv_out = 12000;
+	daq.data_type = READABLE;
+	daq_configCheck();
+	daq_selectPaths();
+}
+
+int main(void){
+	uint32_t mask, ranges, voutMode, r, n;
+	int i;
+
+	for(mask=0;mask<(1 << MAX_CHAN);mask++){
+		for(ranges=0;ranges<(1 << MAX_CHAN);ranges++){
+			for(voutMode=0;voutMode<3;voutMode++){
+				for(r=0;r<sizeof(sampleRates)/sizeof(sampleRates[0]);r++){
+					variant_config(mask, ranges, voutMode, sampleRates[r]);
+					sampleStrfCount = 12345;
+					for(n=0;n<VARIANT_SAMPLES;n++){
+						uint16_t rawVal[MAX_VALUES] = {0};
+						char sampleStr[SAMPLE_STR_SIZE];
+
+						for(i=0;i<MAX_CHAN;i++){
+							rawValSum[i] = variant_rand() % (65536 * daq.subsamples);
+						}
+						rawVoutSum = variant_rand() % (65536 * daq.subsamples);
+						daq_collectSample(rawVal);
+						daq_formatSample(rawVal, sampleStr);
+						printf("%u%u%u %5d %04x %04x %04x %04x %s", (unsigned int)mask, (unsigned int)ranges,
+								(unsigned int)voutMode, (int)daq.sample_rate, rawVal[0], rawVal[1], rawVal[2], rawVal[3], sampleStr);
+					}
+				}
+			}
+		}
+	}
+	return 0;
+}
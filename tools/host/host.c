@@ -0,0 +1,294 @@
+/*
+ * host.c
+ *
+ *  Virtual time and the platform stand-ins of the host harness. The chip,
+ *  board, scheduler and system functions the acquisition and writer code calls
+ *  are replaced here, the firmware sources themselves are built unchanged.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "daq.h"
+#include "system.h"
+#include "host.h"
+
+// Firmware interrupt handlers, daq.c
+void RIT_IRQHandler(void);
+void MRT1_IRQHandler(void);
+
+Host_Costs host_costs = {
+	.rit = 484,
+	.mrt1 = 67,
+	.format = 0,
+	.formatBase = 550,
+	.formatValue = 1370,
+};
+uint64_t host_cycles;
+bool host_writerPosted;
+int host_error = -1;
+bool host_verbose;
+void (*host_check)(void);
+
+// Sampling timers
+static bool ritOn;
+static uint64_t ritPeriod;
+static uint64_t ritNext;
+static bool mrtOn;
+static uint64_t mrtPeriod;
+static uint64_t mrtNext;
+static uint32_t mrtChan[4];
+
+// Peripherals, SPI1 always ready with a mid-scale conversion for the vout sense
+static LPC_SPI_T spi1 = { .STAT = SPI_STAT_RXRDY | SPI_STAT_TXRDY, .RXDAT = 0x8000 };
+LPC_SPI_T *LPC_SPI0, *LPC_SPI1 = &spi1;
+LPC_GPIO_T *LPC_GPIO;
+LPC_RTC_T *LPC_RTC;
+LPC_RITIMER_T *LPC_RITIMER;
+LPC_SCT_T *LPC_SCT0;
+uint32_t SystemCoreClock = SYS_CLOCK_RATE;
+
+// Board, main.c and system.c
+RingBuffer *rawBuff;
+FATFS fatfs[_VOLUMES];
+uint8_t rsel_pins[3];
+SYSTEM_STATE system_state;
+SD_STATE sd_state;
+uint64_t sched_sleepCycles;
+
+// Memory arena, mem.c places it at fixed RAM addresses
+static uint32_t arena[MEM_ARENA_SIZE / 4];
+static MEM_PLAN memPlan;
+static uint32_t memUsed;
+
+/* Virtual time */
+
+void host_reset(void){
+	host_cycles = 0;
+	ritOn = mrtOn = false;
+	host_writerPosted = false;
+	host_error = -1;
+}
+
+// Time of the next sampling interrupt, UINT64_MAX if none is running
+static uint64_t host_nextIrq(void){
+	uint64_t next = UINT64_MAX;
+	if(ritOn){
+		next = ritNext;
+	}
+	if(mrtOn && mrtNext < next){
+		next = mrtNext;
+	}
+	return next;
+}
+
+// Run the interrupt due at host_nextIrq(), returns its cycle cost
+static uint32_t host_irq(void){
+	if(ritOn && (!mrtOn || ritNext <= mrtNext)){
+		ritNext += ritPeriod;
+		RIT_IRQHandler();
+		return host_costs.rit;
+	}
+	mrtNext += mrtPeriod;
+	MRT1_IRQHandler();
+	return host_costs.mrt1;
+}
+
+void host_work(uint64_t cc){
+	uint64_t end = host_cycles + cc;
+	uint64_t due;
+
+	while((due = host_nextIrq()) <= end){
+		if(due > host_cycles){
+			host_cycles = due;
+		}
+		uint32_t cost = host_irq();
+		host_cycles += cost;
+		end += cost;
+	}
+	host_cycles = end;
+	if(host_check){
+		host_check();
+	}
+}
+
+void host_idle(void){
+	uint64_t due = host_nextIrq();
+	if(due == UINT64_MAX){
+		return;
+	}
+	if(due > host_cycles){
+		sched_sleepCycles += due - host_cycles;
+		host_cycles = due;
+	}
+	host_work(0);
+}
+
+bool host_loadProfile(const char *fn){
+	char line[256];
+	char name[64];
+	unsigned int count, min, mean;
+	FILE *f = fopen(fn, "r");
+
+	if(!f){
+		return false;
+	}
+	while(fgets(line, sizeof(line), f)){
+		if(sscanf(line, "%63[^,], %u, %u, %u", name, &count, &min, &mean) != 4 || count == 0){
+			continue;
+		}
+		if(strcmp(name, "RIT_IRQHandler") == 0){
+			host_costs.rit = mean;
+		}else if(strcmp(name, "MRT1_IRQHandler") == 0){
+			host_costs.mrt1 = mean;
+		}else if(strcmp(name, "daq_readableFormat") == 0){
+			host_costs.format = mean;
+		}
+	}
+	fclose(f);
+	return true;
+}
+
+/* Delay and cycle counter, delay.c */
+
+uint32_t DWT_Get(void){
+	return (uint32_t)host_cycles;
+}
+
+void DWT_Delay(uint32_t us){
+	host_work((uint64_t)us * (SYS_CLOCK_RATE / 1000000));
+}
+
+/* Timers driving the sampling interrupts */
+
+void Chip_RIT_Init(LPC_RITIMER_T *rit){
+	ritOn = false;
+}
+
+void Chip_RIT_DeInit(LPC_RITIMER_T *rit){
+	ritOn = false;
+}
+
+void Chip_RIT_SetCompareValue(LPC_RITIMER_T *rit, uint64_t val){
+	ritPeriod = val + 1;
+}
+
+void Chip_RIT_Enable(LPC_RITIMER_T *rit){
+	ritOn = true;
+	ritNext = host_cycles + ritPeriod;
+}
+
+void Chip_RIT_EnableCompClear(LPC_RITIMER_T *rit){}
+void Chip_RIT_ClearIntStatus(LPC_RITIMER_T *rit){}
+
+LPC_MRT_CH_T *LPC_MRT_CH(int ch){
+	return &mrtChan[ch];
+}
+
+// A zero interval stops the channel, as the MRT does
+void Chip_MRT_SetInterval(LPC_MRT_CH_T *mrt, uint32_t interval){
+	if(mrt != LPC_MRT_CH(1)){
+		return;
+	}
+	mrtPeriod = interval & ~MRT_INTVAL_LOAD;
+	mrtOn = mrtPeriod != 0;
+	mrtNext = host_cycles + mrtPeriod;
+}
+
+void Chip_MRT_SetDisabled(LPC_MRT_CH_T *mrt){
+	if(mrt == LPC_MRT_CH(1)){
+		mrtOn = false;
+	}
+}
+
+void Chip_MRT_IntClear(LPC_MRT_CH_T *mrt){}
+void Chip_MRT_SetEnabled(LPC_MRT_CH_T *mrt){}
+void Chip_MRT_SetMode(LPC_MRT_CH_T *mrt, int mode){}
+
+// RTC seconds from a fixed start, 2015-03-02 20:02:43
+uint32_t Chip_RTC_GetCount(LPC_RTC_T *rtc){
+	return 1425326563 + (uint32_t)(host_cycles / SYS_CLOCK_RATE);
+}
+
+/* Other peripherals, no-ops */
+
+void Chip_GPIO_SetPinDIROutput(LPC_GPIO_T *gpio, uint8_t port, uint8_t pin){}
+void Chip_GPIO_SetPinState(LPC_GPIO_T *gpio, uint8_t port, uint8_t pin, bool state){}
+bool Chip_GPIO_GetPinState(LPC_GPIO_T *gpio, uint8_t port, uint8_t pin){ return false; }
+void Chip_SCTPWM_Init(LPC_SCT_T *sct){}
+void Chip_SCTPWM_SetRate(LPC_SCT_T *sct, uint32_t freq){}
+void Chip_SCTPWM_SetOutPin(LPC_SCT_T *sct, uint8_t index, uint8_t pin){}
+void Chip_SCTPWM_Start(LPC_SCT_T *sct){}
+void Chip_SCTPWM_SetDutyCycle(LPC_SCT_T *sct, uint8_t index, uint32_t ticks){}
+void Chip_SWM_MovablePinAssign(CHIP_SWM_PIN_MOVABLE_T movable, uint8_t pin){}
+void NVIC_EnableIRQ(int irq){}
+void NVIC_DisableIRQ(int irq){}
+void NVIC_SetPriority(int irq, uint32_t priority){}
+void Board_LED_Color(COLOR_T color){}
+void adc_spi_setup(void){}
+
+/* Memory arena, mem.c */
+
+void mem_plan(MEM_PLAN plan){
+	memPlan = plan;
+	memUsed = 0;
+}
+
+MEM_PLAN mem_currentPlan(void){
+	return memPlan;
+}
+
+void *mem_alloc(uint32_t size){
+	void *p;
+	size = MEM_ALIGN(size);
+	if(size > MEM_ARENA_SIZE - memUsed){
+		return NULL;
+	}
+	p = (char *)arena + memUsed;
+	memUsed += size;
+	return p;
+}
+
+uint32_t mem_available(void){
+	return MEM_ARENA_SIZE - memUsed;
+}
+
+/* Scheduler, system and error handling */
+
+void sched_post(SCHED_TASK task){
+	if(task == TASK_WRITER){
+		host_writerPosted = true;
+	}
+}
+
+void sched_yield(SCHED_TASK task){
+	sched_post(task);
+}
+
+void system_setTickRate(uint32_t hz){}
+
+uint32_t vbat_mV(void){
+	return 3700;
+}
+
+// The firmware handles the error after the running task returns, the harness ends the run
+void error(ERROR_CODE code){
+	if(host_error < 0){
+		host_error = code;
+	}
+}
+
+void log_string(const char *logString){
+	if(host_verbose){
+		printf("  %10.3f s  %s\n", (double)host_cycles / SYS_CLOCK_RATE, logString);
+	}
+}
+
+char *getTimeStr(void){
+	static char str[] = "Mon Mar 02 20:02:43 2015\n";
+	return str;
+}
+
+// The card is benchmarked by the latency model, not by bench.c
+void bench_card(void){}
+void bench_logPlan(void){}
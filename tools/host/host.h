@@ -0,0 +1,52 @@
+/*
+ * host.h
+ *
+ *  Virtual time and platform stand-ins for running the acquisition and writer
+ *  code on the host. Time only moves when host_work() or host_idle() is called,
+ *  and the sampling interrupts RIT_IRQHandler and MRT1_IRQHandler run when
+ *  their timers come due, taking their cycle cost from the work they preempt.
+ */
+
+#ifndef HOST_H_
+#define HOST_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HOST_CARD_SECTORS 0x200000 // 1 GB fake card, FAT32 with 4 kB clusters
+
+// Mean cycles per call charged for the sampling interrupts, from profile.txt means with host_loadProfile()
+typedef struct Host_Costs {
+	uint32_t rit;		// RIT_IRQHandler, per conversion
+	uint32_t mrt1;		// MRT1_IRQHandler, per channel conversion, includes its share of daq_updateVout
+	uint32_t format;	// daq_readableFormat, per sample, 0 to take it from formatBase + formatValue * values
+	uint32_t formatBase;	// daq_readableFormat cycles of the time column
+	uint32_t formatValue;	// daq_readableFormat cycles per value
+} Host_Costs;
+
+extern Host_Costs host_costs;
+extern uint64_t host_cycles;	// Virtual time in core clock cycles
+extern bool host_writerPosted;	// TASK_WRITER posted since the writer last ran
+extern int host_error;			// First ERROR_CODE raised, -1 if none
+extern bool host_verbose;		// Print log_string lines
+extern void (*host_check)(void);	// Called after each host_work(), may longjmp out of a task that does not return
+
+// Clear virtual time, the timers and the error, before a run
+void host_reset(void);
+
+// Run cc cycles of task work, the sampling interrupts due meanwhile run first and delay it
+void host_work(uint64_t cc);
+
+// Sleep until the next sampling interrupt and run it
+void host_idle(void);
+
+// Take the mean cycles of the sampling probes from a profile.txt, returns false if it cannot be read
+bool host_loadProfile(const char *fn);
+
+// Format a RAM disk of HOST_CARD_SECTORS sectors FAT32 and mount it
+void host_cardInit(void);
+
+// Card write latency model, parsed from a spec, see host_card.c
+bool host_cardModel(const char *spec, uint32_t seed);
+
+#endif /* HOST_H_ */
@@ -0,0 +1,255 @@
+/*
+ * host_card.c
+ *
+ *  RAM disk in place of sd_spi.c for the host harness. diskio.c and FatFs run
+ *  unchanged on top of it, and each block write takes the virtual time of a
+ *  card write latency model:
+ *
+ *    const:US                        every write takes US
+ *    tail:US,P,MAX_US                US, with probability P a write takes up to MAX_US
+ *    gc:US,PERIOD_S,MIN_MS,MAX_MS    US, with a MIN_MS-MAX_MS pause every PERIOD_S
+ *    replay:FILE                     f_write latencies replayed from a trace.bin
+ *                                    (trace.h) or a text file of us per line
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "daq.h"
+#include "system.h"
+#include "trace.h"
+#include "host.h"
+
+#define HOST_READ_US 200 // Time to read a block at the SPI clock
+
+uint32_t sd_write_busy;
+uint32_t sd_crc_errors;
+uint64_t sd_sleepCycles;
+uint32_t sd_wakes;
+
+static uint8_t *card;
+
+// Latency model
+typedef enum { MODEL_CONST, MODEL_TAIL, MODEL_GC, MODEL_REPLAY } Model_Kind;
+static Model_Kind modelKind = MODEL_CONST;
+static double modelArg[4] = { 800 };
+static double *replay; // Replayed latencies in us
+static uint32_t replayCount;
+static uint32_t replayIndex;
+static uint64_t nextGc; // Virtual time of the next gc pause
+static uint32_t randState;
+
+static double host_rand(void){
+	randState = randState * 1103515245 + 12345;
+	return (randState >> 8) / (double)(1 << 24);
+}
+
+// f_write latencies of a trace.bin, or one latency per line
+static bool host_loadReplay(const char *fn){
+	FILE *f = fopen(fn, "rb");
+	Trace_Header h;
+	uint32_t cap = 1024;
+
+	if(!f){
+		return false;
+	}
+	replay = malloc(cap * sizeof(double));
+	replayCount = 0;
+	if(fread(&h, sizeof(h), 1, f) == 1 && h.magic == TRACE_MAGIC){
+		Trace_Event e;
+		uint32_t start = 0;
+		bool started = false;
+		while(h.count-- && fread(&e, sizeof(e), 1, f) == 1){
+			if(e.id == TRACE_WRITE_START){
+				start = e.time;
+				started = true;
+			}else if(e.id == TRACE_WRITE_END && started){
+				if(replayCount == cap){
+					replay = realloc(replay, (cap *= 2) * sizeof(double));
+				}
+				replay[replayCount++] = (e.time - start) * 1e6 / h.clock;
+				started = false;
+			}
+		}
+	}else{
+		double us;
+		rewind(f);
+		while(fscanf(f, "%lf", &us) == 1){
+			if(replayCount == cap){
+				replay = realloc(replay, (cap *= 2) * sizeof(double));
+			}
+			replay[replayCount++] = us;
+		}
+	}
+	fclose(f);
+	return replayCount > 0;
+}
+
+bool host_cardModel(const char *spec, uint32_t seed){
+	const char *args = strchr(spec, ':');
+	int n;
+
+	if(!args){
+		return false;
+	}
+	args++;
+	randState = seed;
+	nextGc = 0;
+	replayIndex = 0;
+	if(strncmp(spec, "replay:", 7) == 0){
+		modelKind = MODEL_REPLAY;
+		return host_loadReplay(args);
+	}
+	n = sscanf(args, "%lf,%lf,%lf,%lf", &modelArg[0], &modelArg[1], &modelArg[2], &modelArg[3]);
+	if(strncmp(spec, "const:", 6) == 0 && n == 1){
+		modelKind = MODEL_CONST;
+	}else if(strncmp(spec, "tail:", 5) == 0 && n == 3){
+		modelKind = MODEL_TAIL;
+	}else if(strncmp(spec, "gc:", 3) == 0 && n == 4){
+		modelKind = MODEL_GC;
+		nextGc = (uint64_t)(modelArg[1] * SYS_CLOCK_RATE);
+	}else{
+		return false;
+	}
+	return true;
+}
+
+// Cycles taken by the next write
+static uint64_t host_writeCycles(void){
+	double us = modelArg[0];
+
+	switch(modelKind){
+	case MODEL_TAIL:
+		if(host_rand() < modelArg[1]){
+			us += host_rand() * (modelArg[2] - modelArg[0]);
+		}
+		break;
+	case MODEL_GC:
+		if(host_cycles >= nextGc){
+			nextGc += (uint64_t)(modelArg[1] * SYS_CLOCK_RATE);
+			us += 1000 * (modelArg[2] + host_rand() * (modelArg[3] - modelArg[2]));
+		}
+		break;
+	case MODEL_REPLAY:
+		us = replay[replayIndex++ % replayCount];
+		break;
+	default:
+		break;
+	}
+	return (uint64_t)(us * (SYS_CLOCK_RATE / 1000000));
+}
+
+/* Card functions used by diskio.c */
+
+SD_ERROR sd_wake(void){
+	return SD_OK;
+}
+
+void sd_sleep(void){}
+
+uint8_t sd_speed_down(void){
+	return 1;
+}
+
+uint8_t sd_read_block(uint32_t blockaddr, uint8_t *data){
+	return sd_read_multiple_blocks(blockaddr, 1, data);
+}
+
+uint8_t sd_read_multiple_blocks(uint32_t blockaddr, uint32_t blockcount, uint8_t *data){
+	memcpy(data, card + (uint64_t)blockaddr * SD_BLOCKSIZE, blockcount * SD_BLOCKSIZE);
+	host_work((uint64_t)blockcount * HOST_READ_US * (SYS_CLOCK_RATE / 1000000));
+	return SD_OK;
+}
+
+uint8_t sd_write_block(uint32_t blockaddr, const uint8_t *data){
+	return sd_write_multiple_blocks(blockaddr, 1, data);
+}
+
+// A multiple block write takes the model latency once per block
+uint8_t sd_write_multiple_blocks(uint32_t blockaddr, uint32_t blockcount, const uint8_t *data){
+	uint64_t cc = 0;
+	uint32_t i;
+
+	memcpy(card + (uint64_t)blockaddr * SD_BLOCKSIZE, data, blockcount * SD_BLOCKSIZE);
+	for(i=0;i<blockcount;i++){
+		cc += host_writeCycles();
+	}
+	sd_write_busy = cc / blockcount;
+	host_work(cc);
+	return SD_OK;
+}
+
+/* FAT32 format of the RAM disk, 4 kB clusters as on a 1-32 GB card */
+
+static void host_put16(uint8_t *p, uint16_t v){
+	p[0] = v;
+	p[1] = v >> 8;
+}
+
+static void host_put32(uint8_t *p, uint32_t v){
+	host_put16(p, v);
+	host_put16(p + 2, v >> 16);
+}
+
+void host_cardInit(void){
+	const uint32_t rsvd = 32, spc = 8;
+	uint32_t fatSz = ((HOST_CARD_SECTORS - rsvd) / spc + 2) * 4 / SD_BLOCKSIZE + 1;
+	uint8_t *bs, *fat;
+	int i;
+
+	if(!card){
+		card = calloc(HOST_CARD_SECTORS, SD_BLOCKSIZE);
+		if(!card){
+			fprintf(stderr, "no memory for the card\n");
+			exit(1);
+		}
+	}else{
+		memset(card, 0, (uint64_t)HOST_CARD_SECTORS * SD_BLOCKSIZE);
+	}
+
+	// Boot sector, with its backup in sector 6
+	bs = card;
+	memcpy(bs, "\xEB\x58\x90" "MSDOS5.0", 11);
+	host_put16(bs + 11, SD_BLOCKSIZE);
+	bs[13] = spc;
+	host_put16(bs + 14, rsvd);
+	bs[16] = 2;
+	bs[21] = 0xF8;
+	host_put16(bs + 24, 63);
+	host_put16(bs + 26, 255);
+	host_put32(bs + 32, HOST_CARD_SECTORS);
+	host_put32(bs + 36, fatSz);
+	host_put32(bs + 44, 2);
+	host_put16(bs + 48, 1);
+	host_put16(bs + 50, 6);
+	bs[64] = 0x80;
+	bs[66] = 0x29;
+	host_put32(bs + 67, 0x12345678);
+	memcpy(bs + 71, "NO NAME    FAT32   ", 19);
+	host_put16(bs + 510, 0xAA55);
+	memcpy(card + 6 * SD_BLOCKSIZE, bs, SD_BLOCKSIZE);
+
+	// FS info, free count unknown
+	bs = card + SD_BLOCKSIZE;
+	host_put32(bs, 0x41615252);
+	host_put32(bs + 484, 0x61417272);
+	host_put32(bs + 488, 0xFFFFFFFF);
+	host_put32(bs + 492, 0xFFFFFFFF);
+	host_put16(bs + 510, 0xAA55);
+
+	// Both FATs, the root directory is cluster 2
+	for(i=0;i<2;i++){
+		fat = card + (uint64_t)(rsvd + i * fatSz) * SD_BLOCKSIZE;
+		host_put32(fat, 0x0FFFFFF8);
+		host_put32(fat + 4, 0x0FFFFFFF);
+		host_put32(fat + 8, 0x0FFFFFFF);
+	}
+
+	cardinfo.CardCapacity = (uint64_t)HOST_CARD_SECTORS * SD_BLOCKSIZE;
+	sd_state = SD_READY;
+	if(f_mount(&fatfs[0], "", 1) != FR_OK){
+		fprintf(stderr, "cannot mount the card\n");
+		exit(1);
+	}
+}
@@ -0,0 +1,30 @@
+/*
+ * app_usbd_cfg.h
+ *
+ *  Host stand-in for the USB ROM stack configuration of the LPCOpen MSC example,
+ *  only types and sizes, the host harness does not run the MSC code.
+ */
+
+#ifndef HOST_APP_USBD_CFG_H
+#define HOST_APP_USBD_CFG_H
+#include <stdint.h>
+#include "chip.h"
+typedef void *USBD_HANDLE_T;
+typedef struct { uint32_t usb_reg_base, mem_base, mem_size; uint8_t max_num_ep; } USBD_API_INIT_PARAM_T;
+typedef struct { uint8_t *device_desc, *string_desc, *full_speed_desc, *high_speed_desc, *device_qualifier; } USB_CORE_DESCS_T;
+typedef struct { uint32_t mem_base, mem_size; uint8_t *InquiryStr; uint32_t BlockCount, BlockSize, MemorySize; uint8_t *intf_desc;
+ void (*MSC_Write)(uint32_t, uint8_t**, uint32_t, uint32_t); void (*MSC_Read)(uint32_t, uint8_t**, uint32_t, uint32_t);
+ ErrorCode_t (*MSC_Verify)(uint32_t, uint8_t*, uint32_t, uint32_t); void (*MSC_GetWriteBuf)(uint32_t, uint8_t**, uint32_t, uint32_t); } USBD_MSC_INIT_PARAM_T;
+typedef struct { uint8_t bLength, bDescriptorType, bInterfaceNumber, bAlternateSetting, bNumEndpoints, bInterfaceClass, bInterfaceSubClass; } USB_INTERFACE_DESCRIPTOR;
+typedef struct { struct { void (*ISR)(USBD_HANDLE_T); void (*Connect)(USBD_HANDLE_T, uint32_t); ErrorCode_t (*Init)(USBD_HANDLE_T*, USB_CORE_DESCS_T*, USBD_API_INIT_PARAM_T*); } *hw;
+ struct { ErrorCode_t (*init)(USBD_HANDLE_T, USBD_MSC_INIT_PARAM_T*); } *msc; } USBD_API_T;
+
+#define USBD_API g_pUsbApi
+#define USB_STACK_MEM_BASE 0x02008000
+#define USB_STACK_MEM_SIZE 0x1000
+#define USB_FS_MAX_BULK_PACKET 64
+#define USB_CONFIGURATION_DESC_SIZE 9
+#define USB_DEVICE_CLASS_STORAGE 8
+#define MSC_SUBCLASS_SCSI 6
+extern const uint8_t USB_DeviceDescriptor[], USB_StringDescriptor[], InquiryStr[]; extern uint8_t USB_FsConfigDescriptor[];
+#endif
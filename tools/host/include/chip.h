@@ -0,0 +1,124 @@
+/*
+ * chip.h
+ *
+ *  Host stand-in for the LPCOpen chip header, enough of the LPC15xx for the
+ *  acquisition, writer and FatFs sources to build on the host. Peripherals are
+ *  plain structs and the Chip_ functions are no-ops in host.c, except those
+ *  that host.c uses to schedule the sampling interrupts in virtual time.
+ */
+
+#ifndef HOST_CHIP_H
+#define HOST_CHIP_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#define STATIC static
+#define INLINE inline
+#define ALIGNED(n) __attribute__((aligned(n)))
+extern uint32_t SystemCoreClock;
+typedef struct { volatile uint32_t CFG, DLY, STAT, INTENSET, INTENCLR, RXDAT, TXDATCTL, TXDAT, TXCTL, DIV, INTSTAT; } LPC_SPI_T;
+extern LPC_SPI_T *LPC_SPI0, *LPC_SPI1;
+typedef struct { volatile uint32_t ISEL, IENR, SIENR, CIENR, IENF, SIENF, CIENF, RISE, FALL, IST; } LPC_PIN_INT_T;
+extern LPC_PIN_INT_T *LPC_GPIO_PIN_INT;
+typedef struct { volatile uint32_t CTRL, SEQ_CTRL[2], SEQ_GDAT[2], RESERVED[2], DR[12], THR_LOW[2], THR_HIGH[2], CHAN_THRSEL, INTEN, FLAGS, TRM; } LPC_ADC_T;
+extern LPC_ADC_T *LPC_ADC0, *LPC_ADC1;
+typedef struct { volatile uint32_t CTRL, CYCCNT; } DWT_Type;
+extern DWT_Type *DWT;
+typedef struct { volatile uint32_t DEMCR; } CoreDebug_Type;
+extern CoreDebug_Type *CoreDebug;
+typedef struct { volatile uint32_t CTRL, LOAD, VAL, CALIB; } SysTick_Type;
+extern SysTick_Type *SysTick;
+typedef struct { volatile uint32_t ICSR, SCR, SHCSR; } SCB_Type;
+extern SCB_Type *SCB;
+typedef struct { volatile uint32_t SYSMEMREMAP, RESERVED0[3], FLASHCFG; volatile uint32_t FRGCTRL; volatile uint32_t PDRUNCFG; } LPC_SYSCTL_T;
+extern LPC_SYSCTL_T *LPC_SYSCTL;
+typedef struct { volatile uint32_t FLASHCFG; } LPC_FMC_T;
+typedef struct { volatile uint32_t MODE, SEED; union { volatile uint32_t SUM; volatile uint32_t WRDATA32; volatile uint16_t WRDATA16; volatile uint8_t WRDATA8; }; } LPC_CRC_T;
+typedef enum { CRC_POLY_CCITT, CRC_POLY_CRC16, CRC_POLY_CRC32 } CRC_POLY_T;
+void Chip_CRC_Init(void); void Chip_CRC_SetPoly(CRC_POLY_T, uint32_t); void Chip_CRC_SetSeed(uint32_t); void Chip_CRC_Write8(uint8_t); uint32_t Chip_CRC_Sum(void);
+extern LPC_CRC_T *LPC_CRC;
+typedef void LPC_GPIO_T; extern LPC_GPIO_T *LPC_GPIO;
+typedef void LPC_RTC_T; extern LPC_RTC_T *LPC_RTC;
+typedef void LPC_RITIMER_T; extern LPC_RITIMER_T *LPC_RITIMER;
+typedef void LPC_SCT_T; extern LPC_SCT_T *LPC_SCT0;
+typedef void LPC_IOCON_T; extern LPC_IOCON_T *LPC_IOCON;
+typedef void LPC_USART_T; extern LPC_USART_T *LPC_USART0;
+typedef void LPC_SWM_T; extern LPC_SWM_T *LPC_SWM;
+typedef void LPC_MRT_CH_T; LPC_MRT_CH_T *LPC_MRT_CH(int);
+typedef struct { int pin; } PINMUX_GRP_T;
+typedef struct { uint32_t ClkDiv; int Mode, ClockMode, DataOrder, SSELPol; } SPI_CFG_T;
+typedef struct { int PreDelay, PostDelay, FrameDelay, TransferDelay; } SPI_DELAY_CONFIG_T;
+enum { SPI_MODE_MASTER, SPI_CLOCK_MODE0, SPI_DATA_MSB_FIRST, SPI_CFG_SPOL0_LO, SPI_STAT_RXRDY=1, SPI_STAT_TXRDY=2,
+ SPI_TXCTL_ASSERT_SSEL0=0, SPI_TXCTL_DEASSERT_SSEL0=1<<16, SPI_TXCTL_RXIGNORE=1<<22, SPI_TXDATCTL_RXIGNORE=1<<22, SPI_TXDATCTL_EOT=1<<20, SPI_STAT_MSTIDLE=1<<8 };
+#define SPI_TXDATCTL_LEN(n) ((n)<<24)
+enum { MRT_INTVAL_LOAD=1u<<31, MRT_MODE_ONESHOT, MRT_MODE_REPEAT };
+#define MRTn_INTFLAG(n) (1<<(n))
+enum { ADC_DR_DATAVALID=1u<<31, ADC_SEQA_IDX=0, ADC_SEQB_IDX=1, ADC_SEQ_CTRL_HWTRIG_POLPOS=1<<18, ADC_SEQ_CTRL_SEQ_ENA=1u<<31, ADC_TRIM_VRANGE_HIGHV=0,
+ ADC_SEQ_CTRL_MODE_EOS=1<<30, ADC_SEQ_CTRL_BURST=1<<27, ADC_SEQ_CTRL_START=1<<26 };
+#define ADC_DR_RESULT(n) (((n)>>4)&0xFFF)
+#define ADC_SEQ_CTRL_CHANSEL(n) (1<<(n))
+#define ADC_SEQ_CTRL_HWTRIG(n) ((n)<<12)
+#define ADC_DR_THCMPRANGE(n) (((n)>>16)&3)
+#define ADC_DR_THCMPCROSS(n) (((n)>>18)&3)
+enum { ADC_INTEN_SEQA_ENABLE=1, ADC_INTEN_CMP_DISABLE=0, ADC_INTEN_CMP_OUTSIDETH=1, ADC_INTEN_CMP_CROSSTH=2, ADC_FLAGS_SEQA_INT_MASK=1<<28, ADC_FLAGS_THCMP_INT_MASK=1<<30 };
+#define ADC_INTEN_CMP_ENABLE(isel,ch) ((isel)<<(2*(ch)+3))
+#define ADC_FLAGS_THCMP_MASK(ch) (1<<(ch))
+enum { IOCON_ADMODE_EN=0, IOCON_DIGMODE_EN=0, IOCON_FUNC0=0, IOCON_MODE_INACT=0, IOCON_MODE_PULLDOWN=0, IOCON_MODE_PULLUP=0 };
+enum { SYSCTL_CLOCK_EEPROM, SYSCTL_CLOCK_IOCON, SYSCTL_CLOCK_PININT, SYSCTL_CLOCK_SWM, SYSCTL_CLOCK_CRC, SYSCTL_CLOCK_DMA, RESET_EEPROM, RESET_IOCON, RESET_PININT, RESET_CRC };
+enum { MRT_IRQn, RITIMER_IRQn, USB0_IRQn, PIN_INT0_IRQn, ADC0_SEQA_IRQn, ADC0_SEQB_IRQn, ADC0_THCMP_IRQn, ADC0_OVR_IRQn, PendSV_IRQn };
+enum { SWM_FIXED_ADC0_3, SWM_SCT0_OUT0_O, SWM_SPI0_MISO_IO, SWM_SPI0_MOSI_IO, SWM_SPI0_SCK_IO, SWM_SPI0_SSELSN_0_IO, SWM_SPI1_MISO_IO, SWM_SPI1_MOSI_IO, SWM_SPI1_SCK_IO, SWM_SPI1_SSELSN_0_IO, SWM_UART0_RXD_I, SWM_UART0_TXD_O, SWM_USB_VBUS_I };
+typedef int CHIP_SWM_PIN_MOVABLE_T;
+enum { CoreDebug_DEMCR_TRCENA_Msk=1<<24, DWT_CTRL_CYCCNTENA_Msk=1, SCB_ICSR_PENDSVSET_Msk=1<<28, UART_STAT_TXIDLE=8 };
+enum { FLASHTIM_18MHZ_CPU, FLASHTIM_36MHZ_CPU, FLASHTIM_72MHZ_CPU };
+#define __WFI() ((void)0)
+#define __DSB() ((void)0)
+#define __ISB() ((void)0)
+#define __disable_irq() ((void)0)
+#define __enable_irq() ((void)0)
+#define __RAMFUNC(x) __attribute__((section(".ramfunc")))
+#define __DATA(x) __attribute__((section(".data_" #x)))
+#define __BSS(x) __attribute__((section(".bss_" #x)))
+#define __CLZ(x) __builtin_clz(x)
+#define __REV(x) __builtin_bswap32(x)
+static inline uint32_t __RBIT(uint32_t x){ uint32_t r = 0; int i; for(i=0;i<32;i++){ r = (r << 1) | ((x >> i) & 1); } return r; }
+#define __NVIC_PRIO_BITS 3
+typedef struct { void *pUSBD; } LPC_ROM_API_T; extern LPC_ROM_API_T *LPC_ROM_API;
+#define LPC_USB0_BASE 0
+typedef int ErrorCode_t; enum { LPC_OK, ERR_FAILED };
+typedef struct { void (*uart_isr)(void*); int (*uart_put_line)(void*,void*); uint32_t (*uart_get_mem_size)(void); void *(*uart_setup)(uint32_t,uint8_t*); uint32_t (*uart_init)(void*,void*); } UARTD_API_T;
+extern UARTD_API_T *LPC_UARTD_API;
+typedef void UART_HANDLE_T;
+typedef struct { uint8_t *buffer; uint32_t size; int transfer_mode, driver_mode; } UART_PARAM_T;
+typedef struct { uint32_t sys_clk_in_hz, baudrate_in_hz; uint8_t config, sync_mod; uint16_t error_en; } UART_CONFIG_T;
+enum { TX_MODE_SZERO, DRIVER_MODE_POLLING, NO_ERR_EN };
+#define __DMB() __sync_synchronize()
+static inline uint32_t __get_PRIMASK(void){ return 0; }
+static inline void __set_PRIMASK(uint32_t m){ (void)m; }
+
+/* Functions of the LPCOpen chip layer used by the firmware sources, host.c */
+void Chip_GPIO_SetPinDIROutput(LPC_GPIO_T *gpio, uint8_t port, uint8_t pin);
+void Chip_GPIO_SetPinState(LPC_GPIO_T *gpio, uint8_t port, uint8_t pin, bool state);
+bool Chip_GPIO_GetPinState(LPC_GPIO_T *gpio, uint8_t port, uint8_t pin);
+void Chip_MRT_IntClear(LPC_MRT_CH_T *mrt);
+void Chip_MRT_SetEnabled(LPC_MRT_CH_T *mrt);
+void Chip_MRT_SetDisabled(LPC_MRT_CH_T *mrt);
+void Chip_MRT_SetInterval(LPC_MRT_CH_T *mrt, uint32_t interval);
+void Chip_MRT_SetMode(LPC_MRT_CH_T *mrt, int mode);
+void Chip_RIT_Init(LPC_RITIMER_T *rit);
+void Chip_RIT_DeInit(LPC_RITIMER_T *rit);
+void Chip_RIT_Enable(LPC_RITIMER_T *rit);
+void Chip_RIT_EnableCompClear(LPC_RITIMER_T *rit);
+void Chip_RIT_ClearIntStatus(LPC_RITIMER_T *rit);
+void Chip_RIT_SetCompareValue(LPC_RITIMER_T *rit, uint64_t val);
+uint32_t Chip_RTC_GetCount(LPC_RTC_T *rtc);
+void Chip_SCTPWM_Init(LPC_SCT_T *sct);
+void Chip_SCTPWM_SetRate(LPC_SCT_T *sct, uint32_t freq);
+void Chip_SCTPWM_SetOutPin(LPC_SCT_T *sct, uint8_t index, uint8_t pin);
+void Chip_SCTPWM_Start(LPC_SCT_T *sct);
+void Chip_SCTPWM_SetDutyCycle(LPC_SCT_T *sct, uint8_t index, uint32_t ticks);
+void Chip_SWM_MovablePinAssign(CHIP_SWM_PIN_MOVABLE_T movable, uint8_t pin);
+void NVIC_EnableIRQ(int irq);
+void NVIC_DisableIRQ(int irq);
+void NVIC_SetPriority(int irq, uint32_t priority);
+
+#endif
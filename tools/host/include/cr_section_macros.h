@@ -0,0 +1,2 @@
+/* Host stand-in for the LPCXpresso section macros, __RAMFUNC is in chip.h */
+#include "chip.h"
@@ -0,0 +1,2 @@
+/* Host stand-in for the USB ROM error codes, ErrorCode_t is in chip.h */
+#include "chip.h"
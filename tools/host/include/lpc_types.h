@@ -0,0 +1,2 @@
+/* Host stand-in for the LPCOpen base types, in chip.h */
+#include "chip.h"
@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""
+pack_assets.py
+
+Generates console_converter.h, the assets written to a freshly formatted card.
+Assets are stored as LZ4 blocks with match offsets limited to LZ_WINDOW_SIZE
+(lz_decomp.h), so the firmware can decompress them through a small ring
+window straight into sector sized f_write calls.
+
+Usage:
+    python3 tools/pack_assets.py tools/user_guide.txt converter.exe > console_converter.h
+"""
+
+import sys
+
+WINDOW_SIZE = 2048	# Must match LZ_WINDOW_SIZE in lz_decomp.h
+MIN_MATCH = 4
+LAST_LITERALS = 5	# LZ4 block rules, keeps the output readable by any LZ4 decoder
+MF_LIMIT = 12
+HASH_CHAIN = 64		# Match candidates checked per position
+
+
+def write_length(out, length):
+	while length >= 255:
+		out.append(255)
+		length -= 255
+	out.append(length)
+
+
+def write_sequence(out, literals, match_len, offset):
+	lit_len = len(literals)
+	token = min(lit_len, 15) << 4
+	if match_len:
+		token |= min(match_len - MIN_MATCH, 15)
+	out.append(token)
+	if lit_len >= 15:
+		write_length(out, lit_len - 15)
+	out += literals
+	if match_len:
+		out += bytes((offset & 0xFF, offset >> 8))
+		if match_len - MIN_MATCH >= 15:
+			write_length(out, match_len - MIN_MATCH - 15)
+
+
+def compress(data):
+	"""Greedy LZ4 block compression with offsets limited to WINDOW_SIZE"""
+	out = bytearray()
+	chains = {}
+	n = len(data)
+	anchor = 0
+	i = 0
+	while i < n - MF_LIMIT:
+		key = data[i:i + MIN_MATCH]
+		best_len, best_off = 0, 0
+		for j in reversed(chains.get(key, [])[-HASH_CHAIN:]):
+			if i - j > WINDOW_SIZE:
+				break
+			length = MIN_MATCH
+			while i + length < n - LAST_LITERALS and data[j + length] == data[i + length]:
+				length += 1
+			if length > best_len:
+				best_len, best_off = length, i - j
+		chains.setdefault(key, []).append(i)
+		if best_len >= MIN_MATCH:
+			write_sequence(out, data[anchor:i], best_len, best_off)
+			for k in range(i + 1, i + best_len):
+				chains.setdefault(data[k:k + MIN_MATCH], []).append(k)
+			i += best_len
+			anchor = i
+		else:
+			i += 1
+	write_sequence(out, data[anchor:], 0, 0)
+	return bytes(out)
+
+
+def decompress(comp):
+	"""Reference decoder used to verify the compressed output"""
+	out = bytearray()
+	i = 0
+
+	def read_length(i):
+		total = 0
+		while True:
+			b = comp[i]
+			i += 1
+			total += b
+			if b != 255:
+				return total, i
+
+	while i < len(comp):
+		token = comp[i]
+		i += 1
+		lit_len = token >> 4
+		if lit_len == 15:
+			extra, i = read_length(i)
+			lit_len += extra
+		out += comp[i:i + lit_len]
+		i += lit_len
+		if i >= len(comp):
+			break
+		offset = comp[i] | comp[i + 1] << 8
+		i += 2
+		match_len = token & 0x0F
+		if match_len == 15:
+			extra, i = read_length(i)
+			match_len += extra
+		match_len += MIN_MATCH
+		assert 0 < offset <= WINDOW_SIZE
+		for _ in range(match_len):
+			out.append(out[-offset])
+	return bytes(out)
+
+
+def c_array(name, data):
+	lines = ["const uint8_t %s[%d] = {" % (name, len(data))]
+	for k in range(0, len(data), 12):
+		lines.append("\t" + ", ".join("0x%02X" % b for b in data[k:k + 12]) + ",")
+	lines[-1] = lines[-1].rstrip(",")
+	lines.append("};")
+	return "\n".join(lines)
+
+
+def main():
+	if len(sys.argv) != 3:
+		sys.exit(__doc__)
+	guide = open(sys.argv[1], "rb").read()
+	converter = open(sys.argv[2], "rb").read()
+
+	guide_lz = compress(guide)
+	converter_lz = compress(converter)
+	assert decompress(guide_lz) == guide
+	assert decompress(converter_lz) == converter
+
+	sys.stderr.write("user guide: %d -> %d bytes\n" % (len(guide), len(guide_lz)))
+	sys.stderr.write("converter:  %d -> %d bytes\n" % (len(converter), len(converter_lz)))
+
+	print("#ifndef CONSOLE_CONVERTER_H_")
+	print("#define CONSOLE_CONVERTER_H_")
+	print("")
+	print("// Generated by tools/pack_assets.py, do not edit")
+	print("// Assets are LZ4 block compressed, decompress with lz_decompressToFile()")
+	print("")
+	print('const char userGuideFn[] = "user_guide.txt";')
+	print("")
+	print("#define USER_GUIDE_SIZE %d // Decompressed size in bytes" % len(guide))
+	print("")
+	print(c_array("userGuideLZ", guide_lz))
+	print("")
+	print('const char converterFn[] = "converter.exe";')
+	print("")
+	print("#define CONVERTER_SIZE %d // Decompressed size in bytes" % len(converter))
+	print("")
+	print(c_array("consoleConverterLZ", converter_lz))
+	print("")
+	print("#endif")
+
+
+if __name__ == "__main__":
+	main()
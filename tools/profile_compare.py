@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+"""
+profile_compare.py
+
+Compares the cycle statistics of two profile.txt files (profile.h), such as a
+recording made with RAMFUNC_ISR undefined in board.h, running the sampling
+ISRs from flash, and one made with it defined, running them from SRAM, or
+recordings made with and without DAQ_SPECIALIZED, the sample paths specialized
+to the recording config against the generic path.
+
+For each probe the mean, max and jitter (max - min) cycles of both files are
+printed with the change from the first to the second. Jitter is the spread
+the sample timing sees, flash wait states and prefetch misses show up in it.
+
+Usage:
+    python3 tools/profile_compare.py profile_flash.txt profile_sram.txt
+"""
+
+import sys
+
+
+def load(fn):
+	"""Returns ({field: value} of the header lines, {probe: (count, min, mean, max)})"""
+	info = {}
+	probes = {}
+	with open(fn) as f:
+		for line in f:
+			cols = [c.strip() for c in line.split(",")]
+			if len(cols) >= 5 and cols[1].isdigit():
+				probes[cols[0]] = tuple(int(c) for c in cols[1:5])
+			elif len(cols) >= 2:
+				info[cols[0]] = cols[1]
+	return info, probes
+
+
+def change(a, b):
+	return "%+.0f%%" % (100.0 * (b - a) / a) if a else "-"
+
+
+def main():
+	if len(sys.argv) != 3:
+		sys.stderr.write(__doc__)
+		sys.exit(1)
+	(info_a, a), (info_b, b) = load(sys.argv[1]), load(sys.argv[2])
+
+	print("A: %s, isr code %s, sample path %s" % (sys.argv[1], info_a.get("isr code", "?"), info_a.get("sample path", "?")))
+	print("B: %s, isr code %s, sample path %s" % (sys.argv[2], info_b.get("isr code", "?"), info_b.get("sample path", "?")))
+	print("%-26s %8s %8s %6s %8s %8s %6s %8s %8s %6s" % ("probe [cc]", "mean A", "mean B", "",
+		"max A", "max B", "", "jitter A", "jitter B", ""))
+	for name in a:
+		if name not in b or not a[name][0] or not b[name][0]:
+			continue
+		_, min_a, mean_a, max_a = a[name]
+		_, min_b, mean_b, max_b = b[name]
+		print("%-26s %8d %8d %6s %8d %8d %6s %8d %8d %6s" % (name,
+			mean_a, mean_b, change(mean_a, mean_b),
+			max_a, max_b, change(max_a, max_b),
+			max_a - min_a, max_b - min_b, change(max_a - min_a, max_b - min_b)))
+
+
+if __name__ == "__main__":
+	main()
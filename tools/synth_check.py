@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""
+synth_check.py
+
+Verifies a recording made with a synthetic SIGNAL SOURCE in config.txt.
+Every sample of every enabled channel is compared with the value the
+firmware generated (daq_synthValue in daq.c), so lost, repeated or
+reordered samples and formatting errors are reported. Samples dropped on
+overload are skipped where the recording marks a gap, and counted.
+
+Binary files are compared exactly. Readable files are converted back through
+the channel scaling in the header and compared within the 5 significant
+digits of the readable format. Vout is measured, so it is not checked.
+
+Pass the segments of a recording in order to check them as one stream.
+
+Usage:
+    python3 tools/synth_check.py data_001.bin [data_001_001.bin ...]
+"""
+
+import math
+import os
+import struct
+import sys
+
+SYNTH_SINE_SIZE = 64		# daq.h
+SYNTH_SINE_AMPL = 30000		# daq.h
+MAX_ERRORS = 20				# Errors printed before giving up
+
+SINE = [int(math.floor(32768 + SYNTH_SINE_AMPL * math.sin(2 * math.pi * i / SYNTH_SINE_SIZE) + 0.5))
+	for i in range(SYNTH_SINE_SIZE)]
+
+
+def synth_value(signal, n, ch):
+	"""Mirror of daq_synthValue()"""
+	if signal == "RAMP":
+		return (n + ch * 0x5555) & 0xFFFF
+	if signal == "SINE":
+		return SINE[(n + ch * (SYNTH_SINE_SIZE // 3)) % SYNTH_SINE_SIZE]
+	if signal == "WORST":
+		return 0xFFFF if (n + ch) & 1 else 0x0000
+	raise SystemExit("not a synthetic recording, signal " + signal)
+
+
+def read_header(data):
+	"""Returns the header fields, the channel list and the offset of the data"""
+	end = data.index(b"end header\n") + len(b"end header\n")
+	header = {}
+	channels = []	# (ch index, scale, offset, cscale, coffset)
+	for line in data[:end].decode("latin-1").splitlines():
+		cols = [c.strip() for c in line.split(",")]
+		if len(cols) >= 13 and cols[0].startswith("ch") and cols[1] == "scale":
+			channels.append((int(cols[0][2:]) - 1, float(cols[2]), float(cols[5]), float(cols[8]), float(cols[11])))
+		elif len(cols) >= 2:
+			header[cols[0]] = cols[1]
+	return header, channels, end
+
+
+def read_gaps(fn):
+	"""Returns {first dropped sample: count} from a binary recording's gap file"""
+	gaps = {}
+	try:
+		with open(fn) as f:
+			for line in f:
+				cols = [c.strip() for c in line.split(",")]
+				if len(cols) == 3 and cols[0] == "gap" and cols[1].isdigit():
+					gaps[int(cols[1])] = int(cols[2])
+	except FileNotFoundError:
+		pass	# No samples were dropped
+	return gaps
+
+
+def check(files):
+	n = 0
+	errors = 0
+	dropped = 0
+
+	def fail(msg):
+		nonlocal errors
+		errors += 1
+		if errors <= MAX_ERRORS:
+			print(msg)
+
+	for fn in files:
+		with open(fn, "rb") as f:
+			data = f.read()
+		header, channels, pos = read_header(data)
+		signal = header.get("signal", "ADC")
+		values = len(channels) + (1 if "vout" in header else 0)
+		start = n
+
+		if header["data type"] == "BINARY":
+			gaps = read_gaps(os.path.join(os.path.dirname(fn), header["gaps"])) if "gaps" in header else {}
+			count = (len(data) - pos) // (2 * values)
+			samples = struct.unpack_from("<%dH" % (count * values), data, pos)
+			for s in range(count):
+				if n in gaps:
+					dropped += gaps[n]
+					n += gaps[n]
+				for v, ch in enumerate(channels):
+					expect = synth_value(signal, n, ch[0])
+					got = samples[s * values + v]
+					if got != expect:
+						fail("%s: sample %d ch%d is %d, expected %d" % (fn, n, ch[0] + 1, got, expect))
+				n += 1
+		else:
+			lines = data[pos:].decode("latin-1").splitlines()[1:]	# Skip the labels
+			period = 1.0 / int(header["sample rate"])
+			for line in lines:
+				cols = line.split(",")
+				if cols[0] == "gap":
+					if int(cols[1]) != n:
+						fail("%s: gap at sample %s, expected at %d" % (fn, cols[1].strip(), n))
+					dropped += int(cols[2])
+					n = int(cols[1]) + int(cols[2])
+					continue
+				if len(cols) < 1 + len(channels):
+					fail("%s: sample %d is truncated: %s" % (fn, n, line))
+					n += 1
+					continue
+				if abs(float(cols[0]) - n * period) > period / 2:
+					fail("%s: sample %d has time %s, expected %.6f" % (fn, n, cols[0], n * period))
+				for v, ch in enumerate(channels):
+					_, scale, offset, cscale, coffset = ch
+					raw = synth_value(signal, n, ch[0])
+					expect = ((raw - coffset) * cscale - offset) * scale
+					got = float(cols[1 + v])
+					# 5 significant digits, and the generated sine may round 1 LSB differently
+					tol = max(abs(expect) * 1e-4, abs(cscale * scale) * (1 if signal == "SINE" else 0.5))
+					if abs(got - expect) > tol:
+						fail("%s: sample %d ch%d is %s, expected %.4e" % (fn, n, ch[0] + 1, cols[1 + v].strip(), expect))
+				n += 1
+
+		print("%s: %s, %d samples" % (fn, signal, n - start))
+
+	print("%d samples, %d dropped, %d errors" % (n - dropped, dropped, errors))
+	return errors == 0
+
+
+def main():
+	if len(sys.argv) < 2:
+		sys.stderr.write(__doc__)
+		sys.exit(1)
+	sys.exit(0 if check(sys.argv[1:]) else 1)
+
+
+if __name__ == "__main__":
+	main()
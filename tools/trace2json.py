@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""
+trace2json.py
+
+Converts trace.bin, the event trace written by the error handler (trace.h),
+to a Chrome trace JSON timeline. Open the output in chrome://tracing or
+https://ui.perfetto.dev to see the events leading up to an error.
+
+Usage:
+    python3 tools/trace2json.py trace.bin > trace.json
+"""
+
+import json
+import struct
+import sys
+
+TRACE_MAGIC = 0x31435254	# "TRC1", TRACE_MAGIC in trace.h
+HEADER = struct.Struct("<IIII")	# Trace_Header
+EVENT = struct.Struct("<IHH")	# Trace_Event
+
+# Event ids in TRACE_ID order, (name, phase, thread)
+# Phase B/E begin and end a slice, i is an instant, X is a slice ending at the event
+EVENTS = [
+	("RIT_IRQHandler", "B", "isr"),
+	("RIT_IRQHandler", "E", "isr"),
+	("MRT1_IRQHandler", "B", "isr"),
+	("MRT1_IRQHandler", "E", "isr"),
+	("block", "i", "writer"),
+	("f_write", "B", "writer"),
+	("f_write", "E", "writer"),
+	("sd busy", "X", "sd"),
+	("fat alloc", "i", "fat"),
+	("button", "i", "system"),
+	("state", "i", "system"),
+	("error", "i", "system"),
+]
+
+ARG_NAMES = ["", "", "", "", "rawBuff bytes", "bytes", "bytes written", "us", "cluster", "long press", "state", "code"]
+STATES = ["IDLE", "MSC", "DAQ"]
+ERRORS = ["ERROR_UNKNOWN", "ERROR_F_WRITE", "ERROR_BUF_OVF", "ERROR_MSC_SD_READ", "ERROR_MSC_SD_WRITE",
+	"ERROR_MSC_INIT", "ERROR_SD_INIT", "ERROR_SAMPLE_TIME", "ERROR_READ_CONFIG", "ERROR_WRITE_CONFIG",
+	"ERROR_DISK_FULL"]
+THREADS = ["isr", "writer", "sd", "fat", "system"]
+
+
+def decode(data):
+	magic, clock, count, lost = HEADER.unpack_from(data, 0)
+	if magic != TRACE_MAGIC:
+		raise ValueError("not a trace file")
+
+	events = []
+	wraps = 0
+	last = None
+	for n in range(count):
+		time, eid, arg = EVENT.unpack_from(data, HEADER.size + n * EVENT.size)
+		# DWT counter wraps every 2^32 cycles, events are in order
+		if last is not None and time < last:
+			wraps += 1
+		last = time
+		events.append(((wraps << 32) + time, eid, arg))
+	return clock, lost, events
+
+
+def to_chrome(clock, lost, events):
+	out = []
+	for tid, name in enumerate(THREADS):
+		out.append({"name": "thread_name", "ph": "M", "pid": 0, "tid": tid, "args": {"name": name}})
+
+	t0 = events[0][0] if events else 0
+	for cc, eid, arg in events:
+		us = (cc - t0) * 1e6 / clock
+		if eid >= len(EVENTS):
+			out.append({"name": "unknown %d" % eid, "ph": "i", "s": "t", "ts": us, "pid": 0, "tid": 0, "args": {"arg": arg}})
+			continue
+		name, ph, thread = EVENTS[eid]
+		e = {"name": name, "ph": ph, "ts": us, "pid": 0, "tid": THREADS.index(thread)}
+		if ph == "X":
+			e["ts"] = us - arg
+			e["dur"] = arg
+		if ph == "i":
+			e["s"] = "t"
+		if ARG_NAMES[eid]:
+			value = arg
+			if name == "state" and arg < len(STATES):
+				value = STATES[arg]
+			elif name == "error" and arg < len(ERRORS):
+				value = ERRORS[arg]
+				e["name"] = value
+			e["args"] = {ARG_NAMES[eid]: value}
+		out.append(e)
+
+	return {"traceEvents": out, "otherData": {"clock Hz": clock, "events lost": lost}}
+
+
+def main():
+	if len(sys.argv) != 2:
+		sys.stderr.write(__doc__)
+		sys.exit(1)
+
+	with open(sys.argv[1], "rb") as f:
+		data = f.read()
+
+	clock, lost, events = decode(data)
+	json.dump(to_chrome(clock, lost, events), sys.stdout, indent=1)
+	sys.stdout.write("\n")
+
+
+if __name__ == "__main__":
+	main()
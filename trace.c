@@ -0,0 +1,50 @@
+/*
+ * trace.c
+ *
+ *  Fixed size ring of compact time stamped events, frozen on the first error
+ *  and written to trace.bin by the error handler. tools/trace2json.py converts
+ *  the dump to a Chrome trace / Perfetto timeline.
+ */
+
+#include "trace.h"
+#include "ff.h"
+
+Trace_Event traceRing[TRACE_SIZE];
+volatile uint32_t traceHead;
+volatile bool traceFrozen;
+
+// Stop recording events so the history leading up to an error is kept
+void trace_freeze(void){
+	traceFrozen = true;
+}
+
+// Write the recorded events to the named file
+void trace_dump(const char *fn){
+	FIL traceFile;
+	Trace_Header header;
+	UINT bw;
+	uint32_t first;
+
+	trace_freeze();
+
+	header.magic = TRACE_MAGIC;
+	header.clock = SystemCoreClock;
+	header.count = traceHead < TRACE_SIZE ? traceHead : TRACE_SIZE;
+	header.lost = traceHead - header.count;
+
+	if(f_open(&traceFile, fn, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK){
+		return;
+	}
+	f_write(&traceFile, &header, sizeof(header), &bw);
+
+	// Oldest event first, the ring wraps at most once in the output
+	first = traceHead & (TRACE_SIZE-1);
+	if(header.count == TRACE_SIZE && first != 0){
+		f_write(&traceFile, &traceRing[first], (TRACE_SIZE - first) * sizeof(Trace_Event), &bw);
+		f_write(&traceFile, traceRing, first * sizeof(Trace_Event), &bw);
+	} else {
+		f_write(&traceFile, traceRing, header.count * sizeof(Trace_Event), &bw);
+	}
+
+	f_close(&traceFile);
+}
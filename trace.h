@@ -0,0 +1,79 @@
+/*
+ * trace.h
+ *
+ *  Fixed size ring of compact time stamped events, frozen on the first error
+ *  and written to trace.bin by the error handler. tools/trace2json.py converts
+ *  the dump to a Chrome trace / Perfetto timeline.
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include "board.h"
+#include "delay.h"
+
+#define TRACE_SIZE 256 // Number of events held, power of 2
+#define TRACE_MAGIC 0x31435254 // "TRC1", start of trace.bin
+
+// Event ids, keep in sync with tools/trace2json.py
+typedef enum {
+	TRACE_RIT_ENTER,	// Sample timer ISR entry, TRACE_ISR only
+	TRACE_RIT_EXIT,		// Sample timer ISR exit, TRACE_ISR only
+	TRACE_MRT1_ENTER,	// ADC conversion ISR entry, TRACE_ISR only
+	TRACE_MRT1_EXIT,	// ADC conversion ISR exit, TRACE_ISR only
+	TRACE_BLOCK,		// Block of file data ready, arg is the rawBuff fill in bytes
+	TRACE_WRITE_START,	// f_write of a data block start, arg is the size in bytes
+	TRACE_WRITE_END,	// f_write of a data block end, arg is the bytes written
+	TRACE_SD_BUSY,		// SD card busy after a block write, arg is the busy time in us
+	TRACE_FAT_ALLOC,	// Cluster allocated, arg is the low 16 bits of the cluster number
+	TRACE_BUTTON,		// Push button, arg is 0 for a short press, 1 for a long press
+	TRACE_STATE,		// System state change, arg is the new SYSTEM_STATE
+	TRACE_ERROR			// Error raised, arg is the ERROR_CODE
+} TRACE_ID;
+
+// A single trace event, 8 bytes
+typedef struct Trace_Event {
+	uint32_t time;	// DWT cycle count
+	uint16_t id;	// TRACE_ID
+	uint16_t arg;	// Event specific argument
+} Trace_Event;
+
+// Header of trace.bin, followed by count events, oldest first
+typedef struct Trace_Header {
+	uint32_t magic;	// TRACE_MAGIC
+	uint32_t clock;	// DWT clock rate in Hz
+	uint32_t count;	// Number of events
+	uint32_t lost;	// Events overwritten before the dump
+} Trace_Header;
+
+extern Trace_Event traceRing[TRACE_SIZE];
+extern volatile uint32_t traceHead; // Count of events recorded, free running
+extern volatile bool traceFrozen; // Set to stop recording
+
+// Record an event, safe to call from any interrupt priority, ~25cc
+static inline void trace_event(TRACE_ID id, uint16_t arg){
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if(!traceFrozen){
+		Trace_Event *e = &traceRing[traceHead++ & (TRACE_SIZE-1)];
+		e->time = DWT_Get();
+		e->id = id;
+		e->arg = arg;
+	}
+	__set_PRIMASK(primask);
+}
+
+// ISR entry/exit events fill the ring in a few ms, so they are only recorded with TRACE_ISR
+#ifdef TRACE_ISR
+#define trace_isr(id) trace_event(id, 0)
+#else
+#define trace_isr(id)
+#endif
+
+// Stop recording events so the history leading up to an error is kept
+void trace_freeze(void);
+
+// Write the recorded events to the named file
+void trace_dump(const char *fn);
+
+#endif /* TRACE_H_ */